@@ -21,6 +21,7 @@
 // efficiency calculation.
 // prototype version by S.Arcelli silvia.arcelli@cern.ch
 ///////////////////////////////////////////////////////////////////////////
+#include "TBits.h"
 #include "AliCFCutBase.h"
 #include "AliCFManager.h"
 
@@ -34,7 +35,9 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtCutChain(),
+  fPartCutChain()
 { 
   //
   // ctor
@@ -48,7 +51,9 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtCutChain(),
+  fPartCutChain()
 { 
    //
    // ctor
@@ -62,7 +67,9 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fEvtCutChain(),
+  fPartCutChain()
 { 
    //
    //copy ctor
@@ -84,6 +91,8 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  this->fEvtCutChain.clear();
+  this->fPartCutChain.clear();
   return *this ;
 }
 
@@ -105,16 +114,53 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     return kTRUE;
   }
   if(!fPartCutList[isel])return kTRUE;
-  TObjArrayIter iter(fPartCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const std::vector<AliCFCutBase*> &cuts = GetCutChain(fPartCutChain,isel,fPartCutList[isel],selcuts);
+  for (UInt_t icut=0; icut<cuts.size(); icut++) {
+    if(!cuts[icut]->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckParticleCuts(Int_t isel, const TObjArray *objects, TBits &selected, const TString  &selcuts) const {
+  //
+  // check which objects of the array pass particle-level selection isel:
+  // bit i of selected is set if objects->At(i) is selected.
+  // The cut chain is resolved once for the whole array.
+  // Returns the number of selected objects
+  //
+
+  selected.ResetAllBits();
+  if (!objects) return 0;
+  Int_t nobj = objects->GetEntriesFast();
+
+  if(isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+  }
+  if(isel>=fNStepPart || !fPartCutList[isel]) {
+    Int_t nsel = 0;
+    for (Int_t iobj=0; iobj<nobj; iobj++) {
+      if (!objects->UncheckedAt(iobj)) continue;
+      selected.SetBitNumber(iobj);
+      nsel++;
+    }
+    return nsel;
+  }
+
+  const std::vector<AliCFCutBase*> &cuts = GetCutChain(fPartCutChain,isel,fPartCutList[isel],selcuts);
+  Int_t nsel = 0;
+  for (Int_t iobj=0; iobj<nobj; iobj++) {
+    TObject *obj = objects->UncheckedAt(iobj);
+    if (!obj) continue;
+    Bool_t isSel = kTRUE;
+    for (UInt_t icut=0; icut<cuts.size() && isSel; icut++) isSel = cuts[icut]->IsSelected(obj);
+    if (!isSel) continue;
+    selected.SetBitNumber(iobj);
+    nsel++;
+  }
+  return nsel;
+}
+
 //_____________________________________________________________________________
 Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &selcuts) const{
   //
@@ -126,12 +172,9 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
       return kTRUE;
   }
   if(!fEvtCutList[isel])return kTRUE;
-  TObjArrayIter iter(fEvtCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const std::vector<AliCFCutBase*> &cuts = GetCutChain(fEvtCutChain,isel,fEvtCutList[isel],selcuts);
+  for (UInt_t icut=0; icut<cuts.size(); icut++) {
+    if(!cuts[icut]->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
@@ -222,6 +265,29 @@ Bool_t AliCFManager::CompareStrings(const TString  &cutname,const TString  &selc
 }
 
 
+//_____________________________________________________________________________
+const std::vector<AliCFCutBase*>& AliCFManager::GetCutChain(std::vector<CutChain> &chains, Int_t isel, const TObjArray *list, const TString &selcuts) const {
+  //
+  // cuts of list selected by selcuts, resolved only when the list, its
+  // number of entries or selcuts change
+  //
+
+  if ((Int_t)chains.size()<=isel) chains.resize(isel+1);
+  CutChain &chain = chains[isel];
+  if (chain.fList==list && chain.fNEntries==list->GetEntriesFast() && chain.fSelCuts==selcuts) return chain.fCuts;
+
+  chain.fList = list;
+  chain.fNEntries = list->GetEntriesFast();
+  chain.fSelCuts = selcuts;
+  chain.fCuts.clear();
+  for (Int_t icut=0; icut<chain.fNEntries; icut++) {
+    AliCFCutBase *cut = (AliCFCutBase*)list->UncheckedAt(icut);
+    if (!cut) continue;
+    if (CompareStrings(cut->GetName(),selcuts)) chain.fCuts.push_back(cut);
+  }
+  return chain.fCuts;
+}
+
 //_____________________________________________________________________________
 void AliCFManager::SetEventCutsList(Int_t isel, TObjArray* array) {
   //
@@ -243,6 +309,7 @@ void AliCFManager::SetEventCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fEvtCutList[isel] = array;
+  if ((Int_t)fEvtCutChain.size()>isel) fEvtCutChain[isel] = CutChain();
 }
 
 //_____________________________________________________________________________
@@ -267,4 +334,5 @@ void AliCFManager::SetParticleCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fPartCutList[isel] = array;
+  if ((Int_t)fPartCutChain.size()>isel) fPartCutChain[isel] = CutChain();
 }
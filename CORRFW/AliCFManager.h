@@ -24,10 +24,14 @@
 // now the number of steps are fixed by the particle/event containers themselves.
 //
 
+#include <vector>
 #include "TNamed.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
+class TBits;
+class AliCFCutBase;
+
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
 {
@@ -116,7 +120,22 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Batch version: bit i of selected is set if objects->At(i) passes the
+  //particle-level selection isel, returns the number of selected objects
+  virtual Int_t CheckParticleCuts(Int_t isel, const TObjArray *objects, TBits &selected, const TString &selcuts="all") const;
+
  private:
+
+  //Cuts of one selection step which are checked for a given selcuts string.
+  //Built at the first call, so that the string comparisons are not repeated
+  //for every object
+  struct CutChain {
+    CutChain() : fList(0x0), fNEntries(0), fSelCuts(), fCuts() {}
+    const TObjArray *fList;           // cut list the chain was built from
+    Int_t fNEntries;                  // number of entries of the list at that time
+    TString fSelCuts;                 // selcuts string
+    std::vector<AliCFCutBase*> fCuts; // cuts to be checked, in list order
+  };
   
   //number of steps
   Int_t fNStepEvt;  // number of steps in event selection
@@ -130,9 +149,13 @@ class AliCFManager : public TNamed
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
+  mutable std::vector<CutChain> fEvtCutChain;  //! cut chain of each event-selection step
+  mutable std::vector<CutChain> fPartCutChain; //! cut chain of each particle-selection step
+
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  const std::vector<AliCFCutBase*>& GetCutChain(std::vector<CutChain> &chains, Int_t isel, const TObjArray *list, const TString &selcuts) const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
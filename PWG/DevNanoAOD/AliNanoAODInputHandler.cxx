@@ -0,0 +1,34 @@
+#include "AliNanoAODInputHandler.h"
+#include "AliNanoAODTrackColumns.h"
+
+ClassImp(AliNanoAODInputHandler)
+
+AliNanoAODInputHandler::AliNanoAODInputHandler() :
+  AliAODInputHandler(),
+  fTracksName("tracks")
+{
+  // default ctor
+}
+
+AliNanoAODInputHandler::AliNanoAODInputHandler(const char* name, const char* title) :
+  AliAODInputHandler(name, title),
+  fTracksName("tracks")
+{
+  // ctor
+}
+
+AliNanoAODInputHandler::~AliNanoAODInputHandler()
+{
+  // dtor
+}
+
+Bool_t AliNanoAODInputHandler::BeginEvent(Long64_t entry)
+{
+  // Prepares the event as AliAODInputHandler and connects the track views to
+  // the columns of the event just read. Nothing to do if the NanoAOD has no
+  // columnar tracks
+
+  Bool_t result = AliAODInputHandler::BeginEvent(entry);
+  AliNanoAODTrackColumns::ConnectTracks(GetEvent(), fTracksName.Data());
+  return result;
+}
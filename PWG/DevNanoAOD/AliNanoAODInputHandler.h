@@ -0,0 +1,40 @@
+/// \class AliNanoAODInputHandler
+/// \brief AOD input handler for NanoAODs with columnar tracks
+///
+/// Same as AliAODInputHandler, and connects the track views of the "tracks"
+/// array to the AliNanoAODTrackColumns of the event at each BeginEvent, so
+/// that tasks reading columnar NanoAODs (AliNanoAODReplicator::SetColumnarTracks)
+/// through AliVEvent::GetTrack() do not have to call
+/// AliNanoAODTrackColumns::ConnectTracks() themselves:
+///
+///     mgr->SetInputEventHandler(new AliNanoAODInputHandler());
+///
+/// NanoAODs written with track objects are read as with AliAODInputHandler.
+
+#ifndef _ALINANOAODINPUTHANDLER_H_
+#define _ALINANOAODINPUTHANDLER_H_
+
+#include "AliAODInputHandler.h"
+#include "TString.h"
+
+class AliNanoAODInputHandler : public AliAODInputHandler
+{
+public:
+  AliNanoAODInputHandler();
+  AliNanoAODInputHandler(const char* name, const char* title);
+  virtual ~AliNanoAODInputHandler();
+
+  virtual Bool_t BeginEvent(Long64_t entry);
+
+  void SetTracksName(const char* name) { fTracksName = name; }
+
+private:
+  AliNanoAODInputHandler(const AliNanoAODInputHandler&);
+  AliNanoAODInputHandler& operator=(const AliNanoAODInputHandler&);
+
+  TString fTracksName;   ///< name of the tracks array, the columns are "<name>Columns"
+
+  ClassDef(AliNanoAODInputHandler, 1)
+};
+
+#endif /* _ALINANOAODINPUTHANDLER_H_ */
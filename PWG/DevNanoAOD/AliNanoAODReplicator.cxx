@@ -49,6 +49,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -109,7 +110,10 @@ AliAODBranchReplicator(),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fColumnarTracks(kFALSE),
+  fTrackColumns(0x0),
+  fColumnTrack(0x0)
   {
   // Default ctor. we need it to avoid instantiating a wrong mapping when reading from file
   }
@@ -146,7 +150,10 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fColumnarTracks(kFALSE),
+  fTrackColumns(0x0),
+  fColumnTrack(0x0)
 {
   // default ctor
 }
@@ -157,6 +164,7 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
   // dtor
   delete fTrackCuts;
   delete fList;
+  delete fColumnTrack;
 }
 
 //_____________________________________________________________________________
@@ -236,7 +244,7 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
 
   //  std::cout << "MC Mode: " << fMCMode << ", Tracks " << fTracks->GetEntries() << std::endl;
   
-  if ( fMCMode>=2 && !fTracks->GetEntries() ) {
+  if ( fMCMode>=2 && !(fColumnarTracks ? fTrackColumns->GetNumberOfTracks() : fTracks->GetEntries()) ) {
     return;
   }
   // for fMCMode==1 we only copy MC information for events where there's at least one muon track
@@ -275,12 +283,20 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
       } 
 
       // loop on (kept) tracks to find their ancestors
-      TIter nextTRACK(fTracks);
-      AliNanoAODTrack* track;
+      std::vector<Int_t> trackLabels;
+      if (fColumnarTracks) {
+        for (Int_t i = 0; i < fTrackColumns->GetNumberOfTracks(); i++)
+          trackLabels.push_back(fTrackColumns->GetLabel(i));
+      } else {
+        TIter nextTRACK(fTracks);
+        AliNanoAODTrack* track;
+        while ( ( track = static_cast<AliNanoAODTrack*>(nextTRACK()) ) )
+          trackLabels.push_back(track->GetLabel());
+      }
     
-      while ( ( track = static_cast<AliNanoAODTrack*>(nextTRACK()) ) )
+      for (UInt_t iLabel = 0; iLabel < trackLabels.size(); iLabel++)
 	{
-	  Int_t label = TMath::Abs(track->GetLabel()); 
+	  Int_t label = TMath::Abs(trackLabels[iLabel]); 
       
 	  while ( label >= 0 ) 
 	    {
@@ -389,15 +405,20 @@ void AliNanoAODReplicator::FilterMC(const AliAODEvent& source)
     
       // now remap the tracks...
     
-      TIter nextTrack(fTracks);
-      AliNanoAODTrack* t;
-      //      std::cout << "Remapping tracks" << std::endl;
+      if (fColumnarTracks) {
+        for (Int_t i = 0; i < fTrackColumns->GetNumberOfTracks(); i++)
+          fTrackColumns->SetLabel(i, GetNewLabel(fTrackColumns->GetLabel(i)));
+      } else {
+        TIter nextTrack(fTracks);
+        AliNanoAODTrack* t;
+        //      std::cout << "Remapping tracks" << std::endl;
     
-      while ( ( t = dynamic_cast<AliNanoAODTrack*>(nextTrack()) ) )
-	{
+        while ( ( t = dynamic_cast<AliNanoAODTrack*>(nextTrack()) ) )
+	  {
 	  
-	  t->SetLabel(GetNewLabel(t->GetLabel()));
-	}
+	    t->SetLabel(GetNewLabel(t->GetLabel()));
+	  }
+      }
     
     } // closes fMCMode == 1
   else if ( mcParticles ) 
@@ -442,7 +463,18 @@ TList* AliNanoAODReplicator::GetList() const
       fList = new TList;
       fList->SetOwner(kTRUE);
 
-      fTracks = new TClonesArray("AliNanoAODTrack");
+      if (fColumnarTracks) {
+        // V0s and cascades keep references to their daughter track objects
+        if (fSaveV0s || fSaveCascades)
+          AliFatal("Columnar tracks cannot be combined with V0s or cascades");
+        fColumnTrack = new AliNanoAODTrack(fVarList.Data());
+        fTrackColumns = new AliNanoAODTrackColumns(Form("%sColumns", fOutputArrayName.Data()));
+        fList->Add(fTrackColumns);
+        // views on the columns, so that readers of the "tracks" array keep working
+        fTracks = new TClonesArray("AliNanoAODTrackView");
+      } else {
+        fTracks = new TClonesArray("AliNanoAODTrack");
+      }
       fTracks->SetName(fOutputArrayName.Data());
       fList->Add(fTracks);
 
@@ -532,7 +564,10 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 {
   // Replicate (and filter if filters are there) the relevant parts we're interested in AODEvent
   
-  fTracks->Clear("C");
+  if (fTracks)
+    fTracks->Clear("C");
+  if (fTrackColumns)
+    fTrackColumns->Clear();
   
   assert(fVertices!=0x0);
   fVertices->Clear("C");
@@ -688,6 +723,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   }
   
   std::map<TObject*, AliNanoAODTrack*> trackAssociation;
+  std::vector<AliAODTrack*> columnTracks; // selected tracks, columnar mode
   
   // Tracks
   Int_t ntracks(0);
@@ -715,6 +751,11 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     if (!selected)
       continue;
 
+    if (fColumnarTracks) {
+      columnTracks.push_back(aodtrack);
+      continue;
+    }
+
     AliNanoAODTrack* nanoTrack = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
 
     for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
@@ -722,6 +763,24 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     
     trackAssociation[aodtrack] = nanoTrack;
   }
+
+  // Columnar tracks: the columns are sized once and filled track by track
+  if (fColumnarTracks) {
+    fTrackColumns->SetNumberOfTracks(columnTracks.size());
+    for (UInt_t j = 0; j < columnTracks.size(); j++) {
+      AliAODTrack* aodtrack = columnTracks[j];
+      fColumnTrack->Fill(aodtrack);
+      for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
+        (*it)->SetNanoAODTrack(aodtrack, fColumnTrack);
+
+      Int_t prodVertex = -1;
+      std::map<AliAODVertex*, AliAODVertex*>::iterator itV = fClonedVertices.find(aodtrack->GetProdVertex());
+      if (itV != fClonedVertices.end())
+        prodVertex = fVertices->IndexOf(itV->second);
+      fTrackColumns->SetTrack(j, fColumnTrack, prodVertex);
+    }
+    fTrackColumns->SetTrackViews(fTracks, fVertices);
+  }
   
   // Replace references to stored tracks. 
   // NOTE this has to respect the order in which they were stored (e.g. for a V0 the first daugther needs to be the positive one).
@@ -743,7 +802,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     }
   }
   
-  AliDebug(1,Form("tracks=%d vertices=%d", fTracks->GetEntries(),fVertices->GetEntries())); 
+  AliDebug(1,Form("tracks=%d vertices=%d", fColumnarTracks ? fTrackColumns->GetNumberOfTracks() : fTracks->GetEntries(),fVertices->GetEntries())); 
   
   // Finally, deal with MC information, if needed
   if ( fMCMode > 0 ) {
@@ -49,6 +49,7 @@ class AliAODHeader;
 class AliNanoAODHeader;
 class AliAnalysisTaskSE;
 class AliNanoAODTrack;
+class AliNanoAODTrackColumns;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
@@ -92,6 +93,10 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void SetOutputArrayName(TString name) {fOutputArrayName=name;}
 
   void SetVarListHeaderTC(TString var) {fVarListHeader_fTC=var;}
+
+  // Stores the tracks as AliNanoAODTrackColumns, read with AliNanoAODInputHandler.
+  // Not for tasks casting the tracks to AliNanoAODTrack (FemtoDream, Sigma0)
+  void SetColumnarTracks(Bool_t b) { fColumnarTracks = b; }
     
  private:
 
@@ -145,10 +150,14 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   std::map<AliAODVertex*, std::vector<TObject*> > fKeepDaughters; //! Tracks needed as references to V0s and cascades
   std::map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
 
+  Bool_t fColumnarTracks; // if kTRUE the tracks are stored in an AliNanoAODTrackColumns, the tracks array holds AliNanoAODTrackView
+  mutable AliNanoAODTrackColumns* fTrackColumns; //! columnar tracks
+  mutable AliNanoAODTrack* fColumnTrack; //! track filled from each selected AOD track before it is copied to the columns
+
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 6) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
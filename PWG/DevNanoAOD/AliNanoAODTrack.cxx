@@ -60,12 +60,29 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
 {
   // constructor
 
-  Double_t position[3];
-  aodTrack->GetXYZ(position); // GetXYZ() returns kTRUE, if it's DCA information
   AliNanoAODTrackMapping::GetInstance(vars);
 
   // Create internal structure
   AllocateInternalStorage(AliNanoAODTrackMapping::GetInstance()->GetSize(), AliNanoAODTrackMapping::GetInstance()->GetSizeInt());
+
+  Fill(aodTrack);
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrack::Fill(AliAODTrack * aodTrack)
+{
+  // Copies the variables of the mapping from the AOD track.
+  // All other variables (custom variables) and the flags are reset, so that
+  // the same object can be filled with many tracks (see AliNanoAODTrackColumns)
+
+  for (Int_t i = 0; i < AliNanoAODTrackMapping::GetInstance()->GetSize(); i++)
+    SetVar(i, 0);
+  for (Int_t i = 0; i < AliNanoAODTrackMapping::GetInstance()->GetSizeInt(); i++)
+    SetVarInt(i, 0);
+  fNanoFlags = 0;
+
+  Double_t position[3];
+  aodTrack->GetXYZ(position); // GetXYZ() returns kTRUE, if it's DCA information
   
   // Get DCA correctly (covers both kases with and without kIsDCA bit set)
   Float_t dcaXY = 0;
@@ -63,6 +63,7 @@ public:
   };
   
   UInt_t GetNanoFlags() const { return fNanoFlags; }
+  void SetNanoFlags(UInt_t flags) { fNanoFlags = flags; }
   virtual Short_t  Charge() const { return TESTBIT(fNanoFlags, kNanoCharge) ? 1 : -1; }
   Bool_t HasTOFPID() { return TESTBIT(fNanoFlags, kNanoHasTOFPID); }
   virtual Bool_t HasPointOnITSLayer(Int_t i) const { return TESTBIT(fNanoFlags, i+kNanoClusterITS0); }
@@ -74,6 +75,8 @@ public:
   AliNanoAODTrack(AliESDTrack * esdTrack, const char * vars);
   AliNanoAODTrack(const char * vars);
 
+  void Fill(AliAODTrack * aodTrack);
+
   virtual ~AliNanoAODTrack();
   AliNanoAODTrack(const AliNanoAODTrack& trk); 
   AliNanoAODTrack& operator=(const AliNanoAODTrack& trk);
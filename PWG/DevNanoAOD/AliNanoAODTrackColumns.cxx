@@ -0,0 +1,140 @@
+#include "AliNanoAODTrackColumns.h"
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackMapping.h"
+#include "AliNanoAODTrackView.h"
+#include "AliAODVertex.h"
+#include "AliVEvent.h"
+#include "AliLog.h"
+#include "TClonesArray.h"
+
+ClassImp(AliNanoAODTrackColumns)
+
+AliNanoAODTrackColumns::AliNanoAODTrackColumns() :
+  TObject(),
+  fName("tracksColumns"),
+  fNTracks(0),
+  fNVars(0),
+  fNVarsInt(0),
+  fVars(),
+  fVarsInt(),
+  fLabels(),
+  fNanoFlags(),
+  fProdVertex(),
+  fVertices(0)
+{
+  // default ctor
+}
+
+AliNanoAODTrackColumns::AliNanoAODTrackColumns(const char* name) :
+  TObject(),
+  fName(name),
+  fNTracks(0),
+  fNVars(0),
+  fNVarsInt(0),
+  fVars(),
+  fVarsInt(),
+  fLabels(),
+  fNanoFlags(),
+  fProdVertex(),
+  fVertices(0)
+{
+  // ctor
+}
+
+AliNanoAODTrackColumns::~AliNanoAODTrackColumns()
+{
+  // dtor
+}
+
+void AliNanoAODTrackColumns::Clear(Option_t* /*opt*/)
+{
+  // removes all tracks, keeping the allocated memory
+  SetNumberOfTracks(0);
+}
+
+void AliNanoAODTrackColumns::SetNumberOfTracks(Int_t nTracks)
+{
+  // Sets the number of tracks of the event. The columns are resized to the
+  // variables of the mapping and have to be filled with SetTrack
+
+  fNTracks = nTracks;
+  fNVars = AliNanoAODTrackMapping::GetInstance()->GetSize();
+  fNVarsInt = AliNanoAODTrackMapping::GetInstance()->GetSizeInt();
+
+  fVars.resize(fNVars * fNTracks);
+  fVarsInt.resize(fNVarsInt * fNTracks);
+  fLabels.resize(fNTracks);
+  fNanoFlags.resize(fNTracks);
+  fProdVertex.resize(fNTracks);
+}
+
+void AliNanoAODTrackColumns::SetTrack(Int_t iTrack, const AliNanoAODTrack* track, Int_t prodVertex)
+{
+  // Stores the track at position iTrack (< GetNumberOfTracks())
+
+  for (Int_t var = 0; var < fNVars; var++)
+    fVars[var * fNTracks + iTrack] = track->GetVar(var);
+  for (Int_t var = 0; var < fNVarsInt; var++)
+    fVarsInt[var * fNTracks + iTrack] = track->GetVarInt(var);
+
+  fLabels[iTrack] = track->GetLabel();
+  fNanoFlags[iTrack] = track->GetNanoFlags();
+  fProdVertex[iTrack] = prodVertex;
+}
+
+Int_t AliNanoAODTrackColumns::GetColumnIndex(const char* varName)
+{
+  // Index of the variable, -1 if not stored. Call once, not per track
+  return AliNanoAODTrackMapping::GetInstance()->GetVarIndex(varName);
+}
+
+Short_t AliNanoAODTrackColumns::Charge(Int_t iTrack) const
+{
+  // charge as AliNanoAODTrack::Charge
+  return TESTBIT(fNanoFlags[iTrack], AliNanoAODTrack::kNanoCharge) ? 1 : -1;
+}
+
+AliAODVertex* AliNanoAODTrackColumns::GetProdVertexObject(Int_t iTrack) const
+{
+  // production vertex, 0 if not stored or if the vertices are not connected
+  Int_t index = fProdVertex[iTrack];
+  if (!fVertices || index < 0 || index >= fVertices->GetEntriesFast())
+    return 0;
+  return static_cast<AliAODVertex*>(fVertices->At(index));
+}
+
+void AliNanoAODTrackColumns::SetTrackViews(TClonesArray* tracks, const TClonesArray* vertices)
+{
+  // Fills the array with one AliNanoAODTrackView per stored track. The views
+  // do not copy anything and are valid as long as this object holds the event.
+  // The production vertices are resolved if the vertices array is given
+
+  fVertices = vertices;
+
+  tracks->Clear("C"); // also drops the views read from the file
+  for (Int_t i = 0; i < fNTracks; i++)
+    new((*tracks)[i]) AliNanoAODTrackView(this, i);
+}
+
+AliNanoAODTrackColumns* AliNanoAODTrackColumns::ConnectTracks(AliVEvent* event, const char* tracksName)
+{
+  // Connects the track views of the event to its columns. To be called once
+  // per event before the tracks are used. Returns the columns, 0 if the event
+  // has no columnar tracks
+
+  if (!event)
+    return 0;
+
+  AliNanoAODTrackColumns* columns = dynamic_cast<AliNanoAODTrackColumns*> (event->FindListObject(Form("%sColumns", tracksName)));
+  if (!columns)
+    return 0;
+
+  TClonesArray* tracks = dynamic_cast<TClonesArray*> (event->FindListObject(tracksName));
+  if (!tracks) {
+    AliFatalClass(Form("No \"%s\" array for the columnar NanoAOD tracks", tracksName));
+    return 0;
+  }
+
+  columns->SetTrackViews(tracks, dynamic_cast<TClonesArray*> (event->FindListObject("vertices")));
+  return columns;
+}
@@ -0,0 +1,94 @@
+/// \class AliNanoAODTrackColumns
+/// \brief Columnar storage of the NanoAOD tracks of one event
+///
+/// Instead of one AliNanoAODTrack object per track, all tracks of the event
+/// are stored column by column: the values of one variable for all tracks are
+/// contiguous in memory and on disk (which also compresses much better).
+/// The variables and their indexes are the ones of AliNanoAODTrackMapping.
+///
+/// Reading, resolve the column once per event and loop over the tracks:
+///
+///     const Float_t* pt = columns->GetColumn(AliNanoAODTrackMapping::GetInstance()->GetPt());
+///     for (Int_t i = 0; i < columns->GetNumberOfTracks(); i++)
+///       ... pt[i] ...
+///
+/// The "tracks" array of the event holds one AliNanoAODTrackView per track,
+/// so tasks which need AliVTrack objects keep working. The views read from
+/// the columns and have to be connected once per event after reading. This is
+/// done by AliNanoAODInputHandler; with another input handler call
+///
+///     AliNanoAODTrackColumns* columns = AliNanoAODTrackColumns::ConnectTracks(InputEvent());
+///
+/// The views are not AliNanoAODTrack: tasks casting the tracks to
+/// AliNanoAODTrack (FemtoDream, Sigma0) do not support columnar tracks.
+///
+/// Written by AliNanoAODReplicator if SetColumnarTracks() is set.
+
+#ifndef _ALINANOAODTRACKCOLUMNS_H_
+#define _ALINANOAODTRACKCOLUMNS_H_
+
+#include <vector>
+
+#include "TObject.h"
+#include "TString.h"
+
+class TClonesArray;
+class AliVEvent;
+class AliAODVertex;
+class AliNanoAODTrack;
+
+class AliNanoAODTrackColumns : public TObject
+{
+public:
+  AliNanoAODTrackColumns();
+  AliNanoAODTrackColumns(const char* name);
+  virtual ~AliNanoAODTrackColumns();
+
+  virtual const char* GetName() const { return fName.Data(); }
+  virtual void Clear(Option_t* opt = "");
+
+  void SetNumberOfTracks(Int_t nTracks);
+  void SetTrack(Int_t iTrack, const AliNanoAODTrack* track, Int_t prodVertex = -1);
+
+  Int_t GetNumberOfTracks() const { return fNTracks; }
+  Int_t GetNumberOfVars()    const { return fNVars; }
+  Int_t GetNumberOfVarsInt() const { return fNVarsInt; }
+
+  // columns, index as in AliNanoAODTrackMapping
+  const Float_t* GetColumn(Int_t var)    const { return (var < 0 || fNTracks == 0) ? 0 : &fVars[var * fNTracks]; }
+  const Int_t*   GetColumnInt(Int_t var) const { return (var < 0 || fNTracks == 0) ? 0 : &fVarsInt[var * fNTracks]; }
+  static Int_t   GetColumnIndex(const char* varName);
+
+  Float_t GetVar(Int_t iTrack, Int_t var)    const { return fVars[var * fNTracks + iTrack]; }
+  Int_t   GetVarInt(Int_t iTrack, Int_t var) const { return fVarsInt[var * fNTracks + iTrack]; }
+  Int_t   GetLabel(Int_t iTrack)      const { return fLabels[iTrack]; }
+  UInt_t  GetNanoFlags(Int_t iTrack)  const { return fNanoFlags[iTrack]; }
+  Short_t Charge(Int_t iTrack)        const;
+  Int_t   GetProdVertex(Int_t iTrack) const { return fProdVertex[iTrack]; }
+  AliAODVertex* GetProdVertexObject(Int_t iTrack) const;
+
+  void SetLabel(Int_t iTrack, Int_t label) { fLabels[iTrack] = label; }
+
+  void SetTrackViews(TClonesArray* tracks, const TClonesArray* vertices = 0);
+  static AliNanoAODTrackColumns* ConnectTracks(AliVEvent* event, const char* tracksName = "tracks");
+
+private:
+  AliNanoAODTrackColumns(const AliNanoAODTrackColumns&);
+  AliNanoAODTrackColumns& operator=(const AliNanoAODTrackColumns&);
+
+  TString fName;                    ///< name of the branch
+  Int_t fNTracks;                   ///< number of tracks
+  Int_t fNVars;                     ///< number of float variables per track
+  Int_t fNVarsInt;                  ///< number of int variables per track
+  std::vector<Float_t> fVars;       ///< float variables, [var * fNTracks + track]
+  std::vector<Int_t> fVarsInt;      ///< int variables, [var * fNTracks + track]
+  std::vector<Int_t> fLabels;       ///< track labels
+  std::vector<UInt_t> fNanoFlags;   ///< AliNanoAODTrack::ENanoFlags bits
+  std::vector<Int_t> fProdVertex;   ///< index of the production vertex in the vertices array, -1 if not stored
+
+  const TClonesArray* fVertices;    //!<! vertices of the event, for GetProdVertexObject
+
+  ClassDef(AliNanoAODTrackColumns, 2)
+};
+
+#endif /* _ALINANOAODTRACKCOLUMNS_H_ */
@@ -0,0 +1,74 @@
+#include "AliNanoAODTrackView.h"
+#include "AliExternalTrackParam.h"
+#include "AliDetectorPID.h"
+#include "AliLog.h"
+
+ClassImp(AliNanoAODTrackView)
+
+AliNanoAODTrackView::AliNanoAODTrackView() :
+  AliVTrack(),
+  fColumns(0),
+  fIndex(-1),
+  fDetectorPID(0)
+{
+  // default ctor
+}
+
+AliNanoAODTrackView::AliNanoAODTrackView(const AliNanoAODTrackColumns* columns, Int_t index) :
+  AliVTrack(),
+  fColumns(columns),
+  fIndex(index),
+  fDetectorPID(0)
+{
+  // ctor: view on track index of the columns
+}
+
+AliNanoAODTrackView::~AliNanoAODTrackView()
+{
+  // dtor
+  delete fDetectorPID;
+}
+
+void AliNanoAODTrackView::Clear(Option_t* /*opt*/)
+{
+  // disconnects the view
+  fColumns = 0;
+  fIndex = -1;
+  delete fDetectorPID;
+  fDetectorPID = 0;
+}
+
+Bool_t AliNanoAODTrackView::PropagateToDCA(const AliVVertex* /*vtx*/,
+    Double_t /*b*/, Double_t /*maxd*/, Double_t /*dz*/[2], Double_t /*covar*/[3])
+{
+  // AliNanoAODTrack::PropagateToDCA updates the track, the view is read-only
+  AliError("Columnar NanoAOD tracks are read-only, use AliExternalTrackParam::CopyFromVTrack and propagate the copy");
+  return kFALSE;
+}
+
+Bool_t AliNanoAODTrackView::GetXYZAt(Double_t x, Double_t b, Double_t* r) const
+{
+  // global track position extrapolated to the radial position "x" (cm) in
+  // the magnetic field "b" (kG), see AliNanoAODTrack::GetXYZAt
+
+  AliExternalTrackParam etp;
+  if (!etp.CopyFromVTrack(this))
+    return kFALSE;
+  return etp.GetXYZAt(x, b, r);
+}
+
+Bool_t AliNanoAODTrackView::GetCovarianceXYZPxPyPz(Double_t cv[21]) const
+{
+  for (Int_t i=0; i<21; i++)
+    cv[i] = GetVar(AliNanoAODTrackMapping::GetInstance()->GetCovMat(i));
+
+  return kTRUE;
+}
+
+void AliNanoAODTrackView::SetDetectorPID(const AliDetectorPID* pid)
+{
+  /// Set the detector PID
+
+  if (fDetectorPID) delete fDetectorPID;
+  fDetectorPID = pid;
+}
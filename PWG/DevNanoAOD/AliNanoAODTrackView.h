@@ -0,0 +1,204 @@
+/// \class AliNanoAODTrackView
+/// \brief AliVTrack interface to one track of AliNanoAODTrackColumns
+///
+/// The view only holds the columns and the index of the track: all values
+/// are read from the column arrays, nothing is copied. The accessors are the
+/// ones of AliNanoAODTrack. Views are read-only.
+///
+/// In columnar mode the replicator stores the views in the usual "tracks"
+/// array, so tasks looping over AliVEvent::GetTrack() keep working. When
+/// reading, the views have to be connected to the columns once per event,
+/// which AliNanoAODInputHandler does; with another input handler call
+///
+///     AliNanoAODTrackColumns::ConnectTracks(InputEvent());
+///
+/// Using a view which is not connected is fatal. A view is not an
+/// AliNanoAODTrack: dynamic_cast<AliNanoAODTrack*> of it returns 0.
+
+#ifndef _ALINANOAODTRACKVIEW_H_
+#define _ALINANOAODTRACKVIEW_H_
+
+#include "AliVTrack.h"
+#include "AliAODTrack.h"
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
+#include "AliNanoAODTrackMapping.h"
+
+class AliAODVertex;
+class AliDetectorPID;
+
+class AliNanoAODTrackView : public AliVTrack
+{
+public:
+  AliNanoAODTrackView();
+  AliNanoAODTrackView(const AliNanoAODTrackColumns* columns, Int_t index);
+  virtual ~AliNanoAODTrackView();
+
+  virtual void Clear(Option_t* opt = "");
+
+  using TObject::ClassName;
+
+  void Connect(const AliNanoAODTrackColumns* columns, Int_t index) { fColumns = columns; fIndex = index; }
+  const AliNanoAODTrackColumns* GetColumns() const { return fColumns; }
+  Int_t GetIndex() const { return fIndex; }
+
+  // variables, index as in AliNanoAODTrackMapping
+  Double_t GetVar(Int_t var) const    { CheckVar(var); return fColumns->GetVar(fIndex, var); }
+  Int_t    GetVarInt(Int_t var) const { CheckVar(var); return fColumns->GetVarInt(fIndex, var); }
+
+  UInt_t GetNanoFlags() const { CheckVar(0); return fColumns->GetNanoFlags(fIndex); }
+  virtual Short_t Charge() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kNanoCharge) ? 1 : -1; }
+  Bool_t HasTOFPID() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kNanoHasTOFPID); }
+  virtual Bool_t HasPointOnITSLayer(Int_t i) const { return TESTBIT(GetNanoFlags(), i+AliNanoAODTrack::kNanoClusterITS0); }
+
+  // kinematics
+  virtual Double_t OneOverPt() const { return (Pt() != 0.) ? 1./Pt() : -999.; }
+  virtual Double_t Phi()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi());   }
+  virtual Double_t Theta()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()); }
+
+  virtual Double_t Px() const { return Pt() * TMath::Cos(Phi()); }
+  virtual Double_t Py() const { return Pt() * TMath::Sin(Phi()); }
+  virtual Double_t Pz() const { return Pt() / TMath::Tan(Theta()); }
+  virtual Double_t Pt() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()); }
+  virtual Double_t P()  const { return TMath::Sqrt(Pt()*Pt()+Pz()*Pz()); }
+  virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
+
+  virtual Double_t Xv() const { return GetProdVertex() ? GetProdVertex()->GetX() : -999.; }
+  virtual Double_t Yv() const { return GetProdVertex() ? GetProdVertex()->GetY() : -999.; }
+  virtual Double_t Zv() const { return GetProdVertex() ? GetProdVertex()->GetZ() : -999.; }
+  virtual Bool_t   XvYvZv(Double_t x[3]) const { x[0] = Xv(); x[1] = Yv(); x[2] = Zv(); return kTRUE; }
+
+  Double_t Chi2perNDF()  const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()); }
+  virtual UShort_t GetTPCncls(Int_t /*row0*/=0, Int_t /*row1*/=159)  const { return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCncls()); }
+  virtual UShort_t GetTPCNcls()  const { return GetTPCncls(); }
+
+  virtual Double_t M() const { AliFatal("Not Implemented"); return -1; }
+  virtual Double_t E() const { AliFatal("Not Implemented"); return -1; }
+  Double_t E(Double_t m) const { return TMath::Sqrt(P()*P() + m*m); }
+  virtual Double_t Y() const { AliFatal("Not Implemented"); return  -1; }
+
+  virtual Double_t Eta() const { return -TMath::Log(TMath::Tan(0.5 * Theta())); }
+  virtual Double_t GetSign() const {return Charge(); }
+  virtual Bool_t   PropagateToDCA(const AliVVertex *vtx,
+				  Double_t b, Double_t maxd, Double_t dz[2], Double_t covar[3]);
+
+  ULong64_t GetStatus() const { return (ULong64_t(GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetStatus())) << 32) + GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetStatus()+1); }
+
+  Int_t   GetID() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetID()); }
+  Int_t   GetLabel() const { CheckVar(0); return fColumns->GetLabel(fIndex); }
+
+  Bool_t GetPxPyPz(Double_t *p) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
+
+  template <typename T> Bool_t GetPosition(T *x) const {
+    x[0]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()); x[1]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()); x[2]=GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosZ());
+    return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kIsDCA);}
+  Bool_t GetXYZ(Double_t *p) const { return GetPosition(p); }
+  Bool_t GetXYZAt(Double_t x, Double_t b, Double_t *r) const;
+  Bool_t GetCovarianceXYZPxPyPz(Double_t cv[21]) const;
+
+  Bool_t IsMuonTrack() const { return TESTBIT(GetNanoFlags(), AliNanoAODTrack::kIsMuonTrack); }
+
+  Double_t XAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAx()); }
+  Double_t YAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAy()); }
+  Double_t ZAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPosDCAz()); }
+  Bool_t   XYZAtDCA(Double_t x[3]) const { x[0] = XAtDCA(); x[1] = YAtDCA(); x[2] = ZAtDCA(); return kTRUE; }
+
+  Double_t DCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetDCA()); }
+
+  Double_t PxAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAX()); }
+  Double_t PyAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAY()); }
+  Double_t PzAtDCA() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPDCAZ()); }
+  Double_t PAtDCA() const { return TMath::Sqrt(PxAtDCA()*PxAtDCA() + PyAtDCA()*PyAtDCA() + PzAtDCA()*PzAtDCA()); }
+  Bool_t   PxPyPzAtDCA(Double_t p[3]) const { p[0] = PxAtDCA(); p[1] = PyAtDCA(); p[2] = PzAtDCA(); return kTRUE; }
+
+  Double_t GetRAtAbsorberEnd() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetRAtAbsorberEnd()); }
+
+  UChar_t  GetITSClusterMap() const       { AliFatal("Not Implemented. Use HasPointOnITSLayer!"); return 0;};
+
+  Bool_t  TestFilterBit(UInt_t filterBit) const {return (Bool_t) ((filterBit & GetFilterMap()) != 0);}
+  UInt_t  GetFilterMap() const {return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetFilterMap());}
+
+  Float_t GetTPCClusterInfo(Int_t /*nNeighbours=3*/, Int_t /*type=0*/, Int_t /*row0=0*/, Int_t /*row1=159*/, Int_t /*type*/=0) const { AliFatal("Not Implemented"); return 0;};
+
+  UShort_t GetTPCNclsF() const { return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsF());}
+  UShort_t GetTPCnclsS() const { return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCnclsS());}
+  UShort_t GetTPCNCrossedRows()  const { return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCNCrossedRows());}
+  Float_t  GetTPCFoundFraction() const { return GetTPCNCrossedRows()>0 ? float(GetTPCNcls())/GetTPCNCrossedRows() : 0;}
+
+  Double_t GetTrackPhiOnEMCal() const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPhiOnEMCal());}
+  Double_t GetTrackEtaOnEMCal() const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackEtaOnEMCal());}
+  Double_t GetTrackPtOnEMCal() const  {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTrackPtOnEMCal());}
+  Double_t GetTrackPOnEMCal() const {return TMath::Abs(GetTrackEtaOnEMCal()) < 1 ? GetTrackPtOnEMCal()*TMath::CosH(GetTrackEtaOnEMCal()) : -999;}
+
+  //pid signal interface
+  Double_t  GetITSsignal()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetITSsignal());}
+  Double_t  GetTPCsignal()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignal());}
+  Double_t  GetTPCsignalTunedOnData() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalTuned());}
+  UShort_t  GetTPCsignalN()      const { return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTPCsignalN());}
+  Double_t  GetTPCmomentum()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCmomentum()); }
+  Double_t  GetTPCTgl()          const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTPCTgl());      }
+  Double_t  GetTOFsignal()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignal());   }
+  Double_t  GetIntegratedLength() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetintegratedLength()); }
+  void      SetIntegratedLength(Double_t/* l*/) {AliFatal("Not implemented");}
+  Double_t  GetTOFsignalTunedOnData() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFsignalTuned());}
+  Double_t  GetHMPIDsignal()      const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDsignal());};
+  Double_t  GetHMPIDoccupancy()  const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetHMPIDoccupancy());};
+
+  virtual void GetIntegratedTimes(Double_t */*times*/, Int_t) const { AliFatal("Not implemented"); return;}
+
+  Int_t   GetTOFBunchCrossing (Double_t /*b=0*/, Bool_t /*tpcPIDonly=kFALSE*/) const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTOFBunchCrossing()); }
+  UChar_t   GetTRDncls(Int_t /*layer*/)                           const {AliFatal("Not Implemented"); return 0;};
+  Double_t  GetTRDslice(Int_t /*plane*/, Int_t /*slice*/)         const {AliFatal("Not Implemented"); return 0;};
+  Double_t  GetTRDmomentum(Int_t /*plane*/, Double_t */*sp*/=0x0) const {AliFatal("Not Implemented"); return 0;};
+
+  Double_t  GetTRDsignal()         const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDsignal());}
+  Double_t  GetTRDchi2()           const {return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDChi2());}
+  UChar_t   GetTRDncls()           const {return GetTRDncls(-1);}
+  Int_t     GetNumberOfTRDslices() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTRDnSlices()); }
+
+  AliAODVertex *GetProdVertex() const { CheckVar(0); return fColumns->GetProdVertexObject(fIndex); }
+
+  Int_t    PdgCode() const {return 0;}
+
+  // Trasient PID object, is owned by the view
+  virtual void  SetDetectorPID(const AliDetectorPID *pid);
+  virtual const AliDetectorPID* GetDetectorPID() const { return fDetectorPID; }
+
+  //  needed  to inherit from VTrack, but not implemented
+  virtual UChar_t  GetTRDntrackletsPID() const  { return GetVarInt(AliNanoAODTrackMapping::GetInstance()->GetTRDntrackletsPID()); };
+  virtual void      GetHMPIDpid(Double_t */*p*/) const  {AliFatal("Not Implemented"); return;};
+  virtual Double_t GetBz() const  {AliFatal("Not Implemented"); return 0;};
+  virtual void     GetBxByBz(Double_t [3]/*b[3]*/) const  {AliFatal("Not Implemented"); return;};
+  virtual const    AliExternalTrackParam * GetOuterParam() const {AliFatal("Not Implemented"); return 0;};
+  virtual const    AliExternalTrackParam * GetInnerParam() const {AliFatal("Not Implemented"); return 0;};
+  virtual Int_t    GetNcls(Int_t /*idet*/) const {AliFatal("Not Implemented"); return 0;};
+  virtual const Double_t *PID() const {AliFatal("Not Implemented"); return 0;};
+
+  virtual void GetImpactParameters(Float_t &xy,Float_t &z) const { xy = DCA(); z = ZAtDCA(); }
+
+  bool   IsTRDrefit() const { return GetNanoFlags() & AliNanoAODTrack::kTRDrefit; }
+  bool   HasTOFpid() const { return GetNanoFlags() & AliNanoAODTrack::kNanoHasTOFPID; }
+
+private:
+  AliNanoAODTrackView(const AliNanoAODTrackView&);
+  AliNanoAODTrackView& operator=(const AliNanoAODTrackView&);
+
+  void CheckVar(Int_t var) const;
+
+  const AliNanoAODTrackColumns* fColumns;       //! columns of the event
+  Int_t fIndex;                                 //! index of the track in the columns
+  mutable const AliDetectorPID* fDetectorPID;   //!<! transient object to cache calibrated PID information
+
+  ClassDef(AliNanoAODTrackView, 1)
+};
+
+inline void AliNanoAODTrackView::CheckVar(Int_t var) const
+{
+  // the checks are cheap compared to a wrong value read silently
+  if (!fColumns)
+    AliFatal("Columnar NanoAOD tracks: call AliNanoAODTrackColumns::ConnectTracks(event) once per event before using the tracks");
+  if (var < 0)
+    AliFatal("Variable not stored in this NanoAOD");
+}
+
+#endif /* _ALINANOAODTRACKVIEW_H_ */
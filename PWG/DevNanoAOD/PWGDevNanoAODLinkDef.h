@@ -19,6 +19,9 @@
 #pragma link C++ class AliNanoAODSimpleSetterCRCZDC+;
 #pragma link C++ class AliNanoAODSimpleSetterJet+;
 #pragma link C++ class AliNanoAODTrackMapping+;
+#pragma link C++ class AliNanoAODTrackColumns+;
+#pragma link C++ class AliNanoAODTrackView+;
+#pragma link C++ class AliNanoAODInputHandler+;
 #pragma link C++ class AliAnalysisTaskNanoSimple;
 #pragma link C++ class AliAnalysisTaskNanoValidator;
 
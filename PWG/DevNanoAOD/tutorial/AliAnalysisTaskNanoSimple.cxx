@@ -9,6 +9,7 @@
 
 #include "AliNanoAODHeader.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 #include "AliAODConversionPhoton.h"
 
@@ -83,6 +84,10 @@ void  AliAnalysisTaskNanoSimple::UserExec(Option_t */*option*/)
   if (kV0MCentrality != -1)
     Printf("V0M centrality = %f", nanoHeader->GetVar(kV0MCentrality));
   
+  // columnar tracks (AliNanoAODReplicator::SetColumnarTracks): the tracks are views
+  // on the columns and have to be connected once per event
+  AliNanoAODTrackColumns* columns = AliNanoAODTrackColumns::ConnectTracks(fInputEvent);
+
   unsigned int nTracks = fInputEvent->GetNumberOfTracks();
   for (unsigned int i = 0; i < nTracks; i++) {
     AliVTrack* track = (AliVTrack*) fInputEvent->GetTrack(i);
@@ -115,6 +120,13 @@ void  AliAnalysisTaskNanoSimple::UserExec(Option_t */*option*/)
       //Printf("  TPC_sigma_proton = %f               TOF_sigma_proton = %f", pidResponse->NumberOfSigmasTPC(track, AliPID::kProton), pidResponse->NumberOfSigmasTOF(track, AliPID::kProton));
   }
   
+  // columnar tracks: faster than the views, resolve the column once, then loop
+  if (columns) {
+    const Float_t* pt = columns->GetColumn(AliNanoAODTrackMapping::GetInstance()->GetPt());
+    for (Int_t i = 0; pt && i < columns->GetNumberOfTracks(); i++)
+      Printf("pt = %f   charge = %d", pt[i], columns->Charge(i));
+  }
+
   // V0 access - as usual
   AliAODEvent* aod = dynamic_cast<AliAODEvent*> (fInputEvent);
   if (aod->GetV0s()) {
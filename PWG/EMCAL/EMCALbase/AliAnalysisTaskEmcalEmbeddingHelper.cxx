@@ -26,6 +26,9 @@
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TTree.h>
+#include <TBranch.h>
+#include <TEnv.h>
 #include <TGrid.h>
 #include <TGridResult.h>
 #include <TSystem.h>
@@ -169,7 +172,13 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fPrefetchExternalEvents(false),
+  fPrefetchCacheSize(100000000),
+  fPrefetchCacheDirectory(""),
+  fSelectionBranches(),
+  fSelectionTreeNumber(-1),
+  fSelectionBranchesOnly(false)
 {
   if (fgInstance != nullptr) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -243,7 +252,13 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fPrefetchExternalEvents(false),
+  fPrefetchCacheSize(100000000),
+  fPrefetchCacheDirectory(""),
+  fSelectionBranches(),
+  fSelectionTreeNumber(-1),
+  fSelectionBranchesOnly(false)
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -370,6 +385,12 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("autoConfigureIdentifier", fAutoConfigureIdentifier, false);
   // Random rejection 
   res = fYAMLConfig.GetProperty("randomRejectionFactor", fRandomRejectionFactor, false);
+
+  // Prefetching of the external events
+  baseName = "prefetchExternalEvents";
+  res = fYAMLConfig.GetProperty({baseName, "enabled"}, fPrefetchExternalEvents, false);
+  res = fYAMLConfig.GetProperty({baseName, "cacheSize"}, fPrefetchCacheSize, false);
+  res = fYAMLConfig.GetProperty({baseName, "cacheDirectory"}, fPrefetchCacheDirectory, false);
 }
 
 /**
@@ -821,6 +842,7 @@ void AliAnalysisTaskEmcalEmbeddingHelper::DetermineFirstFileToEmbed()
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 {
   Int_t attempts = -1;
+  Int_t loadedEntry = -1;
 
   do {
     // Reset to start of tree
@@ -847,7 +869,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
     // Load current event
     // Can be a simple less than, because fFileNumber counts from 0.
     if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
+      LoadExternalEntry(fCurrentEntry);
     }
     else {
       AliError("====================================================================================================");
@@ -865,9 +887,10 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
       // Access the relevant entry
       // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
-      fChain->GetEntry(fCurrentEntry);
+      LoadExternalEntry(fCurrentEntry);
     }
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
+    loadedEntry = fCurrentEntry;
 
     // Set relevant event properties
     SetEmbeddedEventProperties();
@@ -887,6 +910,12 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
   } while (!IsEventSelected());
 
+  // Only the branches needed by the selection were read, so read the rest of the selected event
+  if (fSelectionBranchesOnly) {
+    fChain->GetEntry(loadedEntry);
+    fSelectionBranchesOnly = false;
+  }
+
   if (fCreateHisto) {
     fHistManager.FillTH1("fHistEventCount", "Accepted");
     fHistManager.FillTH1("fHistEmbeddedEventsAttempted", attempts);
@@ -897,6 +926,108 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
   return kTRUE;
 }
 
+/**
+ * Load an entry of the TChain into the external event. If the external events are prefetched, only the
+ * branches needed by the embedded event selection are read, and fSelectionBranchesOnly is set. The
+ * remaining branches are then read in GetNextEntry() once the event is selected.
+ *
+ * @param[in] entry Entry of the TChain to load
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::LoadExternalEntry(Long64_t entry)
+{
+  fSelectionBranchesOnly = false;
+
+  if (fPrefetchExternalEvents) {
+    Long64_t treeEntry = fChain->LoadTree(entry);
+    if (treeEntry >= 0) {
+      // The branches belong to the tree, so they have to be retrieved again for each new tree
+      if (fChain->GetTreeNumber() != fSelectionTreeNumber) {
+        FindSelectionBranches();
+      }
+      if (fSelectionBranches.size() > 0) {
+        for (auto branch : fSelectionBranches) {
+          branch->GetEntry(treeEntry);
+        }
+        fSelectionBranchesOnly = true;
+        return;
+      }
+    }
+  }
+
+  fChain->GetEntry(entry);
+}
+
+/**
+ * Find the branches of the current tree which contain everything needed by SetEmbeddedEventProperties()
+ * and CheckIsEmbeddedEventSelected(): the header, the vertices and the MC header (if available). Only
+ * implemented for AODs. If a branch is not found, fSelectionBranches is left empty and all branches
+ * are read for every event.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::FindSelectionBranches()
+{
+  fSelectionBranches.clear();
+  fSelectionTreeNumber = fChain->GetTreeNumber();
+
+  AliAODEvent * aodEvent = dynamic_cast<AliAODEvent *>(fExternalEvent);
+  TTree * tree = fChain->GetTree();
+  if (!aodEvent || !tree || !aodEvent->GetHeader() || !aodEvent->GetVertices()) {
+    return;
+  }
+
+  // The objects of the AOD event are named after the branches they are read from
+  std::vector <std::string> branchNames = {aodEvent->GetHeader()->GetName(), aodEvent->GetVertices()->GetName()};
+  if (aodEvent->FindListObject(AliAODMCHeader::StdBranchName())) {
+    branchNames.push_back(AliAODMCHeader::StdBranchName());
+  }
+
+  for (auto branchName : branchNames)
+  {
+    // Branches of friend trees are not considered, as their entries may not be aligned with the tree
+    TBranch * branch = tree->GetBranch(branchName.c_str());
+    if (!branch || branch->GetTree() != tree) {
+      AliWarningStream() << "Branch \"" << branchName << "\" needed by the embedded event selection was not found in tree " << fSelectionTreeNumber << ". All branches will be read for every event of this tree.\n";
+      fSelectionBranches.clear();
+      return;
+    }
+    fSelectionBranches.push_back(branch);
+  }
+}
+
+/**
+ * Setup the prefetching of the external events. The asynchronous prefetching and the cache directory are
+ * read by ROOT when the cache of a file is created, so this must be called before the first file of the
+ * chain is opened.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetupPrefetching()
+{
+  AliInfoStream() << "Prefetching of the external events enabled with a tree cache of " << fPrefetchCacheSize << " bytes.\n";
+
+  gEnv->SetValue("TFile.AsyncPrefetching", 1);
+  if (fPrefetchCacheDirectory != "") {
+    AliInfoStream() << "Caching the prefetched blocks in \"" << fPrefetchCacheDirectory << "\".\n";
+    gEnv->SetValue("Cache.Directory", fPrefetchCacheDirectory.c_str());
+  }
+
+  fChain->SetCacheSize(fPrefetchCacheSize);
+}
+
+/**
+ * Called for each new tree of the chain when prefetching. All branches of the tree are added to the cache
+ * (they are all read for the selected events), and the next file of the chain is opened asynchronously.
+ * The chain will pick up the opened file when it moves to the next tree.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PrefetchNextFile()
+{
+  fChain->AddBranchToCache("*", kTRUE);
+
+  Int_t nextTreeNumber = fChain->GetTreeNumber() + 1;
+  if (nextTreeNumber > 0 && nextTreeNumber < fChain->GetNtrees()) {
+    const char * nextFilename = fChain->GetListOfFiles()->At(nextTreeNumber)->GetTitle();
+    AliDebugStream(2) << "Opening the next file to embed \"" << nextFilename << "\" asynchronously.\n";
+    TFile::AsyncOpen(nextFilename);
+  }
+}
+
 /**
  * Set some properties of the event that are not immediately available from the external event to make them
  * available to user tasks.
@@ -1323,6 +1454,11 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::SetupInputFiles()
     AliErrorStream() << "Number of input files (" << fFilenames.size() << ") is larger than the number of available files (" << fMaxNumberOfFiles << "). Something went wrong when adding some of those files to the TChain!\n";
   }
 
+  // Must be setup before the first file is opened by InitEvent()
+  if (fPrefetchExternalEvents) {
+    SetupPrefetching();
+  }
+
   // Setup input event
   Bool_t res = InitEvent();
   if (!res) return kFALSE;
@@ -1442,6 +1578,10 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // next tree (in the next file) since entries are indexed starting from 0.
   fChain->GetEntry(fUpperEntry);
 
+  if (fPrefetchExternalEvents) {
+    PrefetchNextFile();
+  }
+
   // Determine tree size and current entry
   // Set the limits of the new tree
   fLowerEntry = fUpperEntry;
@@ -1880,6 +2020,11 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "File list filename: \"" << fFileListFilename << "\"\n";
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
+  tempSS << "Prefetch external events: " << fPrefetchExternalEvents << "\n";
+  if (fPrefetchExternalEvents) {
+    tempSS << "Prefetching cache size: " << fPrefetchCacheSize << " bytes\n";
+    tempSS << "Prefetching cache directory: \"" << fPrefetchCacheDirectory << "\"\n";
+  }
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
@@ -19,6 +19,7 @@
 class TString;
 class TChain;
 class TFile;
+class TBranch;
 class AliVEvent;
 class AliVHeader;
 class AliGenPythiaEventHeader;
@@ -203,6 +204,34 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetMaxVertexDistance(Double_t distance)                    { fMaxVertexDist = distance; }
   /* @} */
 
+  /**
+   * @{
+   * @name Prefetching of the external events
+   *
+   * If enabled, the reading of the external events is overlapped with the processing:
+   * - The external tree is read through a tree cache with asynchronous prefetching, so the
+   *   upcoming baskets are read by the ROOT prefetching thread while the current event is processed.
+   * - The next file of the chain is opened asynchronously as soon as the embedding of a file starts.
+   * - For AODs, only the header, vertices and MC header are read to apply the embedded event selection.
+   *   The other branches are only read and unpacked for the selected events.
+   * - If a cache directory is set, the prefetched blocks are kept there and reused by the following jobs
+   *   which read the same files.
+   *
+   * The selected events and the recorded histograms are the same as without prefetching. Note that the
+   * asynchronous prefetching and the cache directory are process wide ROOT settings.
+   */
+  bool GetPrefetchExternalEvents()                          const { return fPrefetchExternalEvents; }
+  Long64_t GetPrefetchCacheSize()                           const { return fPrefetchCacheSize; }
+  std::string GetPrefetchCacheDirectory()                   const { return fPrefetchCacheDirectory; }
+
+  /// Enable prefetching of the external events. Can also be enabled through the %YAML configuration.
+  void SetPrefetchExternalEvents(bool b = true)                   { fPrefetchExternalEvents = b; }
+  /// Set the size of the tree cache used to prefetch the external events (in bytes)
+  void SetPrefetchCacheSize(Long64_t size)                        { fPrefetchCacheSize = size; }
+  /// Set the local directory where the prefetched blocks are cached across jobs
+  void SetPrefetchCacheDirectory(std::string path)                { fPrefetchCacheDirectory = path; }
+  /* @} */
+
   /**
    * @{
    * @name Properties of the embedded event
@@ -293,6 +322,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          SetupInputFiles()     ;
   std::string     ConstructFullPythiaXSecFilename(std::string inputFilename, const std::string & pythiaFilename, bool testIfExists) const;
   Bool_t          GetNextEntry()        ;
+  void            LoadExternalEntry(Long64_t entry);
+  void            FindSelectionBranches();
+  void            SetupPrefetching()    ;
+  void            PrefetchNextFile()    ;
   void            SetEmbeddedEventProperties();
   void            RecordEmbeddedEventProperties();
   Bool_t          IsEventSelected()     ;
@@ -375,6 +408,13 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   bool                                          fPrintTimingInfoToLog; ///< Flag to print time to execute InitTree(), for logging purposes
   TStopwatch                                    fTimer            ;    //!<! Timer for the InitTree() function
 
+  bool                                          fPrefetchExternalEvents; ///< If true, prefetch the external events (see SetPrefetchExternalEvents())
+  Long64_t                                      fPrefetchCacheSize; ///< Size of the tree cache used to prefetch the external events (bytes)
+  std::string                                   fPrefetchCacheDirectory; ///< Local directory where the prefetched blocks are cached. Disabled if empty
+  std::vector <TBranch *>                       fSelectionBranches; //!<! Branches of the current tree needed by the embedded event selection
+  Int_t                                         fSelectionTreeNumber; //!<! Tree number in the chain of the selection branches
+  bool                                          fSelectionBranchesOnly; //!<! Notes whether only the selection branches of the current entry were read
+
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
  private:
@@ -382,7 +422,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 12);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 13);
   /// \endcond
 };
 #endif
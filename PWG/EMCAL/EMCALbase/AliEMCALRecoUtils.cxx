@@ -18,6 +18,8 @@
 #include <TArrayI.h>
 #include <TArrayF.h>
 #include <TObjArray.h>
+#include <vector>
+#include <algorithm>
 
 // STEER includes
 #include "AliVCluster.h"
@@ -2710,6 +2712,10 @@ void AliEMCALRecoUtils::RecalculateClusterShowerShapeParametersWithCellCuts(cons
 /// Given the input event, loop over all the tracks, select the closest cluster as matched with fCutR.
 /// Store matched cluster indexes and residuals.
 ///
+/// The clusters are sorted in cubic cells with the size of the cluster window,
+/// each extrapolated track is only compared to the clusters in the same and in the
+/// neighbouring cells, all other clusters are out of the window anyway.
+///
 /// \param event: event pointer
 /// \param clusterArr: list of clusters
 /// \param geom: AliEMCALGeometry pointer
@@ -2770,13 +2776,45 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     }
   }
   
+  const TObjArray *matchArr = clusterArr ? clusterArr : clusterArray;
+  
+  // Sort the clusters in cells of the cluster window, as (cell, cluster index) pairs.
+  // Clusters without cell (position not defined or far outside) are checked for all tracks.
+  Bool_t useCells = fClusterWindow > 0;
+  std::vector< std::pair<Long64_t,Int_t> > cellClusters;
+  std::vector<Int_t> noCellClusters;
+  std::vector<Int_t> candidates;
+  if (useCells)
+  {
+    cellClusters.reserve(matchArr->GetEntriesFast());
+    Float_t  clsPos[3] = {0.,0.,0.};
+    Double_t pos[3]    = {0.,0.,0.};
+    Int_t    cell[3]   = {0,0,0};
+    for (Int_t icl=0; icl<matchArr->GetEntriesFast(); icl++)
+    {
+      AliVCluster *cluster = dynamic_cast<AliVCluster*> (matchArr->At(icl)) ;
+      if (!cluster || !cluster->IsEMCAL()) continue;
+      
+      cluster->GetPosition(clsPos);
+      for (Int_t i=0; i<3; i++) pos[i] = clsPos[i];
+      
+      if (GetClusterWindowCell(pos, cell))
+        cellClusters.push_back(std::make_pair(GetClusterWindowCellKey(cell), icl));
+      else
+        noCellClusters.push_back(icl);
+    }
+    std::sort(cellClusters.begin(), cellClusters.end());
+  }
+  
   Int_t    matched=0;
   Double_t cv[21];
   TString  genName;
   for (Int_t i=0; i<21;i++) cv[i]=0;
+  AliExternalTrackParam aodTrackParam; // reused for all AOD tracks
   for (Int_t itr=0; itr<event->GetNumberOfTracks(); itr++)
   {
     AliExternalTrackParam *trackParam = 0;
+    Bool_t ownParam = kFALSE;
     Int_t mcLabel = -1;
     // If the input event is ESD, the starting point for extrapolation is TPCOut, if available, or TPCInner 
     AliESDtrack *esdTrack = 0;
@@ -2805,7 +2843,10 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
           trackParam =  const_cast<AliExternalTrackParam*>(esdTrack->GetInnerParam());  
       }
       else
+      {
         trackParam =  new AliExternalTrackParam(*esdTrack); // If ITS Track Standing alone		
+        ownParam = kTRUE;
+      }
       
       mcLabel = TMath::Abs(esdTrack->GetLabel());
     }
@@ -2857,7 +2898,8 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
       AliDebug(5,Form("aod track: i=%d | pos=(%5.4f,%5.4f,%5.4f) | mom=(%5.4f,%5.4f,%5.4f) | charge=%d\n",
                       itr,pos[0],pos[1],pos[2],mom[0],mom[1],mom[2],aodTrack->Charge()));
       
-      trackParam= new AliExternalTrackParam(pos,mom,cv,aodTrack->Charge());
+      aodTrackParam.Set(pos,mom,cv,aodTrack->Charge());
+      trackParam = &aodTrackParam;
       
       mcLabel = TMath::Abs(aodTrack->GetLabel());
     }
@@ -2890,7 +2932,11 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
         if ( genName.Contains(fMCGenerToAccept[ig]) ) generOK = kTRUE;
       }
 
-      if ( !generOK ) continue;
+      if ( !generOK ) 
+      {
+        if (ownParam) delete trackParam;
+        continue;
+      }
     }
     
     // Extrapolate the track to EMCal surface, see AliEMCALRecoUtilsBase
@@ -2898,14 +2944,13 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     Float_t eta, phi, pt;
     if (!ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt)) 
     {
-      if (aodevent    && trackParam) delete trackParam;
-      if (fITSTrackSA && trackParam) delete trackParam;
+      if (ownParam) delete trackParam;
       continue;
     }
     
     if ( TMath::Abs(eta) > 0.75 ) 
     {
-      if ( trackParam && (aodevent || fITSTrackSA) )   delete trackParam;
+      if (ownParam) delete trackParam;
       continue;
     }
     
@@ -2913,18 +2958,44 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     if ( geom->GetNumberOfSuperModules() < 13 &&  // Run1 10 (12, 2 not active but present)
         ( phi < 70*TMath::DegToRad() || phi > 190*TMath::DegToRad())) 
     {
-      if ( trackParam && (aodevent || fITSTrackSA) )   delete trackParam;
+      if (ownParam) delete trackParam;
       continue;
     }
     
     //Find matched clusters
     Int_t index = -1;
     Float_t dEta = -999, dPhi = -999;
-    if (!clusterArr) 
-      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, clusterArray, dEta, dPhi);  
+    Double_t exPos[3] = {0.,0.,0.};
+    Int_t    cell[3]  = {0,0,0};
+    if ( useCells && emcalParam.GetXYZ(exPos) && GetClusterWindowCell(exPos, cell) )
+    {
+      // Clusters in the 27 cells around the track, in increasing index order as in the full loop
+      candidates = noCellClusters;
+      Int_t nCell[3];
+      for (Int_t ix=-1; ix<=1; ix++)
+      {
+        nCell[0] = cell[0]+ix;
+        for (Int_t iy=-1; iy<=1; iy++)
+        {
+          nCell[1] = cell[1]+iy;
+          for (Int_t iz=-1; iz<=1; iz++)
+          {
+            nCell[2] = cell[2]+iz;
+            Long64_t key = GetClusterWindowCellKey(nCell);
+            std::vector< std::pair<Long64_t,Int_t> >::const_iterator it = 
+              std::lower_bound(cellClusters.begin(), cellClusters.end(), std::make_pair(key, -1));
+            for ( ; it != cellClusters.end() && it->first == key; ++it) 
+              candidates.push_back(it->second);
+          }
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+      
+      if (!candidates.empty())
+        index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, matchArr, &candidates[0], (Int_t)candidates.size(), dEta, dPhi);
+    }
     else 
-      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, clusterArr  , dEta, dPhi);  
-    
+      index = FindMatchedClusterInClusterArr(&emcalParam, &emcalParam, matchArr, dEta, dPhi);  
     
     if (index>-1) 
     {
@@ -2935,8 +3006,7 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
       matched++;
     }
     
-    if (aodevent && trackParam) delete trackParam;
-    if (fITSTrackSA && trackParam) delete trackParam;
+    if (ownParam) delete trackParam;
   }//track loop
   
   if (clusterArray) 
@@ -3048,6 +3118,28 @@ Int_t  AliEMCALRecoUtils::FindMatchedClusterInClusterArr(const AliExternalTrackP
                                                          AliExternalTrackParam *trkParam, 
                                                          const TObjArray * clusterArr, 
                                                          Float_t &dEta, Float_t &dPhi)
+{  
+  return FindMatchedClusterInClusterArr(emcalParam, trkParam, clusterArr, 0x0, clusterArr->GetEntriesFast(), dEta, dPhi);
+}
+
+///
+/// Find matched cluster in a subset of the input array of clusters.
+/// 
+/// \param emcalParam: emcal track parameters container?
+/// \param trkParam: track parameters container?
+/// \param clusterArr: input array of clusters
+/// \param candidates: indices in clusterArr of the clusters to check, in increasing order; all clusters if 0x0
+/// \param nCandidates: number of candidates
+/// \param dEta: found track-cluster match residual in eta direction
+/// \param dPhi: found track-cluster match residual in phi direction
+///
+/// \return  the index of matched cluster to input track.
+//_______________________________________________________________________________________________
+Int_t  AliEMCALRecoUtils::FindMatchedClusterInClusterArr(const AliExternalTrackParam *emcalParam, 
+                                                         AliExternalTrackParam *trkParam, 
+                                                         const TObjArray * clusterArr, 
+                                                         const Int_t *candidates, Int_t nCandidates,
+                                                         Float_t &dEta, Float_t &dPhi)
 {  
   dEta=-999, dPhi=-999;
   Float_t dRMax = fCutR, dEtaMax=fCutEta, dPhiMax=fCutPhi;
@@ -3058,8 +3150,9 @@ Int_t  AliEMCALRecoUtils::FindMatchedClusterInClusterArr(const AliExternalTrackP
   if (!emcalParam->GetXYZ(exPos)) return index;
 
   Float_t clsPos[3] = {0.,0.,0.};
-  for (Int_t icl=0; icl<clusterArr->GetEntriesFast(); icl++)
+  for (Int_t ic=0; ic<nCandidates; ic++)
   {
+    Int_t icl = candidates ? candidates[ic] : ic;
     AliVCluster *cluster = dynamic_cast<AliVCluster*> (clusterArr->At(icl)) ;
     
     if (!cluster || !cluster->IsEMCAL()) continue;
@@ -3108,6 +3201,30 @@ Int_t  AliEMCALRecoUtils::FindMatchedClusterInClusterArr(const AliExternalTrackP
   return index;
 }
 
+///
+/// Cell of the position in the grid of cubic cells used in FindMatches.
+/// The cells are slightly larger than the cluster window, so that a cluster
+/// in the window of a track is always in the same or in a neighbouring cell.
+///
+/// \param pos: global position
+/// \param cell: cell indices in x, y and z
+///
+/// \return false if the position is not defined or too far for the grid
+///
+//---------------------------------------------------------------------------------
+Bool_t AliEMCALRecoUtils::GetClusterWindowCell(const Double_t pos[3], Int_t cell[3]) const
+{
+  const Double_t cellSize = fClusterWindow*(1+1e-6);
+  const Int_t    offset   = 1 << 19; // cells are kept positive and below 2^20, see GetClusterWindowCellKey
+  for (Int_t i=0; i<3; i++)
+  {
+    Double_t c = TMath::Floor(pos[i]/cellSize);
+    if ( !(TMath::Abs(c) < offset-2) ) return kFALSE; // also for nan
+    cell[i] = (Int_t)c + offset;
+  }
+  return kTRUE;
+}
+
 ///
 /// Return the residual by extrapolating a track param to a cluster.
 /// Mass and step hypothesis are set via data members fStepCluster and fMass 
@@ -452,6 +452,16 @@ public:
                                                       Float_t & amp, TArrayI & labeArr, TArrayF & eDepArr ) const;
 private:  
   
+  // Track matching helpers for FindMatches
+  Int_t    FindMatchedClusterInClusterArr(const AliExternalTrackParam *emcalParam, 
+                                          AliExternalTrackParam *trkParam, 
+                                          const TObjArray * clusterArr, 
+                                          const Int_t *candidates, Int_t nCandidates,
+                                          Float_t &dEta, Float_t &dPhi);
+  Bool_t   GetClusterWindowCell(const Double_t pos[3], Int_t cell[3]) const;
+  static Long64_t GetClusterWindowCellKey(const Int_t cell[3])
+  { return ((Long64_t)cell[0] << 40) | ((Long64_t)cell[1] << 20) | (Long64_t)cell[2] ; }
+  
   // Position recalculation
   Float_t    fMisalTransShift[15];       ///< Cluster position translation shift parameters
   Float_t    fMisalRotShift[15];         ///< Cluster position rotation shift parameters
@@ -0,0 +1,195 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include "AliEmcalTrackExtrapolationCache.h"
+
+#include "AliAnalysisManager.h"
+#include "AliEMCALRecoUtils.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTrackExtrapolationCache)
+/// \endcond
+
+//_______________________________________________
+AliEmcalTrackExtrapolationCache::AliEmcalTrackExtrapolationCache() :
+  TNamed(DefaultName(), DefaultName()),
+  fEntry(-1),
+  fTrackEntries(),
+  fParamEntries(),
+  fLastHit(kFALSE),
+  fNHits(0),
+  fNMisses(0)
+{
+}
+
+//_______________________________________________
+AliEmcalTrackExtrapolationCache::AliEmcalTrackExtrapolationCache(const char* name) :
+  TNamed(name, name),
+  fEntry(-1),
+  fTrackEntries(),
+  fParamEntries(),
+  fLastHit(kFALSE),
+  fNHits(0),
+  fNMisses(0)
+{
+}
+
+/**
+ * Cache of the event. It is created and added to the event by the first
+ * caller, and cleared for every new entry of the analysis manager.
+ * Call once per event, do not keep the pointer for the next events.
+ * @param event Input event
+ * @return Extrapolation cache of the event
+ */
+AliEmcalTrackExtrapolationCache* AliEmcalTrackExtrapolationCache::GetCache(AliVEvent* event)
+{
+  if (!event) return 0;
+
+  AliEmcalTrackExtrapolationCache* cache = dynamic_cast<AliEmcalTrackExtrapolationCache*>(event->FindListObject(DefaultName()));
+  if (!cache) {
+    cache = new AliEmcalTrackExtrapolationCache(DefaultName());
+    event->AddObject(cache);
+  }
+
+  // Without analysis manager the entries are not known, the cache is then only used within one task
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (entry < 0 || entry != cache->fEntry) cache->Reset(entry);
+
+  return cache;
+}
+
+/**
+ * Forget all extrapolations, the counters are kept.
+ * @param entry Entry of the analysis manager the cache is used for
+ */
+void AliEmcalTrackExtrapolationCache::Reset(Long64_t entry)
+{
+  fEntry = entry;
+  fTrackEntries.clear();
+  fParamEntries.clear();
+}
+
+/**
+ * Same as AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliVTrack*, ...),
+ * the extrapolation is done only if it was not yet done in the event with
+ * the same parameters. The phi, eta and pt on the EMCal surface are set in the track.
+ * @return kTRUE if the track could be extrapolated
+ */
+Bool_t AliEmcalTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(AliVTrack *track, Double_t emcalR, Double_t mass, Double_t step, Double_t minpT,
+                                                                       Bool_t useMassForTracking, Bool_t useDCA, Bool_t useOuterParam)
+{
+  typedef std::multimap<Int_t, TrackEntry>::iterator TrackEntryIter;
+  std::pair<TrackEntryIter, TrackEntryIter> range = fTrackEntries.equal_range(track->GetID());
+  for (TrackEntryIter it = range.first; it != range.second; ++it) {
+    const TrackEntry &e = it->second;
+    if (e.fTrack == track && e.fPx == track->Px() && e.fPy == track->Py() && e.fPz == track->Pz() &&
+        e.fEmcalR == emcalR && e.fMass == mass && e.fStep == step && e.fMinPt == minpT &&
+        e.fUseMassForTracking == useMassForTracking && e.fUseDCA == useDCA && e.fUseOuterParam == useOuterParam) {
+      track->SetTrackPhiEtaPtOnEMCal(e.fPhi, e.fEta, e.fPt);
+      fLastHit = kTRUE;
+      fNHits++;
+      return e.fResult;
+    }
+  }
+
+  TrackEntry e;
+  e.fTrack = track;
+  e.fPx = track->Px();
+  e.fPy = track->Py();
+  e.fPz = track->Pz();
+  e.fEmcalR = emcalR;
+  e.fMass = mass;
+  e.fStep = step;
+  e.fMinPt = minpT;
+  e.fUseMassForTracking = useMassForTracking;
+  e.fUseDCA = useDCA;
+  e.fUseOuterParam = useOuterParam;
+  e.fResult = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, emcalR, mass, step, minpT, useMassForTracking, useDCA, useOuterParam);
+  e.fPhi = track->GetTrackPhiOnEMCal();
+  e.fEta = track->GetTrackEtaOnEMCal();
+  e.fPt = track->GetTrackPtOnEMCal();
+  fTrackEntries.insert(std::make_pair(track->GetID(), e));
+
+  fLastHit = kFALSE;
+  fNMisses++;
+  return e.fResult;
+}
+
+/**
+ * Same as AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliExternalTrackParam*, ...),
+ * the extrapolation is done only if the same parameters of the track were already
+ * extrapolated in the event with the same settings. trkParam is set to the
+ * extrapolated parameters in both cases.
+ * @param track Track of the parameters, used as key together with the parameters
+ * @return kTRUE if the parameters could be extrapolated
+ */
+Bool_t AliEmcalTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(const AliVTrack *track, AliExternalTrackParam *trkParam, Double_t emcalR, Double_t mass, Double_t step,
+                                                                       Float_t &eta, Float_t &phi, Float_t &pt)
+{
+  typedef std::multimap<Int_t, ParamEntry>::iterator ParamEntryIter;
+  std::pair<ParamEntryIter, ParamEntryIter> range = fParamEntries.equal_range(track->GetID());
+  for (ParamEntryIter it = range.first; it != range.second; ++it) {
+    const ParamEntry &e = it->second;
+    if (e.fTrack == track && e.fEmcalR == emcalR && e.fMass == mass && e.fStep == step && IsSameParam(e.fStart, *trkParam)) {
+      *trkParam = e.fEnd;
+      eta = e.fEta;
+      phi = e.fPhi;
+      pt = e.fPt;
+      fLastHit = kTRUE;
+      fNHits++;
+      return e.fResult;
+    }
+  }
+
+  ParamEntry e;
+  e.fTrack = track;
+  e.fEmcalR = emcalR;
+  e.fMass = mass;
+  e.fStep = step;
+  e.fStart = *trkParam;
+  e.fResult = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trkParam, emcalR, mass, step, eta, phi, pt);
+  e.fEnd = *trkParam;
+  e.fEta = eta;
+  e.fPhi = phi;
+  e.fPt = pt;
+  fParamEntries.insert(std::make_pair(track->GetID(), e));
+
+  fLastHit = kFALSE;
+  fNMisses++;
+  return e.fResult;
+}
+
+/**
+ * Whether the two track parameters are identical: reference
+ * frame, parameters and covariance matrix
+ */
+Bool_t AliEmcalTrackExtrapolationCache::IsSameParam(const AliExternalTrackParam &p1, const AliExternalTrackParam &p2)
+{
+  if (p1.GetX() != p2.GetX() || p1.GetAlpha() != p2.GetAlpha()) return kFALSE;
+
+  const Double_t *par1 = p1.GetParameter(), *par2 = p2.GetParameter();
+  for (Int_t i = 0; i < 5; i++) {
+    if (par1[i] != par2[i]) return kFALSE;
+  }
+
+  const Double_t *cov1 = p1.GetCovariance(), *cov2 = p2.GetCovariance();
+  for (Int_t i = 0; i < 15; i++) {
+    if (cov1[i] != cov2[i]) return kFALSE;
+  }
+
+  return kTRUE;
+}
@@ -0,0 +1,106 @@
+/**
+ * \file AliEmcalTrackExtrapolationCache.h
+ * \brief Declaration of class AliEmcalTrackExtrapolationCache
+ *
+ * In this header file the class AliEmcalTrackExtrapolationCache is declared
+ *
+ * \date Oct 17, 2026
+ */
+
+#ifndef ALIEMCALTRACKEXTRAPOLATIONCACHE_H
+#define ALIEMCALTRACKEXTRAPOLATIONCACHE_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <map>
+#include <TNamed.h>
+#include "AliExternalTrackParam.h"
+
+class AliVEvent;
+class AliVTrack;
+
+/**
+ * \class AliEmcalTrackExtrapolationCache
+ * \brief Per-event cache of the track extrapolations to the EMCal surface
+ * \ingroup EMCALCOREFW
+ *
+ * Several tasks of a train extrapolate the same tracks to the EMCal surface
+ * (AliEmcalTrackPropagatorTask, AliEmcalCorrectionClusterTrackMatcher,
+ * AliCaloTrackMatcher, ...). The cache is published in the event and keeps
+ * the result of each extrapolation, keyed by the track ID and the parameters
+ * of the extrapolation (radius, mass hypothesis, step, ...), so that the same
+ * extrapolation is done only once per event. The results are exactly the ones
+ * of AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface.
+ *
+ * The cache is found (or created) in the event with GetCache(), once per event:
+ *
+ * ~~~{.cxx}
+ * AliEmcalTrackExtrapolationCache *cache = AliEmcalTrackExtrapolationCache::GetCache(InputEvent());
+ * cache->ExtrapolateTrackToEMCalSurface(track, 440.);
+ * ~~~
+ *
+ * It is cleared when the analysis manager moves to the next entry. An entry
+ * is only used if the track kinematics (AliVTrack version) or the starting
+ * parameters (AliExternalTrackParam version) are also the same.
+ */
+class AliEmcalTrackExtrapolationCache : public TNamed {
+
+ public:
+  AliEmcalTrackExtrapolationCache();
+  AliEmcalTrackExtrapolationCache(const char* name);
+  virtual ~AliEmcalTrackExtrapolationCache() {}
+
+  static AliEmcalTrackExtrapolationCache* GetCache(AliVEvent* event);
+  static const char* DefaultName() { return "EmcalTrackExtrapolationCache"; }
+
+  Bool_t ExtrapolateTrackToEMCalSurface(AliVTrack *track, Double_t emcalR=440, Double_t mass=0.1396, Double_t step=20, Double_t minpT=0.35,
+                                        Bool_t useMassForTracking=kFALSE, Bool_t useDCA=kFALSE, Bool_t useOuterParam=kFALSE);
+  Bool_t ExtrapolateTrackToEMCalSurface(const AliVTrack *track, AliExternalTrackParam *trkParam, Double_t emcalR, Double_t mass, Double_t step,
+                                        Float_t &eta, Float_t &phi, Float_t &pt);
+
+  void     Reset(Long64_t entry=-1);
+
+  Bool_t   IsLastHit()   const { return fLastHit  ; }
+  Long64_t GetNHits()    const { return fNHits    ; }
+  Long64_t GetNMisses()  const { return fNMisses  ; }
+
+ private:
+  /// Extrapolation of an AliVTrack, see AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliVTrack*, ...)
+  struct TrackEntry {
+    const AliVTrack       *fTrack;                  ///< track
+    Double_t               fPx, fPy, fPz;           ///< momentum of the track
+    Double_t               fEmcalR, fMass, fStep, fMinPt;
+    Bool_t                 fUseMassForTracking, fUseDCA, fUseOuterParam;
+    Bool_t                 fResult;                 ///< return value of the extrapolation
+    Double_t               fPhi, fEta, fPt;         ///< values set in the track
+  };
+
+  /// Extrapolation of track parameters, see AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliExternalTrackParam*, ...)
+  struct ParamEntry {
+    const AliVTrack       *fTrack;                  ///< track of the parameters
+    Double_t               fEmcalR, fMass, fStep;
+    AliExternalTrackParam  fStart;                  ///< parameters before the extrapolation
+    Bool_t                 fResult;                 ///< return value of the extrapolation
+    AliExternalTrackParam  fEnd;                    ///< parameters after the extrapolation
+    Float_t                fEta, fPhi, fPt;         ///< values returned by the extrapolation
+  };
+
+  static Bool_t IsSameParam(const AliExternalTrackParam &p1, const AliExternalTrackParam &p2);
+
+  Long64_t                          fEntry;        //!<! entry of the analysis manager the cache is filled for
+  std::multimap<Int_t, TrackEntry>  fTrackEntries; //!<! AliVTrack extrapolations, by track ID
+  std::multimap<Int_t, ParamEntry>  fParamEntries; //!<! track parameter extrapolations, by track ID
+  Bool_t                            fLastHit;      //!<! whether the last extrapolation was found in the cache
+  Long64_t                          fNHits;        //!<! number of extrapolations found in the cache
+  Long64_t                          fNMisses;      //!<! number of extrapolations done
+
+  AliEmcalTrackExtrapolationCache(const AliEmcalTrackExtrapolationCache&);            // not implemented
+  AliEmcalTrackExtrapolationCache& operator=(const AliEmcalTrackExtrapolationCache&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTrackExtrapolationCache, 1);
+  /// \endcond
+};
+
+#endif
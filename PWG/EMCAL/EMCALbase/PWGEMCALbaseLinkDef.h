@@ -20,6 +20,7 @@
 #pragma link C++ class AliEmcalTrackSelection+;
 #pragma link C++ class AliEmcalTrackSelectionESD+;
 #pragma link C++ class AliEmcalTrackSelectionAOD+;
+#pragma link C++ class AliEmcalTrackExtrapolationCache+;
 #pragma link C++ class AliParticleContainer+;
 #pragma link C++ class AliPicoTrack+;
 #pragma link C++ class AliMCParticleContainer+;
@@ -15,6 +15,7 @@
 #include "AliEmcalParticle.h"
 #include "AliEMCALGeometry.h"
 #include "AliMCEvent.h"
+#include "AliEmcalTrackExtrapolationCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionClusterTrackMatcher);
@@ -36,6 +37,7 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fUsePIDmass(kTRUE),
   fUseDCA(kTRUE),
   fUseOuterParamInESDs(kFALSE),
+  fUseExtrapolationCache(kTRUE),
   fUpdateTracks(kTRUE),
   fUpdateClusters(kTRUE),
   fClusterContainerIndexMap(),
@@ -46,6 +48,7 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fNEmcalClusters(0),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0),
+  fHistExtrapolationCache(0),
   fNMCGenerToAccept(0),
   fMCGenerToAcceptForTrack(1)
 {
@@ -79,6 +82,7 @@ Bool_t AliEmcalCorrectionClusterTrackMatcher::Initialize()
   GetProperty("usePIDmass", fUsePIDmass);
   GetProperty("useDCA", fUseDCA);
   GetProperty("useOuterParamInESDs", fUseOuterParamInESDs);
+  GetProperty("useExtrapolationCache", fUseExtrapolationCache);
   GetProperty("maxDist", fMaxDistance);
   GetProperty("updateClusters", fUpdateClusters);
   GetProperty("updateTracks", fUpdateTracks);
@@ -156,6 +160,10 @@ void AliEmcalCorrectionClusterTrackMatcher::UserCreateOutputObjects()
     fHistMatchPhiAll = new TH1F("fHistMatchPhiAll", "fHistMatchPhiAll", 400, -0.2, 0.2);
     fOutput->Add(fHistMatchEtaAll);
     fOutput->Add(fHistMatchPhiAll);
+    fHistExtrapolationCache = new TH1F("fHistExtrapolationCache", "fHistExtrapolationCache", 2, -0.5, 1.5);
+    fHistExtrapolationCache->GetXaxis()->SetBinLabel(1, "hit");
+    fHistExtrapolationCache->GetXaxis()->SetBinLabel(2, "miss");
+    fOutput->Add(fHistExtrapolationCache);
     
     const Int_t nCentChBins = fNcentBins * 2;
     for(Int_t icent=0; icent<nCentChBins; ++icent) {
@@ -292,6 +300,9 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
     mass = 0.1396;
   }
 
+  AliEmcalTrackExtrapolationCache * cache = 0;
+  if (fUseExtrapolationCache) cache = AliEmcalTrackExtrapolationCache::GetCache(fEventManager.InputEvent());
+
   AliParticleContainer * partCont = 0;
   TIter nextPartCont(&fParticleCollArray);
   while ((partCont = static_cast<AliParticleContainer*>(nextPartCont()))) {
@@ -335,7 +346,13 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
         }
         
         // Propagate the track
-        AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA, fUseOuterParamInESDs);
+        if (cache) {
+          cache->ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA, fUseOuterParamInESDs);
+          if (fHistExtrapolationCache) fHistExtrapolationCache->Fill(cache->IsLastHit() ? 0 : 1);
+        }
+        else {
+          AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA, fUseOuterParamInESDs);
+        }
       }
 
       // Reset properties of the track to fix TRefArray errors which occur when AddTrackMatched(obj) is called.
@@ -6,6 +6,7 @@
 #include "AliEmcalTrackPropagatorTask.h"
 
 #include "AliParticleContainer.h"
+#include "AliEmcalTrackExtrapolationCache.h"
 
 #include <TClonesArray.h>
 
@@ -19,7 +20,8 @@ AliEmcalTrackPropagatorTask::AliEmcalTrackPropagatorTask() :
   AliAnalysisTaskEmcal("AliEmcalTrackPropagatorTask", kFALSE),
   fDist(440),
   fOnlyIfNotSet(kTRUE),
-  fOnlyIfEmcal(kTRUE)
+  fOnlyIfEmcal(kTRUE),
+  fUseExtrapolationCache(kTRUE)
 {
   // Constructor.
 }
@@ -29,7 +31,8 @@ AliEmcalTrackPropagatorTask::AliEmcalTrackPropagatorTask(const char *name) :
   AliAnalysisTaskEmcal(name, kFALSE),
   fDist(440),
   fOnlyIfNotSet(kTRUE),
-  fOnlyIfEmcal(kTRUE)
+  fOnlyIfEmcal(kTRUE),
+  fUseExtrapolationCache(kTRUE)
 {
   // Constructor.
 }
@@ -61,6 +64,9 @@ Bool_t AliEmcalTrackPropagatorTask::Run()
   AliParticleContainer* tracks = GetParticleContainer(0);
 
   if (!tracks) return 0;
+
+  AliEmcalTrackExtrapolationCache* cache = 0;
+  if (fUseExtrapolationCache) cache = AliEmcalTrackExtrapolationCache::GetCache(InputEvent());
   
   tracks->ResetCurrentID();
   AliVTrack* track = 0;
@@ -68,7 +74,10 @@ Bool_t AliEmcalTrackPropagatorTask::Run()
     if (fOnlyIfNotSet && track->IsExtrapolatedToEMCAL()) continue;
     if (fOnlyIfEmcal && !track->IsEMCAL()) continue;
     
-    AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fDist);
+    if (cache)
+      cache->ExtrapolateTrackToEMCalSurface(track, fDist);
+    else
+      AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fDist);
   }
 
   return kTRUE;
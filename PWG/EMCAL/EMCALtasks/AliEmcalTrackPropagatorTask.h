@@ -12,6 +12,7 @@ class AliEmcalTrackPropagatorTask : public AliAnalysisTaskEmcal {
   void               SetDist(Double_t d)               { fDist           = d; }
   void               SetOnlyIfNotSet(Bool_t b)         { fOnlyIfNotSet   = b; }
   void               SetOnlyIfEmcal(Bool_t b)          { fOnlyIfEmcal    = b; }
+  void               SetUseExtrapolationCache(Bool_t b){ fUseExtrapolationCache = b; }
 
  protected:
   void               ExecOnce();
@@ -20,11 +21,12 @@ class AliEmcalTrackPropagatorTask : public AliAnalysisTaskEmcal {
   Double_t           fDist;              // distance to surface (440cm default)
   Bool_t             fOnlyIfNotSet;      // propagate only if needed
   Bool_t             fOnlyIfEmcal;       // propagate only if it is in the EMCal acceptance
+  Bool_t             fUseExtrapolationCache; // share the extrapolations with the other tasks through AliEmcalTrackExtrapolationCache
 
  private:
   AliEmcalTrackPropagatorTask(const AliEmcalTrackPropagatorTask&);            // not implemented
   AliEmcalTrackPropagatorTask &operator=(const AliEmcalTrackPropagatorTask&); // not implemented
 
-  ClassDef(AliEmcalTrackPropagatorTask, 3); // Class to propagate and store track parameters at EMCAL surface
+  ClassDef(AliEmcalTrackPropagatorTask, 4); // Class to propagate and store track parameters at EMCAL surface
 };
 #endif
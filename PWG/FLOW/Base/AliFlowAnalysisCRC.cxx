@@ -45,6 +45,7 @@
 #include "AliFlowVector.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisCRC.h"
+#include "AliFlowQvectorKernel.h"
 #include "AliLog.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -148,6 +149,7 @@ fUseQvectorTerms(kFALSE),
 fReQ(NULL),
 fImQ(NULL),
 fSpk(NULL),
+fQvectorKernel(NULL),
 fReQGF(NULL),
 fImQGF(NULL),
 fIntFlowCorrelationsEBE(NULL),
@@ -412,6 +414,7 @@ AliFlowAnalysisCRC::~AliFlowAnalysisCRC()
   // destructor
   delete fHistList;
   delete fTempList;
+  delete fQvectorKernel;
   if(fCRCQVecWeightsList) delete fCRCQVecWeightsList;
   if(fCRCZDCCalibList)    delete fCRCZDCCalibList;
   if(fCRCZDC2DCutList)    delete fCRCZDC2DCutList;
@@ -593,6 +596,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
   Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
   AliFlowTrackSimple *aftsTrack = NULL;
   Int_t n = fHarmonic; // shortcut for the harmonic
+  if(!fQvectorKernel){fQvectorKernel = new AliFlowQvectorKernel();} // integrated RPs
+  fQvectorKernel->Clear();
 
   // d.1) Initialize particle weights
   Int_t cw = 0;
@@ -817,23 +822,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           if(fPhiExclZoneHist->GetBinContent(fPhiExclZoneHist->FindBin(dEta,dPhi))<0.5) continue;
         }
 
-        // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-        for(Int_t m=0;m<12;m++) // to be improved - hardwired 6
-        {
-          for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-          {
-            (*fReQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi);
-            (*fImQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi);
-          }
-        }
-        // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-        for(Int_t p=0;p<8;p++)
-        {
-          for(Int_t k=0;k<9;k++)
-          {
-            (*fSpk)(p,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k);
-          }
-        }
+        // Collect the particle for Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} (calculated after the loop over data bellow):
+        fQvectorKernel->AddParticle(0,dPhi,wPhiEta*wPhi*wPt*wEta*wTrack);
         // Differential flow:
         if(fCalculateDiffFlow || fCalculate2DDiffFlow)
         {
@@ -1247,6 +1237,29 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
     }
   } // end of for(Int_t i=0;i<nPrim;i++)
 
+  // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] (m = 1,2,...,12, k = 0,1,...,8) and S_{p,k} in one pass over the RPs,
+  // harmonic 0 gives sum_{i} w_{i}^{k}:
+  {
+    Double_t reQ[13*9] = {0.};
+    Double_t imQ[13*9] = {0.};
+    fQvectorKernel->Accumulate(0,0,13,n,9,1,reQ,imQ);
+    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6
+    {
+      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+      {
+        (*fReQ)(m,k)+=reQ[(m+1)*9+k];
+        (*fImQ)(m,k)+=imQ[(m+1)*9+k];
+      }
+    }
+    for(Int_t p=0;p<8;p++)
+    {
+      for(Int_t k=0;k<9;k++)
+      {
+        (*fSpk)(p,k)+=reQ[k];
+      }
+    }
+  }
+
   // ************************************************************************************************************
 
   // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
@@ -64,6 +64,7 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fQvectorFlagsPro(NULL),
  fCalculateQvector(kFALSE),
  fCalculateDiffQvectors(kFALSE),
+ fQvectorKernel(NULL),
  // 3.) Correlations:
  fCorrelationsList(NULL),
  fCorrelationsFlagsPro(NULL),
@@ -80,6 +81,8 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fCalculateOnlyForSC(kFALSE),
  fCalculateOnlyCos(kFALSE),
  fCalculateOnlySin(kFALSE),
+ fUseCorrelatorPlan(kFALSE),
+ fCorrelatorPlan(NULL),
  // 4.) Event-by-event cumulants:
  fEbECumulantsList(NULL),
  fEbECumulantsFlagsPro(NULL),
@@ -170,6 +173,8 @@ AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleC
  // Destructor.
  
  delete fHistList;
+ delete fCorrelatorPlan;
+ delete fQvectorKernel;
 
 } // end of AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleCorrelations()
 
@@ -632,6 +637,10 @@ void AliFlowAnalysisWithMultiparticleCorrelations::InitializeArraysForCorrelatio
    fCorrelationsPro[cs][c] = NULL;
   }
  }
+ for(Int_t c=0;c<8;c++) // [1p,2p,...,8p]
+ {
+  fCorrelatorPlanDenominators[c] = -1;
+ }
 
 } // void AliFlowAnalysisWithMultiparticleCorrelations::InitializeArraysForCorrelations()
 
@@ -739,6 +748,19 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlow
  // a) Calculate all booked multi-particle correlations:
  Double_t dMultRP = fSelectRandomlyRPs ? fnSelectedRandomlyRPs : anEvent->GetNumberOfRPs(); // TBI shall I promote this variable into data member? 
  if(fSkipSomeIntervals){ dMultRP = dMultRP - fNumberOfSkippedRPParticles; }
+
+ if(fCorrelatorPlan) // evaluate all booked correlations in one go
+ {
+  std::complex<Double_t> qvector[49*9];
+  for(Int_t h=0;h<49;h++)
+  {
+   for(Int_t wp=0;wp<9;wp++)
+   {
+    qvector[h*9+wp] = std::complex<Double_t>(fQvector[h][wp].Re(),fQvector[h][wp].Im());
+   }
+  }
+  fCorrelatorPlan->Evaluate(qvector);
+ } // if(fCorrelatorPlan)
  
  for(Int_t cs=0;cs<2;cs++) // cos/sin 
  {
@@ -754,8 +776,18 @@ void AliFlowAnalysisWithMultiparticleCorrelations::CalculateCorrelations(AliFlow
    {
     TString sBinLabel = fCorrelationsPro[cs][co]->GetXaxis()->GetBinLabel(b);
     if(sBinLabel.EqualTo("")){break;} 
-    Double_t num = CastStringToCorrelation(sBinLabel.Data(),kTRUE);
-    Double_t den = CastStringToCorrelation(sBinLabel.Data(),kFALSE);
+    Double_t num = 0.;
+    Double_t den = 0.;
+    if(fCorrelatorPlan)
+    {
+     const std::complex<Double_t> &corr = fCorrelatorPlan->Value(fCorrelatorPlanNodes[cs][co][b-1]);
+     num = 0==cs ? corr.real() : corr.imag();
+     den = fCorrelatorPlan->Value(fCorrelatorPlanDenominators[co]).real();
+    } else
+      {
+       num = CastStringToCorrelation(sBinLabel.Data(),kTRUE);
+       den = CastStringToCorrelation(sBinLabel.Data(),kFALSE);
+      }
     Double_t weight = den; // TBI: add support for other options for the weight eventually
     if(den>0.) 
     {
@@ -954,24 +986,7 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
  if(TString(string).BeginsWith("Sin")){bRealPart = kFALSE;}
 
  Int_t n[8] = {0,0,0,0,0,0,0,0}; // harmonics, supporting up to 8p correlations
- UInt_t whichCorr = 0;   
- for(Int_t t=0;t<=TString(string).Length();t++)
- {
-  if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
-  {
-   n[whichCorr] = string[t-1] - '0';
-   if(TString(string[t-2]).EqualTo("-")){n[whichCorr] = -1*n[whichCorr];}
-   if(!(TString(string[t-2]).EqualTo("-") 
-      || TString(string[t-2]).EqualTo(",")
-      || TString(string[t-2]).EqualTo("("))) // TBI relax this eventually to allow two-digits harmonics
-   { 
-    cout<<Form("And the fatal string is... '%s'. Congratulations!!",string)<<endl; 
-    Fatal(sMethodName.Data(),"!(TString(string[t-2]).EqualTo(...");
-   }
-   whichCorr++;
-   if(whichCorr>=9){Fatal(sMethodName.Data(),"whichCorr>=9");} // not supporting corr. beyond 8p 
-  } // if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
- } // for(UInt_t t=0;t<=TString(string).Length();t++)
+ UInt_t whichCorr = this->CastStringToHarmonics(string,n);
 
  switch(whichCorr)
  {
@@ -1034,6 +1049,38 @@ Double_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToCorrelation(c
 
 //=======================================================================================================================
 
+Int_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n)
+{
+ // Cast string of the generic form Cos/Sin(-n_1,-n_2,...,n_{k-1},n_k) into the harmonics n_1,...,n_k, stored in n[0],...,n[k-1].
+ // Returns k, the number of particles in the correlation. The array n shall hold at least 8 elements. 
+
+ TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n)"; 
+
+ UInt_t whichCorr = 0;   
+ for(Int_t t=0;t<=TString(string).Length();t++)
+ {
+  if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
+  {
+   if(whichCorr>=8){Fatal(sMethodName.Data(),"whichCorr>=8");} // not supporting corr. beyond 8p 
+   n[whichCorr] = string[t-1] - '0';
+   if(TString(string[t-2]).EqualTo("-")){n[whichCorr] = -1*n[whichCorr];}
+   if(!(TString(string[t-2]).EqualTo("-") 
+      || TString(string[t-2]).EqualTo(",")
+      || TString(string[t-2]).EqualTo("("))) // TBI relax this eventually to allow two-digits harmonics
+   { 
+    cout<<Form("And the fatal string is... '%s'. Congratulations!!",string)<<endl; 
+    Fatal(sMethodName.Data(),"!(TString(string[t-2]).EqualTo(...");
+   }
+   whichCorr++;
+  } // if(TString(string[t]).EqualTo(",") || TString(string[t]).EqualTo(")")) // TBI this is just ugly
+ } // for(UInt_t t=0;t<=TString(string).Length();t++)
+
+ return whichCorr;
+
+} // Int_t AliFlowAnalysisWithMultiparticleCorrelations::CastStringToHarmonics(const char *string, Int_t *n)
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithMultiparticleCorrelations::CalculateProductsOfCorrelations(AliFlowEventSimple *anEvent, TProfile2D *profile2D)
 {
  // Calculate products of multi-particle correlations (needed for error propagation).
@@ -1995,11 +2042,24 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 {
  // Fill Q-vector components.
 
+ // The loop over tracks only selects the particles and determines their weights. All harmonics and powers
+ // of the Q-, p- and q-vector components are then obtained in one pass from AliFlowQvectorKernel.
+ // Changes w.r.t. the previous per-particle loop (p- and q-vectors only, Q-vector unchanged):
+ //  a) p-vector of a POI is weighted with (wPhi*wPt*wEta)^p of the POI weights. The previous loop used for
+ //     p > 0 the weights left over from the q-vector of the same particle, and without POI weights a stale
+ //     power of them instead of 1;
+ //  b) POIs in the underflow or overflow bin are skipped. The previous loop wrote them to fpvector[-1] and
+ //     fpvector[100] (resp. fqvector), i.e. out of bounds.
+
+ if(!fQvectorKernel){fQvectorKernel = new AliFlowQvectorKernel(3);} // [RP,POI,RP&&POI]
+ fQvectorKernel->Clear();
+
  Int_t nTracks = anEvent->NumberOfTracks(); // TBI shall I promote this to data member?
  Double_t dPhi = 0., wPhi = 1.; // azimuthal angle and corresponding phi weight
  Double_t dPt = 0., wPt = 1.; // transverse momentum and corresponding pT weight
  Double_t dEta = 0., wEta = 1.; // pseudorapidity and corresponding eta weight
- Double_t wToPowerP = 1.; // weight raised to power p
+ Bool_t bUseRPWeights = fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2];
+ Bool_t bUsePOIWeights = fUseWeights[1][0]||fUseWeights[1][1]||fUseWeights[1][2];
  Int_t nCounterRPs = 0;
  for(Int_t t=0;t<nTracks;t++) // loop over all tracks
  {
@@ -2019,50 +2079,30 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 
   if(!(pTrack->InRPSelection() || pTrack->InPOISelection())){printf("\n AAAARGH: pTrack is neither RP nor POI !!!!"); continue;}
 
+  // Access kinematic variables:
+  dPhi = pTrack->Phi(); // azimuthal angle
+  //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
+  //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
+  dPt = pTrack->Pt();
+  dEta = pTrack->Eta();
+
   if(pTrack->InRPSelection()) // fill Q-vector components only with reference particles
   {
    nCounterRPs++;
    if(fSelectRandomlyRPs && nCounterRPs == fnSelectedRandomlyRPs){break;} // for(Int_t t=0;t<nTracks;t++) // loop over all tracks
 
-   wPhi = 1.; wPt = 1.; wEta = 1.; wToPowerP = 1.; // TBI this shall go somewhere else, for performance sake
-
-   // Access kinematic variables for RP and corresponding weights:
-   dPhi = pTrack->Phi(); // azimuthal angle
+   // Corresponding weights for RP:
+   wPhi = 1.; wPt = 1.; wEta = 1.;
    if(fUseWeights[0][0]){wPhi = Weight(dPhi,"RP","phi");} // corresponding phi weight
-   //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
-   //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
-   dPt = pTrack->Pt();
    if(fUseWeights[0][1]){wPt = Weight(dPt,"RP","pt");} // corresponding pT weight
-   dEta = pTrack->Eta();
    if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
-
-   // Calculate Q-vector components:
-   for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
-   {
-    for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
-    {
-     if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fQvector[h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
-    } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
-   } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+   fQvectorKernel->AddParticle(0,dPhi,bUseRPWeights ? wPhi*wPt*wEta : 1.);
   } // if(pTrack->InRPSelection()) // fill Q-vector components only with reference particles
 
   // Differential Q-vectors (a.k.a. p-vector and q-vector):
   if(!fCalculateDiffQvectors){continue;}
   if(pTrack->InPOISelection()) 
   {
-   wPhi = 1.; wPt = 1.; wEta = 1.; wToPowerP = 1.; // TBI this shall go somewhere else, for performance sake
-
-   // Access kinematic variables for POI and corresponding weights:
-   dPhi = pTrack->Phi(); // azimuthal angle
-   if(fUseWeights[1][0]){wPhi = Weight(dPhi,"POI","phi");} // corresponding phi weight
-   //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
-   //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
-   dPt = pTrack->Pt();
-   if(fUseWeights[1][1]){wPt = Weight(dPt,"POI","pt");} // corresponding pT weight
-   dEta = pTrack->Eta();
-   if(fUseWeights[1][2]){wEta = Weight(dEta,"POI","eta");} // corresponding eta weight
-
    // Determine bin:
    Int_t binNo = -44;
    if(fCalculateDiffCorrelationsVsPt)
@@ -2072,39 +2112,60 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
      {
       binNo = fDiffCorrelationsPro[0][0]->FindBin(dEta); // TBI: hardwired [0][0]
      }
-   // Calculate p-vector components:
-   for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
-   {
-    for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
-    {
-     if(fUseWeights[1][0]||fUseWeights[1][1]||fUseWeights[1][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fpvector[binNo-1][h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
 
-     if(pTrack->InRPSelection()) 
-     {
-      // Fill q-vector components:
-      wPhi = 1.; wPt = 1.; wEta = 1.; wToPowerP = 1.; // TBI this shall go somewhere else, for performance sake
-
-      if(fUseWeights[0][0]){wPhi = Weight(dPhi,"RP","phi");} // corresponding phi weight
-      //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
-      //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
-      if(fUseWeights[0][1]){wPt = Weight(dPt,"RP","pt");} // corresponding pT weight
-      if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
-      if(fUseWeights[1][0]){wPhi = Weight(dPhi,"POI","phi");} // corresponding phi weight
-      //if(dPhi < 0.){dPhi += TMath::TwoPi();} TBI
-      //if(dPhi > TMath::TwoPi()){dPhi -= TMath::TwoPi();} TBI
-      if(fUseWeights[1][1]){wPt = Weight(dPt,"POI","pt");} // corresponding pT weight
-      if(fUseWeights[1][2]){wEta = Weight(dEta,"POI","eta");} // corresponding eta weight
-      if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]||fUseWeights[1][0]||fUseWeights[1][1]||fUseWeights[1][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-      fqvector[binNo-1][h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
-     } // if(pTrack->InRPSelection()) 
-
-    } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
-   } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+   // p-vector, weights for POI:
+   wPhi = 1.; wPt = 1.; wEta = 1.;
+   if(fUseWeights[1][0]){wPhi = Weight(dPhi,"POI","phi");} // corresponding phi weight
+   if(fUseWeights[1][1]){wPt = Weight(dPt,"POI","pt");} // corresponding pT weight
+   if(fUseWeights[1][2]){wEta = Weight(dEta,"POI","eta");} // corresponding eta weight
+   fQvectorKernel->AddParticle(1,dPhi,bUsePOIWeights ? wPhi*wPt*wEta : 1.,binNo-1);
+
+   // q-vector, weights for POI if used, otherwise for RP:
+   if(pTrack->InRPSelection()) 
+   {
+    if(!fUseWeights[1][0]){wPhi = fUseWeights[0][0] ? Weight(dPhi,"RP","phi") : 1.;} // corresponding phi weight
+    if(!fUseWeights[1][1]){wPt = fUseWeights[0][1] ? Weight(dPt,"RP","pt") : 1.;} // corresponding pT weight
+    if(!fUseWeights[1][2]){wEta = fUseWeights[0][2] ? Weight(dEta,"RP","eta") : 1.;} // corresponding eta weight
+    fQvectorKernel->AddParticle(2,dPhi,bUseRPWeights||bUsePOIWeights ? wPhi*wPt*wEta : 1.,binNo-1);
+   } // if(pTrack->InRPSelection()) 
   } // if(pTrack->InPOISelection()) 
 
  } // for(Int_t t=0;t<nTracks;t++) // loop over all tracks
 
+ // Calculate Q-vector components:
+ const Int_t nHarmonics = fMaxHarmonic*fMaxCorrelator+1;
+ const Int_t nPowers = fMaxCorrelator+1;
+ std::vector<Double_t> re(nHarmonics*nPowers,0.), im(nHarmonics*nPowers,0.);
+ fQvectorKernel->Accumulate(0,0,nHarmonics,1,nPowers,1,&re[0],&im[0]);
+ for(Int_t h=0;h<nHarmonics;h++)
+ {
+  for(Int_t wp=0;wp<nPowers;wp++) // weight power
+  {
+   fQvector[h][wp] += TComplex(re[h*nPowers+wp],im[h*nPowers+wp]);
+  }
+ }
+
+ // Calculate p-vector and q-vector components:
+ if(!fCalculateDiffQvectors){return;}
+ for(Int_t pq=1;pq<=2;pq++) // [p-vector,q-vector]
+ {
+  re.assign(100*nHarmonics*nPowers,0.); // TBI hardwired 100 
+  im.assign(100*nHarmonics*nPowers,0.);
+  fQvectorKernel->Accumulate(pq,0,nHarmonics,1,nPowers,100,&re[0],&im[0]);
+  for(Int_t b=0;b<100;b++) // TBI hardwired 100 
+  {
+   for(Int_t h=0;h<nHarmonics;h++)
+   {
+    for(Int_t wp=0;wp<nPowers;wp++) // weight power
+    {
+     Int_t i = (b*nHarmonics+h)*nPowers+wp;
+     if(1==pq){fpvector[b][h][wp] += TComplex(re[i],im[i]);}
+     else{fqvector[b][h][wp] += TComplex(re[i],im[i]);}
+    }
+   }
+  } // for(Int_t b=0;b<100;b++)
+ } // for(Int_t pq=1;pq<=2;pq++) // [p-vector,q-vector]
+
 } // void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimple *anEvent)
 
 //=======================================================================================================================
@@ -2915,10 +2976,64 @@ void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForCorrelations
  } 
  cout<<"    Booked.                                           "<<endl; // TBI 
 
+ // c) Expand all booked correlations into one evaluation plan:
+ if(fUseCorrelatorPlan){this->BookCorrelatorPlan();}
+
 } // end of void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForCorrelations()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithMultiparticleCorrelations::BookCorrelatorPlan()
+{
+ // Expand all booked correlations and their denominators into one AliFlowCorrelatorPlan. The recursion terms
+ // shared between different correlations are then evaluated only once per event in CalculateCorrelations().
+
+ TString sMethodName = "void AliFlowAnalysisWithMultiparticleCorrelations::BookCorrelatorPlan()";
+
+ cout<<" => Building the plan for all booked correlations..."<<endl;
+ delete fCorrelatorPlan;
+ fCorrelatorPlan = new AliFlowCorrelatorPlan(9); // second dimension of fQvector[49][9]
+
+ Int_t zeros[8] = {0,0,0,0,0,0,0,0};
+ for(Int_t co=0;co<8;co++) // [1p,2p,...,8p]
+ {
+  if(!(fCorrelationsPro[0][co] || fCorrelationsPro[1][co])){continue;}
+  fCorrelatorPlanDenominators[co] = fCorrelatorPlan->AddCorrelator(co+1,zeros);
+ }
+
+ Int_t n[8] = {0,0,0,0,0,0,0,0}; // harmonics
+ for(Int_t cs=0;cs<2;cs++) // [0=cos,1=sin]
+ {
+  for(Int_t co=0;co<8;co++) // [1p,2p,...,8p]
+  {
+   fCorrelatorPlanNodes[cs][co].Set(0);
+   if(!fCorrelationsPro[cs][co]){continue;}
+   Int_t nBins = fCorrelationsPro[cs][co]->GetNbinsX();
+   fCorrelatorPlanNodes[cs][co].Set(nBins);
+   Int_t nBooked = 0;
+   for(Int_t b=1;b<=nBins;b++)
+   {
+    TString sBinLabel = fCorrelationsPro[cs][co]->GetXaxis()->GetBinLabel(b);
+    if(sBinLabel.EqualTo("")){break;} 
+    if(co+1 != this->CastStringToHarmonics(sBinLabel.Data(),n))
+    {
+     cout<<Form("And the fatal label is... '%s'. Congratulations!!",sBinLabel.Data())<<endl; 
+     Fatal(sMethodName.Data(),"co+1 != this->CastStringToHarmonics(sBinLabel.Data(),n)");
+    }
+    fCorrelatorPlanNodes[cs][co][b-1] = fCorrelatorPlan->AddCorrelator(co+1,n);
+    nBooked++;
+   } // for(Int_t b=1;b<=nBins;b++)
+   fCorrelatorPlanNodes[cs][co].Set(nBooked);
+  } // for(Int_t co=0;co<8;co++) // [1p,2p,...,8p]
+ } // for(Int_t cs=0;cs<2;cs++) // [0=cos,1=sin]
+
+ fCorrelatorPlan->Print();
+ fCorrelatorPlan->ClearLookupTables();
+
+} // void AliFlowAnalysisWithMultiparticleCorrelations::BookCorrelatorPlan()
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithMultiparticleCorrelations::BookEverythingForDiffCorrelations()
 {
  // Book all the stuff for differential correlations.
@@ -5062,6 +5177,125 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t*
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithMultiparticleCorrelations::BenchmarkCorrelatorPlan(Int_t nEvents, Int_t nParticles)
+{
+ // Micro-benchmark: compare the time per event needed to evaluate all isotropic correlations up to v_{fMaxHarmonic}
+ // (i.e. the standard configuration obtained with SetCalculateIsotropic(kTRUE)) with:
+ //  a) CastStringToCorrelation(...), as done by default in CalculateCorrelations(...) (closed formulas up to 6p),
+ //  b) Recursion(...) for all correlations,
+ //  c) one AliFlowCorrelatorPlan built for all correlations (SetUseCorrelatorPlan(kTRUE)).
+ // The events are random azimuthal angles with unit weights, filled directly into fQvector.
+ // Can be called from the prompt without Init(), e.g. 
+ //  AliFlowAnalysisWithMultiparticleCorrelations mpc; mpc.BenchmarkCorrelatorPlan(10,500);
+
+ TString sMethodName = "void AliFlowAnalysisWithMultiparticleCorrelations::BenchmarkCorrelatorPlan(Int_t nEvents, Int_t nParticles)";
+ if(nEvents<1 || nParticles<8){Fatal(sMethodName.Data(),"nEvents<1 || nParticles<8");}
+ if(fMaxHarmonic>9){Fatal(sMethodName.Data(),"fMaxHarmonic>9");} // the labels support only one-digit harmonics
+
+ TStopwatch timer;
+ Double_t *phi = new Double_t[nParticles];
+ std::complex<Double_t> qvector[49*9];
+
+ cout<<endl;
+ cout<<Form("Benchmark of correlator plan: %d events, %d particles, isotropic correlations up to v%d",nEvents,nParticles,fMaxHarmonic)<<endl;
+ for(Int_t maxCorr=2;maxCorr<=fMaxCorrelator;maxCorr+=2) // standard configurations: up to 2p, 4p, 6p and 8p 
+ {
+  // Book all isotropic correlations with n1<=n2<=...<=nk, as in BookEverythingForCorrelations():
+  std::vector<std::vector<Int_t> > correlations;
+  std::vector<TString> labels;
+  for(Int_t co=2;co<=maxCorr;co++) // [2p,...,maxCorr-p]
+  {
+   std::vector<Int_t> n(co,-fMaxHarmonic);
+   while(kTRUE)
+   {
+    Int_t sum = 0;
+    for(Int_t i=0;i<co;i++){sum += n[i];}
+    if(0==sum)
+    {
+     correlations.push_back(n);
+     TString label = "Cos(";
+     for(Int_t i=0;i<co;i++){label += Form(i<co-1 ? "%d," : "%d)",n[i]);}
+     labels.push_back(label);
+    }
+    Int_t i = co-1;
+    while(i>=0 && n[i]==fMaxHarmonic){i--;}
+    if(i<0){break;}
+    n[i]++;
+    for(Int_t j=i+1;j<co;j++){n[j] = n[i];}
+   } // while(kTRUE)
+  } // for(Int_t co=2;co<=maxCorr;co++) // [2p,...,maxCorr-p]
+  const Int_t nCorrelations = correlations.size();
+
+  // Build the plan:
+  timer.Start(kTRUE);
+  AliFlowCorrelatorPlan plan(9);
+  std::vector<Int_t> nodes(nCorrelations,-1);
+  for(Int_t c=0;c<nCorrelations;c++){nodes[c] = plan.AddCorrelator(correlations[c].size(),&correlations[c][0]);}
+  Int_t zeros[8] = {0,0,0,0,0,0,0,0};
+  for(Int_t co=2;co<=maxCorr;co++){plan.AddCorrelator(co,zeros);}
+  timer.Stop();
+  Double_t dBuildTime = timer.RealTime();
+
+  Double_t dTime[3] = {0.,0.,0.}; // [labels,recursion,plan]
+  Double_t dMaxRelDiff = 0.;
+  for(Int_t e=0;e<nEvents;e++)
+  {
+   for(Int_t p=0;p<nParticles;p++){phi[p] = gRandom->Uniform(0.,TMath::TwoPi());}
+   for(Int_t h=0;h<49;h++)
+   {
+    Double_t dRe = 0., dIm = 0.;
+    for(Int_t p=0;p<nParticles;p++){dRe += TMath::Cos(h*phi[p]); dIm += TMath::Sin(h*phi[p]);}
+    for(Int_t wp=0;wp<9;wp++) // unit weights
+    {
+     fQvector[h][wp] = TComplex(dRe,dIm);
+     qvector[h*9+wp] = std::complex<Double_t>(dRe,dIm);
+    }
+   } // for(Int_t h=0;h<49;h++)
+
+   // a) Default:
+   timer.Start(kTRUE);
+   for(Int_t c=0;c<nCorrelations;c++){CastStringToCorrelation(labels[c].Data(),kTRUE);}
+   timer.Stop();
+   dTime[0] += timer.RealTime();
+
+   // b) Recursion:
+   std::vector<Double_t> recursion(nCorrelations,0.);
+   timer.Start(kTRUE);
+   for(Int_t c=0;c<nCorrelations;c++)
+   {
+    Int_t n[8] = {0,0,0,0,0,0,0,0};
+    for(UInt_t i=0;i<correlations[c].size();i++){n[i] = correlations[c][i];}
+    recursion[c] = Recursion(correlations[c].size(),n).Re();
+   }
+   timer.Stop();
+   dTime[1] += timer.RealTime();
+
+   // c) Plan:
+   timer.Start(kTRUE);
+   plan.Evaluate(qvector);
+   timer.Stop();
+   dTime[2] += timer.RealTime();
+
+   for(Int_t c=0;c<nCorrelations;c++)
+   {
+    Double_t dRelDiff = TMath::Abs(plan.Value(nodes[c]).real()-recursion[c])/TMath::Max(1.,TMath::Abs(recursion[c]));
+    if(dRelDiff > dMaxRelDiff){dMaxRelDiff = dRelDiff;}
+   }
+  } // for(Int_t e=0;e<nEvents;e++)
+
+  cout<<Form(" up to %dp: %d correlations, %d plan nodes (built in %.3f s)",maxCorr,nCorrelations,plan.GetNumberOfNodes(),dBuildTime)<<endl;
+  cout<<Form("   time per event: default %.4f s, recursion %.4f s, plan %.4f s (speed-up %.1f w.r.t. recursion), max. rel. difference %.2e",
+             dTime[0]/nEvents,dTime[1]/nEvents,dTime[2]/nEvents,dTime[2]>0. ? dTime[1]/dTime[2] : 0.,dMaxRelDiff)<<endl;
+ } // for(Int_t maxCorr=2;maxCorr<=fMaxCorrelator;maxCorr+=2)
+ cout<<endl;
+
+ delete [] phi;
+ this->ResetQvector();
+
+} // void AliFlowAnalysisWithMultiparticleCorrelations::BenchmarkCorrelatorPlan(Int_t nEvents, Int_t nParticles)
+
+//=======================================================================================================================
+
 TComplex AliFlowAnalysisWithMultiparticleCorrelations::OneDiff(Int_t n1)
 {
  // Generic differential one-particle correlation <exp[i(n1*psi1)]>.
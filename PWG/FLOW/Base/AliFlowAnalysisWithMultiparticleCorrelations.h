@@ -30,6 +30,8 @@
 #include "TStopwatch.h"
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
+#include "AliFlowCorrelatorPlan.h"
+#include "AliFlowQvectorKernel.h"
 
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
@@ -66,6 +68,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
    virtual void BookEverythingForQvector();
    virtual void BookEverythingForWeights();
    virtual void BookEverythingForCorrelations();
+    virtual void BookCorrelatorPlan();
    virtual void BookEverythingForEbECumulants();
    virtual void BookEverythingForNestedLoops();
    virtual void BookEverythingForStandardCandles();
@@ -189,6 +192,9 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t GetCalculateOnlyCos() const {return this->fCalculateOnlyCos;};
   void SetCalculateOnlySin(Bool_t cos) {this->fCalculateOnlySin = cos;};
   Bool_t GetCalculateOnlySin() const {return this->fCalculateOnlySin;};
+  void SetUseCorrelatorPlan(Bool_t ucp) {this->fUseCorrelatorPlan = ucp;};
+  Bool_t GetUseCorrelatorPlan() const {return this->fUseCorrelatorPlan;};
+  AliFlowCorrelatorPlan* GetCorrelatorPlan() const {return this->fCorrelatorPlan;};
 
   //  5.4.) Event-by-event cumulants:
   void SetEbECumulantsList(TList* const ebecl) {this->fEbECumulantsList = ebecl;};
@@ -314,8 +320,10 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   virtual TComplex FourDiff(Int_t n1, Int_t n2, Int_t n3, Int_t n4);
   virtual Double_t Weight(const Double_t &value, const char *type, const char *variable); // value, [RP,POI], [phi,pt,eta]
   virtual Double_t CastStringToCorrelation(const char *string, Bool_t numerator);
+  virtual Int_t CastStringToHarmonics(const char *string, Int_t *n);
   virtual Double_t Covariance(const char *x, const char *y, TProfile2D *profile2D, Bool_t bUnbiasedEstimator = kFALSE);
   virtual TComplex Recursion(Int_t n, Int_t* harmonic, Int_t mult = 1, Int_t skip = 0); // Credits: Kristjan Gulbrandsen (gulbrand@nbi.dk) 
+  virtual void BenchmarkCorrelatorPlan(Int_t nEvents = 100, Int_t nParticles = 500);
   virtual void CalculateProductsOfCorrelations(AliFlowEventSimple *anEvent, TProfile2D *profile2D);
   static void DumpPointsForDurham(TGraphErrors *ge);
   static void DumpPointsForDurham(TH1D *h);
@@ -386,6 +394,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateDiffQvectors; // to calculate or not to calculate p- and q-vector components, that's a Boolean...  
   TComplex fpvector[100][49][9]; // p-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
   TComplex fqvector[100][49][9]; // q-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
+  AliFlowQvectorKernel *fQvectorKernel; //! particles of the current event for the calculation of Q-, p- and q-vector components
 
   // 3.) Correlations:
   TList *fCorrelationsList;           // list to hold all correlations objects
@@ -404,6 +413,10 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateOnlyForSC;         // calculate only correlations needed for 'standard candles'
   Bool_t fCalculateOnlyCos;           // calculate only 'cos' correlations
   Bool_t fCalculateOnlySin;           // calculate only 'sin' correlations
+  Bool_t fUseCorrelatorPlan;          // evaluate all booked correlations with one precomputed plan instead of the recursion
+  AliFlowCorrelatorPlan *fCorrelatorPlan; //! plan for all booked correlations, built in Init()
+  TArrayI fCorrelatorPlanNodes[2][8];     //! plan nodes of the booked correlations [0=cos,1=sin][1p,2p,...,8p][bin-1]
+  Int_t fCorrelatorPlanDenominators[8];   //! plan nodes of the denominators [1p,2p,...,8p]
 
   // 4.) Event-by-event cumulants:
   TList *fEbECumulantsList;         // list to hold all e-b-e cumulants objects
@@ -477,7 +490,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Int_t fHighestHarmonicEtaGaps;      // 2-p correlations with eta gaps will be calculated for harmonics [fLowestHarmonicEtaGaps,fHighestHarmonicEtaGaps]
   TProfile *fEtaGapsPro[6];           // [harmonic] different eta gaps are different bins
 
-  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,6);
+  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,8);
 
 };
 
@@ -43,6 +43,7 @@
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisWithQCumulants.h"
+#include "AliFlowQvectorKernel.h"
 #include "TArrayD.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -137,6 +138,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fReQ(NULL),
  fImQ(NULL),
  fSpk(NULL),
+ fQvectorKernel(NULL),
  fIntFlowCorrelationsEBE(NULL),
  fIntFlowEventWeightsForCorrelationsEBE(NULL),
  fIntFlowCorrelationsAllEBE(NULL),
@@ -271,6 +273,7 @@ AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
  // destructor
  
  delete fHistList;
+ delete fQvectorKernel;
 
 } // end of AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
 
@@ -368,7 +371,6 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fNumberOfPOIsEBE = anEvent->GetNumberOfPOIs(); // number of POIs (i.e. number of particles of interest)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
- Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -376,9 +378,12 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  if(fStoreControlHistograms){this->FillControlHistograms(anEvent);}                                                              
                                                                                                                                                                                                                                                                                         
  // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
+ //    The loop over data only selects the particles and determines their weights, all Q-vector components are
+ //    then calculated in one pass over the collected particles, see FillQvectorComponents().
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
- Int_t n = fHarmonic; // shortcut for the harmonic 
+ if(!fQvectorKernel){fQvectorKernel = new AliFlowQvectorKernel(10);} // [0 = integrated][1+3*t+d: t = RP,POI,RP&&POI; d = pt,eta,(pt,eta)]
+ fQvectorKernel->Clear();
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
@@ -409,87 +414,18 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
-    // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
-    {
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
-     } 
-    }
-    // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
+    // Collect the particle for Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} (calculated in e) below):
+    fQvectorKernel->AddParticle(0,dPhi,wPhi*wPt*wEta*wTrack);
     // Differential flow:
     if(fCalculateDiffFlow || fCalculate2DDiffFlow)
     {
-     ptEta[0] = dPt; 
-     ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      {
-       if(fCalculateDiffFlow)
-       {
-        for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-        {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-       } // end of if(fCalculateDiffFlow) 
-       if(fCalculate2DDiffFlow)
-       {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-        if(m==0) // s_{p,k} does not depend on index m
-        {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-        } // end of if(m==0) // s_{p,k} does not depend on index m
-       } // end of if(fCalculate2DDiffFlow)
-      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     // r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
+     this->AddDiffFlowParticle(0,dPhi,dPt,dEta,wPhi*wPt*wEta*wTrack);
      // Checking if RP particle is also POI particle:      
      if(aftsTrack->InPOISelection())
      {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
-      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-      {
-       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-       {
-        if(fCalculateDiffFlow)
-        {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
-        {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
-       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+      // q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
+      this->AddDiffFlowParticle(2,dPhi,dPt,dEta,wPhi*wPt*wEta*wTrack);
      } // end of if(aftsTrack->InPOISelection())  
     } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
    } // end of if(pTrack->InRPSelection())
@@ -519,28 +455,8 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
-    ptEta[0] = dPt;
-    ptEta[1] = dEta;
-    // Calculate p_{m*n,k} ('p-vector' for POIs): 
-    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-    {
-     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     {
-      if(fCalculateDiffFlow)
-      {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
-      {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+    // p_{m*n,k} ('p-vector' for POIs): 
+    this->AddDiffFlowParticle(1,dPhi,dPt,dEta,wPhi*wPt*wEta*wTrack);
    } // end of if(pTrack->InPOISelection())    
   } else // to if(aftsTrack)
     {
@@ -549,6 +465,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+ this->FillQvectorComponents();
  for(Int_t p=0;p<8;p++)
  {
   for(Int_t k=0;k<9;k++)
@@ -700,6 +617,127 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithQCumulants::AddDiffFlowParticle(Int_t t, Double_t dPhi, Double_t dPt, Double_t dEta, Double_t wParticle)
+{
+ // Add particle of type t (0 = RP, 1 = POI, 2 = RP && POI) to the sets of fQvectorKernel for differential flow 
+ // vs pt, eta and (pt,eta). The bins are the global bins of the e-b-e profiles filled in FillQvectorComponents().
+ 
+ if(fCalculateDiffFlow)
+ {
+  Double_t ptEta[2] = {dPt,dEta}; // 0 = dPt, 1 = dEta
+  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+  {
+   fQvectorKernel->AddParticle(1+3*t+pe,dPhi,wParticle,fReRPQ1dEBE[t][pe][0][0]->FindBin(ptEta[pe]));
+  }
+ }
+ if(fCalculate2DDiffFlow)
+ {
+  fQvectorKernel->AddParticle(1+3*t+2,dPhi,wParticle,fReRPQ2dEBE[t][0][0]->FindBin(dPt,dEta));
+ }
+ 
+} // end of void AliFlowAnalysisWithQCumulants::AddDiffFlowParticle(Int_t t, Double_t dPhi, Double_t dPt, Double_t dEta, Double_t wParticle)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::FillQvectorComponents()
+{
+ // From the particles collected in fQvectorKernel calculate Re[Q_{m*n,k}], Im[Q_{m*n,k}] (m = 1,2,...,12, k = 0,1,...,8) 
+ // and S_{p,k} (not yet raised to the power p+1) for reference flow, and r_{m*n,k}, p_{m*n,k}, q_{m*n,k} (m = 1,...,4)
+ // and s_{p,k} for differential flow. All harmonics and powers of weights are obtained in one pass over the particles.
+ // Each bin of the e-b-e profiles is filled once with the sum over its particles divided by their number and with
+ // weight equal to their number, which gives the same GetBinContent()*GetBinEntries() as filling particle by particle.
+ 
+ Int_t n = fHarmonic; // shortcut for the harmonic
+ 
+ // Reference flow, harmonics 0,n,2n,...,12n:
+ Double_t reQ[13*9] = {0.};
+ Double_t imQ[13*9] = {0.};
+ fQvectorKernel->Accumulate(0,0,13,n,9,1,reQ,imQ);
+ for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
+ {
+  for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+  {
+   (*fReQ)(m,k) += reQ[(m+1)*9+k];
+   (*fImQ)(m,k) += imQ[(m+1)*9+k];
+  }
+ }
+ // S_{p,k}: harmonic 0 gives sum_{i} w_{i}^{k}:
+ for(Int_t p=0;p<8;p++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {     
+   (*fSpk)(p,k) += reQ[k];
+  }
+ } 
+ 
+ // Differential flow, harmonics 0,n,...,4n:
+ if(!(fCalculateDiffFlow || fCalculate2DDiffFlow)){return;}
+ for(Int_t t=0;t<3;t++) // type (0 = RP, 1 = POI, 2 = RP && POI)
+ {
+  for(Int_t d=0;d<3;d++) // 0 = pt, 1 = eta, 2 = (pt,eta)
+  {
+   if(d<2 && !(fCalculateDiffFlow && d<1+(Int_t)fCalculateDiffFlowVsEta)){continue;}
+   if(2==d && !fCalculate2DDiffFlow){continue;}
+   Int_t set = 1+3*t+d;
+   if(0==fQvectorKernel->GetNumberOfParticles(set)){continue;}
+   Int_t nCells = (d<2 ? fReRPQ1dEBE[t][d][0][0]->GetNcells() : fReRPQ2dEBE[t][0][0]->GetNcells());
+   std::vector<Double_t> re(nCells*5*9,0.);
+   std::vector<Double_t> im(nCells*5*9,0.);
+   std::vector<Double_t> counts(nCells,0.);
+   fQvectorKernel->Accumulate(set,0,5,n,9,nCells,&re[0],&im[0],&counts[0]);
+   for(Int_t b=0;b<nCells;b++)
+   {
+    if(counts[b]<=0.){continue;}
+    Double_t *reBin = &re[b*5*9];
+    Double_t *imBin = &im[b*5*9];
+    if(d<2)
+    {
+     Double_t x = fReRPQ1dEBE[t][d][0][0]->GetXaxis()->GetBinCenter(b);
+     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+     {
+      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+      {
+       fReRPQ1dEBE[t][d][m][k]->Fill(x,reBin[(m+1)*9+k]/counts[b],counts[b]);
+       fImRPQ1dEBE[t][d][m][k]->Fill(x,imBin[(m+1)*9+k]/counts[b],counts[b]);
+      }
+     }
+     if(1!=t) // s_{p,k} is not needed for POIs
+     {
+      for(Int_t k=0;k<9;k++)
+      {
+       fs1dEBE[t][d][k]->Fill(x,reBin[k]/counts[b],counts[b]);
+      }
+     }
+    } else
+      {
+       Int_t binX = 0, binY = 0, binZ = 0;
+       fReRPQ2dEBE[t][0][0]->GetBinXYZ(b,binX,binY,binZ);
+       Double_t x = fReRPQ2dEBE[t][0][0]->GetXaxis()->GetBinCenter(binX);
+       Double_t y = fReRPQ2dEBE[t][0][0]->GetYaxis()->GetBinCenter(binY);
+       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+       {
+        for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+        {
+         fReRPQ2dEBE[t][m][k]->Fill(x,y,reBin[(m+1)*9+k]/counts[b],counts[b]);
+         fImRPQ2dEBE[t][m][k]->Fill(x,y,imBin[(m+1)*9+k]/counts[b],counts[b]);
+        }
+       }
+       if(1!=t) // s_{p,k} is not needed for POIs
+       {
+        for(Int_t k=0;k<9;k++)
+        {
+         fs2dEBE[t][k]->Fill(x,y,reBin[k]/counts[b],counts[b]);
+        }
+       }
+      }
+   } // end of for(Int_t b=0;b<nCells;b++)
+  } // end of for(Int_t d=0;d<3;d++)
+ } // end of for(Int_t t=0;t<3;t++)
+ 
+} // end of void AliFlowAnalysisWithQCumulants::FillQvectorComponents()
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::Finish()
 {
  // Calculate the final results.
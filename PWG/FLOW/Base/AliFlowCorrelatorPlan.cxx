@@ -0,0 +1,186 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+ /************************************
+ * precomputed evaluation plan for   *
+ * multi-particle correlators        *
+ * obtained from Q-vector components *
+ ************************************/
+
+#include "AliFlowCorrelatorPlan.h"
+
+#include "Riostream.h"
+#include "TString.h"
+
+using std::endl;
+using std::cout;
+
+//================================================================================================================
+
+AliFlowCorrelatorPlan::AliFlowCorrelatorPlan(Int_t maxPower):
+ fMaxPower(maxPower),
+ fNumberOfCorrelators(0),
+ fNodes(),
+ fValues(),
+ fNodeIndex(),
+ fRecursions()
+{
+ // Constructor. 'maxPower' is the number of powers of the particle weights stored per harmonic
+ // in the Q-vector array passed to Evaluate().
+
+} // AliFlowCorrelatorPlan::AliFlowCorrelatorPlan(Int_t maxPower)
+
+//================================================================================================================
+
+bool AliFlowCorrelatorPlan::Node::operator<(const Node &other) const
+{
+ // Strict weak ordering, used only to find identical operations.
+
+ if(fOperation != other.fOperation){return fOperation < other.fOperation;}
+ if(fA != other.fA){return fA < other.fA;}
+ if(fB != other.fB){return fB < other.fB;}
+ return fC < other.fC;
+
+} // bool AliFlowCorrelatorPlan::Node::operator<(const Node &other) const
+
+//================================================================================================================
+
+void AliFlowCorrelatorPlan::Clear()
+{
+ // Remove all correlators.
+
+ fNumberOfCorrelators = 0;
+ fNodes.clear();
+ fValues.clear();
+ fNodeIndex.clear();
+ fRecursions.clear();
+
+} // void AliFlowCorrelatorPlan::Clear()
+
+//================================================================================================================
+
+void AliFlowCorrelatorPlan::ClearLookupTables()
+{
+ // The lookup tables are needed only while correlators are added. Correlators added afterwards are still
+ // correct, but do not share terms with the ones added before.
+
+ std::map<Node,Int_t>().swap(fNodeIndex);
+ std::map<std::vector<Int_t>,Int_t>().swap(fRecursions);
+
+} // void AliFlowCorrelatorPlan::ClearLookupTables()
+
+//================================================================================================================
+
+Int_t AliFlowCorrelatorPlan::AddCorrelator(Int_t n, const Int_t *harmonic)
+{
+ // Add the n-particle correlator with harmonics harmonic[0],...,harmonic[n-1] to the plan and return the node
+ // holding its value after Evaluate(). Adding the same correlator again returns the same node.
+
+ std::vector<Int_t> h(harmonic,harmonic+n);
+ fNumberOfCorrelators++;
+ Int_t node = Recursion(n,&h[0]);
+ fValues.resize(fNodes.size());
+ return node;
+
+} // Int_t AliFlowCorrelatorPlan::AddCorrelator(Int_t n, const Int_t *harmonic)
+
+//================================================================================================================
+
+Int_t AliFlowCorrelatorPlan::AddNode(Int_t operation, Int_t a, Int_t b, Double_t c)
+{
+ // Return the index of the node for this operation, appending it if it is not yet in the plan.
+ // Multiplication and addition are commutative, the operands are sorted to catch more duplicates.
+
+ if((kMultiply == operation || kAdd == operation) && b < a){Int_t t = a; a = b; b = t;}
+
+ Node node;
+ node.fOperation = operation;
+ node.fA = a;
+ node.fB = b;
+ node.fC = c;
+
+ std::map<Node,Int_t>::const_iterator it = fNodeIndex.find(node);
+ if(it != fNodeIndex.end()){return it->second;}
+
+ Int_t index = fNodes.size();
+ fNodes.push_back(node);
+ fNodeIndex[node] = index;
+ return index;
+
+} // Int_t AliFlowCorrelatorPlan::AddNode(Int_t operation, Int_t a, Int_t b, Double_t c)
+
+//================================================================================================================
+
+Int_t AliFlowCorrelatorPlan::Recursion(Int_t n, Int_t *harmonic, Int_t mult, Int_t skip)
+{
+ // Same structure as AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t* harmonic, Int_t mult, Int_t skip),
+ // but recording the operations instead of performing them. The result of each distinct call is remembered.
+
+ std::vector<Int_t> key(harmonic,harmonic+n);
+ key.push_back(mult);
+ key.push_back(skip);
+ std::map<std::vector<Int_t>,Int_t>::const_iterator it = fRecursions.find(key);
+ if(it != fRecursions.end()){return it->second;}
+
+ Int_t nm1 = n-1;
+ Int_t h = harmonic[nm1];
+ Int_t c = h >= 0 ? AddNode(kQ,h*fMaxPower+mult) : AddNode(kConjQ,-h*fMaxPower+mult);
+ if(nm1 > 0)
+ {
+  c = AddNode(kMultiply,c,Recursion(nm1,harmonic));
+  if(nm1 != skip)
+  {
+   Int_t multp1 = mult+1;
+   Int_t nm2 = n-2;
+   Int_t counter1 = 0;
+   Int_t hhold = harmonic[counter1];
+   harmonic[counter1] = harmonic[nm2];
+   harmonic[nm2] = hhold + harmonic[nm1];
+   Int_t c2 = Recursion(nm1,harmonic,multp1,nm2);
+   Int_t counter2 = n-3;
+   while(counter2 >= skip)
+   {
+    harmonic[nm2] = harmonic[counter1];
+    harmonic[counter1] = hhold;
+    ++counter1;
+    hhold = harmonic[counter1];
+    harmonic[counter1] = harmonic[nm2];
+    harmonic[nm2] = hhold + harmonic[nm1];
+    c2 = AddNode(kAdd,c2,Recursion(nm1,harmonic,multp1,counter2));
+    --counter2;
+   }
+   harmonic[nm2] = harmonic[counter1];
+   harmonic[counter1] = hhold;
+   c = AddNode(kSubtract,c,c2,Double_t(mult));
+  } // if(nm1 != skip)
+ } // if(nm1 > 0)
+
+ fRecursions[key] = c;
+ return c;
+
+} // Int_t AliFlowCorrelatorPlan::Recursion(Int_t n, Int_t *harmonic, Int_t mult, Int_t skip)
+
+//================================================================================================================
+
+void AliFlowCorrelatorPlan::Print() const
+{
+ // Print the size of the plan.
+
+ Int_t nOperations[5] = {0,0,0,0,0};
+ for(UInt_t i=0;i<fNodes.size();i++){nOperations[fNodes[i].fOperation]++;}
+ cout<<Form("AliFlowCorrelatorPlan: %d correlators, %d nodes (%d Q-vector components, %d multiplications, %d additions, %d subtractions), %d distinct recursion calls",
+            fNumberOfCorrelators,GetNumberOfNodes(),nOperations[kQ]+nOperations[kConjQ],nOperations[kMultiply],nOperations[kAdd],nOperations[kSubtract],(Int_t)fRecursions.size())<<endl;
+
+} // void AliFlowCorrelatorPlan::Print() const
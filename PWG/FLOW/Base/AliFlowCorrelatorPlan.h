@@ -0,0 +1,96 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+ /************************************
+ * precomputed evaluation plan for   *
+ * multi-particle correlators        *
+ * obtained from Q-vector components *
+ ************************************/
+
+#ifndef ALIFLOWCORRELATORPLAN_H
+#define ALIFLOWCORRELATORPLAN_H
+
+#include <complex>
+#include <map>
+#include <vector>
+
+#include "Rtypes.h"
+
+// The generic multi-particle correlator <exp[i(n1*phi1+...+nk*phik)]> (numerator, i.e. not yet divided by the
+// number of combinations) is expanded with the same recursion as AliFlowAnalysisWithMultiparticleCorrelations::Recursion()
+// (credits: Kristjan Gulbrandsen), but instead of being evaluated it is recorded as a list of elementary operations
+// on Q-vector components. Identical sub-expressions, both between the terms of one correlator and between different
+// correlators, are stored only once, so that the whole set of booked correlators forms one evaluation graph.
+// The graph is built once (at Init), and then in each event Evaluate() runs through the operations in order,
+// every operation being executed exactly once.
+
+class AliFlowCorrelatorPlan
+{
+ public:
+  AliFlowCorrelatorPlan(Int_t maxPower = 9);
+  virtual ~AliFlowCorrelatorPlan() {};
+
+  // Building:
+  Int_t AddCorrelator(Int_t n, const Int_t *harmonic); // returns the node holding the correlator
+  void Clear();
+  void ClearLookupTables(); // free the memory used for the de-duplication once all correlators are added
+
+  // Evaluation:
+  void Evaluate(const std::complex<Double_t> *qvector); // Q_{h,p} = qvector[h*maxPower+p], h,p >= 0
+  const std::complex<Double_t>& Value(Int_t node) const {return fValues[node];};
+
+  // Bookkeeping:
+  Int_t GetMaxPower() const {return fMaxPower;};
+  Int_t GetNumberOfNodes() const {return (Int_t)fNodes.size();};
+  Int_t GetNumberOfCorrelators() const {return fNumberOfCorrelators;};
+  void Print() const;
+
+ private:
+  enum EOperation {kQ, kConjQ, kMultiply, kAdd, kSubtract};
+
+  struct Node
+  {
+   Int_t fOperation; // EOperation
+   Int_t fA;         // kQ, kConjQ: index in the Q-vector array; otherwise: first operand
+   Int_t fB;         // second operand
+   Double_t fC;      // kSubtract: fA - fC*fB
+   bool operator<(const Node &other) const; // ordering for the de-duplication
+  };
+
+  Int_t AddNode(Int_t operation, Int_t a, Int_t b = -1, Double_t c = 1.);
+  Int_t Recursion(Int_t n, Int_t *harmonic, Int_t mult = 1, Int_t skip = 0);
+
+  Int_t fMaxPower;                                 // second dimension of the Q-vector array
+  Int_t fNumberOfCorrelators;                      // number of calls to AddCorrelator()
+  std::vector<Node> fNodes;                        // operations, every operand precedes its users
+  std::vector<std::complex<Double_t> > fValues;    // values of the nodes in the current event
+  std::map<Node,Int_t> fNodeIndex;                 // node -> index, de-duplicates the operations
+  std::map<std::vector<Int_t>,Int_t> fRecursions;  // (harmonics,mult,skip) -> index, de-duplicates the recursion calls
+};
+
+//================================================================================================================
+
+inline void AliFlowCorrelatorPlan::Evaluate(const std::complex<Double_t> *qvector)
+{
+ // Evaluate all nodes for the Q-vector components of the current event.
+
+ const Int_t nNodes = fNodes.size();
+ for(Int_t i=0;i<nNodes;i++)
+ {
+  const Node &node = fNodes[i];
+  switch(node.fOperation)
+  {
+   case kQ: fValues[i] = qvector[node.fA]; break;
+   case kConjQ: fValues[i] = std::conj(qvector[node.fA]); break;
+   case kMultiply: fValues[i] = fValues[node.fA]*fValues[node.fB]; break;
+   case kAdd: fValues[i] = fValues[node.fA]+fValues[node.fB]; break;
+   case kSubtract: fValues[i] = fValues[node.fA]-node.fC*fValues[node.fB]; break;
+  }
+ }
+
+} // inline void AliFlowCorrelatorPlan::Evaluate(const std::complex<Double_t> *qvector)
+
+#endif
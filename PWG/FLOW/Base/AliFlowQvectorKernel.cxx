@@ -0,0 +1,157 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+ /************************************
+ * Q-vector components for many      *
+ * harmonics and weight powers in    *
+ * one pass over the particles       *
+ ************************************/
+
+#include "AliFlowQvectorKernel.h"
+
+#include <algorithm>
+#include <cmath>
+
+//================================================================================================================
+
+AliFlowQvectorKernel::AliFlowQvectorKernel(Int_t nSets):
+ fSets(nSets),
+ fPowers()
+{
+ // Constructor.
+
+} // AliFlowQvectorKernel::AliFlowQvectorKernel(Int_t nSets)
+
+//================================================================================================================
+
+void AliFlowQvectorKernel::SetNumberOfSets(Int_t nSets)
+{
+ // Set the number of particle sets, the sets are cleared.
+
+ fSets.resize(nSets);
+ Clear();
+
+} // void AliFlowQvectorKernel::SetNumberOfSets(Int_t nSets)
+
+//================================================================================================================
+
+void AliFlowQvectorKernel::Clear()
+{
+ // Remove the particles of all sets, call it at the beginning of each event.
+
+ for(UInt_t s=0;s<fSets.size();s++)
+ {
+  fSets[s].fPhi.clear();
+  fSets[s].fWeight.clear();
+  fSets[s].fBin.clear();
+ }
+
+} // void AliFlowQvectorKernel::Clear()
+
+//================================================================================================================
+
+void AliFlowQvectorKernel::Accumulate(Int_t set, Int_t firstHarmonic, Int_t nHarmonics, Int_t harmonicStep, Int_t nPowers,
+                                      Int_t nBins, Double_t *re, Double_t *im, Double_t *counts)
+{
+ // Add the Q-vector components of the particles of the set to re and im, see the header for the layout.
+
+ const ParticleSet &particles = fSets[set];
+ const Int_t nParticles = particles.fPhi.size();
+ const Int_t nHP = nHarmonics*nPowers;
+ fPowers.resize(nPowers*kBlockSize);
+ Double_t *wk = &fPowers[0];
+
+ Double_t cosStep[kBlockSize], sinStep[kBlockSize]; // exp(i*step*phi)
+ Double_t c[kBlockSize], s[kBlockSize];             // exp(i*n*phi) for the current harmonic
+ Int_t bin[kBlockSize];
+
+ for(Int_t first=0;first<nParticles;first+=kBlockSize)
+ {
+  const Int_t n = std::min((Int_t)kBlockSize,nParticles-first);
+  const Double_t *phi = &particles.fPhi[first];
+  const Double_t *w = &particles.fWeight[first];
+
+  // Per particle: angles and weight powers.
+  for(Int_t j=0;j<n;j++)
+  {
+   cosStep[j] = std::cos(harmonicStep*phi[j]);
+   sinStep[j] = std::sin(harmonicStep*phi[j]);
+   wk[j] = 1.;
+  }
+  for(Int_t k=1;k<nPowers;k++)
+  {
+   for(Int_t j=0;j<n;j++){wk[k*kBlockSize+j] = wk[(k-1)*kBlockSize+j]*w[j];}
+  }
+  if(0 == firstHarmonic)
+  {
+   for(Int_t j=0;j<n;j++){c[j] = 1.; s[j] = 0.;}
+  } else if(1 == firstHarmonic)
+    {
+     for(Int_t j=0;j<n;j++){c[j] = cosStep[j]; s[j] = sinStep[j];}
+    } else
+      {
+       for(Int_t j=0;j<n;j++){c[j] = std::cos(firstHarmonic*harmonicStep*phi[j]); s[j] = std::sin(firstHarmonic*harmonicStep*phi[j]);}
+      }
+
+  // Bins, particles outside the range are switched off via their bin:
+  Bool_t bSingleBin = kTRUE;
+  for(Int_t j=0;j<n;j++)
+  {
+   bin[j] = particles.fBin[first+j];
+   if(bin[j] < 0 || bin[j] >= nBins){bin[j] = -1;}
+   if(bin[j] != 0){bSingleBin = kFALSE;}
+  }
+  if(counts)
+  {
+   for(Int_t j=0;j<n;j++){if(bin[j] >= 0){counts[bin[j]] += 1.;}}
+  }
+
+  for(Int_t h=0;h<nHarmonics;h++)
+  {
+   if(bSingleBin) // all particles in bin 0: plain reductions
+   {
+    for(Int_t k=0;k<nPowers;k++)
+    {
+     const Double_t *wkk = wk+k*kBlockSize;
+     Double_t sumRe = 0., sumIm = 0.;
+     for(Int_t j=0;j<n;j++){sumRe += wkk[j]*c[j]; sumIm += wkk[j]*s[j];}
+     re[h*nPowers+k] += sumRe;
+     im[h*nPowers+k] += sumIm;
+    }
+   } else
+     {
+      for(Int_t j=0;j<n;j++)
+      {
+       if(bin[j] < 0){continue;}
+       Double_t *reBin = re + bin[j]*nHP + h*nPowers;
+       Double_t *imBin = im + bin[j]*nHP + h*nPowers;
+       for(Int_t k=0;k<nPowers;k++)
+       {
+        reBin[k] += wk[k*kBlockSize+j]*c[j];
+        imBin[k] += wk[k*kBlockSize+j]*s[j];
+       }
+      }
+     }
+   // Next harmonic:
+   for(Int_t j=0;j<n;j++)
+   {
+    const Double_t cNext = c[j]*cosStep[j] - s[j]*sinStep[j];
+    s[j] = s[j]*cosStep[j] + c[j]*sinStep[j];
+    c[j] = cNext;
+   }
+  } // for(Int_t h=0;h<nHarmonics;h++)
+ } // for(Int_t first=0;first<nParticles;first+=kBlockSize)
+
+} // void AliFlowQvectorKernel::Accumulate(...)
@@ -0,0 +1,79 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+ /************************************
+ * Q-vector components for many      *
+ * harmonics and weight powers in    *
+ * one pass over the particles       *
+ ************************************/
+
+#ifndef ALIFLOWQVECTORKERNEL_H
+#define ALIFLOWQVECTORKERNEL_H
+
+#include <vector>
+
+#include "Rtypes.h"
+
+// Shared by AliFlowAnalysisWithQCumulants, AliFlowAnalysisCRC and AliFlowAnalysisWithMultiparticleCorrelations.
+//
+// The analysis loops over the tracks of AliFlowEventSimple only once to select the particles and to determine
+// their weights, and adds them with AddParticle() to one or more particle sets (e.g. RPs, POIs, RPs&&POIs,
+// each one with its own binning in pt or eta). The azimuthal angles, weights and bins are kept in contiguous
+// arrays. Accumulate() then calculates for one set all the components
+//
+//   Q_{n,k}(bin) = sum_{particles in bin} w^k exp(i*n*phi),   n = (first + h)*step, h = 0,...,nHarmonics-1, k = 0,...,nPowers-1
+//
+// in a single pass: cos and sin are evaluated once per particle, the higher harmonics follow by the angle
+// recurrence exp(i*(n+step)*phi) = exp(i*n*phi)*exp(i*step*phi), and the weight powers by repeated
+// multiplication. The particles are processed in blocks, with the innermost loops running over the particles
+// of a block, so that the compiler can vectorize them.
+
+class AliFlowQvectorKernel
+{
+ public:
+  AliFlowQvectorKernel(Int_t nSets = 1);
+  virtual ~AliFlowQvectorKernel() {};
+
+  void SetNumberOfSets(Int_t nSets);
+  Int_t GetNumberOfSets() const {return (Int_t)fSets.size();};
+
+  void Clear(); // remove the particles of all sets, the allocated memory is kept
+  void AddParticle(Int_t set, Double_t phi, Double_t weight = 1., Int_t bin = 0);
+  Int_t GetNumberOfParticles(Int_t set) const {return (Int_t)fSets[set].fPhi.size();};
+
+  // re, im: [nBins][nHarmonics][nPowers], counts (optional): [nBins] number of particles; particles with bin
+  // outside [0,nBins) are skipped. The results are added to the content of the arrays.
+  void Accumulate(Int_t set, Int_t firstHarmonic, Int_t nHarmonics, Int_t harmonicStep, Int_t nPowers,
+                  Int_t nBins, Double_t *re, Double_t *im, Double_t *counts = NULL);
+
+  enum {kBlockSize = 64};
+
+ private:
+  struct ParticleSet
+  {
+   std::vector<Double_t> fPhi;    // azimuthal angles
+   std::vector<Double_t> fWeight; // particle weights
+   std::vector<Int_t> fBin;       // bins
+  };
+
+  std::vector<ParticleSet> fSets;  // particle sets
+  std::vector<Double_t> fPowers;   // scratch: weight powers of one block [power][particle]
+};
+
+//================================================================================================================
+
+inline void AliFlowQvectorKernel::AddParticle(Int_t set, Double_t phi, Double_t weight, Int_t bin)
+{
+ // Add a particle to the set.
+
+ ParticleSet &particles = fSets[set];
+ particles.fPhi.push_back(phi);
+ particles.fWeight.push_back(weight);
+ particles.fBin.push_back(bin);
+
+} // inline void AliFlowQvectorKernel::AddParticle(Int_t set, Double_t phi, Double_t weight, Int_t bin)
+
+#endif
@@ -64,7 +64,9 @@ AliEmcalJet::AliEmcalJet() :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentArena(nullptr),
+  fConstituentArenaSlice(-1)
 {
   fClosestJets[0] = 0;
   fClosestJets[1] = 0;
@@ -116,7 +118,9 @@ AliEmcalJet::AliEmcalJet(Double_t px, Double_t py, Double_t pz) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentArena(nullptr),
+  fConstituentArenaSlice(-1)
 {
   if (fPt != 0) {
     fPhi = TVector2::Phi_0_2pi(TMath::ATan2(py, px));
@@ -173,7 +177,9 @@ AliEmcalJet::AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentArena(nullptr),
+  fConstituentArenaSlice(-1)
 {
   fPhi = TVector2::Phi_0_2pi(fPhi);
 
@@ -224,7 +230,9 @@ AliEmcalJet::AliEmcalJet(const AliEmcalJet& jet) :
   fJetShapeProperties(0),
   fJetAcceptanceType(jet.fJetAcceptanceType),
   fParticleConstituents(jet.fParticleConstituents),
-  fClusterConstituents(jet.fClusterConstituents)
+  fClusterConstituents(jet.fClusterConstituents),
+  fConstituentArena(nullptr),
+  fConstituentArenaSlice(-1)
 
 {
   // Copy constructor.
@@ -296,6 +304,9 @@ AliEmcalJet& AliEmcalJet::operator=(const AliEmcalJet& jet)
     fJetAcceptanceType  = jet.fJetAcceptanceType;
     fParticleConstituents = jet.fParticleConstituents;
     fClusterConstituents = jet.fClusterConstituents;
+    // the arena link is not copied, see SetConstituentArena()
+    fConstituentArena   = nullptr;
+    fConstituentArenaSlice = -1;
   }
 
   return *this;
@@ -540,6 +551,7 @@ void AliEmcalJet::ResetMatching()
  */
 Int_t AliEmcalJet::ContainsTrack(Int_t it) const
 {
+  if (fConstituentArena) return fConstituentArena->FindTrack(fConstituentArenaSlice, it);
   for (Int_t i = 0; i < fTrackIDs.GetSize(); i++) {
     if (it == fTrackIDs[i]) return i;
   }
@@ -553,6 +565,7 @@ Int_t AliEmcalJet::ContainsTrack(Int_t it) const
  */
 Int_t AliEmcalJet::ContainsCluster(Int_t ic) const
 {
+  if (fConstituentArena) return fConstituentArena->FindCluster(fConstituentArenaSlice, ic);
   for (Int_t i = 0; i < fClusterIDs.GetSize(); i++) {
     if (ic == fClusterIDs[i]) return i;
   }
@@ -677,6 +690,8 @@ void AliEmcalJet::Clear(Option_t */*option*/)
   fHasGhost = kFALSE;
   fClusterConstituents.clear();
   fParticleConstituents.clear();
+  fConstituentArena = nullptr;
+  fConstituentArenaSlice = -1;
 }
 
 /**
@@ -22,6 +22,7 @@
 #include "AliEmcalJetShapeProperties.h"
 #include "AliEmcalClusterJetConstituent.h"
 #include "AliEmcalParticleJetConstituent.h"
+#include "AliEmcalJetConstituentArena.h"
 
 /**
  * @class AliEmcalJet
@@ -241,6 +242,26 @@ class AliEmcalJet : public AliVParticle
    */
   bool HasParticleConstituent(const AliVParticle *const part) const;
 
+  /**
+   * @brief Get the per-event constituent arena the jet is stored in
+   * @return Constituent arena (nullptr if the jet finder did not fill one)
+   */
+  const PWG::JETFW::AliEmcalJetConstituentArena *GetConstituentArena() const { return fConstituentArena; }
+
+  /**
+   * @brief Get the slice of the jet in the constituent arena
+   * @return Index of the slice (-1 if the jet is not stored in an arena)
+   */
+  Int_t GetConstituentArenaSlice() const { return fConstituentArenaSlice; }
+
+  /**
+   * @brief Link the jet to its constituents in a constituent arena
+   * The slice must contain the same tracks and clusters as the jet. The link is not copied with the jet.
+   * @param[in] arena Constituent arena (not owned)
+   * @param[in] slice Index of the slice of the jet
+   */
+  void SetConstituentArena(const PWG::JETFW::AliEmcalJetConstituentArena *arena, Int_t slice) { fConstituentArena = arena; fConstituentArenaSlice = slice; }
+
   // Fragmentation function
   Double_t          GetZ(const Double_t trkPx, const Double_t trkPy, const Double_t trkPz)  const;
   Double_t          GetZ(const AliVParticle* trk )                                          const;
@@ -435,6 +456,8 @@ class AliEmcalJet : public AliVParticle
 
   std::vector<PWG::JETFW::AliEmcalParticleJetConstituent>      fParticleConstituents;  ///< List of particle constituents
   std::vector<PWG::JETFW::AliEmcalClusterJetConstituent>       fClusterConstituents;   ///< List of cluster constituents
+  const PWG::JETFW::AliEmcalJetConstituentArena               *fConstituentArena;      //!<! Per-event constituent arena (not owned)
+  Int_t                                                         fConstituentArenaSlice; //!<! Slice of the jet in the constituent arena
 
  private:
   /**
@@ -447,7 +470,7 @@ class AliEmcalJet : public AliVParticle
   };
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJet,19);
+  ClassDef(AliEmcalJet,20);
   /// \endcond
 };
 
@@ -0,0 +1,123 @@
+/************************************************************************************
+ * Copyright (C) 2019, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <algorithm>
+
+#include "AliEmcalJetConstituentArena.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::JETFW::AliEmcalJetConstituentArena)
+/// \endcond
+
+namespace PWG {
+namespace JETFW {
+
+AliEmcalJetConstituentArena::AliEmcalJetConstituentArena() :
+    TObject(),
+    fPt(),
+    fEta(),
+    fPhi(),
+    fM(),
+    fIndex(),
+    fSlices(),
+    fOpenTracks(),
+    fOpenClusters()
+{
+
+}
+
+void AliEmcalJetConstituentArena::Clear(Option_t *) {
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fM.clear();
+  fIndex.clear();
+  fSlices.clear();
+  fOpenTracks.clear();
+  fOpenClusters.clear();
+}
+
+Int_t AliEmcalJetConstituentArena::OpenJet() {
+  fOpenTracks.clear();
+  fOpenClusters.clear();
+  Slice slice;
+  slice.fFirst = fIndex.size();
+  slice.fNTracks = 0;
+  slice.fNClusters = 0;
+  fSlices.push_back(slice);
+  return fSlices.size() - 1;
+}
+
+void AliEmcalJetConstituentArena::AddTrack(Int_t index, Double_t pt, Double_t eta, Double_t phi, Double_t m) {
+  Constituent c = {index, pt, eta, phi, m};
+  fOpenTracks.push_back(c);
+}
+
+void AliEmcalJetConstituentArena::AddCluster(Int_t index, Double_t pt, Double_t eta, Double_t phi, Double_t m) {
+  Constituent c = {index, pt, eta, phi, m};
+  fOpenClusters.push_back(c);
+}
+
+void AliEmcalJetConstituentArena::CloseJet() {
+  if (fSlices.empty()) return;
+  Slice &slice = fSlices.back();
+  slice.fNTracks = fOpenTracks.size();
+  slice.fNClusters = fOpenClusters.size();
+  Append(fOpenTracks);
+  Append(fOpenClusters);
+}
+
+void AliEmcalJetConstituentArena::Append(std::vector<Constituent> &constituents) {
+  std::sort(constituents.begin(), constituents.end());
+  for (const auto &c : constituents) {
+    fPt.push_back(c.fPt);
+    fEta.push_back(c.fEta);
+    fPhi.push_back(c.fPhi);
+    fM.push_back(c.fM);
+    fIndex.push_back(c.fIndex);
+  }
+  constituents.clear();
+}
+
+Int_t AliEmcalJetConstituentArena::FindTrack(Int_t islice, Int_t index) const {
+  const Slice &slice = fSlices[islice];
+  return Find(slice.fFirst, slice.fNTracks, index);
+}
+
+Int_t AliEmcalJetConstituentArena::FindCluster(Int_t islice, Int_t index) const {
+  const Slice &slice = fSlices[islice];
+  return Find(slice.fFirst + slice.fNTracks, slice.fNClusters, index);
+}
+
+Int_t AliEmcalJetConstituentArena::Find(UInt_t first, UInt_t n, Int_t index) const {
+  const Int_t *begin = fIndex.data() + first, *end = begin + n;
+  const Int_t *found = std::lower_bound(begin, end, index);
+  if (found == end || *found != index) return -1;
+  return found - begin;
+}
+
+}
+}
@@ -0,0 +1,167 @@
+/************************************************************************************
+ * Copyright (C) 2019, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALJETCONSTITUENTARENA_H
+#define ALIEMCALJETCONSTITUENTARENA_H
+
+#include <vector>
+#include <TObject.h>
+
+/**
+ * @namespace PWG
+ * @brief Basic namespace for general framework objects
+ */
+namespace PWG {
+
+/**
+ * @namespace JETFW
+ * @brief Namespace for objects belonging to the ALICE jet framework
+ * @ingroup JETFW
+ */
+namespace JETFW {
+
+/**
+ * @class AliEmcalJetConstituentArena
+ * @brief Per-event structure-of-arrays storage of the jet constituents
+ * @ingroup JETFW
+ *
+ * The kinematics (pt, eta, phi, m) and the global index of the constituents of all
+ * jets of an event are stored in contiguous arrays. Each jet occupies one slice of
+ * the arena: first its track constituents, then its cluster constituents, each
+ * sorted by index, i.e. in the same order as the track / cluster IDs of the jet after
+ * AliEmcalJet::SortConstituents(). Jet shape calculations can then loop over the
+ * arrays of a slice instead of resolving every constituent via its TClonesArray,
+ * and the membership of a track / cluster is found by binary search.
+ *
+ * The arena is filled by the jet finder (see AliEmcalJetTask::SetFillConstituentArena())
+ * and referenced by the jets (AliEmcalJet::GetConstituentArena()). It is cleared at the
+ * beginning of every event, the allocated memory is kept.
+ */
+class AliEmcalJetConstituentArena : public TObject {
+public:
+  /**
+   * @struct Slice
+   * @brief Range of the constituents of one jet in the arena
+   */
+  struct Slice {
+    UInt_t fFirst;      ///< Position of the first constituent of the jet
+    UInt_t fNTracks;    ///< Number of track constituents (stored first)
+    UInt_t fNClusters;  ///< Number of cluster constituents (stored after the tracks)
+  };
+
+  AliEmcalJetConstituentArena();
+  virtual ~AliEmcalJetConstituentArena() {}
+
+  /**
+   * @brief Remove all jets and constituents, the allocated memory is kept
+   */
+  void Clear(Option_t *option = "");
+
+  /**
+   * @brief Start the slice of a new jet
+   * @return Index of the slice
+   */
+  Int_t OpenJet();
+
+  /**
+   * @brief Add a track constituent to the jet currently open
+   * @param[in] index Global index of the track (as in AliEmcalJet::TrackAt())
+   */
+  void AddTrack(Int_t index, Double_t pt, Double_t eta, Double_t phi, Double_t m);
+
+  /**
+   * @brief Add a cluster constituent to the jet currently open
+   * @param[in] index Global index of the cluster (as in AliEmcalJet::ClusterAt())
+   */
+  void AddCluster(Int_t index, Double_t pt, Double_t eta, Double_t phi, Double_t m);
+
+  /**
+   * @brief Close the slice of the current jet: sort tracks and clusters by index and copy them into the arena
+   */
+  void CloseJet();
+
+  Int_t         GetNJets()                     const { return fSlices.size()        ; }
+  UInt_t        GetNConstituents()             const { return fIndex.size()         ; }
+  const Slice  &GetSlice(Int_t islice)         const { return fSlices[islice]       ; }
+
+  /// Arrays over all constituents of the event, use with the ranges given by GetSlice()
+  const Double_t *GetPt()                      const { return fPt.data()            ; }
+  const Double_t *GetEta()                     const { return fEta.data()           ; }
+  const Double_t *GetPhi()                     const { return fPhi.data()           ; }
+  const Double_t *GetM()                       const { return fM.data()             ; }
+  const Int_t    *GetIndex()                   const { return fIndex.data()         ; }
+
+  /**
+   * @brief Find a track among the constituents of a jet
+   * @param[in] islice Slice of the jet
+   * @param[in] index Global index of the track
+   * @return Position of the track among the track constituents of the jet, -1 if not found
+   */
+  Int_t FindTrack(Int_t islice, Int_t index) const;
+
+  /**
+   * @brief Find a cluster among the constituents of a jet
+   * @param[in] islice Slice of the jet
+   * @param[in] index Global index of the cluster
+   * @return Position of the cluster among the cluster constituents of the jet, -1 if not found
+   */
+  Int_t FindCluster(Int_t islice, Int_t index) const;
+
+protected:
+  /**
+   * @struct Constituent
+   * @brief Constituent of the jet currently open
+   */
+  struct Constituent {
+    Int_t    fIndex;
+    Double_t fPt;
+    Double_t fEta;
+    Double_t fPhi;
+    Double_t fM;
+    bool operator<(const Constituent &o) const { return fIndex < o.fIndex; }
+  };
+
+  void  Append(std::vector<Constituent> &constituents);
+  Int_t Find(UInt_t first, UInt_t n, Int_t index) const;
+
+  std::vector<Double_t>     fPt;                //!<! Constituent transverse momentum
+  std::vector<Double_t>     fEta;               //!<! Constituent pseudorapidity
+  std::vector<Double_t>     fPhi;               //!<! Constituent azimuthal angle
+  std::vector<Double_t>     fM;                 //!<! Constituent mass
+  std::vector<Int_t>        fIndex;             //!<! Constituent global index
+  std::vector<Slice>        fSlices;            //!<! Slices of the jets
+  std::vector<Constituent>  fOpenTracks;        //!<! Tracks of the jet currently open
+  std::vector<Constituent>  fOpenClusters;      //!<! Clusters of the jet currently open
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetConstituentArena, 1);
+  /// \endcond
+};
+
+}
+}
+
+#endif /* ALIEMCALJETCONSTITUENTARENA_H */
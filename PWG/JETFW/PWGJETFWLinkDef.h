@@ -21,5 +21,6 @@
 #pragma link C++ class PWG::JETFW::AliEmcalJetConstituent+;
 #pragma link C++ class PWG::JETFW::AliEmcalParticleJetConstituent+;
 #pragma link C++ class PWG::JETFW::AliEmcalClusterJetConstituent+;
+#pragma link C++ class PWG::JETFW::AliEmcalJetConstituentArena+;
 
 #endif
@@ -28,6 +28,12 @@
 // the derivation from THnSparse is obviously against many OO rules. correct would be a common baseclass of THnSparse and THn.
 //
 // Templated version allows also the use of double as storage container
+//
+// FillN fills a batch of entries: the global bin indices are computed per axis over blocks of entries
+// (arithmetic for equidistant axes, branch-free binary search for variable axes) and the weights are added afterwards.
+// For multi-threaded filling, SetNShards(n) creates n independent value containers, each thread fills its own
+// shard via FillN(..., shard). The shards are added to the main containers by ReduceShards(), which is called by
+// Merge() and FillParent()
 // 
 // Author: Jan Fiete Grosse-Oetringhaus
 
@@ -53,7 +59,11 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fFixedBinsCache(0),
+  fNShards(0),
+  fShardValues(0),
+  fShardSumw2(0)
 {
   // Constructor
 }
@@ -69,7 +79,11 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fFixedBinsCache(0),
+  fNShards(0),
+  fShardValues(0),
+  fShardSumw2(0)
 {
   // Constructor
 
@@ -106,7 +120,11 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fFixedBinsCache(0),
+  fNShards(0),
+  fShardValues(0),
+  fShardSumw2(0)
 {
   //
   // AliTHnT copy constructor
@@ -120,6 +138,8 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
     if (c.fSumw2[i])  fSumw2[i]  = new TemplateArray(*(c.fSumw2[i]));
   }
 
+  // the copy has no shards, the not yet reduced shards of c are added to its containers
+  c.AddShards(fValues, fSumw2);
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -135,6 +155,9 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  delete[] fFixedBinsCache;
+  
+  DeleteShards();
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -165,6 +188,9 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
   // assigment operator
 
   if (this != &c) {
+    // the shards are sized with the present fNSteps, so they have to go before it is changed
+    DeleteShards();
+
     AliCFContainer::operator=(c);
     fNBins=c.fNBins;
     fNVars=c.fNVars;
@@ -191,9 +217,12 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
       fValues = 0;
       fSumw2 = 0;
     }
-    delete [] axisCache;
-    axisCache = new TAxis*[fNVars];
-    memcpy(axisCache, c.axisCache, fNVars*sizeof(TAxis*));
+
+    // the not yet reduced shards of c are added to the copied containers (this object has no shards)
+    c.AddShards(fValues, fSumw2);
+
+    // the caches refer to the previous axes and number of variables
+    ResetCaches();
   }
   return *this;
 }
@@ -206,6 +235,12 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
 
   AliTHnT& target = (AliTHnT &) c;
   
+  // the shards and containers of the target are sized with its present fNSteps
+  target.DeleteShards();
+  target.DeleteContainers();
+  delete[] target.fValues;
+  delete[] target.fSumw2;
+
   AliCFContainer::Copy(target);
   
   target.fNSteps = fNSteps;
@@ -226,6 +261,11 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
     else
       target.fSumw2[i] = 0;
   }
+
+  // the not yet reduced shards are added to the copied containers (the target has no shards)
+  AddShards(target.fValues, target.fSumw2);
+
+  target.ResetCaches();
 }
 
 //____________________________________________________________________
@@ -244,6 +284,8 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
   
   AliCFContainer::Merge(list);
 
+  ReduceShards();
+
   TIterator* iter = list->MakeIterator();
   TObject* obj;
   
@@ -253,6 +295,8 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
     AliTHnT* entry = dynamic_cast<AliTHnT*> (obj);
     if (entry == 0) 
       continue;
+    
+    entry->ReduceShards();
 
     for (Int_t i=0; i<fNSteps; i++)
     {
@@ -287,16 +331,11 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
   // fills an entry
 
   // fill axis cache
-  if (!axisCache)
+  if (!axisCache || !fNbinsCache)
+    InitAxisCache();
+  
+  if (!fLastVars)
   {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
-    
     fLastVars = new Double_t[fNVars];
     fLastBins = new Int_t[fNVars];
     
@@ -360,6 +399,304 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache()
+{
+  // caches axis pointers and binning information used by Fill and FillN
+  
+  delete[] axisCache;
+  delete[] fNbinsCache;
+  delete[] fFixedBinsCache;
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fFixedBinsCache = new Bool_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    fFixedBinsCache[i] = !axisCache[i]->IsVariableBinSize();
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::ResetCaches()
+{
+  // recreates the axis caches (after the axes have been replaced by an assignment or copy)
+  // the caches of the last used bins are recreated by the next Fill
+  
+  delete[] fLastVars;
+  delete[] fLastBins;
+  fLastVars = 0;
+  fLastBins = 0;
+  
+  if (fNVars > 0 && fNSteps > 0)
+  {
+    InitAxisCache();
+  }
+  else
+  {
+    delete[] axisCache;
+    delete[] fNbinsCache;
+    delete[] fFixedBinsCache;
+    axisCache = 0;
+    fNbinsCache = 0;
+    fFixedBinsCache = 0;
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t n, const Double_t* const* columns, Int_t istep, const Double_t* weights, Int_t shard)
+{
+  // fills n entries
+  //   columns[i][j] is the value of variable i for entry j
+  //   weights (optional) contains one weight per entry
+  //   shard >= 0 fills the per-thread container <shard> (see SetNShards), which needs no locking
+  //     as long as each thread uses its own shard. With shard < 0 the main containers are filled.
+  
+  if (n <= 0)
+    return;
+  
+  TemplateArray** values = fValues;
+  TemplateArray** sumw2 = fSumw2;
+  if (shard >= 0)
+  {
+    if (shard >= fNShards)
+    {
+      AliError(Form("Shard %d requested but only %d shards available. Call SetNShards first.", shard, fNShards));
+      return;
+    }
+    values = fShardValues[shard];
+    sumw2 = fShardSumw2[shard];
+  }
+  
+  // for shards the caches are created by SetNShards, before the threads start filling
+  if (!axisCache || !fNbinsCache || !fFixedBinsCache)
+    InitAxisCache();
+  
+  if (!values[istep])
+  {
+    values[istep] = new TemplateArray(fNBins);
+    if (shard < 0)
+      AliInfo(Form("Created values container for step %d", istep));
+  }
+  
+  // process in blocks which fit into the stack buffers of FillBlock
+  const Int_t kBlockSize = 256;
+  for (Int_t offset = 0; offset < n; offset += kBlockSize)
+    FillBlock(TMath::Min(kBlockSize, n - offset), columns, offset, istep, weights, values, sumw2);
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillBlock(Int_t n, const Double_t* const* columns, Int_t offset, Int_t istep, const Double_t* weights, TemplateArray** values, TemplateArray** sumw2)
+{
+  // fills a block of at most 256 entries starting at <offset>
+  // the global bin index is built axis by axis over the whole block; entries in under/overflow get marked invalid
+  
+  Long64_t globalBin[256];
+  Bool_t valid[256];
+  
+  for (Int_t j=0; j<n; j++)
+  {
+    globalBin[j] = 0;
+    valid[j] = kTRUE;
+  }
+  
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    const Double_t* x = columns[i] + offset;
+    const Int_t nBins = fNbinsCache[i];
+    const Double_t xMin = axisCache[i]->GetXmin();
+    const Double_t xMax = axisCache[i]->GetXmax();
+    
+    if (fFixedBinsCache[i])
+    {
+      // same arithmetic as TAxis::FindBin to obtain identical bins
+      const Double_t width = xMax - xMin;
+      for (Int_t j=0; j<n; j++)
+      {
+        const Bool_t inside = (x[j] >= xMin) && (x[j] < xMax);
+        const Int_t tmpBin = inside ? (Int_t) (nBins * (x[j] - xMin) / width) : 0;
+        valid[j] = valid[j] && inside && tmpBin < nBins;
+        globalBin[j] = globalBin[j] * nBins + tmpBin;
+      }
+    }
+    else
+    {
+      // branch-free search for the last edge <= x (as TMath::BinarySearch in TAxis::FindBin)
+      const Double_t* edges = axisCache[i]->GetXbins()->GetArray();
+      for (Int_t j=0; j<n; j++)
+      {
+        const Bool_t inside = (x[j] >= xMin) && (x[j] < xMax);
+        const Double_t* base = edges;
+        Int_t len = nBins + 1;
+        while (len > 1)
+        {
+          const Int_t half = len / 2;
+          base = (base[half] <= x[j]) ? base + half : base;
+          len -= half;
+        }
+        const Int_t tmpBin = inside ? (Int_t) (base - edges) : 0;
+        valid[j] = valid[j] && inside;
+        globalBin[j] = globalBin[j] * nBins + tmpBin;
+      }
+    }
+  }
+  
+  TemplateType* target = values[istep]->GetArray();
+  
+  if (!weights)
+  {
+    TemplateType* targetSumw2 = (sumw2[istep]) ? sumw2[istep]->GetArray() : 0;
+    for (Int_t j=0; j<n; j++)
+    {
+      if (!valid[j])
+        continue;
+      target[globalBin[j]] += 1;
+      if (targetSumw2)
+        targetSumw2[globalBin[j]] += 1;
+    }
+    return;
+  }
+  
+  const Double_t* w = weights + offset;
+  
+  // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+  if (!sumw2[istep])
+  {
+    for (Int_t j=0; j<n; j++)
+    {
+      if (valid[j] && w[j] != 1)
+      {
+        sumw2[istep] = new TemplateArray(*values[istep]);
+        break;
+      }
+    }
+  }
+  
+  TemplateType* targetSumw2 = (sumw2[istep]) ? sumw2[istep]->GetArray() : 0;
+  for (Int_t j=0; j<n; j++)
+  {
+    if (!valid[j])
+      continue;
+    target[globalBin[j]] += w[j];
+    if (targetSumw2)
+      targetSumw2[globalBin[j]] += w[j] * w[j];
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::SetNShards(Int_t nShards)
+{
+  // creates <nShards> per-thread containers which can be filled concurrently with FillN(..., shard)
+  // previously filled shards are summed into the main containers first
+  // has to be called before the worker threads start filling
+  
+  ReduceShards();
+  DeleteShards();
+  
+  if (!axisCache || !fNbinsCache || !fFixedBinsCache)
+    InitAxisCache();
+  
+  if (nShards <= 0)
+    return;
+  
+  fNShards = nShards;
+  fShardValues = new TemplateArray**[fNShards];
+  fShardSumw2 = new TemplateArray**[fNShards];
+  for (Int_t s=0; s<fNShards; s++)
+  {
+    fShardValues[s] = new TemplateArray*[fNSteps];
+    fShardSumw2[s] = new TemplateArray*[fNSteps];
+    for (Int_t i=0; i<fNSteps; i++)
+    {
+      fShardValues[s][i] = 0;
+      fShardSumw2[s][i] = 0;
+    }
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::AddShards(TemplateArray** values, TemplateArray** sumw2) const
+{
+  // adds the content of the per-thread containers to <values> and <sumw2> (fNSteps containers each, created if needed)
+  // the shards are not changed
+  
+  for (Int_t s=0; s<fNShards; s++)
+  {
+    for (Int_t i=0; i<fNSteps; i++)
+    {
+      const TemplateArray* shardValues = fShardValues[s][i];
+      const TemplateArray* shardSumw2 = fShardSumw2[s][i];
+      if (!shardValues)
+        continue;
+      
+      if (!values[i])
+        values[i] = new TemplateArray(fNBins);
+      
+      // a container without sumw2 was only filled with weight 1, in which case sumw2 = values
+      if (shardSumw2 && !sumw2[i])
+        sumw2[i] = new TemplateArray(*values[i]);
+      
+      TemplateType* target = values[i]->GetArray();
+      const TemplateType* source = shardValues->GetArray();
+      for (Long64_t l = 0; l<fNBins; l++)
+        target[l] += source[l];
+      
+      if (sumw2[i])
+      {
+        TemplateType* targetSumw2 = sumw2[i]->GetArray();
+        const TemplateType* sourceSumw2 = (shardSumw2) ? shardSumw2->GetArray() : source;
+        for (Long64_t l = 0; l<fNBins; l++)
+          targetSumw2[l] += sourceSumw2[l];
+      }
+    }
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::ReduceShards()
+{
+  // adds the content of the per-thread containers to the main containers and resets the shards
+  // must not be called while threads are filling
+  
+  AddShards(fValues, fSumw2);
+  
+  for (Int_t s=0; s<fNShards; s++)
+  {
+    for (Int_t i=0; i<fNSteps; i++)
+    {
+      if (fShardValues[s][i])
+        fShardValues[s][i]->Reset();
+      delete fShardSumw2[s][i];
+      fShardSumw2[s][i] = 0;
+    }
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::DeleteShards()
+{
+  // deletes the per-thread containers (without adding their content)
+  
+  for (Int_t s=0; s<fNShards; s++)
+  {
+    for (Int_t i=0; i<fNSteps; i++)
+    {
+      delete fShardValues[s][i];
+      delete fShardSumw2[s][i];
+    }
+    delete[] fShardValues[s];
+    delete[] fShardSumw2[s];
+  }
+  delete[] fShardValues;
+  delete[] fShardSumw2;
+  
+  fNShards = 0;
+  fShardValues = 0;
+  fShardSumw2 = 0;
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
@@ -448,6 +785,7 @@ void AliTHnT<TemplateArray, TemplateType>::FillParent()
 {
   // fills the information stored in the buffer in this class into the baseclass containers
   
+  ReduceShards();
   FillContainer(this);
 }
 
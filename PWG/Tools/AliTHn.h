@@ -9,6 +9,10 @@
 // Use AliTHn instead of AliCFContainer and your memory consumption will be drastically reduced
 // As AliTHn derives from AliCFContainer, you can just replace your current AliCFContainer object by AliTHn
 // Once you have the merged output, call FillParent() and you can use AliCFContainer as usual
+//
+// FillN() fills a batch of entries given as columns (one array per variable). With SetNShards() each thread
+// can fill its own shard (FillN(..., shard)) without locking; shards are summed by ReduceShards(), Merge() and FillParent()
+// Copies (copy constructor, operator=, Copy()) contain the sum of the main containers and the not yet reduced shards, without shards
 
 #include "TObject.h"
 #include "TString.h"
@@ -26,6 +30,7 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void FillN(Int_t n, const Double_t* const* columns, Int_t istep, const Double_t* weights=0, Int_t shard=-1) = 0;
   virtual void FillParent() = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
@@ -48,6 +53,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillN(Int_t n, const Double_t* const* columns, Int_t istep, const Double_t* weights=0, Int_t shard=-1);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -57,6 +63,10 @@ class AliTHnT : public AliTHnBase
   virtual void DeleteContainers();
   virtual void ReduceAxis();
   
+  void SetNShards(Int_t nShards);
+  Int_t GetNShards() const { return fNShards; }
+  void ReduceShards();
+  
   AliTHnT(const AliTHnT &c);
   AliTHnT& operator=(const AliTHnT& corr);
   virtual void Copy(TObject& c) const;
@@ -65,7 +75,12 @@ class AliTHnT : public AliTHnBase
   
 protected:
   void Init();
+  void InitAxisCache();
+  void DeleteShards();
+  void AddShards(TemplateArray** values, TemplateArray** sumw2) const;
+  void ResetCaches();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
+  void FillBlock(Int_t n, const Double_t* const* columns, Int_t offset, Int_t istep, const Double_t* weights, TemplateArray** values, TemplateArray** sumw2);
   
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
@@ -77,6 +92,11 @@ protected:
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Bool_t* fFixedBinsCache; //! cache whether axis has equidistant bins (bin found arithmetically in FillN)
+  
+  Int_t fNShards;              //! number of per-thread shards
+  TemplateArray*** fShardValues; //! [fNShards][fNSteps] per-thread data containers, reduced in ReduceShards
+  TemplateArray*** fShardSumw2;  //! [fNShards][fNSteps] per-thread data containers, reduced in ReduceShards
   
   ClassDef(AliTHnT, 5) // THn like container
 };
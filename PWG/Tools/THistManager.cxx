@@ -15,7 +15,6 @@
 #include <cfloat>
 #include <cstring>
 #include <iostream>   // for unit tests
-#include <sstream>
 #include <string>
 #include <exception>
 #include <vector>
@@ -42,14 +41,16 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fFillHandles()
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fFillHandles()
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -420,14 +421,10 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optionstring(opt);
-	if(optionstring.Contains("w")){
-	  // use bin width as weight
-	  Int_t bin = hist->GetXaxis()->FindBin(x);
-	  // check if not overflow or underflow bin
-	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
-	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
-	}
+	bool usebinwidth(false);
+	DecodeBinWidthOption(opt, kTH1, 1, usebinwidth);
+	// use bin width as weight
+	if(usebinwidth) weight = GetBinWidthCorrection(hist->GetXaxis(), x);
 	hist->Fill(x, weight);
 }
 
@@ -443,15 +440,10 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
     Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
   }
-	TString optionstring(opt);
-	if(optionstring.Contains("w")){
-	  // use bin width as weight
-	  // get bin for label
-	  Int_t bin = hist->GetXaxis()->FindBin(label);
-	  // check if not overflow or underflow bin
-	  if(bin != 0 && bin != hist->GetXaxis()->GetNbins())
-	    weight = 1./hist->GetXaxis()->GetBinWidth(bin);
-	}
+	bool usebinwidth(false);
+	DecodeBinWidthOption(opt, kTH1, 1, usebinwidth);
+	// use bin width as weight
+	if(usebinwidth) weight = GetBinWidthCorrectionBin(hist->GetXaxis(), hist->GetXaxis()->FindBin(label));
   hist->Fill(label, weight);
 }
 
@@ -467,16 +459,11 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optstring(opt);
-	Double_t myweight = optstring.Contains("w") ? 1. : weight;
-	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(x);
-	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-	}
-	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(y);
-	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-	}
+	bool usebinwidth(false);
+	unsigned int binwidthaxes = DecodeBinWidthOption(opt, kTH2, 2, usebinwidth);
+	Double_t myweight = usebinwidth ? 1. : weight;
+	if(binwidthaxes & 1u) myweight *= GetBinWidthCorrection(hist->GetXaxis(), x);
+	if(binwidthaxes & 2u) myweight *= GetBinWidthCorrection(hist->GetYaxis(), y);
 	hist->Fill(x, y, myweight);
 }
 
@@ -492,17 +479,12 @@ void THistManager::FillTH2(const char *name, double *point, double weight, Optio
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optstring(opt);
-	Double_t myweight = optstring.Contains("w") ? 1. : weight;
-	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(point[0]);
-	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-	}
-	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(point[1]);
-	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-	}
-	hist->Fill(point[0], point[1], weight);
+	bool usebinwidth(false);
+	unsigned int binwidthaxes = DecodeBinWidthOption(opt, kTH2, 2, usebinwidth);
+	Double_t myweight = usebinwidth ? 1. : weight;
+	if(binwidthaxes & 1u) myweight *= GetBinWidthCorrection(hist->GetXaxis(), point[0]);
+	if(binwidthaxes & 2u) myweight *= GetBinWidthCorrection(hist->GetYaxis(), point[1]);
+	hist->Fill(point[0], point[1], myweight);
 }
 
 void THistManager::FillTH2(const char *name, const char *labelX, const char *labelY, double weight, Option_t *opt) {
@@ -517,17 +499,12 @@ void THistManager::FillTH2(const char *name, const char *labelX, const char *lab
     Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
   }
-  TString optstring(opt);
-  Double_t myweight = optstring.Contains("w") ? 1. : weight;
-  if(optstring.Contains("wx")){
-    Int_t binx = hist->GetXaxis()->FindBin(labelY);
-    if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-  }
-  if(optstring.Contains("wy")){
-    Int_t biny = hist->GetYaxis()->FindBin(labelX);
-    if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-  }
-  hist->Fill(labelX, labelY, weight);
+  bool usebinwidth(false);
+  unsigned int binwidthaxes = DecodeBinWidthOption(opt, kTH2, 2, usebinwidth);
+  Double_t myweight = usebinwidth ? 1. : weight;
+  if(binwidthaxes & 1u) myweight *= GetBinWidthCorrectionBin(hist->GetXaxis(), hist->GetXaxis()->FindBin(labelX));
+  if(binwidthaxes & 2u) myweight *= GetBinWidthCorrectionBin(hist->GetYaxis(), hist->GetYaxis()->FindBin(labelY));
+  hist->Fill(labelX, labelY, myweight);
 }
 
 void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
@@ -542,21 +519,13 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optstring(opt);
-	Double_t myweight = optstring.Contains("w") ? 1. : weight;
-	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(x);
-	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-	}
-	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(y);
-	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-	}
-	if(optstring.Contains("wz")){
-	  Int_t binz = hist->GetZaxis()->FindBin(z);
-	  if(binz != 0 && binz != hist->GetZaxis()->GetNbins()) myweight *= 1./hist->GetZaxis()->GetBinWidth(binz);
-	}
-	hist->Fill(x, y, z, weight);
+	bool usebinwidth(false);
+	unsigned int binwidthaxes = DecodeBinWidthOption(opt, kTH3, 3, usebinwidth);
+	Double_t myweight = usebinwidth ? 1. : weight;
+	if(binwidthaxes & 1u) myweight *= GetBinWidthCorrection(hist->GetXaxis(), x);
+	if(binwidthaxes & 2u) myweight *= GetBinWidthCorrection(hist->GetYaxis(), y);
+	if(binwidthaxes & 4u) myweight *= GetBinWidthCorrection(hist->GetZaxis(), z);
+	hist->Fill(x, y, z, myweight);
 }
 
 void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
@@ -571,21 +540,13 @@ void THistManager::FillTH3(const char* name, const double* point, double weight,
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optstring(opt);
-	Double_t myweight = optstring.Contains("w") ? 1. : weight;
-	if(optstring.Contains("wx")){
-	  Int_t binx = hist->GetXaxis()->FindBin(point[0]);
-	  if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-	}
-	if(optstring.Contains("wy")){
-	  Int_t biny = hist->GetYaxis()->FindBin(point[1]);
-	  if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-	}
-	if(optstring.Contains("wz")){
-	  Int_t binz = hist->GetZaxis()->FindBin(point[2]);
-	  if(binz != 0 && binz != hist->GetZaxis()->GetNbins()) myweight *= 1./hist->GetZaxis()->GetBinWidth(binz);
-	}
-	hist->Fill(point[0], point[1], point[2], weight);
+	bool usebinwidth(false);
+	unsigned int binwidthaxes = DecodeBinWidthOption(opt, kTH3, 3, usebinwidth);
+	Double_t myweight = usebinwidth ? 1. : weight;
+	if(binwidthaxes & 1u) myweight *= GetBinWidthCorrection(hist->GetXaxis(), point[0]);
+	if(binwidthaxes & 2u) myweight *= GetBinWidthCorrection(hist->GetYaxis(), point[1]);
+	if(binwidthaxes & 4u) myweight *= GetBinWidthCorrection(hist->GetZaxis(), point[2]);
+	hist->Fill(point[0], point[1], point[2], myweight);
 }
 
 void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
@@ -600,18 +561,14 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
-	TString optstring(opt);
-	Double_t myweight = optstring.Contains("w") ? 1. : weight;
-	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
-	  std::stringstream weighthandler;
-	  weighthandler << "w" << iaxis;
-	  if(optstring.Contains(weighthandler.str().c_str())){
-	    Int_t bin = hist->GetAxis(iaxis)->FindBin(x[iaxis]);
-	    if(bin != 0 && bin != hist->GetAxis(iaxis)->GetNbins()) myweight *= hist->GetAxis(iaxis)->GetBinWidth(bin);
-	  }
+	bool usebinwidth(false);
+	unsigned int binwidthaxes = DecodeBinWidthOption(opt, kTHnSparse, hist->GetNdimensions(), usebinwidth);
+	Double_t myweight = usebinwidth ? 1. : weight;
+	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions() && iaxis < 32; iaxis++){
+	  if(binwidthaxes & (1u << iaxis)) myweight *= GetBinWidthCorrection(hist->GetAxis(iaxis), x[iaxis]);
 	}
 
-	hist->Fill(x, weight);
+	hist->Fill(x, myweight);
 }
 
 void THistManager::FillProfile(const char* name, double x, double y, double weight){
@@ -625,6 +582,111 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+int THistManager::GetFillHandle(const char *name, Option_t *opt) {
+	TObject *o = FindObject(name);
+	if(!o) return -1;
+	FillHandle_t handle;
+	handle.fObject = o;
+	int ndim = 0;
+	// TProfile inherits from TH1, so needs to be checked first
+	if(o->InheritsFrom(TProfile::Class())) { handle.fType = kTProfile; ndim = 1; }
+	else if(o->InheritsFrom(TH3::Class())) { handle.fType = kTH3; ndim = 3; }
+	else if(o->InheritsFrom(TH2::Class())) { handle.fType = kTH2; ndim = 2; }
+	else if(o->InheritsFrom(TH1::Class())) { handle.fType = kTH1; ndim = 1; }
+	else if(o->InheritsFrom(THnSparse::Class())) { handle.fType = kTHnSparse; ndim = static_cast<THnSparse *>(o)->GetNdimensions(); }
+	else {
+		Fatal("THistManager::GetFillHandle", "Object %s is not of a histogram type", name);
+		return -1;
+	}
+
+	// decode options once
+	handle.fBinWidthAxes = DecodeBinWidthOption(opt, handle.fType, ndim, handle.fUseBinWidth);
+	fFillHandles.push_back(handle);
+	return fFillHandles.size() - 1;
+}
+
+const THistManager::FillHandle_t &THistManager::GetHandle(int handle, HistType_t type, const char *method) const {
+	if(handle < 0 || handle >= static_cast<int>(fFillHandles.size()))
+		Fatal(method, "Invalid histogram handle %d", handle);
+	const FillHandle_t &result = fFillHandles[handle];
+	if(result.fType != type)
+		Fatal(method, "Histogram %s behind handle %d has a different type", result.fObject->GetName(), handle);
+	return result;
+}
+
+unsigned int THistManager::DecodeBinWidthOption(Option_t *opt, HistType_t type, int ndim, bool &usebinwidth) {
+	TString optstring(opt);
+	optstring.ToLower();
+	usebinwidth = optstring.Contains("w");
+	unsigned int binwidthaxes = 0;
+	if(!usebinwidth) return binwidthaxes;
+	const char *axisnames[3] = {"wx", "wy", "wz"};
+	for(int iaxis = 0; iaxis < ndim && iaxis < 32; iaxis++){
+		bool corraxis = false;
+		if(type == kTHnSparse) corraxis = optstring.Contains(Form("w%d", iaxis));
+		else if(type == kTH1) corraxis = true;
+		else if(iaxis < 3) corraxis = optstring.Contains(axisnames[iaxis]);
+		if(corraxis) binwidthaxes |= (1u << iaxis);
+	}
+	return binwidthaxes;
+}
+
+double THistManager::GetBinWidthCorrection(const TAxis *axis, double x) {
+	return GetBinWidthCorrectionBin(axis, axis->FindFixBin(x));
+}
+
+double THistManager::GetBinWidthCorrectionBin(const TAxis *axis, Int_t bin) {
+	if(bin < 1 || bin > axis->GetNbins()) return 1.;
+	return 1./axis->GetBinWidth(bin);
+}
+
+void THistManager::FillTH1(int handle, double x, double weight) {
+	const FillHandle_t &h = GetHandle(handle, kTH1, "THistManager::FillTH1");
+	TH1 *hist = static_cast<TH1 *>(h.fObject);
+	if(h.fUseBinWidth) weight = GetBinWidthCorrection(hist->GetXaxis(), x);
+	hist->Fill(x, weight);
+}
+
+void THistManager::FillTH2(int handle, double x, double y, double weight) {
+	const FillHandle_t &h = GetHandle(handle, kTH2, "THistManager::FillTH2");
+	TH2 *hist = static_cast<TH2 *>(h.fObject);
+	if(h.fUseBinWidth){
+		weight = 1.;
+		if(h.fBinWidthAxes & 1u) weight *= GetBinWidthCorrection(hist->GetXaxis(), x);
+		if(h.fBinWidthAxes & 2u) weight *= GetBinWidthCorrection(hist->GetYaxis(), y);
+	}
+	hist->Fill(x, y, weight);
+}
+
+void THistManager::FillTH3(int handle, double x, double y, double z, double weight) {
+	const FillHandle_t &h = GetHandle(handle, kTH3, "THistManager::FillTH3");
+	TH3 *hist = static_cast<TH3 *>(h.fObject);
+	if(h.fUseBinWidth){
+		weight = 1.;
+		if(h.fBinWidthAxes & 1u) weight *= GetBinWidthCorrection(hist->GetXaxis(), x);
+		if(h.fBinWidthAxes & 2u) weight *= GetBinWidthCorrection(hist->GetYaxis(), y);
+		if(h.fBinWidthAxes & 4u) weight *= GetBinWidthCorrection(hist->GetZaxis(), z);
+	}
+	hist->Fill(x, y, z, weight);
+}
+
+void THistManager::FillTHnSparse(int handle, const double *x, double weight) {
+	const FillHandle_t &h = GetHandle(handle, kTHnSparse, "THistManager::FillTHnSparse");
+	THnSparse *hist = static_cast<THnSparse *>(h.fObject);
+	if(h.fUseBinWidth){
+		weight = 1.;
+		for(Int_t iaxis = 0; iaxis < hist->GetNdimensions() && iaxis < 32; iaxis++){
+			if(h.fBinWidthAxes & (1u << iaxis)) weight *= GetBinWidthCorrection(hist->GetAxis(iaxis), x[iaxis]);
+		}
+	}
+	hist->Fill(x, weight);
+}
+
+void THistManager::FillProfile(int handle, double x, double y, double weight) {
+	const FillHandle_t &h = GetHandle(handle, kTProfile, "THistManager::FillTProfile");
+	static_cast<TProfile *>(h.fObject)->Fill(x, y, weight);
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -1030,6 +1092,83 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Test1", "Test fill 1D histogram", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test fill 2D histogram", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Group1/Test3", "Test fill 3D histogram", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("Group2/Subgroup1/TestN", "Test Fill THnSparse", 4, nbins, min, max);
+    testmgr.CreateTProfile("TestProfile", "Test fill Profile histogram", 1, 0., 1.);
+    double edges[3] = {0., 1., 3.};
+    testmgr.CreateTH1("TestWidth", "Test fill 1D histogram with bin width correction", 2, edges);
+    testmgr.CreateTH1("TestWidthName", "Test fill 1D histogram with bin width correction by name", 2, edges);
+
+    bool success(true);
+    int h1 = testmgr.GetFillHandle("Test1"),
+        h2 = testmgr.GetFillHandle("Group1/Test2"),
+        h3 = testmgr.GetFillHandle("Group1/Test3"),
+        hN = testmgr.GetFillHandle("Group2/Subgroup1/TestN"),
+        hProfile = testmgr.GetFillHandle("TestProfile"),
+        hWidth = testmgr.GetFillHandle("TestWidth", "w");
+    if(testmgr.GetFillHandle("Group1/NotExisting") != -1){
+      std::cout << "Handle for non-existing histogram is not -1" << std::endl;
+      success = false;
+    }
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(h1, 0.5);
+      testmgr.FillTH2(h2, 0.5, 0.5);
+      testmgr.FillTH3(h3, 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse(hN, point);
+      testmgr.FillProfile(hProfile, 0.5, 1.);
+      testmgr.FillTH1(hWidth, 0.5);
+      testmgr.FillTH1(hWidth, 2.);
+      // same request through the name based path, upper case option
+      testmgr.FillTH1("TestWidthName", 0.5, 1., "W");
+      testmgr.FillTH1("TestWidthName", 2., 1., "W");
+    }
+
+    TH1 *test1 = dynamic_cast<TH1 *>(testmgr.FindObject("Test1"));
+    if(!test1 || TMath::Abs(test1->GetBinContent(1) - 100) > DBL_EPSILON){
+      std::cout << "Test1: Not found or mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    TH2 *test2 = dynamic_cast<TH2 *>(testmgr.FindObject("Group1/Test2"));
+    if(!test2 || TMath::Abs(test2->GetBinContent(1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Not found or mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    TH3 *test3 = dynamic_cast<TH3 *>(testmgr.FindObject("Group1/Test3"));
+    if(!test3 || TMath::Abs(test3->GetBinContent(1, 1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test3: Not found or mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    THnSparse *testN = dynamic_cast<THnSparse *>(testmgr.FindObject("Group2/Subgroup1/TestN"));
+    int index[4] = {1,1,1,1};
+    if(!testN || TMath::Abs(testN->GetBinContent(index) - 100) > DBL_EPSILON){
+      std::cout << "Group2/Subgroup1/TestN: Not found or mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    TProfile *testProfile = dynamic_cast<TProfile *>(testmgr.FindObject("TestProfile"));
+    if(!testProfile || TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "TestProfile: Not found or mismatch in values, expected 1" << std::endl;
+      success = false;
+    }
+    // the last bin (width 2) is corrected as well, in both fill paths
+    const char *widthhistos[2] = {"TestWidth", "TestWidthName"};
+    for(auto widthname : widthhistos){
+      TH1 *testWidth = dynamic_cast<TH1 *>(testmgr.FindObject(widthname));
+      if(!testWidth || TMath::Abs(testWidth->GetBinContent(1) - 100) > 1e-9 || TMath::Abs(testWidth->GetBinContent(2) - 50) > 1e-9){
+        std::cout << widthname << ": Not found or mismatch in values, expected 100 in the first and 50 in the last bin" << std::endl;
+        success = false;
+      }
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1189,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1215,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
 }
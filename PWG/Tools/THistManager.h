@@ -7,6 +7,7 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <vector>
 
 class TArrayD;
 class TAxis;
@@ -95,6 +96,22 @@ class TProfile;
  * an argument for options. Automatic correction for the bin width is done when
  * specifying the argument *W*, followed by the direction. Adding multiple directions
  * the weight is calculated for all directions at the same time.
+ *
+ * # Filling histograms via handles
+ *
+ * Filling by name requires the lookup of the group and the histogram in the
+ * hash lists for every call. For histograms filled many times per event the
+ * name can be resolved once via GetFillHandle, together with the fill options.
+ * The returned integer handle is used in the corresponding Fill overloads,
+ * which access the histogram directly:
+ *
+ * ~~~{.cxx}
+ * int hpt = mgr.GetFillHandle("hPt", "wx");  // in UserCreateOutputObjects
+ * ...
+ * mgr.FillTH1(hpt, pt);                       // in the event loop
+ * ~~~
+ *
+ * Handles stay valid for the lifetime of the histogram manager.
  */
 class THistManager : public TNamed {
 public:
@@ -634,6 +651,66 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Resolve a histogram for filling via handle.
+   *
+   * The histogram is looked up once by its name (in common group notation),
+   * and the fill options (bin width correction) are parsed once. The returned
+   * handle can be used in the Fill overloads taking an integer handle instead
+   * of the histogram name, avoiding string handling and hash list lookups in
+   * the fill. Requesting a handle for the same histogram again creates a new
+   * handle, which can have different options. The options have the same effect
+   * as in the fills by name.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Fill options (see bin width correction)
+   * @return Handle of the histogram (-1 if the histogram is not found)
+   */
+  int GetFillHandle(const char *name, Option_t *opt = "");
+
+  /**
+   * @brief Fill a 1D histogram via its handle (see @ref GetFillHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH1(int handle, double x, double weight = 1.);
+
+  /**
+   * @brief Fill a 2D histogram via its handle (see @ref GetFillHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH2(int handle, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a 3D histogram via its handle (see @ref GetFillHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH3(int handle, double x, double y, double z, double weight = 1.);
+
+  /**
+   * @brief Fill a nD histogram via its handle (see @ref GetFillHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTHnSparse(int handle, const double *x, double weight = 1.);
+
+  /**
+   * @brief Fill a profile histogram via its handle (see @ref GetFillHandle)
+   * @param[in] handle Handle of the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(int handle, double x, double y, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -695,6 +772,68 @@ private:
 	THistManager(const THistManager &);
 	THistManager &operator=(const THistManager &);
 
+	/**
+	 * @enum HistType_t
+	 * @brief Histogram type behind a fill handle
+	 */
+	enum HistType_t {
+	  kTH1 = 0,        ///< 1D histogram
+	  kTH2 = 1,        ///< 2D histogram
+	  kTH3 = 2,        ///< 3D histogram
+	  kTHnSparse = 3,  ///< THnSparse
+	  kTProfile = 4    ///< Profile histogram
+	};
+
+	/**
+	 * @struct FillHandle_t
+	 * @brief Histogram resolved for filling, with pre-parsed fill options
+	 */
+	struct FillHandle_t {
+	  TObject *fObject;           ///< Histogram to be filled
+	  HistType_t fType;           ///< Type of the histogram
+	  bool fUseBinWidth;          ///< Option "w": weight is replaced by the bin width correction
+	  unsigned int fBinWidthAxes; ///< Axes (bit i for axis i) for which the weight is corrected for the bin width
+	};
+
+	/**
+	 * @brief Access fill handle, checking the type of the histogram
+	 *
+	 * Fatal in case the handle is invalid or the type does not match
+	 * @param[in] handle Handle of the histogram
+	 * @param[in] type Expected type of the histogram
+	 * @param[in] method Name of the calling method (for the error message)
+	 * @return The fill handle
+	 */
+	const FillHandle_t &GetHandle(int handle, HistType_t type, const char *method) const;
+
+	/**
+	 * @brief Weight correcting for the bin width of a given axis at a given value
+	 * @param[in] axis Axis of the histogram
+	 * @param[in] x Value on the axis
+	 * @return 1/bin width, 1 for underflow and overflow
+	 */
+	static double GetBinWidthCorrection(const TAxis *axis, double x);
+
+	/**
+	 * @brief Weight correcting for the bin width of a given bin of an axis
+	 * @param[in] axis Axis of the histogram
+	 * @param[in] bin Bin on the axis
+	 * @return 1/bin width, 1 for underflow and overflow
+	 */
+	static double GetBinWidthCorrectionBin(const TAxis *axis, Int_t bin);
+
+	/**
+	 * @brief Decode the bin width correction option (case-insensitive)
+	 *
+	 * Used by the name and handle based fill methods: "w" for TH1, "wx", "wy", "wz" for TH2/TH3, "w<axis>" for THnSparse
+	 * @param[in] opt Fill option
+	 * @param[in] type Type of the histogram
+	 * @param[in] ndim Number of dimensions of the histogram
+	 * @param[out] usebinwidth True if the option contains "w": the weight is replaced by the bin width correction
+	 * @return Axes (bit i for axis i) for which the weight is corrected for the bin width
+	 */
+	static unsigned int DecodeBinWidthOption(Option_t *opt, HistType_t type, int ndim, bool &usebinwidth);
+
 
 	/**
 	 * @brief Find histogram group.
@@ -721,6 +860,7 @@ private:
 
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	std::vector<FillHandle_t> fFillHandles; ///<! Histograms resolved for filling via handle
 
   /// \cond CLASSIMP
 	ClassDef(THistManager, 1);  // Container for histograms
@@ -845,6 +985,23 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via fill handles
+   * Relies on: TestFillSimpleHistograms, TestFillGroupedHistograms
+   *
+   * Creating histograms of all types, partly in groups, with 1 bin per dimension,
+   * resolving them via GetFillHandle and filling each 100 times with the same value.
+   * In addition a 1D histogram with 2 bins of different width is filled with bin
+   * width correction, once via handle and once by name with an upper-case option
+   *
+   * Test passed:
+   * - All histograms need to have in its 1 bin the bin content 100 (1 for the profile)
+   * - The histograms with bin width correction have 100/width in each bin, including the last
+   * - Handles for non-existing histograms are -1
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
 };
 
 /**
@@ -882,5 +1039,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
 }
 #endif
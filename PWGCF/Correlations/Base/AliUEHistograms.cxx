@@ -24,6 +24,8 @@
 
 #include "AliUEHistograms.h"
 
+#include <vector>
+
 #include "AliCFContainer.h"
 #include "AliBasicParticle.h"
 #include "AliVParticle.h"
@@ -584,6 +586,45 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   TArrayF eta(input->GetEntriesFast());
   for (Int_t i=0; i<input->GetEntriesFast(); i++)
     eta[i] = ((AliVParticle*) input->UncheckedAt(i))->Eta();
+
+  // same for the other kinematic variables of the associated particles, the pair loop only reads these arrays
+  // (same code for same-event and mixed-event filling)
+  const Int_t nAssoc = input->GetEntriesFast();
+  std::vector<Double_t> assocPt(nAssoc);
+  std::vector<Double_t> assocPhi(nAssoc);
+  std::vector<Short_t> assocCharge(nAssoc);
+  for (Int_t i=0; i<nAssoc; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) input->UncheckedAt(i);
+    assocPt[i] = particle->Pt();
+    assocPhi[i] = particle->Phi();
+    assocCharge[i] = particle->Charge();
+  }
+
+  // two-track efficiency cut: the radius dependent term of dphistar (see GetDPhiStarTerm) is computed once per particle
+  // and radius instead of once per pair. The terms at the two boundaries are computed for all associated particles, the
+  // ones for the scan in radius only for particles which are in a pair close to the cut.
+  std::vector<Float_t> radii;
+  std::vector<Double_t> assocTermMin, assocTermMax;
+  std::vector<Double_t> assocScan;
+  std::vector<Bool_t> assocScanDone;
+  std::vector<Double_t> triggerScan;
+  if (twoTrackEfficiencyCut)
+  {
+    for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01)
+      radii.push_back(rad);
+    
+    assocTermMin.resize(nAssoc);
+    assocTermMax.resize(nAssoc);
+    for (Int_t i=0; i<nAssoc; i++)
+    {
+      assocTermMin[i] = GetDPhiStarTerm(assocPt[i], assocCharge[i], fTwoTrackCutMinRadius, bSign);
+      assocTermMax[i] = GetDPhiStarTerm(assocPt[i], assocCharge[i], 2.5, bSign);
+    }
+    assocScanDone.resize(nAssoc, kFALSE);
+    triggerScan.resize(radii.size());
+  }
+  const Int_t nRadii = radii.size();
   
   // if particles is not set, just fill event statistics
   if (particles)
@@ -726,6 +767,19 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  continue;
 	}
 	
+      const Double_t triggerPt = triggerParticle->Pt();
+      const Double_t triggerPhi = triggerParticle->Phi();
+      const Short_t triggerCharge = triggerParticle->Charge();
+
+      Double_t triggerTermMin = 0;
+      Double_t triggerTermMax = 0;
+      Bool_t triggerScanDone = kFALSE;
+      if (twoTrackEfficiencyCut)
+      {
+        triggerTermMin = GetDPhiStarTerm(triggerPt, triggerCharge, fTwoTrackCutMinRadius, bSign);
+        triggerTermMax = GetDPhiStarTerm(triggerPt, triggerCharge, 2.5, bSign);
+      }
+
       for (Int_t j=0; j<jMax; j++)
       {
         if (!mixed && i == j)
@@ -752,21 +806,21 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
           continue;
         
         if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
+	  if (assocPt[j] >= triggerPt)
 	    continue;
 	
 	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
+	  if (assocCharge[j] * fAssociatedSelectCharge < 0)
 	    continue;
 
         if (fSelectCharge > 0)
         {
           // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
+          if (fSelectCharge == 1 && assocCharge[j] * triggerCharge > 0)
             continue;
             
           // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
+          if (fSelectCharge == 2 && assocCharge[j] * triggerCharge < 0)
             continue;
         }
         
@@ -790,13 +844,13 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 
 	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutConversionsV > 0 && assocCharge[j] * triggerCharge < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.510e-3, 0.510e-3);
 	  
 	  if (mass < fCutConversionsV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.510e-3, 0.510e-3);
 	    
 	    fControlConvResoncances->Fill(0.0, mass);
 
@@ -806,15 +860,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// K0s
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && assocCharge[j] * triggerCharge < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.1396, 0.1396);
 	  
 	  const Float_t kK0smass = 0.4976;
 	  
 	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.1396, 0.1396);
 	    
 	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
 
@@ -824,16 +878,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 
 	// Lambda
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && assocCharge[j] * triggerCharge < 0)
 	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	  Float_t mass1 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.1396, 0.9383);
+	  Float_t mass2 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.9383, 0.1396);
 	  
 	  const Float_t kLambdaMass = 1.115;
 
 	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
+	    mass1 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.1396, 0.9383);
 
 	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
 	    
@@ -842,7 +896,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	    mass2 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.9383, 0.1396);
 
 	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
 
@@ -854,15 +908,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         // Phi
         if (fCutOnPhi)
         {
-          if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+          if (fCutResonancesV > 0 && assocCharge[j] * triggerCharge < 0)
           {
-            Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
+            Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.4937, 0.4937);
   
             const Float_t kPhimass = 1.019;
 
             if (TMath::Abs(mass - kPhimass*kPhimass) < fCutResonancesV * 5)
             {
-              mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.4937, 0.4937);
+              mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.4937, 0.4937);
 
               fControlConvResoncances->Fill(3, mass - kPhimass*kPhimass);
 
@@ -875,15 +929,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         // Rho
         if (fCutOnRho)
         {
-          if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+          if (fCutResonancesV > 0 && assocCharge[j] * triggerCharge < 0)
           {
-            Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+            Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.1396, 0.1396);
   
             const Float_t kRhomass = 0.770;
 
             if (TMath::Abs(mass - kRhomass*kRhomass) < fCutResonancesV * 5)
             {
-              mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+              mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, assocPt[j], eta[j], assocPhi[j], 0.1396, 0.1396);
 
               fControlConvResoncances->Fill(4, mass - kRhomass*kRhomass);
 
@@ -898,13 +952,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  // the variables & cuthave been developed by the HBT group 
 	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
 
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
+	  Float_t phi1 = triggerPhi;
+	  Float_t pt1 = triggerPt;
 	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
+	  Float_t phi2 = assocPhi[j];
+	  Float_t pt2 = assocPt[j];
 	      
 	  Float_t deta = triggerEta - eta[j];
 	      
@@ -912,8 +964,9 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
 	  {
 	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
+	    // (same as GetDPhiStar at fTwoTrackCutMinRadius and 2.5, with the precomputed terms)
+	    Float_t dphistar1 = FoldDPhiStar(phi1 - phi2 - triggerTermMin + assocTermMin[j]);
+	    Float_t dphistar2 = FoldDPhiStar(phi1 - phi2 - triggerTermMax + assocTermMax[j]);
 	    
 	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
 
@@ -921,9 +974,26 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	    Float_t dphistarmin = 1e5;
 	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
 	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+	      // terms at all radii of the scan, computed at the first pair which needs them
+	      if (!triggerScanDone)
+	      {
+		for (Int_t k=0; k<nRadii; k++)
+		  triggerScan[k] = GetDPhiStarTerm(pt1, triggerCharge, radii[k], bSign);
+		triggerScanDone = kTRUE;
+	      }
+	      if (assocScan.empty())
+		assocScan.resize(nAssoc * nRadii);
+	      const Double_t* assocScanJ = &assocScan[j * nRadii];
+	      if (!assocScanDone[j])
+	      {
+		for (Int_t k=0; k<nRadii; k++)
+		  assocScan[j * nRadii + k] = GetDPhiStarTerm(pt2, assocCharge[j], radii[k], bSign);
+		assocScanDone[j] = kTRUE;
+	      }
+
+	      for (Int_t k=0; k<nRadii; k++)
 	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
+		Float_t dphistar = FoldDPhiStar(phi1 - phi2 - triggerScan[k] + assocScanJ[k]);
 
 		Float_t dphistarabs = TMath::Abs(dphistar);
 		
@@ -938,7 +1008,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	      
 	      if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
 	      {
-// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+// 		Printf("Removed track pair %d %d with %f %f %f %f %f %f %f", i, j, deta, dphistarminabs, phi1, pt1, phi2, pt2, bSign);
 		continue;
 	      }
 
@@ -949,10 +1019,10 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
         
         Double_t vars[6];
         vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
+        vars[1] = assocPt[j];
+        vars[2] = triggerPt;
         vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
+        vars[4] = triggerPhi - assocPhi[j];
         if (vars[4] > 1.5 * TMath::Pi()) 
           vars[4] -= TMath::TwoPi();
         if (vars[4] < -0.5 * TMath::Pi())
@@ -960,7 +1030,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	vars[5] = zVtx;
 	
 	if (fillpT)
-	  weight = particle->Pt();
+	  weight = assocPt[j];
 	
 	Double_t useWeight = weight;
 	if (applyEfficiency)
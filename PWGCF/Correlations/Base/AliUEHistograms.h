@@ -117,6 +117,8 @@ protected:
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+  inline Double_t GetDPhiStarTerm(Float_t pt, Float_t charge, Float_t radius, Float_t bSign);
+  inline Float_t FoldDPhiStar(Float_t dphistar);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -180,7 +182,23 @@ Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1,
   // calculates dphistar
   //
   
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
+  return FoldDPhiStar(phi1 - phi2 - GetDPhiStarTerm(pt1, charge1, radius, bSign) + GetDPhiStarTerm(pt2, charge2, radius, bSign));
+}
+
+Double_t AliUEHistograms::GetDPhiStarTerm(Float_t pt, Float_t charge, Float_t radius, Float_t bSign)
+{ 
+  //
+  // bending of a particle between the vertex and radius (in m), the part of dphistar which depends on one particle
+  //
+  
+  return charge * bSign * TMath::ASin(0.075 * radius / pt);
+}
+
+Float_t AliUEHistograms::FoldDPhiStar(Float_t dphistar)
+{ 
+  //
+  // brings dphistar into the range used for the two-track cut
+  //
   
   static const Double_t kPi = TMath::Pi();
   
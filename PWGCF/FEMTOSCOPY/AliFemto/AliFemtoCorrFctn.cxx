@@ -3,6 +3,7 @@
 ///
 
 #include "AliFemtoCorrFctn.h"
+#include "AliFemtoPairBlock.h"
 
 AliFemtoCorrFctn::AliFemtoCorrFctn():
   fyAnalysis(nullptr),
@@ -34,6 +35,19 @@ void AliFemtoCorrFctn::AddMixedPair(AliFemtoPair*)
   cout << "AliFemtoCorrFctn::AddMixedPair -- Not implemented\n";
 }
 
+void AliFemtoCorrFctn::AddRealPairs(const AliFemtoPairBlock &block)
+{
+  for (size_t i = 0; i < block.Size(); ++i) {
+    AddRealPair(block.Pair(i));
+  }
+}
+void AliFemtoCorrFctn::AddMixedPairs(const AliFemtoPairBlock &block)
+{
+  for (size_t i = 0; i < block.Size(); ++i) {
+    AddMixedPair(block.Pair(i));
+  }
+}
+
 void AliFemtoCorrFctn::AddFirstParticle(AliFemtoParticle*, bool)
 {
   cout << "AliFemtoCorrFctn::AddFirstParticle -- Not implemented\n";
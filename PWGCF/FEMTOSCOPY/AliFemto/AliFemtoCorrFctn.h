@@ -14,6 +14,7 @@
 
 #include <TCollection.h>
 
+class AliFemtoPairBlock;
 
 /// \class AliFemtoCorrFctn
 /// \brief The pure-virtual base class for correlation functions
@@ -44,6 +45,15 @@ public:
   /// Not Implemented - Add background pair
   virtual void AddMixedPair(AliFemtoPair* aPir);
 
+  /// Add a block of signal pairs (batched pair mode of AliFemtoSimpleAnalysis)
+  ///
+  /// The default implementation calls AddRealPair for every pair of the
+  /// block. Correlation functions may override it to use the kinematic
+  /// variables precomputed by the block.
+  virtual void AddRealPairs(const AliFemtoPairBlock &block);
+  /// Add a block of background pairs, see AddRealPairs
+  virtual void AddMixedPairs(const AliFemtoPairBlock &block);
+
   /// Not Implemented - Add pair with optional
   virtual void AddFirstParticle(AliFemtoParticle *particle, bool mixing);
   virtual void AddSecondParticle(AliFemtoParticle *particle);
@@ -5,6 +5,7 @@
 
 #include "AliFemtoCorrFctn3DLCMSSym.h"
 #include "AliFemtoPairCut.h"
+#include "AliFemtoPairBlock.h"
 
 #include <TH3F.h>
 
@@ -198,6 +199,46 @@ void AliFemtoCorrFctn3DLCMSSym::AddMixedPair(AliFemtoPair* pair)
   }
 }
 
+//____________________________
+void AliFemtoCorrFctn3DLCMSSym::AddPairs(const AliFemtoPairBlock &block, TH3F &hist, TH3F &histW)
+{
+  for (size_t i = 0; i < block.Size(); ++i) {
+    if (fPairCut && !fPairCut->Pass(block.Pair(i))) {
+      continue;
+    }
+
+    const Double_t qout = block.QOutCMS(i),
+                   qside = block.QSideCMS(i),
+                   qlong = block.QLongCMS(i);
+
+    Int_t bin = hist.FindBin(qout, qside, qlong);
+
+    // avoid overflow bins
+    if (!(hist.IsBinOverflow(bin) or hist.IsBinUnderflow(bin))) {
+      hist.Fill(qout, qside, qlong, 1.0);
+      histW.Fill(qout, qside, qlong, block.QInv(i));
+    }
+  }
+}
+//____________________________
+void AliFemtoCorrFctn3DLCMSSym::AddRealPairs(const AliFemtoPairBlock &block)
+{
+  if (!fUseLCMS) {
+    AliFemtoCorrFctn::AddRealPairs(block);
+    return;
+  }
+  AddPairs(block, *fNumerator, *fNumeratorW);
+}
+//____________________________
+void AliFemtoCorrFctn3DLCMSSym::AddMixedPairs(const AliFemtoPairBlock &block)
+{
+  if (!fUseLCMS) {
+    AliFemtoCorrFctn::AddMixedPairs(block);
+    return;
+  }
+  AddPairs(block, *fDenominator, *fDenominatorW);
+}
+
 void AliFemtoCorrFctn3DLCMSSym::SetUseLCMS(int aUseLCMS)
 {
   fUseLCMS = aUseLCMS;
@@ -40,6 +40,11 @@ public:
   virtual void AddRealPair(AliFemtoPair* aPair);
   virtual void AddMixedPair(AliFemtoPair* aPair);
 
+  /// Fill from the precomputed LCMS components of the block
+  /// (falls back to the per-pair methods in the pair frame)
+  virtual void AddRealPairs(const AliFemtoPairBlock &block);
+  virtual void AddMixedPairs(const AliFemtoPairBlock &block);
+
   virtual void Finish();
 
   TH3F* Numerator();
@@ -56,6 +61,9 @@ public:
 
 private:
 
+  /// Fill hist and weighted histW with the LCMS pairs of the block
+  void AddPairs(const AliFemtoPairBlock &block, TH3F &hist, TH3F &histW);
+
   TH3F* fNumerator;     ///< Numerator
   TH3F* fDenominator;   ///< Denominator
   TH3F* fNumeratorW;    ///< Qinv-Weighted numerator
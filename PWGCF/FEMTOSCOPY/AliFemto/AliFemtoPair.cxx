@@ -10,11 +10,16 @@
 #include <TMath.h>
 #include "AliFemtoPair.h"
 
+#include <iostream>
+
 double AliFemtoPair::fgMaxDuInner = .8;
 double AliFemtoPair::fgMaxDzInner = 3.;
 double AliFemtoPair::fgMaxDuOuter = 1.4;
 double AliFemtoPair::fgMaxDzOuter = 3.2;
 
+unsigned long long AliFemtoPair::fgCacheEvaluations[AliFemtoPair::kNCacheGroups] = {0, 0, 0};
+unsigned long long AliFemtoPair::fgCacheHits[AliFemtoPair::kNCacheGroups] = {0, 0, 0};
+
 
 AliFemtoPair::AliFemtoPair():
   fTrack1(nullptr),
@@ -26,6 +31,13 @@ AliFemtoPair::AliFemtoPair():
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fKinematicsNotCalculated(1),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
+  fQOutPfCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -53,6 +65,7 @@ AliFemtoPair::AliFemtoPair():
   // Default constructor
   SetDefaultHalfFieldMergingPar();
   std::fill_n(fAverageSeparations, 4, NAN);
+  std::fill_n(fTpcSeparations, 2, NAN);
   std::fill_n(fFemtoWeightCache, 3, std::make_pair(0, NAN));
 }
 
@@ -66,6 +79,13 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fKinematicsNotCalculated(1),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
+  fQOutPfCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -93,9 +113,30 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   // Construct a pair from two particles
   SetDefaultHalfFieldMergingPar();
   std::fill_n(fAverageSeparations, 4, NAN);
+  std::fill_n(fTpcSeparations, 2, NAN);
   std::fill_n(fFemtoWeightCache, 3, std::make_pair(0, NAN));
 }
 
+void AliFemtoPair::ResetCacheCounters()
+{
+  std::fill_n(fgCacheEvaluations, static_cast<int>(kNCacheGroups), 0ULL);
+  std::fill_n(fgCacheHits, static_cast<int>(kNCacheGroups), 0ULL);
+}
+
+void AliFemtoPair::PrintCacheCounters()
+{
+  static const char *names[kNCacheGroups] = {"kinematics", "k*", "TPC separation"};
+
+#ifndef ALIFEMTOPAIR_CACHE_COUNTERS
+  std::cout << "AliFemtoPair cache counters are disabled, compile with -DALIFEMTOPAIR_CACHE_COUNTERS\n";
+  return;
+#endif
+  std::cout << "AliFemtoPair cache - evaluations / saved evaluations:\n";
+  for (int i = 0; i < kNCacheGroups; ++i) {
+    std::cout << "  " << names[i] << ": " << fgCacheEvaluations[i] << " / " << fgCacheHits[i] << "\n";
+  }
+}
+
 void AliFemtoPair::SetDefaultHalfFieldMergingPar()
 {
   fgMaxDuInner = 3;
@@ -137,6 +178,13 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fDKLong(aPair.fDKLong),
   fCVK(aPair.fCVK),
   fKStarCalc(aPair.fKStarCalc),
+  fKinematicsNotCalculated(aPair.fKinematicsNotCalculated),
+  fQInvCalc(aPair.fQInvCalc),
+  fKTCalc(aPair.fKTCalc),
+  fQOutCMSCalc(aPair.fQOutCMSCalc),
+  fQSideCMSCalc(aPair.fQSideCMSCalc),
+  fQLongCMSCalc(aPair.fQLongCMSCalc),
+  fQOutPfCalc(aPair.fQOutPfCalc),
   fNonIdParNotCalculatedGlobal(aPair.fNonIdParNotCalculatedGlobal),
   fMergingParNotCalculated(aPair.fMergingParNotCalculated),
   fWeightedAvSep(aPair.fWeightedAvSep),
@@ -164,6 +212,7 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   // Copy constructor
   /* no-op */
   std::fill_n(fAverageSeparations, 4, NAN);
+  std::fill_n(fTpcSeparations, 2, NAN);
 }
 
 AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
@@ -184,6 +233,14 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fCVK = aPair.fCVK;
   fKStarCalc = aPair.fKStarCalc;
 
+  fKinematicsNotCalculated = aPair.fKinematicsNotCalculated;
+  fQInvCalc = aPair.fQInvCalc;
+  fKTCalc = aPair.fKTCalc;
+  fQOutCMSCalc = aPair.fQOutCMSCalc;
+  fQSideCMSCalc = aPair.fQSideCMSCalc;
+  fQLongCMSCalc = aPair.fQLongCMSCalc;
+  fQOutPfCalc = aPair.fQOutPfCalc;
+
   fNonIdParNotCalculatedGlobal = aPair.fNonIdParNotCalculatedGlobal;
 
   fMergingParNotCalculated = aPair.fMergingParNotCalculated;
@@ -216,6 +273,7 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fClosestRowAtDCAV0NegV0Neg = aPair.fClosestRowAtDCAV0NegV0Neg;
 
   std::fill_n(fAverageSeparations, 4, NAN);
+  std::fill_n(fTpcSeparations, 2, NAN);
 
   return *this;
 }
@@ -233,15 +291,6 @@ double AliFemtoPair::MInv() const
     return tInvariantMass;
 }
 //_________________
-double AliFemtoPair::KT() const
-{
-  // transverse momentum
-  double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
-  tmp *= .5;
-
-  return tmp;
-}
-//_________________
 double AliFemtoPair::Rap() const
 {
   // longitudinal pair rapidity : Y = 0.5 ::log( E1 + E2 + pz1 + pz2 / E1 + E2 - pz1 - pz2 )
@@ -388,91 +437,65 @@ void AliFemtoPair::QYKPPF(double& qP, double& qT, double& q0) const
 
 
 //_________________
-double AliFemtoPair::QOutCMS() const
+void AliFemtoPair::CalcKinematics() const
 {
-  // relative momentum out component in lab frame
-  const AliFemtoThreeVector
-    &p1 = fTrack1->FourMomentum().vect(),
-    &p2 = fTrack2->FourMomentum().vect();
+  // Calculate the relative momentum variables sharing the same sums and
+  // differences of the momenta: qinv, kT, q in LCMS and q out in the pair
+  // frame. They are kept until one of the tracks changes.
+  fKinematicsNotCalculated = 0;
+  CountEvaluation(kCacheKinematics);
 
-  const double
-    dx = p1.x() - p2.x(),
-    px = p1.x() + p2.x(),
-
-    dy = p1.y() - p2.y(),
-    py = p1.y() + p2.y(),
-
-    k = dx*px + dy*py,
-    pt = ::sqrt(px*px + py*py);
+  const AliFemtoLorentzVector
+    &tmp1 = fTrack1->FourMomentum(),
+    &tmp2 = fTrack2->FourMomentum();
 
-  return CHECKED_DIVIDE_ELSE_ZERO(k, pt);
-}
+  // qinv
+  AliFemtoLorentzVector tDiff = tmp1 - tmp2;
+  fQInvCalc = -tDiff.m();
 
-//_________________
-double AliFemtoPair::QSideCMS() const
-{
-  // relative momentum side component in lab frame
-  const AliFemtoThreeVector
-    &p1 = fTrack1->FourMomentum().vect(),
-    &p2 = fTrack2->FourMomentum().vect();
+  // transverse momentum
+  fKTCalc = (tmp1 + tmp2).Perp() * .5;
 
   const double
-    x1 = p1.x(),
-    y1 = p1.y(),
-
-    x2 = p2.x(),
-    y2 = p2.y(),
+    x1 = tmp1.x(),
+    y1 = tmp1.y(),
 
-    xt = x1+x2,
-    yt = y1+y2,
+    x2 = tmp2.x(),
+    y2 = tmp2.y(),
 
-    k = 2.0 * (x2*y1 - x1*y2),
-    pt = ::sqrt(xt*xt + yt*yt);
-
-  return CHECKED_DIVIDE_ELSE_ZERO(k, pt);
-}
-
-//_________________________
-double AliFemtoPair::QLongCMS() const
-{
-  // relative momentum component in lab frame
-  const AliFemtoLorentzVector
-    &tmp1 = fTrack1->FourMomentum(),
-    &tmp2 = fTrack2->FourMomentum();
+    dx = x1 - x2,
+    xt = x1 + x2,
 
-  double dz = tmp1.z() - tmp2.z();
-  double zz = tmp1.z() + tmp2.z();
+    dy = y1 - y2,
+    yt = y1 + y2,
 
-  double dt = tmp1.t() - tmp2.t();
-  double tt = tmp1.t() + tmp2.t();
-
-  double beta = zz/tt;
-  double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
-
-  return gamma * (dz - beta*dt);
-}
+    kOut = dx*xt + dy*yt,
+    kSide = 2.0 * (x2*y1 - x1*y2),
+    pt = ::sqrt(xt*xt + yt*yt);
 
-//________________________________
-double AliFemtoPair::QOutPf() const
-{
-  // relative momentum out component in pair frame
-  const AliFemtoLorentzVector
-    &tmp1 = fTrack1->FourMomentum(),
-    &tmp2 = fTrack2->FourMomentum();
+  // relative momentum out and side components in lab frame
+  fQOutCMSCalc = CHECKED_DIVIDE_ELSE_ZERO(kOut, pt);
+  fQSideCMSCalc = CHECKED_DIVIDE_ELSE_ZERO(kSide, pt);
 
+  // relative momentum long component in lab frame
   const double
+    dz = tmp1.z() - tmp2.z(),
+    zz = tmp1.z() + tmp2.z(),
+
     dt = tmp1.t() - tmp2.t(),
     tt = tmp1.t() + tmp2.t(),
 
-    xt = tmp1.x() + tmp2.x(),
-    yt = tmp1.y() + tmp2.y(),
+    beta = zz/tt,
+    gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
 
-    pt = ::sqrt(xt*xt + yt*yt),
+  fQLongCMSCalc = gamma * (dz - beta*dt);
 
+  // relative momentum out component in pair frame
+  const double
     bOut = pt / tt,
     gammaOut = 1.0 / TMath::Sqrt((1.-bOut)*(1.+bOut));
 
-  return gammaOut * (QOutCMS() - bOut*dt);
+  fQOutPfCalc = gammaOut * (fQOutCMSCalc - bOut*dt);
 }
 
 #undef CHECKED_DIVIDE_ELSE_ZERO
@@ -625,19 +648,31 @@ double AliFemtoPair::Quality2() const
 double AliFemtoPair::NominalTpcExitSeparation() const
 {
   // separation at exit from STAR TPC
+  if (!std::isnan(fTpcSeparations[1])) {
+    CountHit(kCacheSeparation);
+    return fTpcSeparations[1];
+  }
+  CountEvaluation(kCacheSeparation);
+
   const auto &point1 = fTrack1->Track()->NominalTpcExitPoint(),
              &point2 = fTrack2->Track()->NominalTpcExitPoint();
 
-  return (point1 - point2).Mag();
+  return fTpcSeparations[1] = (point1 - point2).Mag();
 }
 
 double AliFemtoPair::NominalTpcEntranceSeparation() const
 {
   // separation at entrance to STAR TPC
+  if (!std::isnan(fTpcSeparations[0])) {
+    CountHit(kCacheSeparation);
+    return fTpcSeparations[0];
+  }
+  CountEvaluation(kCacheSeparation);
+
   const auto &point1 = fTrack1->Track()->NominalTpcEntrancePoint(),
              &point2 = fTrack2->Track()->NominalTpcEntrancePoint();
 
-  return (point1 - point2).Mag();
+  return fTpcSeparations[0] = (point1 - point2).Mag();
 }
 
 // double AliFemtoPair::NominalTpcAverageSeparation() const {
@@ -765,6 +800,7 @@ void AliFemtoPair::CalcNonIdPar() const
   // Use this instead of qXYZ() function when calculating
   // anything for non-identical particles
   fNonIdParNotCalculated=0;
+  CountEvaluation(kCacheNonId);
 
   const AliFemtoLorentzVector
     &p1 = fTrack1->FourMomentum(),
@@ -962,13 +998,17 @@ double
 AliFemtoPair::NominalTpcAverageSeparationTracks() const
 {
   if (std::isnan(fAverageSeparations[0])) {
+    CountEvaluation(kCacheSeparation);
     fAverageSeparations[0] = CalcAvgSepTracks(*fTrack1->Track(), *fTrack2->Track());
+  } else {
+    CountHit(kCacheSeparation);
   }
   return fAverageSeparations[0];
 }
 
 void AliFemtoPair::FillCacheAvgSepTrackV0() const
 {
+  CountEvaluation(kCacheSeparation);
   const AliFemtoTrack *trk = fTrack1->Track() ?: fTrack2->Track();
   const AliFemtoV0 *v0 = fTrack2->V0() ?: fTrack1->V0();
 
@@ -979,6 +1019,7 @@ void AliFemtoPair::FillCacheAvgSepTrackV0() const
 
 void AliFemtoPair::FillCacheAvgSepV0V0() const
 {
+  CountEvaluation(kCacheSeparation);
   CalcAvgSepV0V0(*fTrack1->V0(),
                  *fTrack2->V0(),
                  fAverageSeparations[0],
@@ -993,6 +1034,8 @@ AliFemtoPair::NominalTpcAverageSeparationTrackV0Neg() const
 {
   if (std::isnan(fAverageSeparations[1])) {
     FillCacheAvgSepTrackV0();
+  } else {
+    CountHit(kCacheSeparation);
   }
   return fAverageSeparations[0];
 }
@@ -1002,6 +1045,8 @@ AliFemtoPair::NominalTpcAverageSeparationTrackV0Pos() const
 {
   if (std::isnan(fAverageSeparations[1])) {
     FillCacheAvgSepTrackV0();
+  } else {
+    CountHit(kCacheSeparation);
   }
   return fAverageSeparations[1];
 }
@@ -1011,6 +1056,8 @@ AliFemtoPair::NominalTpcAverageSeparationV0NegV0Neg() const
 {
   if (std::isnan(fAverageSeparations[3])) {
     FillCacheAvgSepV0V0();
+  } else {
+    CountHit(kCacheSeparation);
   }
 
   return fAverageSeparations[0];
@@ -1021,6 +1068,8 @@ AliFemtoPair::NominalTpcAverageSeparationV0NegV0Pos() const
 {
   if (std::isnan(fAverageSeparations[3])) {
     FillCacheAvgSepV0V0();
+  } else {
+    CountHit(kCacheSeparation);
   }
 
   return fAverageSeparations[1];
@@ -1031,6 +1080,8 @@ AliFemtoPair::NominalTpcAverageSeparationV0PosV0Neg() const
 {
   if (std::isnan(fAverageSeparations[3])) {
     FillCacheAvgSepV0V0();
+  } else {
+    CountHit(kCacheSeparation);
   }
 
   return fAverageSeparations[2];
@@ -1041,6 +1092,8 @@ AliFemtoPair::NominalTpcAverageSeparationV0PosV0Pos() const
 {
   if (std::isnan(fAverageSeparations[3])) {
     FillCacheAvgSepV0V0();
+  } else {
+    CountHit(kCacheSeparation);
   }
 
   return fAverageSeparations[3];
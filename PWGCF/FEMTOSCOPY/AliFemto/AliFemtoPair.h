@@ -42,6 +42,30 @@ public:
   void SetTrack1(const AliFemtoParticle* trkPtr);
   void SetTrack2(const AliFemtoParticle* trkPtr);
 
+  /// Drop all lazily calculated pair quantities
+  ///
+  /// Done automatically by SetTrack1/SetTrack2; call it explicitly if the
+  /// momentum of one of the particles was changed in place.
+  void InvalidateCache();
+
+  /// Groups of lazily calculated pair quantities
+  enum ECacheGroup {
+    kCacheKinematics = 0, ///< qinv, kT, LCMS and pair-frame q components
+    kCacheNonId = 1,      ///< k*, its PRF components and CVK
+    kCacheSeparation = 2, ///< nominal TPC entrance/exit and average separations
+    kNCacheGroups = 3
+  };
+
+  /// Number of times the quantities of a group were calculated, for all
+  /// pairs since the last ResetCacheCounters(). The counters are only
+  /// incremented if compiled with ALIFEMTOPAIR_CACHE_COUNTERS (debugging:
+  /// they are not thread-safe and cost time in the pair loop), else they stay 0
+  static unsigned long long CacheEvaluations(ECacheGroup group);
+  /// Number of requests answered from the cache, i.e. evaluations saved
+  static unsigned long long CacheHits(ECacheGroup group);
+  static void ResetCacheCounters();
+  static void PrintCacheCounters();
+
   AliFemtoLorentzVector FourMomentumDiff() const;
   AliFemtoLorentzVector FourMomentumSum() const;
   double QInv() const;
@@ -234,6 +258,19 @@ private:
   mutable double fCVK;    // cos between velocity and relative momentum k*
   mutable double fKStarCalc; // momemntum of first particle in PRF - k*
   void CalcNonIdPar() const;
+  void UseNonIdPar() const;
+
+  mutable short fKinematicsNotCalculated; // Set to 1 until the common kinematic variables are calculated for this pair
+  mutable double fQInvCalc;      // qinv
+  mutable double fKTCalc;        // pair transverse momentum kT
+  mutable double fQOutCMSCalc;   // q out component in LCMS
+  mutable double fQSideCMSCalc;  // q side component in LCMS
+  mutable double fQLongCMSCalc;  // q long component in LCMS
+  mutable double fQOutPfCalc;    // q out component in the pair frame
+  void CalcKinematics() const;
+  void UseKinematics() const;
+
+  mutable double fTpcSeparations[2]; // nominal TPC entrance and exit separations (NAN if not calculated)
 
   mutable short fNonIdParNotCalculatedGlobal; // If global k* was calculated
  /* mutable double fDKSideGlobal;
@@ -287,6 +324,12 @@ private:
   static double fgMaxDuOuter; // Minimum cluster separation in x in outer TPC padrow
   static double fgMaxDzOuter; // Minimum cluster separation in z in outer TPC padrow
 
+  static unsigned long long fgCacheEvaluations[kNCacheGroups]; // calculations of the cached quantities
+  static unsigned long long fgCacheHits[kNCacheGroups];        // requests answered from the cache
+
+  static void CountEvaluation(ECacheGroup group);
+  static void CountHit(ECacheGroup group);
+
   void FillCacheAvgSepTrackV0() const;
   void FillCacheAvgSepV0V0() const;
 
@@ -305,6 +348,8 @@ private:
 
 inline void AliFemtoPair::ResetParCalculated(){
   fNonIdParNotCalculated=1;
+  fKinematicsNotCalculated=1;
+  std::fill_n(fTpcSeparations, 2, NAN);
   fNonIdParNotCalculatedGlobal=1;
   fMergingParNotCalculated=1;
   fMergingParNotCalculatedTrkV0Pos=1;
@@ -328,45 +373,100 @@ inline void AliFemtoPair::SetTrack2(const AliFemtoParticle* trkPtr){
   ResetParCalculated();
 }
 
+inline void AliFemtoPair::InvalidateCache(){
+  ResetParCalculated();
+}
+
+inline void AliFemtoPair::UseNonIdPar() const{
+  if (fNonIdParNotCalculated) CalcNonIdPar();
+  else CountHit(kCacheNonId);
+}
+inline void AliFemtoPair::UseKinematics() const{
+  if (fKinematicsNotCalculated) CalcKinematics();
+  else CountHit(kCacheKinematics);
+}
+
+inline void AliFemtoPair::CountEvaluation(ECacheGroup group){
+#ifdef ALIFEMTOPAIR_CACHE_COUNTERS
+  ++fgCacheEvaluations[group];
+#else
+  (void) group;
+#endif
+}
+inline void AliFemtoPair::CountHit(ECacheGroup group){
+#ifdef ALIFEMTOPAIR_CACHE_COUNTERS
+  ++fgCacheHits[group];
+#else
+  (void) group;
+#endif
+}
+
+inline unsigned long long AliFemtoPair::CacheEvaluations(ECacheGroup group){
+  return fgCacheEvaluations[group];
+}
+inline unsigned long long AliFemtoPair::CacheHits(ECacheGroup group){
+  return fgCacheHits[group];
+}
+
 inline AliFemtoParticle* AliFemtoPair::Track1() const {return fTrack1;}
 inline AliFemtoParticle* AliFemtoPair::Track2() const {return fTrack2;}
 
 inline double AliFemtoPair::KSide() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fDKSide;
 }
 inline double AliFemtoPair::KOut() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fDKOut;
 }
 inline double AliFemtoPair::KLong() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fDKLong;
 }
 inline double AliFemtoPair::KStar() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fKStarCalc;
 }
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return -tDiff.m();
+  UseKinematics();
+  return fQInvCalc;
+}
+inline double AliFemtoPair::KT() const {
+  UseKinematics();
+  return fKTCalc;
+}
+inline double AliFemtoPair::QOutCMS() const {
+  UseKinematics();
+  return fQOutCMSCalc;
+}
+inline double AliFemtoPair::QSideCMS() const {
+  UseKinematics();
+  return fQSideCMSCalc;
+}
+inline double AliFemtoPair::QLongCMS() const {
+  UseKinematics();
+  return fQLongCMSCalc;
+}
+inline double AliFemtoPair::QOutPf() const {
+  UseKinematics();
+  return fQOutPfCalc;
 }
 
 // Fabrice private <<<
 inline double AliFemtoPair::KStarSide() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fDKSide;//mKStarSide;
 }
 inline double AliFemtoPair::KStarOut() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fDKOut;//mKStarOut;
 }
 inline double AliFemtoPair::KStarLong() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fDKLong;//mKStarLong;
 }
 inline double AliFemtoPair::CVK() const{
-  if(fNonIdParNotCalculated) CalcNonIdPar();
+  UseNonIdPar();
   return fCVK;
 }
 
@@ -0,0 +1,92 @@
+///
+/// \file AliFemtoPairBlock.cxx
+///
+
+#include "AliFemtoPairBlock.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+AliFemtoPairBlock::AliFemtoPairBlock():
+  fSize(0),
+  fPairs(kCapacity, nullptr)
+{
+  for (auto &pair : fPairs) {
+    pair = new AliFemtoPair;
+  }
+}
+
+AliFemtoPairBlock::~AliFemtoPairBlock()
+{
+  for (auto pair : fPairs) {
+    delete pair;
+  }
+}
+
+void AliFemtoPairBlock::Compute()
+{
+  // Single pass over the accepted pairs, without branches other than
+  // selects, so that the loop can be vectorized. The expressions follow
+  // the corresponding AliFemtoPair methods term by term.
+
+  const size_t n = fSize;
+
+  for (size_t i = 0; i < n; ++i) {
+    const double
+      px1 = fPx1[i], py1 = fPy1[i], pz1 = fPz1[i], pE1 = fE1[i],
+      px2 = fPx2[i], py2 = fPy2[i], pz2 = fPz2[i], pE2 = fE2[i],
+
+      tPx = px1 + px2,
+      tPy = py1 + py2,
+      tPz = pz1 + pz2,
+      tPE = pE1 + pE2,
+
+      dx = px1 - px2,
+      dy = py1 - py2,
+      dz = pz1 - pz2,
+      dE = pE1 - pE2;
+
+    // QInv
+    const double tDiffM2 = dE*dE - (dx*dx + dy*dy + dz*dz);
+    fQInv[i] = tDiffM2 < 0 ? std::sqrt(-tDiffM2) : -std::sqrt(tDiffM2);
+
+    // Bertsch-Pratt components in LCMS
+    const double pt = std::sqrt(tPx*tPx + tPy*tPy),
+                 kOut = dx*tPx + dy*tPy,
+                 kSide = 2.0 * (px2*py1 - px1*py2);
+    fQOutCMS[i] = pt == 0.0 ? 0.0 : kOut / pt;
+    fQSideCMS[i] = pt == 0.0 ? 0.0 : kSide / pt;
+
+    const double betaL = tPz / tPE,
+                 gammaL = 1.0 / std::sqrt((1. - betaL) * (1. + betaL));
+    fQLongCMS[i] = gammaL * (dz - betaL*dE);
+
+    // k* and its components in the pair rest frame
+    const double
+      mass1_sqrd = std::max(0.0, pE1*pE1 - (px1*px1 + py1*py1 + pz1*pz1)),
+      mass2_sqrd = std::max(0.0, pE2*pE2 - (px2*px2 + py2*py2 + pz2*pz2)),
+      tPtrans2 = tPx*tPx + tPy*tPy,
+      tMtrans2 = tPE*tPE - tPz*tPz,
+      tPinv = std::sqrt(tMtrans2 - tPtrans2),
+      tMtrans = std::sqrt(tMtrans2),
+      tPtrans = std::sqrt(tPtrans2),
+      tQinvL = dE*dE - dx*dx - dy*dy - dz*dz,
+      tQm = (mass1_sqrd - mass2_sqrd) / tPinv;
+
+    fKStar[i] = std::sqrt(tQm*tQm - tQinvL) / 2;
+
+    const double beta = tPz / tPE,
+                 gamma = tPE / tMtrans,
+                 pz1L = gamma * (pz1 - beta * pE1),
+                 pE1L = gamma * (pE1 - beta * pz1),
+                 px1R = (px1*tPx + py1*tPy) / tPtrans,
+                 py1R = (-px1*tPy + py1*tPx) / tPtrans,
+                 betaT = tPtrans / tMtrans,
+                 gammaT = tMtrans / tPinv;
+
+    fKStarLong[i] = pz1L;
+    fKStarSide[i] = py1R;
+    fKStarOut[i] = gammaT * (px1R - betaT * pE1L);
+  }
+}
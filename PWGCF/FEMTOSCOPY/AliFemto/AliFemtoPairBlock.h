@@ -0,0 +1,165 @@
+///
+/// \file AliFemtoPairBlock.h
+///
+
+#ifndef ALIFEMTOPAIRBLOCK_H
+#define ALIFEMTOPAIRBLOCK_H
+
+#include "AliFemtoPair.h"
+#include "AliFemtoParticleBuffer.h"
+
+#include <vector>
+
+
+/// \class AliFemtoPairBlock
+/// \brief A block of pairs with their kinematics computed in one pass
+///
+/// Used by AliFemtoSimpleAnalysis in the batched pair mode. Pairs are
+/// prepared one slot at a time from two AliFemtoParticleBuffer objects,
+/// the analysis pair cut is applied to the AliFemtoPair of the slot and
+/// the pair is accepted or the slot is reused for the next pair. When the
+/// block is full, Compute() evaluates the relative-momentum variables of
+/// all accepted pairs in a single loop over contiguous arrays (written so
+/// that the compiler can vectorize it) and the block is handed to the
+/// correlation functions via AliFemtoCorrFctn::AddRealPairs() /
+/// AddMixedPairs().
+///
+/// The computed values are identical to the ones of the corresponding
+/// AliFemtoPair methods:
+///  - QInv:                          AliFemtoPair::QInv()
+///  - QOutCMS, QSideCMS, QLongCMS:   AliFemtoPair::QOutCMS() etc. (LCMS)
+///  - KStar:                         AliFemtoPair::KStar()
+///  - KStarOut, KStarSide, KStarLong: AliFemtoPair::KStarOut() etc. (PRF)
+///
+class AliFemtoPairBlock {
+public:
+  enum { kCapacity = 256 };
+
+  AliFemtoPairBlock();
+  virtual ~AliFemtoPairBlock();
+
+  /// Set up the next free slot with particle i1 of buffer1 as first
+  /// and particle i2 of buffer2 as second track, and return its pair
+  AliFemtoPair* Prepare(const AliFemtoParticleBuffer &buffer1, size_t i1,
+                        const AliFemtoParticleBuffer &buffer2, size_t i2);
+
+  /// Keep the last prepared pair in the block
+  void Accept();
+
+  /// Compute the kinematic variables of all accepted pairs
+  void Compute();
+
+  /// Remove all pairs from the block
+  void Clear();
+
+  size_t Size() const;
+  bool Full() const;
+
+  AliFemtoPair* Pair(size_t i) const;
+  double QInv(size_t i) const;
+  double QOutCMS(size_t i) const;
+  double QSideCMS(size_t i) const;
+  double QLongCMS(size_t i) const;
+  double KStar(size_t i) const;
+  double KStarOut(size_t i) const;
+  double KStarSide(size_t i) const;
+  double KStarLong(size_t i) const;
+
+protected:
+  size_t fSize;                        ///< number of accepted pairs
+  std::vector<AliFemtoPair*> fPairs;   ///< pair objects of the slots (owned)
+
+  // momenta of the first and second track of each slot
+  double fPx1[kCapacity], fPy1[kCapacity], fPz1[kCapacity], fE1[kCapacity];
+  double fPx2[kCapacity], fPy2[kCapacity], fPz2[kCapacity], fE2[kCapacity];
+
+  // computed kinematics
+  double fQInv[kCapacity];
+  double fQOutCMS[kCapacity], fQSideCMS[kCapacity], fQLongCMS[kCapacity];
+  double fKStar[kCapacity];
+  double fKStarOut[kCapacity], fKStarSide[kCapacity], fKStarLong[kCapacity];
+
+private:
+  AliFemtoPairBlock(const AliFemtoPairBlock&);            // not implemented
+  AliFemtoPairBlock& operator=(const AliFemtoPairBlock&); // not implemented
+};
+
+inline AliFemtoPair* AliFemtoPairBlock::Prepare(const AliFemtoParticleBuffer &buffer1, size_t i1,
+                                                const AliFemtoParticleBuffer &buffer2, size_t i2)
+{
+  const size_t k = fSize;
+  fPx1[k] = buffer1.Px(i1); fPy1[k] = buffer1.Py(i1); fPz1[k] = buffer1.Pz(i1); fE1[k] = buffer1.E(i1);
+  fPx2[k] = buffer2.Px(i2); fPy2[k] = buffer2.Py(i2); fPz2[k] = buffer2.Pz(i2); fE2[k] = buffer2.E(i2);
+
+  AliFemtoPair *pair = fPairs[k];
+  pair->SetTrack1(buffer1.Particle(i1));
+  pair->SetTrack2(buffer2.Particle(i2));
+  return pair;
+}
+
+inline void AliFemtoPairBlock::Accept()
+{
+  ++fSize;
+}
+
+inline void AliFemtoPairBlock::Clear()
+{
+  fSize = 0;
+}
+
+inline size_t AliFemtoPairBlock::Size() const
+{
+  return fSize;
+}
+
+inline bool AliFemtoPairBlock::Full() const
+{
+  return fSize == kCapacity;
+}
+
+inline AliFemtoPair* AliFemtoPairBlock::Pair(size_t i) const
+{
+  return fPairs[i];
+}
+
+inline double AliFemtoPairBlock::QInv(size_t i) const
+{
+  return fQInv[i];
+}
+
+inline double AliFemtoPairBlock::QOutCMS(size_t i) const
+{
+  return fQOutCMS[i];
+}
+
+inline double AliFemtoPairBlock::QSideCMS(size_t i) const
+{
+  return fQSideCMS[i];
+}
+
+inline double AliFemtoPairBlock::QLongCMS(size_t i) const
+{
+  return fQLongCMS[i];
+}
+
+inline double AliFemtoPairBlock::KStar(size_t i) const
+{
+  return fKStar[i];
+}
+
+inline double AliFemtoPairBlock::KStarOut(size_t i) const
+{
+  return fKStarOut[i];
+}
+
+inline double AliFemtoPairBlock::KStarSide(size_t i) const
+{
+  return fKStarSide[i];
+}
+
+inline double AliFemtoPairBlock::KStarLong(size_t i) const
+{
+  return fKStarLong[i];
+}
+
+#endif
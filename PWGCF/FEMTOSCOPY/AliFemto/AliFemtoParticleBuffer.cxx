@@ -0,0 +1,45 @@
+///
+/// \file AliFemtoParticleBuffer.cxx
+///
+
+#include "AliFemtoParticleBuffer.h"
+
+
+AliFemtoParticleBuffer::AliFemtoParticleBuffer():
+  fParticles(),
+  fPx(),
+  fPy(),
+  fPz(),
+  fE()
+{
+}
+
+void AliFemtoParticleBuffer::Fill(const AliFemtoParticleCollection &collection)
+{
+  Clear();
+
+  const size_t n = collection.size();
+  fParticles.reserve(n);
+  fPx.reserve(n);
+  fPy.reserve(n);
+  fPz.reserve(n);
+  fE.reserve(n);
+
+  for (auto particle : collection) {
+    const AliFemtoLorentzVector &p = particle->FourMomentum();
+    fParticles.push_back(particle);
+    fPx.push_back(p.x());
+    fPy.push_back(p.y());
+    fPz.push_back(p.z());
+    fE.push_back(p.e());
+  }
+}
+
+void AliFemtoParticleBuffer::Clear()
+{
+  fParticles.clear();
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fE.clear();
+}
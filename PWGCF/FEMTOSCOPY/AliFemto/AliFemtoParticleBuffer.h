@@ -0,0 +1,87 @@
+///
+/// \file AliFemtoParticleBuffer.h
+///
+
+#ifndef ALIFEMTOPARTICLEBUFFER_H
+#define ALIFEMTOPARTICLEBUFFER_H
+
+#include "AliFemtoParticleCollection.h"
+
+#include <vector>
+
+
+/// \class AliFemtoParticleBuffer
+/// \brief Contiguous (structure-of-arrays) copy of a particle collection
+///
+/// Holds the four-momenta of the particles of an AliFemtoParticleCollection
+/// in separate contiguous arrays, together with the pointers to the
+/// particles themselves, in the order of the collection. The pair loops of
+/// AliFemtoSimpleAnalysis index these arrays instead of walking the list,
+/// and AliFemtoPairBlock gathers the momenta of many pairs from them.
+///
+/// The buffer does not own the particles; it is filled once per event from
+/// the collection and keeps its storage when refilled.
+///
+class AliFemtoParticleBuffer {
+public:
+  AliFemtoParticleBuffer();
+
+  /// Replace the contents with the particles of the collection
+  void Fill(const AliFemtoParticleCollection &collection);
+
+  /// Remove all particles, the allocated storage is kept
+  void Clear();
+
+  size_t Size() const;
+  bool Empty() const;
+
+  AliFemtoParticle* Particle(size_t i) const;
+  double Px(size_t i) const;
+  double Py(size_t i) const;
+  double Pz(size_t i) const;
+  double E(size_t i) const;
+
+protected:
+  std::vector<AliFemtoParticle*> fParticles; ///< particles, not owned
+  std::vector<double> fPx;                   ///< x-component of the momentum
+  std::vector<double> fPy;                   ///< y-component of the momentum
+  std::vector<double> fPz;                   ///< z-component of the momentum
+  std::vector<double> fE;                    ///< energy
+};
+
+inline size_t AliFemtoParticleBuffer::Size() const
+{
+  return fParticles.size();
+}
+
+inline bool AliFemtoParticleBuffer::Empty() const
+{
+  return fParticles.empty();
+}
+
+inline AliFemtoParticle* AliFemtoParticleBuffer::Particle(size_t i) const
+{
+  return fParticles[i];
+}
+
+inline double AliFemtoParticleBuffer::Px(size_t i) const
+{
+  return fPx[i];
+}
+
+inline double AliFemtoParticleBuffer::Py(size_t i) const
+{
+  return fPy[i];
+}
+
+inline double AliFemtoParticleBuffer::Pz(size_t i) const
+{
+  return fPz[i];
+}
+
+inline double AliFemtoParticleBuffer::E(size_t i) const
+{
+  return fE[i];
+}
+
+#endif
@@ -67,7 +67,9 @@
 AliFemtoPicoEvent::AliFemtoPicoEvent() :
   fFirstParticleCollection(0),
   fSecondParticleCollection(0),
-  fThirdParticleCollection(0)
+  fThirdParticleCollection(0),
+  fFirstParticleBuffer(),
+  fSecondParticleBuffer()
 {
   // Default constructor
   fFirstParticleCollection = new AliFemtoParticleCollection;
@@ -78,7 +80,9 @@ AliFemtoPicoEvent::AliFemtoPicoEvent() :
 AliFemtoPicoEvent::AliFemtoPicoEvent(const AliFemtoPicoEvent& aPicoEvent) :
   fFirstParticleCollection(0),
   fSecondParticleCollection(0),
-  fThirdParticleCollection(0)
+  fThirdParticleCollection(0),
+  fFirstParticleBuffer(),
+  fSecondParticleBuffer()
 {
   // Copy constructor
   AliFemtoParticleIterator iter;
@@ -192,7 +196,24 @@ AliFemtoPicoEvent& AliFemtoPicoEvent::operator=(const AliFemtoPicoEvent& aPicoEv
       fThirdParticleCollection->push_back(*iter);
     }
   }
+  fFirstParticleBuffer.Clear();
+  fSecondParticleBuffer.Clear();
 
   return *this;
 }
-
+//_________________
+void AliFemtoPicoEvent::Clear()
+{
+  // Delete the particles of all collections; the collections and the
+  // storage of the buffers are kept, such that the event can be refilled
+  AliFemtoParticleCollection *collections[3] = {fFirstParticleCollection, fSecondParticleCollection, fThirdParticleCollection};
+  for (auto collection : collections) {
+    if (!collection) continue;
+    for (auto particle : *collection) {
+      delete particle;
+    }
+    collection->clear();
+  }
+  fFirstParticleBuffer.Clear();
+  fSecondParticleBuffer.Clear();
+}
@@ -43,6 +43,7 @@
 #define ALIFEMTOPICOEVENT_H
 
 #include "AliFemtoParticleCollection.h"
+#include "AliFemtoParticleBuffer.h"
 
 class AliFemtoPicoEvent{
 public:
@@ -58,14 +59,32 @@ public:
   AliFemtoParticleCollection* SecondParticleCollection();
   AliFemtoParticleCollection* ThirdParticleCollection();
 
+  // contiguous copies of the particle collections, (re)filled on access
+  // when the collection changed size
+  AliFemtoParticleBuffer* FirstParticleBuffer();
+  AliFemtoParticleBuffer* SecondParticleBuffer();
+
+  // delete all particles, keeping the collections for reuse of the event
+  void Clear();
+
 private:
   AliFemtoParticleCollection* fFirstParticleCollection;  // Collection of particles of type 1
   AliFemtoParticleCollection* fSecondParticleCollection; // Collection of particles of type 2
   AliFemtoParticleCollection* fThirdParticleCollection;  // Collection of particles of type 3
+  AliFemtoParticleBuffer fFirstParticleBuffer;           // Contiguous copy of the particles of type 1
+  AliFemtoParticleBuffer fSecondParticleBuffer;          // Contiguous copy of the particles of type 2
 };
 
 inline AliFemtoParticleCollection* AliFemtoPicoEvent::FirstParticleCollection(){return fFirstParticleCollection;}
 inline AliFemtoParticleCollection* AliFemtoPicoEvent::SecondParticleCollection(){return fSecondParticleCollection;}
 inline AliFemtoParticleCollection* AliFemtoPicoEvent::ThirdParticleCollection(){return fThirdParticleCollection;}
+inline AliFemtoParticleBuffer* AliFemtoPicoEvent::FirstParticleBuffer(){
+  if (fFirstParticleBuffer.Size() != fFirstParticleCollection->size()) fFirstParticleBuffer.Fill(*fFirstParticleCollection);
+  return &fFirstParticleBuffer;
+}
+inline AliFemtoParticleBuffer* AliFemtoPicoEvent::SecondParticleBuffer(){
+  if (fSecondParticleBuffer.Size() != fSecondParticleCollection->size()) fSecondParticleBuffer.Fill(*fSecondParticleCollection);
+  return &fSecondParticleBuffer;
+}
 
 #endif
@@ -9,6 +9,8 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoParticleBuffer.h"
+#include "AliFemtoPairBlock.h"
 
 #include <string>
 #include <iostream>
@@ -183,7 +185,10 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fBatchedPairs(kFALSE),
+  fPairBlock(nullptr),
+  fRecycledPicoEvent(nullptr)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +210,10 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fBatchedPairs(a.fBatchedPairs),
+  fPairBlock(nullptr),
+  fRecycledPicoEvent(nullptr)
 {
   /// Copy constructor
 
@@ -317,6 +325,9 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     }
     delete fMixingBuffer;
   }
+
+  delete fPairBlock;
+  delete fRecycledPicoEvent;
 }
 //______________________
 AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAnalysis& aAna)
@@ -402,6 +413,7 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fBatchedPairs = aAna.fBatchedPairs;
 
   return *this;
 }
@@ -473,7 +485,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // Buffer.
   // No memory leak: we will delete picoevents when they come out of the
   // mixing buffer
-  fPicoEvent = new AliFemtoPicoEvent;
+  fPicoEvent = NewPicoEvent();
 
   AliFemtoParticleCollection *collection1 = fPicoEvent->FirstParticleCollection(),
                              *collection2 = fPicoEvent->SecondParticleCollection();
@@ -482,7 +494,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   if (collection1 == nullptr || collection2 == nullptr) {
     cout << "E-AliFemtoSimpleAnalysis::ProcessEvent: new PicoEvent is missing particle collections!\n";
     EventEnd(hbtEvent);  // cleanup for EbyE
-    delete fPicoEvent;
+    RecyclePicoEvent(fPicoEvent);
     return;
   }
 
@@ -526,7 +538,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
 
   if (!tmpPassEvent) {
     EventEnd(hbtEvent);
-    delete fPicoEvent;
+    RecyclePicoEvent(fPicoEvent);
     return;
   }
 
@@ -535,7 +547,13 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
     collection2 = nullptr;
   }
 
-  MakePairs("real", collection1, collection2, EnablePairMonitors());
+  if (fBatchedPairs) {
+    MakePairsBatched("real", *fPicoEvent->FirstParticleBuffer(),
+                     collection2 ? fPicoEvent->SecondParticleBuffer() : nullptr,
+                     EnablePairMonitors());
+  } else {
+    MakePairs("real", collection1, collection2, EnablePairMonitors());
+  }
 
   if (fVerbose) {
     cout << "AliFemtoSimpleAnalysis::ProcessEvent() - reals done ";
@@ -544,8 +562,20 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   //---- Make pairs for mixed events, looping over events in mixingBuffer ----//
   for (auto storedEvent : *fMixingBuffer) {
 
+    if (fBatchedPairs) {
+      if (AnalyzeIdenticalParticles()) {
+        MakePairsBatched("mixed", *fPicoEvent->FirstParticleBuffer(),
+                                  storedEvent->FirstParticleBuffer());
+      } else {
+        MakePairsBatched("mixed", *fPicoEvent->FirstParticleBuffer(),
+                                  storedEvent->SecondParticleBuffer());
+
+        MakePairsBatched("mixed", *storedEvent->FirstParticleBuffer(),
+                                  fPicoEvent->SecondParticleBuffer());
+      }
+
     // If identical - only mix the first particle collections
-    if (AnalyzeIdenticalParticles()) {
+    } else if (AnalyzeIdenticalParticles()) {
       MakePairs("mixed", collection1, storedEvent->FirstParticleCollection());
 
     // If non-identical - mix both combinations of first and second particles
@@ -563,13 +593,21 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   }
 
   //--------- If mixing buffer is full, delete oldest event ---------//
-  if ( MixingBufferFull() ) {
-    delete MixingBuffer()->back();
-    MixingBuffer()->pop_back();
-  }
+  if (fBatchedPairs && MixingBufferFull() && !MixingBuffer()->empty()) {
+    // ring: the oldest entry becomes the newest, its event is recycled
+    AliFemtoPicoEventCollection &buffer = *MixingBuffer();
+    buffer.splice(buffer.begin(), buffer, std::prev(buffer.end()));
+    RecyclePicoEvent(buffer.front());
+    buffer.front() = fPicoEvent;
+  } else {
+    if ( MixingBufferFull() ) {
+      delete MixingBuffer()->back();
+      MixingBuffer()->pop_back();
+    }
 
-  //-------- Add current event (fPicoEvent) to mixing buffer --------//
-  MixingBuffer()->push_front(fPicoEvent);
+    //-------- Add current event (fPicoEvent) to mixing buffer --------//
+    MixingBuffer()->push_front(fPicoEvent);
+  }
 
   EventEnd(hbtEvent);  // cleanup for EbyE
   //cout << "AliFemtoSimpleAnalysis::ProcessEvent() - return to caller ... " << endl;
@@ -680,6 +718,104 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
   delete tPair;
 }
 //_________________________
+void AliFemtoSimpleAnalysis::MakePairsBatched(const char* typeIn,
+                                              const AliFemtoParticleBuffer &buffer1,
+                                              const AliFemtoParticleBuffer *buffer2,
+                                              Bool_t enablePairMonitors)
+{
+/// Batched version of MakePairs: the pairs passing the pair cut are
+/// collected in fPairBlock, which is handed to the CFs when full.
+/// The pairs, their order and the swapping of identical particles are
+/// the same as in MakePairs.
+
+  bool these_are_real_pairs = 0 == strcmp(typeIn, "real");
+
+  if (!these_are_real_pairs && strcmp(typeIn, "mixed")) {
+    std::cerr << "Problem with pair type, type = " << typeIn << "\n";
+    return;
+  }
+
+  // Used to swap particle 1 & 2 in identical-particle analysis
+  bool swpart = fNeventsProcessed % 2;
+
+  if (!fPairBlock) {
+    fPairBlock = new AliFemtoPairBlock;
+  }
+  fPairBlock->Clear();
+
+  const bool identical = (buffer2 == nullptr);
+  const AliFemtoParticleBuffer &inner = identical ? buffer1 : *buffer2;
+  const size_t n1 = buffer1.Size(),
+               n2 = inner.Size();
+
+  for (size_t i = 0; i < n1; ++i) {
+    for (size_t j = identical ? i + 1 : 0; j < n2; ++j) {
+      AliFemtoPair *tPair;
+      if (identical && swpart) {
+        tPair = fPairBlock->Prepare(inner, j, buffer1, i);
+      } else {
+        tPair = fPairBlock->Prepare(buffer1, i, inner, j);
+      }
+      if (identical) {
+        swpart = !swpart;
+      }
+
+      bool tmpPassPair = fPairCut->Pass(tPair);
+
+      if (enablePairMonitors) {
+        fPairCut->FillCutMonitor(tPair, tmpPassPair);
+      }
+
+      if (tmpPassPair) {
+        fPairBlock->Accept();
+        if (fPairBlock->Full()) {
+          FlushPairBlock(these_are_real_pairs);
+        }
+      }
+    }
+  }
+
+  FlushPairBlock(these_are_real_pairs);
+}
+//_________________________
+void AliFemtoSimpleAnalysis::FlushPairBlock(bool realPairs)
+{
+  if (fPairBlock->Size() == 0) {
+    return;
+  }
+
+  fPairBlock->Compute();
+
+  for (auto &tCorrFctn : *fCorrFctnCollection) {
+    if (realPairs)
+      tCorrFctn->AddRealPairs(*fPairBlock);
+    else
+      tCorrFctn->AddMixedPairs(*fPairBlock);
+  }
+
+  fPairBlock->Clear();
+}
+//_________________________
+AliFemtoPicoEvent* AliFemtoSimpleAnalysis::NewPicoEvent()
+{
+  if (fRecycledPicoEvent) {
+    AliFemtoPicoEvent *event = fRecycledPicoEvent;
+    fRecycledPicoEvent = nullptr;
+    return event;
+  }
+  return new AliFemtoPicoEvent;
+}
+//_________________________
+void AliFemtoSimpleAnalysis::RecyclePicoEvent(AliFemtoPicoEvent *event)
+{
+  if (!fBatchedPairs || fRecycledPicoEvent) {
+    delete event;
+    return;
+  }
+  event->Clear();
+  fRecycledPicoEvent = event;
+}
+//_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
 {
   /// Perform initialization operations at the beginning of the event processing
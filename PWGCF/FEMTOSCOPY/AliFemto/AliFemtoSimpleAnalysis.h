@@ -18,6 +18,8 @@
 
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
+class AliFemtoPairBlock;
+class AliFemtoParticleBuffer;
 
 ///
 /// \class AliFemtoSimpleAnalysis
@@ -99,6 +101,17 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Enable the batched pair mode
+  ///
+  /// Pairs are built from contiguous copies of the particle collections
+  /// (AliFemtoParticleBuffer), their kinematics are computed in blocks
+  /// (AliFemtoPairBlock) and handed to the correlation functions with
+  /// AliFemtoCorrFctn::AddRealPairs() / AddMixedPairs(). Pico events
+  /// leaving the mixing buffer are recycled instead of deleted. The
+  /// results are identical to the default mode.
+  void SetBatchedPairs(Bool_t aBatched);
+  Bool_t BatchedPairs() const;
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -159,6 +172,23 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Same as MakePairs, for the batched pair mode. If no second buffer
+  /// is specified, make pairs within the first one.
+  void MakePairsBatched(const char* type,
+                        const AliFemtoParticleBuffer &ParticlesPassingCut1,
+                        const AliFemtoParticleBuffer *ParticlesPassingCut2=NULL,
+                        Bool_t enablePairMonitors=kFALSE);
+
+  /// Compute the kinematics of the pairs in fPairBlock, send them to the
+  /// correlation functions and empty the block
+  void FlushPairBlock(bool realPairs);
+
+  /// Return an empty pico event, recycled if one is available
+  AliFemtoPicoEvent* NewPicoEvent();
+
+  /// Keep the pico event for reuse (batched mode) or delete it
+  void RecyclePicoEvent(AliFemtoPicoEvent *event);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -177,6 +207,10 @@ protected:
   Bool_t fVerbose;
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
+  Bool_t fBatchedPairs;                              ///< Build pairs in blocks, see SetBatchedPairs()
+
+  AliFemtoPairBlock*           fPairBlock;           //!<! Block of pairs used in the batched mode
+  AliFemtoPicoEvent*           fRecycledPicoEvent;   //!<! Pico event kept for reuse in the batched mode
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -305,4 +339,14 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetBatchedPairs(Bool_t aBatched)
+{
+  fBatchedPairs = aBatched;
+}
+
+inline Bool_t AliFemtoSimpleAnalysis::BatchedPairs() const
+{
+  return fBatchedPairs;
+}
+
 #endif
@@ -418,6 +418,9 @@ double AliFemtoDreamEvent::CalculateSphericityEvent(AliVEvent *evt) {
   for (int iTrack = 0; iTrack < numOfTracks; iTrack++) {
 
     AliNanoAODTrack *track = dynamic_cast<AliNanoAODTrack*>(evt->GetTrack(iTrack));
+    if (!track) {
+      AliFatal("Not an AliNanoAODTrack, columnar NanoAOD tracks are not supported");
+    }
 
     double pt = track->Pt();
     double eta = track->Eta();
@@ -113,6 +113,9 @@ void AliFemtoDreamTrack::SetTrack(AliAODTrack *track, const int multiplicity) {
 void AliFemtoDreamTrack::SetTrack(AliVTrack *track, AliVEvent *event,
                                   const int multiplicity) {
   AliNanoAODTrack* nanoTrack = dynamic_cast<AliNanoAODTrack*>(track);
+  if (!nanoTrack) {
+    AliFatal("Not an AliNanoAODTrack, columnar NanoAOD tracks are not supported");
+  }
   this->Reset();
   SetEventMultiplicity(multiplicity);
   fVTrack = track;
@@ -464,6 +467,9 @@ void AliFemtoDreamTrack::SetVInformation(AliVEvent *event) {
   AliNanoAODTrack *nanoTrack = dynamic_cast<AliNanoAODTrack *>(fVTrack);
   AliNanoAODTrack *globalNanoTrack =
       dynamic_cast<AliNanoAODTrack *>(fVGlobalTrack);
+  if (!nanoTrack || !globalNanoTrack) {
+    AliFatal("Not an AliNanoAODTrack, columnar NanoAOD tracks are not supported");
+  }
   this->SetEta(fVTrack->Eta());
   this->SetPhi(fVTrack->Phi());
   this->SetTheta(fVTrack->Theta());
@@ -148,6 +148,12 @@ void AliReducedAnalysisTaskTwoPwrtRP::Init()
 
   if (!fListHistos.IsEmpty()) return; //already initialised
 
+  // the cuts and correlation classes read fValues directly and do not register their variables,
+  // so make sure all variables are filled
+  Bool_t usedVars[AliReducedVarManager::kNVars];
+  for(Int_t i=0; i<AliReducedVarManager::kNVars; ++i) usedVars[i]=kTRUE;
+  AliReducedVarManager::SetUseVars(usedVars);
+
   fListHistos.SetName("ChargeCorrelations");
   fListHistos.SetOwner();
   fListHistosQn.SetName("QnCorrelations");
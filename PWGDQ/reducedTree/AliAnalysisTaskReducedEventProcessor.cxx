@@ -29,6 +29,7 @@ Instructions in AddTask_EPcorrectionsExample.C
 #include "AliReducedEventInfo.h"
 #include "AliHistogramManager.h"
 #include "AliReducedAnalysisTaskSE.h"
+#include "AliReducedVarManager.h"
 #include "AliReducedEventInputHandler.h"
 
 using std::cout;
@@ -140,8 +141,11 @@ void AliAnalysisTaskReducedEventProcessor::UserExec(Option_t *){
   
   if(!event) return;
     
+  // run the task with its own variable manager context, if it has one
+  AliReducedVarContext* previousContext = AliReducedVarManager::SetContext(fReducedTask->GetVarContext());
   fReducedTask->SetEvent(event);
   fReducedTask->Process();
+  AliReducedVarManager::SetContext(previousContext);
   PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
   
   if(fWriteFilteredTree)  {
@@ -156,7 +160,9 @@ void AliAnalysisTaskReducedEventProcessor::FinishTaskOutput()
     //
     // Finish Task 
     //
+  AliReducedVarContext* previousContext = AliReducedVarManager::SetContext(fReducedTask->GetVarContext());
   fReducedTask->Finish();
+  AliReducedVarManager::SetContext(previousContext);
   PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
   if(fWriteFilteredTree)
      PostData(2, fReducedTask->GetFilteredTree());
@@ -49,7 +49,11 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fFillPlansCompiled(kFALSE),
+  fFillInstructions(),
+  fFillPlans(),
+  fFillPlanIndex()
 {
   //
   // Constructor
@@ -71,7 +75,11 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fFillPlansCompiled(kFALSE),
+  fFillInstructions(),
+  fFillPlans(),
+  fFillPlanIndex()
 {
   //
   // Constructor
@@ -131,6 +139,7 @@ void AliHistogramManager::AddHistClass(const Char_t* histClass) {
   hList->SetOwner(kTRUE);
   hList->SetName(histClass);
   fMainList.Add(hList);
+  fFillPlansCompiled = kFALSE;
 }
 
 //_________________________________________________________________
@@ -144,6 +153,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a histogram
   //
+  fFillPlansCompiled = kFALSE;
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -286,6 +296,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a histogram
   //
+  fFillPlansCompiled = kFALSE;
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -431,6 +442,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a multi-dimensional histogram THnF or THnFSparseF
   //
+  fFillPlansCompiled = kFALSE;
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -484,6 +496,7 @@ void AliHistogramManager::AddHistogram(const Char_t* histClass,
   //
   // add a multi-dimensional histogram THnF or THnSparseF with equal or variable bin widths
   //
+  fFillPlansCompiled = kFALSE;
   THashList* hList = (THashList*)fMainList.FindObject(histClass);
   if(!hList) {
     cout << "Warning in AliHistogramManager::AddHistogram(): Histogram list " << histClass << " not found!" << endl;
@@ -620,150 +633,172 @@ THnF* AliHistogramManager::CreateHistogram( const Char_t* name, const Char_t* ti
 
 
 //__________________________________________________________________
-void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+Bool_t AliHistogramManager::CompileFillInstruction(TObject* h, FillInstruction& instr) const {
   //
-  //  fill a class of histograms
+  // Decode the variable mapping encoded in the unique IDs of the histogram and its axes into a fill instruction
+  // Returns kFALSE if the histogram would never be filled (one of its variables is not used)
   //
-  THashList* hList = (THashList*)fMainList.FindObject(className);
-  if(!hList) {
-    /*cout << "Warning in AliHistogramManager::FillHistClass(): Histogram list " << className << " not found!" << endl;
-    cout << "         Histogram list not filled" << endl; */
-    return;
+  Int_t uid = h->GetUniqueID();
+  Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+  Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);
+  Int_t thnDim = 0;
+  if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
+  
+  uid = (uid-(uid%100))/100;
+  Int_t varT = -1;
+  Int_t varW = -1;
+  if(uid>0) {
+    varW = uid%(fNVars+1)-1;
+    if(varW==0) varW=AliReducedVarManager::kNothing;
+    uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+    if(uid>0) varT = uid - 1;
   }
-  if(!hList) {
-    return;
+  Bool_t hasWeight = (varW>AliReducedVarManager::kNothing);
+  if(hasWeight && !fUsedVars[varW]) return kFALSE;
+  
+  instr.fHist = h;
+  instr.fVarW = varW;
+  
+  if(isTHn) {
+    if(thnDim>kMaxFillDims) return kFALSE;
+    THnBase* hn = (THnBase*)h;
+    for(Int_t idim=0;idim<thnDim;++idim) {
+      instr.fVars[idim] = hn->GetAxis(idim)->GetUniqueID();
+      if(!fUsedVars[instr.fVars[idim]]) return kFALSE;
+    }
+    instr.fNDims = thnDim;
+    instr.fKind = (hasWeight ? kFillTHnW : kFillTHn);
+    return kTRUE;
+  }
+  
+  TH1* h1 = (TH1*)h;
+  Int_t dimension = h1->GetDimension();
+  // number of variables needed: profiles have the averaged variable in addition, TProfile3D a 4th variable
+  Int_t nVars = dimension + (isProfile ? 1 : 0);
+  if(dimension<1 || dimension>3) return kFALSE;
+  instr.fVars[0] = h1->GetXaxis()->GetUniqueID();
+  if(nVars>1) instr.fVars[1] = h1->GetYaxis()->GetUniqueID();
+  if(nVars>2) instr.fVars[2] = h1->GetZaxis()->GetUniqueID();
+  if(nVars>3) instr.fVars[3] = varT;
+  for(Int_t i=0;i<nVars;++i) {
+    if(instr.fVars[i]<0 || !fUsedVars[instr.fVars[i]]) return kFALSE;
   }
-    
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
-  Bool_t isSparse=kFALSE;
-  Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    if(isTHn && ((TString)h->ClassName()).Contains("Sparse")) isSparse = kTRUE;
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
+  instr.fNDims = nVars;
+  
+  const Int_t kinds[3][2] = {{kFillTH1, kFillProf1}, {kFillTH2, kFillProf2}, {kFillTH3, kFillProf3}};
+  instr.fKind = kinds[dimension-1][isProfile ? 1 : 0] + (hasWeight ? 1 : 0);
+  return kTRUE;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::CompileFillPlans() {
+  //
+  //  Build the fill plans: for each histogram class a flat list of fill instructions.
+  //  Histograms using a variable not marked as used are never filled and are skipped here.
+  //
+  fFillInstructions.clear();
+  fFillPlans.clear();
+  fFillPlanIndex.clear();
+  
+  for(Int_t i=0; i<fMainList.GetEntries(); ++i) {
+    THashList* hList = (THashList*)fMainList.At(i);
+    FillPlan plan;
+    plan.fFirst = fFillInstructions.size();
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      FillInstruction instr;
+      if(CompileFillInstruction(h, instr)) fFillInstructions.push_back(instr);
     }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
-          case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
-          break;
-          case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
-          break;
-          case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
-          break;
-          default:
-          break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        if (isSparse) {
-          allVarsGood &= fUsedVars[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnSparseF*)h)->GetAxis(idim)->GetUniqueID()];
-        } else {
-          allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-          fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        }
-      }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW]) {
-            if (isSparse) ((THnSparseF*)h)->Fill(fillValues,values[varW]);
-            else          ((THnF*)h)->Fill(fillValues,values[varW]);
-          }
-        }
-        else {
-          if (isSparse) ((THnSparseF*)h)->Fill(fillValues);
-          else          ((THnF*)h)->Fill(fillValues);
-        }
-      }
+    plan.fN = fFillInstructions.size() - plan.fFirst;
+    fFillPlanIndex[hList] = fFillPlans.size();
+    fFillPlans.push_back(plan);
+  }
+  fFillPlansCompiled = kTRUE;
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassIndex(const Char_t* className) {
+  //
+  //  Get the index of the fill plan of a histogram class, to be used with FillHistClass(Int_t, Float_t*)
+  //  The index is valid as long as no histogram classes or histograms are added
+  //
+  if(!fFillPlansCompiled) CompileFillPlans();
+  TObject* hList = fMainList.FindObject(className);
+  if(!hList) return -1;
+  std::map<const TObject*, Int_t>::const_iterator it = fFillPlanIndex.find(hList);
+  if(it==fFillPlanIndex.end()) return -1;
+  return it->second;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values) {
+  //
+  //  fill a class of histograms
+  //
+  FillHistClass(GetHistClassIndex(className), values);
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classIdx, Float_t* values) {
+  //
+  //  fill a class of histograms using its compiled fill plan
+  //
+  if(!fFillPlansCompiled) CompileFillPlans();
+  if(classIdx<0 || classIdx>=(Int_t)fFillPlans.size()) return;
+  
+  const FillPlan& plan = fFillPlans[classIdx];
+  const FillInstruction* instr = (plan.fN>0 ? &fFillInstructions[plan.fFirst] : 0x0);
+  Double_t fillValues[kMaxFillDims]={0.0};
+  for(Int_t i=0; i<plan.fN; ++i, ++instr) {
+    const Int_t* v = instr->fVars;
+    switch(instr->fKind) {
+      case kFillTH1:
+        ((TH1F*)instr->fHist)->Fill(values[v[0]]);
+        break;
+      case kFillTH1W:
+        ((TH1F*)instr->fHist)->Fill(values[v[0]],values[instr->fVarW]);
+        break;
+      case kFillProf1:
+        ((TProfile*)instr->fHist)->Fill(values[v[0]],values[v[1]]);
+        break;
+      case kFillProf1W:
+        ((TProfile*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[instr->fVarW]);
+        break;
+      case kFillTH2:
+        ((TH2F*)instr->fHist)->Fill(values[v[0]],values[v[1]]);
+        break;
+      case kFillTH2W:
+        ((TH2F*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[instr->fVarW]);
+        break;
+      case kFillProf2:
+        ((TProfile2D*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+        break;
+      case kFillProf2W:
+        ((TProfile2D*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[v[2]],values[instr->fVarW]);
+        break;
+      case kFillTH3:
+        ((TH3F*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[v[2]]);
+        break;
+      case kFillTH3W:
+        ((TH3F*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[v[2]],values[instr->fVarW]);
+        break;
+      case kFillProf3:
+        ((TProfile3D*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]]);
+        break;
+      case kFillProf3W:
+        ((TProfile3D*)instr->fHist)->Fill(values[v[0]],values[v[1]],values[v[2]],values[v[3]],values[instr->fVarW]);
+        break;
+      case kFillTHn:
+        for(Int_t idim=0;idim<instr->fNDims;++idim) fillValues[idim] = values[v[idim]];
+        ((THnBase*)instr->fHist)->Fill(fillValues);
+        break;
+      case kFillTHnW:
+        for(Int_t idim=0;idim<instr->fNDims;++idim) fillValues[idim] = values[v[idim]];
+        ((THnBase*)instr->fHist)->Fill(fillValues,values[instr->fVarW]);
+        break;
+      default:
+        break;
     }
   }
 }
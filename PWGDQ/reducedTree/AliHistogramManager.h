@@ -14,6 +14,9 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+#include <map>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +72,9 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  void FillHistClass(Int_t classIdx, Float_t* values);
+  Int_t GetHistClassIndex(const Char_t* className);   // index of the compiled fill plan for a histogram class (-1 if not existing)
+  void CompileFillPlans();                            // build the fill plans for all histogram classes (done automatically on the first fill)
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,7 +112,33 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Compiled fill plans: for each histogram class a flat list of fill instructions with the
+  // variable indices decoded from the unique IDs, built once by CompileFillPlans()
+  enum FillKind {
+    kFillTH1=0, kFillTH1W, kFillProf1, kFillProf1W,
+    kFillTH2, kFillTH2W, kFillProf2, kFillProf2W,
+    kFillTH3, kFillTH3W, kFillProf3, kFillProf3W,
+    kFillTHn, kFillTHnW
+  };
+  enum {kMaxFillDims=20};
+  struct FillInstruction {
+    TObject* fHist;              // histogram to be filled
+    Int_t fKind;                 // one of FillKind
+    Int_t fNDims;                // number of variables in fVars
+    Int_t fVarW;                 // weight variable
+    Int_t fVars[kMaxFillDims];   // variables for x,y,z,t (TH1/TProfile) or for the THn axes
+  };
+  struct FillPlan {
+    Int_t fFirst;                // first instruction of this class in fFillInstructions
+    Int_t fN;                    // number of instructions
+  };
+  Bool_t fFillPlansCompiled;                        //! fill plans are up to date
+  std::vector<FillInstruction> fFillInstructions;   //! fill instructions of all classes
+  std::vector<FillPlan> fFillPlans;                 //! fill plan per histogram class, same order as fMainList
+  std::map<const TObject*, Int_t> fFillPlanIndex;   //! histogram class list -> fill plan index
+  
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  Bool_t CompileFillInstruction(TObject* h, FillInstruction& instr) const;
   
   ClassDef(AliHistogramManager, 4)
 };
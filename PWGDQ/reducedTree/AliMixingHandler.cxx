@@ -21,6 +21,7 @@ using std::flush;
 
 #include "AliReducedVarManager.h"
 #include "AliReducedBaseTrack.h"
+#include "AliReducedTrackInfo.h"
 
 ClassImp(AliMixingHandler);
 
@@ -45,7 +46,12 @@ AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   fHistos(0x0),
   fCrossPairsCuts(),
   fLikePairsLeg1Cuts(),
-  fLikePairsLeg2Cuts()
+  fLikePairsLeg2Cuts(),
+  fUseContiguousPools(kFALSE),
+  fPoolCapacity(0),
+  fContiguousPools(),
+  fHistClassIndices(),
+  fNMixedPairs(0)
 {
   // 
   // default constructor
@@ -84,7 +90,12 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title, Int_
   fHistos(0x0),
   fCrossPairsCuts(),
   fLikePairsLeg1Cuts(),
-  fLikePairsLeg2Cuts()
+  fLikePairsLeg2Cuts(),
+  fUseContiguousPools(kFALSE),
+  fPoolCapacity(0),
+  fContiguousPools(),
+  fHistClassIndices(),
+  fNMixedPairs(0)
 {
   //
   // Named constructor
@@ -173,6 +184,28 @@ void AliMixingHandler::Init() {
   
   fPoolSize.Set(fNParallelCuts*size);
   for(Int_t i=0;i<fNParallelCuts*size;++i) fPoolSize[i] = 0;
+  
+  // histogram classes are resolved once, to avoid the class name lookups in the mixing loop
+  fHistClassIndices.resize(histClassArr->GetEntries());
+  for(Int_t i=0;i<histClassArr->GetEntries();++i)
+    fHistClassIndices[i] = fHistos->GetHistClassIndex(histClassArr->At(i)->GetName());
+  
+  if(fUseContiguousPools && fMixingSetup!=kMixResonanceLegs) {
+    cout << "AliMixingHandler::Init(): WARNING Contiguous pools are only implemented for the resonance legs mixing, TList pools are used" << endl;
+    fUseContiguousPools = kFALSE;
+  }
+  if(fUseContiguousPools) {
+    // every stored event contributes to the pool size of at least one cut and no pool size exceeds the pool depth,
+    //  so this capacity is only reached if pool sizes are manipulated from outside
+    fPoolCapacity = TMath::Max(2, fNParallelCuts*fPoolDepth);
+    fContiguousPools.resize(size);
+    for(Int_t i=0;i<size;++i) {
+      fContiguousPools[i].fNEvents = 0;
+      fContiguousPools[i].fLeg1Begin.assign(1, 0);
+      fContiguousPools[i].fLeg2Begin.assign(1, 0);
+    }
+  }
+  delete histClassArr;
     
   // Initialize the random number generator for event/track downscaling
   TTimeStamp time;
@@ -209,6 +242,19 @@ void AliMixingHandler::FillEvent(TList* leg1List, TList* leg2List, Float_t* valu
   Int_t category = FindEventCategory(values);
   if(category<0) return;   // event characteristics outside the defined ranges
   
+  if(fUseContiguousPools) {
+    if(category>=(Int_t)fContiguousPools.size()) return;   // pools not initialized
+    ContiguousPool& pool = fContiguousPools[category];
+    if(pool.fNEvents>=fPoolCapacity) RemoveOldestEvent(pool, category);
+    FillContiguousPool(leg1List, leg2List, category);
+    ULong_t mixingMask = IncrementPoolSizes(leg1List,leg2List,category);
+    if(mixingMask) {
+      RunEventMixing(pool,mixingMask,type,values);
+      ResetPoolSizes(mixingMask,category);
+    }
+    return;
+  }
+  
   TClonesArray *leg1PoolP = static_cast<TClonesArray*>(fPoolsLeg1.At(category));
   if(!leg1PoolP) leg1PoolP = new(fPoolsLeg1[category]) TClonesArray("TList",1);
   leg1PoolP->SetOwner(kTRUE);
@@ -380,6 +426,19 @@ void AliMixingHandler::RunLeftoverMixing(Int_t type) {
   for(Int_t i=0; i<fNParallelCuts; ++i) mixingMask |= (ULong_t(1)<<i);
   Float_t values[AliReducedVarManager::kNVars];
   
+  if(fUseContiguousPools) {
+    for(Int_t icateg=0; icateg<(Int_t)fContiguousPools.size(); ++icateg) {
+      if(fContiguousPools[icateg].fNEvents==0) continue;
+      for(Int_t iVar=0; iVar<fNMixingVariables; ++iVar) {
+         Int_t bin = GetBinFromCategory(iVar, icateg);
+         values[fVariables[iVar]] = 0.5*(fVariableLimits[iVar][bin] + fVariableLimits[iVar][bin+1]);
+      }
+      RunEventMixing(fContiguousPools[icateg],mixingMask,type,values);
+      ResetPoolSizes(mixingMask,icateg);
+    }
+    return;
+  }
+  
   for(Int_t icateg=0; icateg<fPoolsLeg1.GetEntries(); ++icateg) {
     TClonesArray *leg1Pool = static_cast<TClonesArray*>(fPoolsLeg1.At(icateg));
     TClonesArray *leg2Pool = static_cast<TClonesArray*>(fPoolsLeg2.At(icateg));
@@ -408,8 +467,6 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
-  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
-  
   TIter iterEv1Leg1Pool(leg1Pool);
   TIter iterEv1Leg2Pool(leg2Pool);
   ULong_t testFlags1 = 0;
@@ -443,16 +500,17 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!testFlags2) continue;
 	  
           // fill cross-pairs (leg1 - leg2) for the enabled bits
+          ++fNMixedPairs;
           if(fMixingSetup==kMixResonanceLegs) AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg2, type, values);
           if(fMixingSetup==kMixCorrelation)   AliReducedVarManager::FillCorrelationInfo(ev1Leg1, ev2Leg2, values);
           if(!IsPairSelected(values, 1)) continue;   // fill histograms only if pair cuts are fulfilled
           for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) { 
-              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(histClassArr->At(ibit*3+1)->GetName(), values);
+              if(fMixingSetup==kMixResonanceLegs) fHistos->FillHistClass(fHistClassIndices[ibit*3+1], values);
               if(fMixingSetup==kMixCorrelation) {
                 Int_t pairType = (reinterpret_cast<AliReducedPairInfo*>(ev1Leg1))->PairType();
-                if (fMixLikeSign) fHistos->FillHistClass(histClassArr->At(ibit*3+pairType)->GetName(), values);
-                else              fHistos->FillHistClass(histClassArr->At(ibit)->GetName(), values);
+                if (fMixLikeSign) fHistos->FillHistClass(fHistClassIndices[ibit*3+pairType], values);
+                else              fHistos->FillHistClass(fHistClassIndices[ibit], values);
               }
             }
           }  
@@ -469,11 +527,12 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!testFlags2) continue;
 	  
 	  // fill like-pairs (leg1 - leg1) for the enabled bits
+	  ++fNMixedPairs;
 	  AliReducedVarManager::FillPairInfoME(ev1Leg1, ev2Leg1, type, values);
           if(!IsPairSelected(values, 0)) continue;   // fill histograms only if pair cuts are fulfilled
 	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+0)->GetName(), values);
+              fHistos->FillHistClass(fHistClassIndices[ibit*3+0], values);
           }  
 	}  // end loop over the ev2-leg1 list
       }  // end loop over the ev1-leg1 list
@@ -497,11 +556,12 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
           if(!testFlags2) continue;
 	  
 	  // fill like-pairs (leg2 - leg2) for the enabled bits
+	  ++fNMixedPairs;
 	  AliReducedVarManager::FillPairInfoME(ev1Leg2, ev2Leg2, type, values);
           if(!IsPairSelected(values, 2)) continue;   // fill histograms only if pair cuts are fulfilled
 	  for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
             if((testFlags2)&(ULong_t(1)<<ibit)) 
-              fHistos->FillHistClass(histClassArr->At(ibit*3+2)->GetName(), values);
+              fHistos->FillHistClass(fHistClassIndices[ibit*3+2], values);
           }  
 	}  // end loop over the ev2-leg2 list
       }  // end loop over the ev1-leg2 list
@@ -574,6 +634,192 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
 }
 
 
+//_________________________________________________________________________
+void AliMixingHandler::LegArrays::Add(AliReducedBaseTrack* track) {
+  //
+  // append the fields of a track needed in the mixing
+  //
+  fPx.push_back(track->Px());
+  fPy.push_back(track->Py());
+  fPz.push_back(track->Pz());
+  fP.push_back(track->P());
+  fPt.push_back(track->Pt());
+  fCharge.push_back(track->Charge());
+  if(track->IsA()==AliReducedTrackInfo::Class()) fSPDhit.push_back(((AliReducedTrackInfo*)track)->ITSLayerHit(0) ? 1 : 0);
+  else fSPDhit.push_back(-1);
+  fFlags.push_back(track->GetFlags());
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::LegArrays::Resize(Int_t n) {
+  //
+  // shrink the arrays to n tracks; the allocated memory is kept for reuse
+  //
+  fPx.resize(n); fPy.resize(n); fPz.resize(n); fP.resize(n); fPt.resize(n);
+  fCharge.resize(n); fSPDhit.resize(n); fFlags.resize(n);
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::LegArrays::Move(Int_t from, Int_t to) {
+  //
+  // copy track "from" into the slot "to"
+  //
+  fPx[to] = fPx[from]; fPy[to] = fPy[from]; fPz[to] = fPz[from]; fP[to] = fP[from]; fPt[to] = fPt[from];
+  fCharge[to] = fCharge[from]; fSPDhit[to] = fSPDhit[from]; fFlags[to] = fFlags[from];
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::FillContiguousPool(TList* leg1List, TList* leg2List, Int_t category) {
+  //
+  // append the legs of this event to the contiguous pool of its category
+  //
+  ContiguousPool& pool = fContiguousPools[category];
+  TIter next1(leg1List);
+  AliReducedBaseTrack* track=0x0;
+  while((track=(AliReducedBaseTrack*)next1())) pool.fLeg1.Add(track);
+  TIter next2(leg2List);
+  while((track=(AliReducedBaseTrack*)next2())) pool.fLeg2.Add(track);
+  pool.fLeg1Begin.push_back(pool.fLeg1.fFlags.size());
+  pool.fLeg2Begin.push_back(pool.fLeg2.fFlags.size());
+  pool.fNEvents++;
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::RemoveOldestEvent(ContiguousPool& pool, Int_t category) {
+  //
+  // drop the oldest event of a full pool and decrease the pool sizes of the cuts it contributes to
+  //
+  ULong_t cutsMask = 0;
+  for(Int_t it=pool.fLeg1Begin[0]; it<pool.fLeg1Begin[1]; ++it) cutsMask |= pool.fLeg1.fFlags[it];
+  for(Int_t it=pool.fLeg2Begin[0]; it<pool.fLeg2Begin[1]; ++it) cutsMask |= pool.fLeg2.fFlags[it];
+  Int_t nCategories = fContiguousPools.size();
+  for(Int_t icut=0;icut<fNParallelCuts;++icut) {
+    if((cutsMask&(ULong_t(1)<<icut)) && fPoolSize[icut*nCategories+category]>0)
+      fPoolSize[icut*nCategories+category] -= 1;
+  }
+  // unflag the tracks of the oldest event and let the compaction remove it
+  for(Int_t it=pool.fLeg1Begin[0]; it<pool.fLeg1Begin[1]; ++it) pool.fLeg1.fFlags[it] = 0;
+  for(Int_t it=pool.fLeg2Begin[0]; it<pool.fLeg2Begin[1]; ++it) pool.fLeg2.fFlags[it] = 0;
+  CompactPool(pool);
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::CompactPool(ContiguousPool& pool) {
+  //
+  // remove in place the tracks without mixing flags and the events without tracks, keeping the order
+  //
+  Int_t nEvents = 0;
+  Int_t n1 = 0, n2 = 0;
+  for(Int_t iev=0; iev<pool.fNEvents; ++iev) {
+    Int_t begin1 = n1, begin2 = n2;
+    for(Int_t it=pool.fLeg1Begin[iev]; it<pool.fLeg1Begin[iev+1]; ++it) {
+      if(!pool.fLeg1.fFlags[it]) continue;
+      if(it!=n1) pool.fLeg1.Move(it, n1);
+      ++n1;
+    }
+    for(Int_t it=pool.fLeg2Begin[iev]; it<pool.fLeg2Begin[iev+1]; ++it) {
+      if(!pool.fLeg2.fFlags[it]) continue;
+      if(it!=n2) pool.fLeg2.Move(it, n2);
+      ++n2;
+    }
+    if(n1==begin1 && n2==begin2) continue;     // no tracks left in this event
+    // the offsets of event iev are not needed anymore once it is processed, since nEvents<=iev
+    pool.fLeg1Begin[nEvents] = begin1;
+    pool.fLeg2Begin[nEvents] = begin2;
+    ++nEvents;
+  }
+  pool.fLeg1Begin.resize(nEvents+1);
+  pool.fLeg2Begin.resize(nEvents+1);
+  pool.fLeg1Begin[nEvents] = n1;
+  pool.fLeg2Begin[nEvents] = n2;
+  pool.fLeg1.Resize(n1);
+  pool.fLeg2.Resize(n2);
+  pool.fNEvents = nEvents;
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::RunEventMixing(ContiguousPool& pool, ULong_t mixingMask, Int_t type, Float_t* values) {
+  //
+  // Run event mixing on a contiguous pool
+  // NOTE: Same pairing order and selections as for the TList pools
+  //
+  Int_t entries = pool.fNEvents;
+  if(entries<2) return;
+  
+  const LegArrays& leg1 = pool.fLeg1;
+  const LegArrays& leg2 = pool.fLeg2;
+  ULong_t testFlags1 = 0;
+  ULong_t testFlags2 = 0;
+  for(Int_t iev1=0; iev1<entries; ++iev1) {                            // first event loop
+    for(Int_t iev2=0; iev2<entries; ++iev2) {                         // second event loop 
+      if(iev1==iev2) continue;
+      
+      // loop over the ev1-leg1 tracks
+      for(Int_t i1=pool.fLeg1Begin[iev1]; i1<pool.fLeg1Begin[iev1+1]; ++i1) {
+        testFlags1 = mixingMask & leg1.fFlags[i1];
+        if(!testFlags1) continue;
+        
+        // cross-pairs with the ev2-leg2 tracks
+        for(Int_t i2=pool.fLeg2Begin[iev2]; i2<pool.fLeg2Begin[iev2+1]; ++i2) {
+          testFlags2 = testFlags1 & leg2.fFlags[i2];
+          if(!testFlags2) continue;
+          ++fNMixedPairs;
+          AliReducedVarManager::FillPairInfoME(leg1.fPx[i1], leg1.fPy[i1], leg1.fPz[i1], leg1.fP[i1], leg1.fPt[i1], leg1.fCharge[i1],
+                                               leg2.fPx[i2], leg2.fPy[i2], leg2.fPz[i2], leg2.fP[i2], leg2.fPt[i2], leg2.fCharge[i2],
+                                               type, values, (leg1.fSPDhit[i1]<0 || leg2.fSPDhit[i2]<0 ? -1 : leg1.fSPDhit[i1]+leg2.fSPDhit[i2]));
+          if(!IsPairSelected(values, 1)) continue;
+          for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit)
+            if(testFlags2&(ULong_t(1)<<ibit)) fHistos->FillHistClass(fHistClassIndices[ibit*3+1], values);
+        }
+        
+        if(!fMixLikeSign) continue;
+        // like-pairs with the ev2-leg1 tracks
+        for(Int_t i2=pool.fLeg1Begin[iev2]; i2<pool.fLeg1Begin[iev2+1]; ++i2) {
+          testFlags2 = testFlags1 & leg1.fFlags[i2];
+          if(!testFlags2) continue;
+          ++fNMixedPairs;
+          AliReducedVarManager::FillPairInfoME(leg1.fPx[i1], leg1.fPy[i1], leg1.fPz[i1], leg1.fP[i1], leg1.fPt[i1], leg1.fCharge[i1],
+                                               leg1.fPx[i2], leg1.fPy[i2], leg1.fPz[i2], leg1.fP[i2], leg1.fPt[i2], leg1.fCharge[i2],
+                                               type, values, (leg1.fSPDhit[i1]<0 || leg1.fSPDhit[i2]<0 ? -1 : leg1.fSPDhit[i1]+leg1.fSPDhit[i2]));
+          if(!IsPairSelected(values, 0)) continue;
+          for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit)
+            if(testFlags2&(ULong_t(1)<<ibit)) fHistos->FillHistClass(fHistClassIndices[ibit*3+0], values);
+        }
+      }  // end loop over the ev1-leg1 tracks
+      
+      if(!fMixLikeSign) continue;
+      // like-pairs between the ev1-leg2 and ev2-leg2 tracks
+      for(Int_t i1=pool.fLeg2Begin[iev1]; i1<pool.fLeg2Begin[iev1+1]; ++i1) {
+        testFlags1 = mixingMask & leg2.fFlags[i1];
+        if(!testFlags1) continue;
+        for(Int_t i2=pool.fLeg2Begin[iev2]; i2<pool.fLeg2Begin[iev2+1]; ++i2) {
+          testFlags2 = testFlags1 & leg2.fFlags[i2];
+          if(!testFlags2) continue;
+          ++fNMixedPairs;
+          AliReducedVarManager::FillPairInfoME(leg2.fPx[i1], leg2.fPy[i1], leg2.fPz[i1], leg2.fP[i1], leg2.fPt[i1], leg2.fCharge[i1],
+                                               leg2.fPx[i2], leg2.fPy[i2], leg2.fPz[i2], leg2.fP[i2], leg2.fPt[i2], leg2.fCharge[i2],
+                                               type, values, (leg2.fSPDhit[i1]<0 || leg2.fSPDhit[i2]<0 ? -1 : leg2.fSPDhit[i1]+leg2.fSPDhit[i2]));
+          if(!IsPairSelected(values, 2)) continue;
+          for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit)
+            if(testFlags2&(ULong_t(1)<<ibit)) fHistos->FillHistClass(fHistClassIndices[ibit*3+2], values);
+        }
+      }  // end loop over the ev1-leg2 tracks
+    }  // end second event loop
+  }  // end first event loop
+  
+  // unset the mixing flags and remove the tracks and events which are not needed anymore
+  for(UInt_t it=0; it<pool.fLeg1.fFlags.size(); ++it) pool.fLeg1.fFlags[it] &= ~mixingMask;
+  for(UInt_t it=0; it<pool.fLeg2.fFlags.size(); ++it) pool.fLeg2.fFlags[it] &= ~mixingMask;
+  CompactPool(pool);
+}
+
+
 //_________________________________________________________________________
 Bool_t AliMixingHandler::IsPairSelected(Float_t* values, Int_t pairType) {
    //
@@ -650,6 +896,14 @@ void AliMixingHandler::PrintMixingLists(Int_t debugLevel) {
       cout << endl;
       if(debugLevel<2) continue;
       
+      if(fUseContiguousPools) {
+         const ContiguousPool& pool = fContiguousPools[iCateg];
+         for(Int_t iev=0; iev<pool.fNEvents; ++iev)
+            cout << "	Event #" << iev << ";  No. of tracks (leg1/leg2) :: " 
+            << pool.fLeg1Begin[iev+1]-pool.fLeg1Begin[iev] << " / " << pool.fLeg2Begin[iev+1]-pool.fLeg2Begin[iev] << endl;
+         continue;
+      }
+      
       TClonesArray *leg1PoolP = static_cast<TClonesArray*>(fPoolsLeg1.At(iCateg));
       if(!leg1PoolP) continue;
       TClonesArray &leg1Pool=*leg1PoolP;
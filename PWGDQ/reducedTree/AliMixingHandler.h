@@ -14,10 +14,14 @@
 #include <TList.h>
 #include <TString.h>
 
+#include <vector>
+
 #include "AliHistogramManager.h"
 #include "AliReducedVarManager.h"
 #include "AliReducedInfoCut.h"
 
+class AliReducedBaseTrack;
+
 class AliMixingHandler : public TNamed {
    
 public:
@@ -42,6 +46,7 @@ public:
   void SetDownscaleEvents(Float_t ds) {fDownscaleEvents = ds;}
   void SetDownscaleTracks(Float_t ds) {fDownscaleTracks = ds;}
   void SetNParallelCuts(Int_t n) {fNParallelCuts = n;}
+  void SetUseContiguousPools(Bool_t flag=kTRUE) {fUseContiguousPools = flag;}
   void SetHistogramManager(AliHistogramManager* histos) {fHistos = histos;}
   void SetHistClassNames(const Char_t* names) {fHistClassNames = names;}
   void AddCrossPairsCut(AliReducedInfoCut* cut) {fCrossPairsCuts.Add(cut);}
@@ -67,6 +72,8 @@ public:
   TString GetHistClassNames() const {return fHistClassNames;};
   Int_t GetNMixingVariables() const {return fNMixingVariables;}
   Int_t GetMixingSetup() const {return fMixingSetup;}
+  Bool_t GetUseContiguousPools() const {return fUseContiguousPools;}
+  Long64_t GetNMixedPairs() const {return fNMixedPairs;}
   
   void Init();
   Int_t FindEventCategory(Float_t* values);
@@ -108,11 +115,40 @@ private:
   TList fLikePairsLeg1Cuts;    // cut object for LEG1 like pairs
   TList fLikePairsLeg2Cuts;    // cut object for LEG2 like pairs
   
+  // Contiguous pools: alternative to the TList pools for the kMixResonanceLegs setup
+  // The track fields needed by AliReducedVarManager::FillPairInfoME() are kept in structure-of-arrays form,
+  // one pool per event category with a fixed capacity of events; the memory is reused in place after each mixing
+  struct LegArrays {
+    std::vector<Float_t> fPx, fPy, fPz, fP, fPt;   // kinematics as returned by the AliReducedBaseTrack getters
+    std::vector<Char_t>  fCharge;                  // charge
+    std::vector<Char_t>  fSPDhit;                  // hit in the first ITS layer, -1 if not an AliReducedTrackInfo
+    std::vector<ULong_t> fFlags;                   // cut flags
+    void Add(AliReducedBaseTrack* track);
+    void Resize(Int_t n);
+    void Move(Int_t from, Int_t to);
+  };
+  struct ContiguousPool {
+    Int_t fNEvents;                      // number of events stored
+    std::vector<Int_t> fLeg1Begin;       // [fNEvents+1] offsets of the events in fLeg1
+    std::vector<Int_t> fLeg2Begin;       // [fNEvents+1] offsets of the events in fLeg2
+    LegArrays fLeg1;                     // leg1 tracks of all events
+    LegArrays fLeg2;                     // leg2 tracks of all events
+  };
+  Bool_t fUseContiguousPools;                   // use the contiguous pools instead of the TList pools
+  Int_t fPoolCapacity;                          //! maximum number of events per contiguous pool
+  std::vector<ContiguousPool> fContiguousPools; //! contiguous pools, one per event category
+  std::vector<Int_t> fHistClassIndices;         //! histogram class indices in the histogram manager
+  Long64_t fNMixedPairs;                        //! number of mixed pairs (passing the flag selection)
+  
   void RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
+  void FillContiguousPool(TList* leg1List, TList* leg2List, Int_t category);
+  void RunEventMixing(ContiguousPool& pool, ULong_t mixingMask, Int_t type, Float_t* values);
+  void RemoveOldestEvent(ContiguousPool& pool, Int_t category);
+  void CompactPool(ContiguousPool& pool);
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
   
-  ClassDef(AliMixingHandler,3);
+  ClassDef(AliMixingHandler,4);
 };
 
 #endif
@@ -53,7 +53,14 @@ AliReducedAnalysisFilterTrees::AliReducedAnalysisFilterTrees() :
   fJpsiMotherMCcuts(),
   fMCJpsiPtWeights(0x0),
   fSkipMCEvent(kFALSE),
-  fJpsiElectronMCcuts()
+  fJpsiElectronMCcuts(),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fPairHistClasses(),
+  fTrackHistClasses(),
+  fLegHistClasses(),
+  fCandidatePairHistClasses(),
+  fMCTruthHistClasses()
 {
   //
   // default constructor
@@ -90,7 +97,14 @@ AliReducedAnalysisFilterTrees::AliReducedAnalysisFilterTrees(const Char_t* name,
   fJpsiMotherMCcuts(),
   fMCJpsiPtWeights(0x0),
   fSkipMCEvent(kFALSE),
-  fJpsiElectronMCcuts()  
+  fJpsiElectronMCcuts(),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fPairHistClasses(),
+  fTrackHistClasses(),
+  fLegHistClasses(),
+  fCandidatePairHistClasses(),
+  fMCTruthHistClasses()
 {
   //
   // named constructor
@@ -136,6 +150,62 @@ void AliReducedAnalysisFilterTrees::Init() {
    fHistosManager->SetDefaultVarNames(AliReducedVarManager::fgVariableNames,AliReducedVarManager::fgVariableUnits);
 }
 
+//___________________________________________________________________________
+void AliReducedAnalysisFilterTrees::SetBuildCandidatePairs(AliReducedPairInfo::CandidateType type) {
+  //
+  // build candidate pairs of the given type from the selected tracks
+  //
+   fBuildCandidatePairs = kTRUE;
+   fCandidateType = type;
+   // make sure variables needed to create the candidate pair objects are filled
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPt);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPhi);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kEta);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPairType);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPairTypeSPD);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kMass);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPairLxy);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPseudoProperDecayTime);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPairPointingAngle);
+   AliReducedVarManager::SetUseVariable(AliReducedVarManager::kPairChisquare);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisFilterTrees::ResolveHistClasses() {
+  //
+  // Resolve the histogram classes filled in the event loop, once at the first event when all the classes are defined.
+  // The fills then use AliHistogramManager::FillHistClass(Int_t, Float_t*) instead of looking up the class names
+  //
+   const Char_t* classNames[kNHistClasses] = {
+      "Event_BeforeCuts", "EventTag_BeforeCuts", "EventTriggers_BeforeCuts",
+      "Event_AfterCuts", "EventTag_AfterCuts", "EventTriggers_AfterCuts",
+      "Pair_BeforeCuts", "PairQualityFlags_BeforeCuts", "Track_BeforeCuts",
+      "Track_LEG1_PrefilterTrack", "Track_LEG2_PrefilterTrack"
+   };
+   for(Int_t i=0; i<kNHistClasses; ++i) fHistClasses[i] = GetHistClassIndex(classNames[i]);
+   fPairHistClasses[0] = GetHistClassIndices("Pair", fPairCuts);
+   fPairHistClasses[1] = GetHistClassIndices("PairQualityFlags", fPairCuts);
+   fTrackHistClasses = GetHistClassIndices("Track", fTrackCuts);
+   fMCTruthHistClasses[0] = GetHistClassIndices("", fJpsiMotherMCcuts, 0x0, "_PureMCTRUTH_BeforeSelection");
+   fMCTruthHistClasses[1] = GetHistClassIndices("", fJpsiMotherMCcuts, 0x0, "_PureMCTRUTH_AfterSelection");
+   
+   // NOTE: for symmetric decay channels, the LEG2 (negative) candidates are selected and named with the LEG1 cuts
+   Bool_t isAsymmetricDecayChannel = IsAsymmetricDecayChannel();
+   fLegHistClasses[0] = GetHistClassIndices("Track_LEG1_BeforePrefilter", fLeg1Cuts);
+   fLegHistClasses[1] = GetHistClassIndices("Track_LEG2_BeforePrefilter", (isAsymmetricDecayChannel ? fLeg2Cuts : fLeg1Cuts));
+   const Char_t* candidateNames[3] = {"Pair_Candidate12", "Pair_Candidate11", "Pair_Candidate22"};
+   for(Int_t i=0; i<3; ++i) {
+      fCandidatePairHistClasses[i].assign(fLeg1Cuts.GetEntries(), -1);
+      for(Int_t icut=0; icut<fLeg1Cuts.GetEntries(); ++icut) {
+         if(isAsymmetricDecayChannel && icut>=fLeg2Cuts.GetEntries()) break;
+         TString className = Form("%s_%s", candidateNames[i], fLeg1Cuts.At(icut)->GetName());
+         if(isAsymmetricDecayChannel) {className += "_"; className += fLeg2Cuts.At(icut)->GetName();}
+         fCandidatePairHistClasses[i][icut] = GetHistClassIndex(className.Data());
+      }
+   }
+   fHistClassesResolved = kTRUE;
+}
+
 //___________________________________________________________________________
 void AliReducedAnalysisFilterTrees::Process() {
   //
@@ -150,6 +220,7 @@ void AliReducedAnalysisFilterTrees::Process() {
   if(fEventCounter%10000==0) 
      cout << "Event no. " << fEventCounter << endl;
   fEventCounter++;
+  if(!fHistClassesResolved) ResolveHistClasses();
   
   AliReducedVarManager::SetEvent(fEvent);
   
@@ -159,14 +230,14 @@ void AliReducedAnalysisFilterTrees::Process() {
   
   // fill event information before event cuts
   AliReducedVarManager::FillEventInfo(fEvent, fValues);
-  fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventBeforeCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTagBeforeCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
       AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-      fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersBeforeCuts], fValues);
   }
   
   // apply event selection
@@ -179,14 +250,14 @@ void AliReducedAnalysisFilterTrees::Process() {
   }
  
   // fill event info histograms after cuts
-  fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventAfterCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTagAfterCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-     fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersAfterCuts], fValues);
   }
   
   CreateFilteredEvent();  
@@ -227,19 +298,19 @@ void AliReducedAnalysisFilterTrees::WriteFilteredPairs() {
    for(Int_t ip=0; ip<fEvent->NPairs(); ++ip) {
       pair = (AliReducedPairInfo*)nextPair();
       AliReducedVarManager::FillPairInfo(pair, fValues);
-      fHistosManager->FillHistClass("Pair_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistPairBeforeCuts], fValues);
       for(UShort_t iflag=0; iflag<32; ++iflag) {
          AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues);
-         fHistosManager->FillHistClass("PairQualityFlags_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistPairQualityFlagsBeforeCuts], fValues);
       }
       
       if(IsPairSelected(pair, fValues)) {
          for(Int_t icut=0; icut<fPairCuts.GetEntries(); ++icut) {
             if(pair->TestFlag(icut)) {
-               fHistosManager->FillHistClass(Form("Pair_%s", fPairCuts.At(icut)->GetName()), fValues);
+               fHistosManager->FillHistClass(fPairHistClasses[0][icut], fValues);
                for(UShort_t iflag=0; iflag<32; ++iflag) {
                   AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues);
-                  fHistosManager->FillHistClass(Form("PairQualityFlags_%s", fPairCuts.At(icut)->GetName()), fValues);
+                  fHistosManager->FillHistClass(fPairHistClasses[1][icut], fValues);
                }
             }
          }
@@ -265,7 +336,7 @@ void AliReducedAnalysisFilterTrees::WriteFilteredTracks(Int_t array /*=1*/) {
       track = (AliReducedBaseTrack*)nextTrack();
       AliReducedVarManager::FillTrackInfo(track, fValues);
       AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistTrackBeforeCuts], fValues);
       
       Bool_t writeTrack = IsTrackSelected(track, fValues);
       writeTrack |= TrackIsCandidateLeg(track);
@@ -273,7 +344,7 @@ void AliReducedAnalysisFilterTrees::WriteFilteredTracks(Int_t array /*=1*/) {
       if(writeTrack) {
          for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
             if(track->TestFlag(icut)) 
-               fHistosManager->FillHistClass(Form("Track_%s", fTrackCuts.At(icut)->GetName()), fValues);
+               fHistosManager->FillHistClass(fTrackHistClasses[icut], fValues);
          }
          TClonesArray& tracks = (array==1 ? *(fFilteredEvent->fTracks) : *(fFilteredEvent->fTracks2));
       
@@ -330,22 +401,22 @@ void AliReducedAnalysisFilterTrees::RunCandidateLegsSelection() {
       if(isAsymmetricDecayChannel) {
          if(IsCandidateLegSelected(track, fValues, 1) && mcDecision) {
             fLeg1Tracks.Add(track);
-            FillCandidateLegHistograms("Track_LEG1_BeforePrefilter", track, fValues, 1, isAsymmetricDecayChannel);
+            FillCandidateLegHistograms(fLegHistClasses[0], track, fValues, 1, isAsymmetricDecayChannel);
          }
          if(IsCandidateLegSelected(track, fValues, 2) && mcDecision) {
             fLeg2Tracks.Add(track);
-            FillCandidateLegHistograms("Track_LEG2_BeforePrefilter", track, fValues, 2, isAsymmetricDecayChannel);
+            FillCandidateLegHistograms(fLegHistClasses[1], track, fValues, 2, isAsymmetricDecayChannel);
          }
       }
       else {
          if(IsCandidateLegSelected(track, fValues,1) && mcDecision) {
             if(track->Charge()>0) {
                fLeg1Tracks.Add(track);
-               FillCandidateLegHistograms("Track_LEG1_BeforePrefilter", track, fValues, 1, isAsymmetricDecayChannel);
+               FillCandidateLegHistograms(fLegHistClasses[0], track, fValues, 1, isAsymmetricDecayChannel);
             }
             if(track->Charge()<0) {
                fLeg2Tracks.Add(track);
-               FillCandidateLegHistograms("Track_LEG2_BeforePrefilter", track, fValues, 1, isAsymmetricDecayChannel);
+               FillCandidateLegHistograms(fLegHistClasses[1], track, fValues, 1, isAsymmetricDecayChannel);
             }
          } 
       }
@@ -355,22 +426,22 @@ void AliReducedAnalysisFilterTrees::RunCandidateLegsSelection() {
       if(isAsymmetricDecayChannel) {
          if(IsCandidateLegPrefilterSelected(track, fValues, 1)) {
             fLeg1PrefilteredTracks.Add(track);
-            fHistosManager->FillHistClass("Track_LEG1_PrefilterTrack", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistTrackLeg1PrefilterTrack], fValues);
          }
          if(IsCandidateLegPrefilterSelected(track, fValues, 2)) {
             fLeg2PrefilteredTracks.Add(track);
-            fHistosManager->FillHistClass("Track_LEG2_PrefilterTrack", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistTrackLeg2PrefilterTrack], fValues);
          }
       }
       else {
          if(IsCandidateLegPrefilterSelected(track, fValues)) {
             if(track->Charge()>0) {
                fLeg1PrefilteredTracks.Add(track);
-               fHistosManager->FillHistClass("Track_LEG1_PrefilterTrack", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackLeg1PrefilterTrack], fValues);
             }
             if(track->Charge()<0) {
                fLeg2PrefilteredTracks.Add(track);
-               fHistosManager->FillHistClass("Track_LEG2_PrefilterTrack", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackLeg2PrefilterTrack], fValues);
             }
          }
       }
@@ -483,7 +554,7 @@ void AliReducedAnalysisFilterTrees::RunSameEventPairing() {
          candidatePair->SetFlags(compatibilityMask);
          SetupPair(candidatePair, fValues);
          fFilteredEvent->fNV0candidates[1] += 1;
-         FillCandidatePairHistograms("Pair_Candidate12", candidatePair, fValues, isAsymmetricDecayChannel);
+         FillCandidatePairHistograms(fCandidatePairHistClasses[0], candidatePair, fValues, isAsymmetricDecayChannel);
       }  // end loop over LEG2 tracks
       
       if(fBuildCandidateLikePairs) {
@@ -502,7 +573,7 @@ void AliReducedAnalysisFilterTrees::RunSameEventPairing() {
             candidatePair->SetFlags(compatibilityMask);
             SetupPair(candidatePair, fValues);
             fFilteredEvent->fNV0candidates[1] += 1;            
-            FillCandidatePairHistograms("Pair_Candidate11", candidatePair, fValues, isAsymmetricDecayChannel);
+            FillCandidatePairHistograms(fCandidatePairHistClasses[1], candidatePair, fValues, isAsymmetricDecayChannel);
          }  // end loop over LEG1 tracks
       }  // end if(fBuildCandidateLikePairs)
    }  // end loop over LEG1 tracks
@@ -528,7 +599,7 @@ void AliReducedAnalysisFilterTrees::RunSameEventPairing() {
             candidatePair->SetFlags(compatibilityMask);
             SetupPair(candidatePair, fValues);
             fFilteredEvent->fNV0candidates[1] += 1;           
-            FillCandidatePairHistograms("Pair_Candidate22", candidatePair, fValues, isAsymmetricDecayChannel);
+            FillCandidatePairHistograms(fCandidatePairHistClasses[2], candidatePair, fValues, isAsymmetricDecayChannel);
          }  // end loop over negative tracks
       }  // end loop over negative tracks
    }
@@ -736,25 +807,25 @@ Bool_t AliReducedAnalysisFilterTrees::IsAsymmetricDecayChannel() {
 }
 
 //___________________________________________________________________________
-void AliReducedAnalysisFilterTrees::FillCandidateLegHistograms(TString histClass, AliReducedBaseTrack* track, Float_t* values, Int_t leg, Bool_t isAsymmetricDecayChannel) {
+void AliReducedAnalysisFilterTrees::FillCandidateLegHistograms(const std::vector<Int_t>& histClasses, AliReducedBaseTrack* track, Float_t* values, Int_t leg, Bool_t isAsymmetricDecayChannel) {
    //
-   // fill track histogram lists according to the track flags 
+   // fill track histogram lists according to the track flags, classes <histClass>_<leg cut> as resolved in ResolveHistClasses()
    //
    for(Int_t icut=0; icut<fLeg1Cuts.GetEntries(); ++icut) {
       if(track->TestFlag(leg==2 && isAsymmetricDecayChannel ? icut+32 : icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s", histClass.Data(), (leg==2 && isAsymmetricDecayChannel ? fLeg2Cuts.At(icut)->GetName() : fLeg1Cuts.At(icut)->GetName())), fValues);
+         fHistosManager->FillHistClass(histClasses[icut], fValues);
       }
    }
 }
 
 //___________________________________________________________________________
-void AliReducedAnalysisFilterTrees::FillCandidatePairHistograms(TString histClass, AliReducedPairInfo* pair, Float_t* values, Bool_t isAsymmetricDecayChannel) {
+void AliReducedAnalysisFilterTrees::FillCandidatePairHistograms(const std::vector<Int_t>& histClasses, AliReducedPairInfo* pair, Float_t* values, Bool_t /*isAsymmetricDecayChannel*/) {
    //
-   // fill track histogram lists according to the track flags 
+   // fill track histogram lists according to the track flags, classes <histClass>_<LEG1 cut>[_<LEG2 cut>] as resolved in ResolveHistClasses()
    //
    for(Int_t icut=0; icut<fLeg1Cuts.GetEntries(); ++icut) {
       if(pair->TestFlag(icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s%s", histClass.Data(), fLeg1Cuts.At(icut)->GetName(), (isAsymmetricDecayChannel ? Form("_%s", fLeg2Cuts.At(icut)->GetName()) : "")), fValues);
+         fHistosManager->FillHistClass(histClasses[icut], fValues);
       }
    }
 }
@@ -894,7 +965,7 @@ void AliReducedAnalysisFilterTrees::LoopOverMCTracks(Int_t trackArray /*=1*/) {
       // loop over jpsi mother selections and fill histograms before the kine cuts on electrons
       for(Int_t iCut = 0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
          if(!(motherDecisions & (UInt_t(1)<<iCut)))  continue;
-         fHistosManager->FillHistClass(Form("%s_PureMCTRUTH_BeforeSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);
+         fHistosManager->FillHistClass(fMCTruthHistClasses[0][iCut], fValues);
       }
       if(!daughter1) continue;
       if(!daughter2) continue;
@@ -908,7 +979,7 @@ void AliReducedAnalysisFilterTrees::LoopOverMCTracks(Int_t trackArray /*=1*/) {
       for(Int_t iCut = 0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
          if(!(motherDecisions & (UInt_t(1)<<iCut)))  continue;
          if(!(daughtersDecisions & (UInt_t(1)<<iCut)))  continue;
-         fHistosManager->FillHistClass(Form("%s_PureMCTRUTH_AfterSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);
+         fHistosManager->FillHistClass(fMCTruthHistClasses[1][iCut], fValues);
       }
    }  // end loop over tracks
    return;
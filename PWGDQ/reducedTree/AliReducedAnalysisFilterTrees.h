@@ -5,6 +5,8 @@
 #ifndef ALIREDUCEDANALYSISFILTERTREES_H
 #define ALIREDUCEDANALYSISFILTERTREES_H
 
+#include <vector>
+
 #include <TList.h>
 
 #include "AliReducedAnalysisTaskSE.h"
@@ -35,7 +37,7 @@ public:
   void SetWriteFilteredPairs(Bool_t option=kTRUE) {fWriteFilteredPairs=option;}
   void SetMCJpsiPtWeights(TH1F* weights) {fMCJpsiPtWeights = weights;}
   
-  void SetBuildCandidatePairs(AliReducedPairInfo::CandidateType type) {fBuildCandidatePairs=kTRUE; fCandidateType=type;}
+  void SetBuildCandidatePairs(AliReducedPairInfo::CandidateType type);
   void SetBuildCandidateLikePairs(Bool_t option=kTRUE) {fBuildCandidateLikePairs=option;}
   void AddCandidateLeg1Cut(AliReducedInfoCut* cut) {fLeg1Cuts.Add(cut);}
   void AddCandidateLeg2Cut(AliReducedInfoCut* cut) {fLeg2Cuts.Add(cut);}
@@ -136,6 +138,22 @@ protected:
    //  NOTE: The number of selections on the jpsi electron needs to be the same and in sync with the number of fJpsiMotherMCcuts cuts
    TList fJpsiElectronMCcuts;
    
+   // histogram classes filled in the event loop, resolved at the first event (see ResolveHistClasses())
+   enum EHistClasses {
+      kHistEventBeforeCuts=0, kHistEventTagBeforeCuts, kHistEventTriggersBeforeCuts,
+      kHistEventAfterCuts, kHistEventTagAfterCuts, kHistEventTriggersAfterCuts,
+      kHistPairBeforeCuts, kHistPairQualityFlagsBeforeCuts, kHistTrackBeforeCuts,
+      kHistTrackLeg1PrefilterTrack, kHistTrackLeg2PrefilterTrack,
+      kNHistClasses
+   };
+   Bool_t fHistClassesResolved;                      //! the histogram classes below are resolved
+   Int_t  fHistClasses[kNHistClasses];               //! classes with fixed names, see EHistClasses
+   std::vector<Int_t> fPairHistClasses[2];           //! Pair_<cut>, PairQualityFlags_<cut>
+   std::vector<Int_t> fTrackHistClasses;             //! Track_<cut>
+   std::vector<Int_t> fLegHistClasses[2];            //! Track_LEG<1,2>_BeforePrefilter_<leg cut>
+   std::vector<Int_t> fCandidatePairHistClasses[3];  //! Pair_Candidate<12,11,22>_<LEG1 cut>[_<LEG2 cut>]
+   std::vector<Int_t> fMCTruthHistClasses[2];        //! <J/psi mother MC cut>_PureMCTRUTH_<Before,After>Selection
+   
    Bool_t IsEventSelected(AliReducedBaseEvent* event, Float_t* values=0x0);
    Bool_t IsTrackSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
    Bool_t IsPairSelected(AliReducedPairInfo* pair, Float_t* values=0x0);
@@ -161,10 +179,11 @@ protected:
    void RunSameEventPairing();
    void SetupPair(AliReducedPairInfo* pair, Float_t* values);
    ULong_t CheckTrackCompatibility(AliReducedBaseTrack* leg1, AliReducedBaseTrack* leg2, Bool_t isAsymmetricDecayChannel);
-   void FillCandidateLegHistograms(TString histClass, AliReducedBaseTrack* track, Float_t* values, Int_t leg, Bool_t isAsymmetricDecayChannel);
-   void FillCandidatePairHistograms(TString histClass, AliReducedPairInfo* pair, Float_t* values, Bool_t isAsymmetricDecayChannel);
+   void FillCandidateLegHistograms(const std::vector<Int_t>& histClasses, AliReducedBaseTrack* track, Float_t* values, Int_t leg, Bool_t isAsymmetricDecayChannel);
+   void FillCandidatePairHistograms(const std::vector<Int_t>& histClasses, AliReducedPairInfo* pair, Float_t* values, Bool_t isAsymmetricDecayChannel);
+   void ResolveHistClasses();
    
-  ClassDef(AliReducedAnalysisFilterTrees,1);
+  ClassDef(AliReducedAnalysisFilterTrees,2);
 };
 
 #endif
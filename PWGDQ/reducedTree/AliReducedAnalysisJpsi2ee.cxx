@@ -61,7 +61,13 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee() :
   fClusterTrackMatcherMultipleMatchesBefore(0x0),
   fClusterTrackMatcherMultipleMatchesAfter(0x0),
   fSkipMCEvent(kFALSE),
-  fMCJpsiPtWeights(0x0)
+  fMCJpsiPtWeights(0x0),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fTrackHistClasses(),
+  fPairHistClasses(),
+  fClusterHistClasses(),
+  fMCTruthHistClasses()
 {
   //
   // default constructor
@@ -103,7 +109,13 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee(const Char_t* name, const C
   fClusterTrackMatcherMultipleMatchesBefore(0x0),
   fClusterTrackMatcherMultipleMatchesAfter(0x0),
   fSkipMCEvent(kFALSE),
-  fMCJpsiPtWeights(0x0)
+  fMCJpsiPtWeights(0x0),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fTrackHistClasses(),
+  fPairHistClasses(),
+  fClusterHistClasses(),
+  fMCTruthHistClasses()
 {
   //
   // named constructor
@@ -290,6 +302,47 @@ void AliReducedAnalysisJpsi2ee::Init() {
   }
 }
 
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::ResolveHistClasses() {
+  //
+  // Resolve the histogram classes filled in the event loop, once at the first event when all the classes are defined.
+  // The fills then use AliHistogramManager::FillHistClass(Int_t, Float_t*) instead of looking up the class names
+  //
+  const Char_t* classNames[kNHistClasses] = {
+     "Event_BeforeCuts", "EventTag_BeforeCuts", "EventTriggers_BeforeCuts",
+     "Event_AfterCuts", "EventTag_AfterCuts", "EventTriggers_AfterCuts", "V0Channels",
+     "CaloCluster_BeforeCuts", "Track_BeforeCuts", "TrackStatusFlags_BeforeCuts",
+     "TrackITSclusterMap_BeforeCuts", "TrackITSsharedClusterMap_BeforeCuts", "TrackTPCclusterMap_BeforeCuts"
+  };
+  for(Int_t i=0; i<kNHistClasses; ++i) fHistClasses[i] = GetHistClassIndex(classNames[i]);
+  ResolveTrackHistClasses("Track", fTrackHistClasses);
+  ResolvePairHistClasses("PairSE", fPairHistClasses);
+  fClusterHistClasses = GetHistClassIndices("CaloCluster", fClusterCuts);
+  fMCTruthHistClasses[0] = GetHistClassIndices("", fJpsiMotherMCcuts, 0x0, "_PureMCTruth_BeforeSelection");
+  fMCTruthHistClasses[1] = GetHistClassIndices("", fJpsiMotherMCcuts, 0x0, "_PureMCTruth_AfterSelection");
+  fHistClassesResolved = kTRUE;
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::ResolveTrackHistClasses(const Char_t* trackClass, std::vector<Int_t>* histClasses) const {
+  //
+  // histogram classes <trackClass><type>_<cut>[_<leg MC cut>], for all ETrackHistClassTypes
+  //
+  const Char_t* typeNames[kNTrackHistClassTypes] = {"", "StatusFlags", "ITSclusterMap", "ITSsharedClusterMap", "TPCclusterMap"};
+  for(Int_t i=0; i<kNTrackHistClassTypes; ++i)
+     histClasses[i] = GetHistClassIndices(Form("%s%s", trackClass, typeNames[i]), fTrackCuts, &fLegCandidatesMCcuts);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::ResolvePairHistClasses(const Char_t* pairClass, std::vector<Int_t>* histClasses) const {
+  //
+  // histogram classes <pairClass><PP,PM,MM>_<cut>[_<leg MC cut>]
+  //
+  const Char_t* typeNames[3] = {"PP", "PM", "MM"};
+  for(Int_t i=0; i<3; ++i)
+     histClasses[i] = GetHistClassIndices(Form("%s%s", pairClass, typeNames[i]), fTrackCuts, &fLegCandidatesMCcuts);
+}
+
 
 //___________________________________________________________________________
 void AliReducedAnalysisJpsi2ee::Process() {
@@ -306,6 +359,7 @@ void AliReducedAnalysisJpsi2ee::Process() {
   if(fOptionRunOverMC && fEventCounter%10000==0)  cout << "Event no. " << fEventCounter << endl;
   else if(fEventCounter%10000==0)                 cout << "Event no. " << fEventCounter << endl;
   fEventCounter++;
+  if(!fHistClassesResolved) ResolveHistClasses();
   
   AliReducedVarManager::SetEvent(fEvent);
   
@@ -315,14 +369,14 @@ void AliReducedAnalysisJpsi2ee::Process() {
   
   // fill event information before event cuts
   AliReducedVarManager::FillEventInfo(fEvent, fValues);
-  fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventBeforeCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTagBeforeCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
       AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-      fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersBeforeCuts], fValues);
   }
 
   // apply event selection
@@ -374,18 +428,18 @@ void AliReducedAnalysisJpsi2ee::Process() {
     RunSameEventPairing();
  
   // fill event info histograms after cuts
-  fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventAfterCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTagAfterCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-     fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersAfterCuts], fValues);
   }
   for(UShort_t ich=0; ich<64; ++ich) {
      AliReducedVarManager::FillV0Channel(ich, fValues);
-     fHistosManager->FillHistClass("V0Channels", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistV0Channels], fValues);
   }
   
 }
@@ -396,6 +450,10 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
    //
    // Fill all track histograms
    //
+   if(!fHistClassesResolved) ResolveHistClasses();
+   std::vector<Int_t> otherHistClasses[kNTrackHistClassTypes];
+   const std::vector<Int_t>* histClasses = fTrackHistClasses;
+   if(trackClass!="Track") {ResolveTrackHistClasses(trackClass.Data(), otherHistClasses); histClasses = otherHistClasses;}
    for(Int_t i=0;i<36; ++i) fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+i] = 0.;
    AliReducedBaseTrack* track=0;
    if (fClusterTrackMatcher) {
@@ -413,7 +471,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
       AliReducedVarManager::FillTrackInfo(track, fValues);
       if (fClusterCuts.GetEntries())  AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, &fClusters, fClusterTrackMatcher);
       else                            AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, NULL, fClusterTrackMatcher);
-      FillTrackHistograms(track, trackClass);
+      FillTrackHistClasses(track, histClasses);
    }
    if (fClusterTrackMatcher) {
      fClusterTrackMatcher->FillMultipleMatchesHistogram(fClusterTrackMatcherMultipleMatchesBefore, fClusterTrackMatcher->GetMatchedClusterIDsBefore());
@@ -432,7 +490,7 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(TString trackClass /*= "Trac
       AliReducedVarManager::FillTrackInfo(track, fValues);
       if (fClusterCuts.GetEntries())  AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, &fClusters, fClusterTrackMatcher);
       else                            AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, NULL, fClusterTrackMatcher);
-      FillTrackHistograms(track, trackClass);
+      FillTrackHistClasses(track, histClasses);
    }
    if (fClusterTrackMatcher) {
      fClusterTrackMatcher->FillMultipleMatchesHistogram(fClusterTrackMatcherMultipleMatchesBefore, fClusterTrackMatcher->GetMatchedClusterIDsBefore());
@@ -446,19 +504,25 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track,
    //
    // fill track level histograms
    //
+   if(!fHistClassesResolved) ResolveHistClasses();
+   std::vector<Int_t> otherHistClasses[kNTrackHistClassTypes];
+   if(trackClass=="Track") {FillTrackHistClasses(track, fTrackHistClasses); return;}
+   ResolveTrackHistClasses(trackClass.Data(), otherHistClasses);
+   FillTrackHistClasses(track, otherHistClasses);
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::FillTrackHistClasses(AliReducedBaseTrack* track, const std::vector<Int_t>* histClasses) {
+   //
+   // fill track level histograms, classes as resolved by ResolveTrackHistClasses()
+   //
    UInt_t mcDecisionMap = 0;
    if(fOptionRunOverMC) mcDecisionMap = CheckReconstructedLegMCTruth(track);      
    
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(track->TestFlag(icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(mcDecisionMap) {       // Fill histograms for tracks identified as MC truth
-            for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-               if(mcDecisionMap & (UInt_t(1)<<iMC))
-                  fHistosManager->FillHistClass(Form("%s_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(), 
-                                                                  fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-            }
-         }
+         FillTrackHistClass(histClasses[kTrackHistos], icut, mcDecisionMap);
          
          if(track->IsA() != AliReducedTrackInfo::Class()) continue;
          
@@ -467,64 +531,64 @@ void AliReducedAnalysisJpsi2ee::FillTrackHistograms(AliReducedBaseTrack* track,
          
          for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
             AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-            fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sStatusFlags_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                                     fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            FillTrackHistClass(histClasses[kTrackStatusFlagsHistos], icut, mcDecisionMap);
          }
          for(Int_t iLayer=0; iLayer<6; ++iLayer) {
             AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                                     fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            FillTrackHistClass(histClasses[kTrackITSclusterMapHistos], icut, mcDecisionMap);
             AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                        fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            FillTrackHistClass(histClasses[kTrackITSsharedClusterMapHistos], icut, mcDecisionMap);
          }
          for(Int_t iLayer=0; iLayer<8; ++iLayer) {
             AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(mcDecisionMap) {
-               for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
-                  if(mcDecisionMap & (UInt_t(1)<<iMC))
-                     fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                                     fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
-               }
-            }
+            FillTrackHistClass(histClasses[kTrackTPCclusterMapHistos], icut, mcDecisionMap);
          }
       } // end if(track->TestFlag(icut))
    }  // end loop over cuts
 }
 
 
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::FillTrackHistClass(const std::vector<Int_t>& histClasses, Int_t icut, UInt_t mcDecisionMap) {
+   //
+   // fill the class <trackClass><type>_<cut> and, for tracks identified as MC truth, the classes <trackClass><type>_<cut>_<leg MC cut>
+   //
+   const Int_t nMCcuts = fLegCandidatesMCcuts.GetEntries();
+   fHistosManager->FillHistClass(histClasses[HistClassSlot(icut, -1, nMCcuts)], fValues);
+   if(!mcDecisionMap) return;
+   for(Int_t iMC=0; iMC<nMCcuts; ++iMC) {
+      if(mcDecisionMap & (UInt_t(1)<<iMC))
+         fHistosManager->FillHistClass(histClasses[HistClassSlot(icut, iMC, nMCcuts)], fValues);
+   }
+}
+
+
 //___________________________________________________________________________
 void AliReducedAnalysisJpsi2ee::FillPairHistograms(ULong_t mask, Int_t pairType, TString pairClass /*="PairSE"*/, UInt_t mcDecisions /* = 0*/) {
    //
    // fill pair level histograms
    // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
-   TString typeStr[3] = {"PP", "PM", "MM"};
+   if(!fHistClassesResolved) ResolveHistClasses();
+   std::vector<Int_t> otherHistClasses[3];
+   if(pairClass=="PairSE") {FillPairHistClasses(mask, pairType, fPairHistClasses, mcDecisions); return;}
+   ResolvePairHistClasses(pairClass.Data(), otherHistClasses);
+   FillPairHistClasses(mask, pairType, otherHistClasses, mcDecisions);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::FillPairHistClasses(ULong_t mask, Int_t pairType, const std::vector<Int_t>* histClasses, UInt_t mcDecisions /* = 0*/) {
+   //
+   // fill pair level histograms, classes as resolved by ResolvePairHistClasses()
+   // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
+   const std::vector<Int_t>& typeClasses = histClasses[pairType];
+   const Int_t nMCcuts = fLegCandidatesMCcuts.GetEntries();
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(mask & (ULong_t(1)<<icut)) {
-         fHistosManager->FillHistClass(Form("%s%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
+         fHistosManager->FillHistClass(typeClasses[HistClassSlot(icut, -1, nMCcuts)], fValues);
          if(mcDecisions && pairType==1) {
-            for(Int_t iMC=0; iMC<=fLegCandidatesMCcuts.GetEntries(); ++iMC) {
+            for(Int_t iMC=0; iMC<nMCcuts; ++iMC) {
                if(mcDecisions & (UInt_t(1)<<iMC))
-                  fHistosManager->FillHistClass(Form("%s%s_%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName(), fLegCandidatesMCcuts.At(iMC)->GetName()), fValues);
+                  fHistosManager->FillHistClass(typeClasses[HistClassSlot(icut, iMC, nMCcuts)], fValues);
             }
          }
       }
@@ -536,13 +600,17 @@ void AliReducedAnalysisJpsi2ee::FillClusterHistograms(TString clusterClass/*="Ca
   //
   // fill cluster histograms
   //
+  if(!fHistClassesResolved) ResolveHistClasses();
+  std::vector<Int_t> otherHistClasses;
+  if(clusterClass!="CaloCluster") otherHistClasses = GetHistClassIndices(clusterClass.Data(), fClusterCuts);
+  const std::vector<Int_t>& histClasses = (clusterClass=="CaloCluster" ? fClusterHistClasses : otherHistClasses);
   AliReducedCaloClusterInfo* cluster = NULL;
   TIter nextCluster(&fClusters);
   for (Int_t i=0; i<fClusters.GetEntries(); ++i) {
     cluster = (AliReducedCaloClusterInfo*)nextCluster();
     for (Int_t i=AliReducedVarManager::kEMCALclusterEnergy; i<=AliReducedVarManager::kNEMCALvars; ++i) fValues[i] = -9999.;
     AliReducedVarManager::FillCaloClusterInfo(cluster, fValues);
-    FillClusterHistograms(cluster, clusterClass);
+    FillClusterHistClasses(cluster, histClasses);
   }
 }
 
@@ -551,8 +619,18 @@ void AliReducedAnalysisJpsi2ee::FillClusterHistograms(AliReducedCaloClusterInfo*
   //
   // fill cluster histograms
   //
+  if(!fHistClassesResolved) ResolveHistClasses();
+  if(clusterClass=="CaloCluster") FillClusterHistClasses(cluster, fClusterHistClasses);
+  else                            FillClusterHistClasses(cluster, GetHistClassIndices(clusterClass.Data(), fClusterCuts));
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2ee::FillClusterHistClasses(AliReducedCaloClusterInfo* cluster, const std::vector<Int_t>& histClasses) {
+  //
+  // fill cluster histograms, classes <clusterClass>_<cut>
+  //
   for (Int_t icut=0; icut<fClusterCuts.GetEntries(); ++icut) {
-    if (cluster->TestFlag(icut)) fHistosManager->FillHistClass(Form("%s_%s", clusterClass.Data(), fClusterCuts.At(icut)->GetName()), fValues);
+    if (cluster->TestFlag(icut)) fHistosManager->FillHistClass(histClasses[icut], fValues);
   }
 }
 
@@ -561,6 +639,7 @@ void AliReducedAnalysisJpsi2ee::RunClusterSelection() {
   //
   // select cluster
   //
+  if(!fHistClassesResolved) ResolveHistClasses();
   fClusters.Clear("C");
 
   if (fEvent->IsA() == AliReducedBaseEvent::Class()) return;
@@ -574,7 +653,7 @@ void AliReducedAnalysisJpsi2ee::RunClusterSelection() {
     for (Int_t i=AliReducedVarManager::kEMCALclusterEnergy; i<=AliReducedVarManager::kNEMCALvars; ++i) fValues[i] = -9999.;
 
     AliReducedVarManager::FillCaloClusterInfo(cluster, fValues);
-    fHistosManager->FillHistClass("CaloCluster_BeforeCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistCaloClusterBeforeCuts], fValues);
 
     if (IsClusterSelected(cluster, fValues)) fClusters.Add(cluster);
   }
@@ -599,6 +678,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverTracks(Int_t arrayOption /*=1*/) {
    //
    // Loop over a given track array, apply cuts and add selected tracks to arrays
    //
+   if(!fHistClassesResolved) ResolveHistClasses();
    AliReducedBaseTrack* track = 0x0;
    TClonesArray* trackList = (arrayOption==1 ? fEvent->GetTracks() : fEvent->GetTracks2());
    if (!trackList) return;
@@ -615,24 +695,24 @@ void AliReducedAnalysisJpsi2ee::LoopOverTracks(Int_t arrayOption /*=1*/) {
       AliReducedVarManager::FillTrackInfo(track, fValues);
       if (fClusterCuts.GetEntries())  AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, &fClusters, fClusterTrackMatcher);
       else                            AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, NULL, fClusterTrackMatcher);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistTrackBeforeCuts], fValues);
       
       if(track->IsA() == AliReducedTrackInfo::Class()) {
          AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
          if(trackInfo) {
             for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
                AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-               fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackStatusFlagsBeforeCuts], fValues);
             }
             for(Int_t iLayer=0; iLayer<6; ++iLayer) {
                AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackITSclusterMapBeforeCuts], fValues);
                AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackITSsharedClusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackITSsharedClusterMapBeforeCuts], fValues);
             }
             for(Int_t iLayer=0; iLayer<8; ++iLayer) {
                AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-               fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackTPCclusterMapBeforeCuts], fValues);
             }
          }
       }
@@ -656,8 +736,12 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
    //
    // Run the same event pairing
    //
+   if(!fHistClassesResolved) ResolveHistClasses();
    if(fOptionStoreJpsiCandidates) fJpsiCandidates.Clear("C");
    fValues[AliReducedVarManager::kNpairsSelected] = 0;
+   std::vector<Int_t> otherHistClasses[3];
+   const std::vector<Int_t>* histClasses = fPairHistClasses;
+   if(pairClass!="PairSE") {ResolvePairHistClasses(pairClass.Data(), otherHistClasses); histClasses = otherHistClasses;}
    
    TIter nextPosTrack(&fPosTracks);
    TIter nextNegTrack(&fNegTracks);
@@ -677,7 +761,7 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
          if(!(pTrack->GetFlags() & nTrack->GetFlags())) continue;
          AliReducedVarManager::FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
          if(IsPairSelected(fValues)) {
-            FillPairHistograms(pTrack->GetFlags() & nTrack->GetFlags(), 1, pairClass, (fOptionRunOverMC ? CheckReconstructedLegMCTruth(pTrack, nTrack) : 0));    // 1 is for +- pairs 
+            FillPairHistClasses(pTrack->GetFlags() & nTrack->GetFlags(), 1, histClasses, (fOptionRunOverMC ? CheckReconstructedLegMCTruth(pTrack, nTrack) : 0));    // 1 is for +- pairs 
             fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
             if(fOptionStoreJpsiCandidates) {
                AliReducedPairInfo* pair = new AliReducedPairInfo();
@@ -700,7 +784,7 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
             if(!(pTrack->GetFlags() & pTrack2->GetFlags())) continue;
             AliReducedVarManager::FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
-               FillPairHistograms(pTrack->GetFlags() & pTrack2->GetFlags(), 0, pairClass);       // 0 is for ++ pairs 
+               FillPairHistClasses(pTrack->GetFlags() & pTrack2->GetFlags(), 0, histClasses);       // 0 is for ++ pairs 
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
                if(fOptionStoreJpsiCandidates) {
                   AliReducedPairInfo* pair = new AliReducedPairInfo();
@@ -729,7 +813,7 @@ void AliReducedAnalysisJpsi2ee::RunSameEventPairing(TString pairClass /*="PairSE
             if(!(nTrack->GetFlags() & nTrack2->GetFlags())) continue;
             AliReducedVarManager::FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
-               FillPairHistograms(nTrack->GetFlags() & nTrack2->GetFlags(), 2, pairClass);      // 2 is for -- pairs
+               FillPairHistClasses(nTrack->GetFlags() & nTrack2->GetFlags(), 2, histClasses);      // 2 is for -- pairs
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
                if(fOptionStoreJpsiCandidates) {
                   AliReducedPairInfo* pair = new AliReducedPairInfo();
@@ -917,6 +1001,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
    //
    // loop over the track array and check the pure MC tracks against the defined MC selections
    //   
+   if(!fHistClassesResolved) ResolveHistClasses();
    AliReducedTrackInfo* mother=0x0;
    AliReducedTrackInfo* daughter1 = 0x0;
    AliReducedTrackInfo* daughter2 = 0x0;
@@ -980,7 +1065,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
       // loop over jpsi mother selections and fill histograms before the kine cuts on electrons
       for(Int_t iCut = 0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
          if(!(motherDecisions & (UInt_t(1)<<iCut)))  continue;
-         fHistosManager->FillHistClass(Form("%s_PureMCTruth_BeforeSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);         
+         fHistosManager->FillHistClass(fMCTruthHistClasses[0][iCut], fValues);
       }
       
       if(!daughter1) continue;
@@ -995,7 +1080,7 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
       for(Int_t iCut = 0; iCut<fJpsiMotherMCcuts.GetEntries(); ++iCut) {
          if(!(motherDecisions & (UInt_t(1)<<iCut)))  continue;
          if(!(daughtersDecisions & (UInt_t(1)<<iCut)))  continue;
-         fHistosManager->FillHistClass(Form("%s_PureMCTruth_AfterSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);         
+         fHistosManager->FillHistClass(fMCTruthHistClasses[1][iCut], fValues);
       }
    }  // end loop over tracks
    
@@ -1035,9 +1120,10 @@ void AliReducedAnalysisJpsi2ee::LoopOverMCTracks(Int_t trackArray /*=1*/) {
             // loop over cuts and fill histograms
             for(Int_t iCut = 0; iCut<fJpsiElectronMCcuts.GetEntries(); ++iCut) {
                if(!(daughterDecisions & (UInt_t(1)<<iCut)))  continue;
+               if(iCut>=(Int_t)fMCTruthHistClasses[0].size()) break;     // the classes are named after the J/psi mother MC cuts
                // the same information is filled in both Before and After histogram lists
-               fHistosManager->FillHistClass(Form("%s_PureMCTruth_BeforeSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);         
-               fHistosManager->FillHistClass(Form("%s_PureMCTruth_AfterSelection", fJpsiMotherMCcuts.At(iCut)->GetName()), fValues);         
+               fHistosManager->FillHistClass(fMCTruthHistClasses[0][iCut], fValues);
+               fHistosManager->FillHistClass(fMCTruthHistClasses[1][iCut], fValues);
             }
          }
       }   // end loop over tracks
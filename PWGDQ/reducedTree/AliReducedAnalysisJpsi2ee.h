@@ -5,6 +5,8 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EE_H
 #define ALIREDUCEDANALYSISJPSI2EE_H
 
+#include <vector>
+
 #include <TList.h>
 
 #include "AliReducedAnalysisTaskSE.h"
@@ -134,6 +136,19 @@ protected:
    //  NOTE: The number of selections on the jpsi electron needs to be the same and in sync with the number of fJpsiMotherMCcuts cuts
    TList fJpsiElectronMCcuts;
    
+   // histogram classes filled in the event loop, resolved at the first event (see ResolveHistClasses())
+   enum EHistClasses {
+      kHistEventBeforeCuts=0, kHistEventTagBeforeCuts, kHistEventTriggersBeforeCuts,
+      kHistEventAfterCuts, kHistEventTagAfterCuts, kHistEventTriggersAfterCuts, kHistV0Channels,
+      kHistCaloClusterBeforeCuts, kHistTrackBeforeCuts, kHistTrackStatusFlagsBeforeCuts,
+      kHistTrackITSclusterMapBeforeCuts, kHistTrackITSsharedClusterMapBeforeCuts, kHistTrackTPCclusterMapBeforeCuts,
+      kNHistClasses
+   };
+   enum ETrackHistClassTypes {
+      kTrackHistos=0, kTrackStatusFlagsHistos, kTrackITSclusterMapHistos, kTrackITSsharedClusterMapHistos, kTrackTPCclusterMapHistos,
+      kNTrackHistClassTypes
+   };
+   
   Bool_t IsEventSelected(AliReducedBaseEvent* event, Float_t* values=0x0);
   Bool_t IsClusterSelected(AliReducedCaloClusterInfo* cluster, Float_t* values=0x0);
   Bool_t IsTrackSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
@@ -167,7 +182,22 @@ protected:
   Bool_t fSkipMCEvent;          // decision to skip MC event
   TH1F*  fMCJpsiPtWeights;            // weights vs pt to reject events depending on the jpsi true pt (needed to re-weights jpsi Pt distribution)
   
-  ClassDef(AliReducedAnalysisJpsi2ee,11);
+  Bool_t fHistClassesResolved;                                   //! the histogram classes below are resolved
+  Int_t  fHistClasses[kNHistClasses];                            //! classes with fixed names, see EHistClasses
+  std::vector<Int_t> fTrackHistClasses[kNTrackHistClassTypes];   //! Track<type>_<cut>[_<leg MC cut>], see ETrackHistClassTypes
+  std::vector<Int_t> fPairHistClasses[3];                        //! PairSE<PP,PM,MM>_<cut>[_<leg MC cut>]
+  std::vector<Int_t> fClusterHistClasses;                        //! CaloCluster_<cut>
+  std::vector<Int_t> fMCTruthHistClasses[2];                     //! <J/psi mother MC cut>_PureMCTruth_<Before,After>Selection
+  
+  virtual void ResolveHistClasses();
+  void ResolveTrackHistClasses(const Char_t* trackClass, std::vector<Int_t>* histClasses) const;
+  void ResolvePairHistClasses(const Char_t* pairClass, std::vector<Int_t>* histClasses) const;
+  void FillTrackHistClasses(AliReducedBaseTrack* track, const std::vector<Int_t>* histClasses);
+  void FillTrackHistClass(const std::vector<Int_t>& histClasses, Int_t icut, UInt_t mcDecisionMap);
+  void FillPairHistClasses(ULong_t mask, Int_t pairType, const std::vector<Int_t>* histClasses, UInt_t mcDecisions = 0);
+  void FillClusterHistClasses(AliReducedCaloClusterInfo* cluster, const std::vector<Int_t>& histClasses);
+  
+  ClassDef(AliReducedAnalysisJpsi2ee,12);
 };
 
 #endif
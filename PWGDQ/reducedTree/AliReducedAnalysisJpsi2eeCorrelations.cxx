@@ -47,7 +47,10 @@ AliReducedAnalysisJpsi2eeCorrelations::AliReducedAnalysisJpsi2eeCorrelations() :
   fOptionRunCorrelation(kTRUE),
   fOptionRunCorrelationMixing(kTRUE),
   fAssociatedTrackCuts(),
-  fAssociatedTracks()
+  fAssociatedTracks(),
+  fAssocHistClasses(),
+  fAssocTrackHistClasses(),
+  fCorrHistClasses()
 {
   //
   // default constructor
@@ -64,7 +67,10 @@ AliReducedAnalysisJpsi2eeCorrelations::AliReducedAnalysisJpsi2eeCorrelations(con
   fMBEventCuts(),
   fAssociatedTrackCuts(),
   fAssociatedTracks(),
-  fAssociatedTracksMB()
+  fAssociatedTracksMB(),
+  fAssocHistClasses(),
+  fAssocTrackHistClasses(),
+  fCorrHistClasses()
 {
   //
   // named constructor
@@ -97,6 +103,47 @@ void AliReducedAnalysisJpsi2eeCorrelations::Init() {
   fCorrelationsMixingHandler->SetHistogramManager(fHistosManager);
 }
 
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::ResolveHistClasses() {
+  //
+  // resolve the histogram classes of the J/psi analysis, the associated tracks and the correlations
+  //
+  AliReducedAnalysisJpsi2ee::ResolveHistClasses();
+  const Char_t* classNames[kNAssocHistClasses] = {
+    "AssociatedTrack_BeforeCuts", "AssociatedTrackStatusFlags_BeforeCuts", "AssociatedTrackITSclusterMap_BeforeCuts", "AssociatedTrackTPCclusterMap_BeforeCuts"
+  };
+  for(Int_t i=0; i<kNAssocHistClasses; ++i) fAssocHistClasses[i] = GetHistClassIndex(classNames[i]);
+  ResolveAssociatedTrackHistClasses("AssociatedTrack", fAssocTrackHistClasses);
+  const Char_t* pairTypeNames[3] = {"PP","PM","MM"};
+  for(Int_t i=0; i<3; ++i) ResolveCorrelationHistClasses((TString("CorrSE")+pairTypeNames[i]).Data(), fCorrHistClasses[i]);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::ResolveAssociatedTrackHistClasses(const Char_t* trackClass, std::vector<Int_t> (*histClasses)[2]) const {
+  //
+  // histogram classes <trackClass><type>_<cut> and <trackClass><type>_<cut>_MCTruth, for all EAssocTrackHistClassTypes
+  //
+  const Char_t* typeNames[kNAssocTrackHistClassTypes] = {"", "StatusFlags", "ITSclusterMap", "TPCclusterMap"};
+  for(Int_t i=0; i<kNAssocTrackHistClassTypes; ++i) {
+    histClasses[i][0] = GetHistClassIndices(Form("%s%s", trackClass, typeNames[i]), fAssociatedTrackCuts);
+    histClasses[i][1] = GetHistClassIndices(Form("%s%s", trackClass, typeNames[i]), fAssociatedTrackCuts, 0x0, "_MCTruth");
+  }
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::ResolveCorrelationHistClasses(const Char_t* corrClass, std::vector<Int_t>* histClasses) const {
+  //
+  // histogram classes <corrClass>_<cut>_<associated cut> (histClasses[0]) and <corrClass>_<cut>_<associated cut>_MCTruth (histClasses[1]),
+  // the i-th J/psi leg cut is correlated with the i-th associated track cut
+  //
+  for(Int_t i=0; i<2; ++i) histClasses[i].assign(fAssociatedTrackCuts.GetEntries(), -1);
+  for(Int_t iCut=0; iCut<fAssociatedTrackCuts.GetEntries() && iCut<fTrackCuts.GetEntries(); ++iCut) {
+    TString className = Form("%s_%s_%s", corrClass, fTrackCuts.At(iCut)->GetName(), fAssociatedTrackCuts.At(iCut)->GetName());
+    histClasses[0][iCut] = GetHistClassIndex(className.Data());
+    histClasses[1][iCut] = GetHistClassIndex(Form("%s_MCTruth", className.Data()));
+  }
+}
+
 //___________________________________________________________________________
 void AliReducedAnalysisJpsi2eeCorrelations::Process() {
    //
@@ -231,6 +278,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::LoopOverAssociatedTracks(Int_t array
    //
    // loop over the given track array, select tracks and fill histograms
    //
+   if(!fHistClassesResolved) ResolveHistClasses();
    AliReducedTrackInfo*  track     = 0x0;
    TClonesArray*         trackList = (arrayOption==1 ? fEvent->GetTracks() : fEvent->GetTracks2());
    if (!trackList) return;
@@ -240,18 +288,18 @@ void AliReducedAnalysisJpsi2eeCorrelations::LoopOverAssociatedTracks(Int_t array
       if(fOptionRunOverMC && track->IsMCTruth()) continue;
       AliReducedVarManager::FillTrackInfo(track, fValues);
       AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues);
-      if (fillHistograms) fHistosManager->FillHistClass("AssociatedTrack_BeforeCuts", fValues);
+      if (fillHistograms) fHistosManager->FillHistClass(fAssocHistClasses[kHistAssocTrackBeforeCuts], fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-         if (fillHistograms) fHistosManager->FillHistClass("AssociatedTrackStatusFlags_BeforeCuts", fValues);
+         if (fillHistograms) fHistosManager->FillHistClass(fAssocHistClasses[kHistAssocTrackStatusFlagsBeforeCuts], fValues);
       }
       for(Int_t iLayer=0; iLayer<6; ++iLayer) {
          AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-         if (fillHistograms) fHistosManager->FillHistClass("AssociatedTrackITSclusterMap_BeforeCuts", fValues);
+         if (fillHistograms) fHistosManager->FillHistClass(fAssocHistClasses[kHistAssocTrackITSclusterMapBeforeCuts], fValues);
       }
       for(Int_t iLayer=0; iLayer<8; ++iLayer) {
          AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-         if (fillHistograms) fHistosManager->FillHistClass("AssociatedTrackTPCclusterMap_BeforeCuts", fValues);
+         if (fillHistograms) fHistosManager->FillHistClass(fAssocHistClasses[kHistAssocTrackTPCclusterMapBeforeCuts], fValues);
       }
       if(IsAssociatedTrackSelected(track, fValues)) {
          if (!fillMBTracks) fAssociatedTracks.Add(track);
@@ -267,7 +315,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::RunSameEventCorrelation(TString pair
   //
   if(fJpsiCandidates.GetEntries()==0) return;
   if(fAssociatedTracks.GetEntries()==0) return;
-  TString pairTypeNames[3] = {"PP","PM","MM"};
+  if(!fHistClassesResolved) ResolveHistClasses();
 
   TIter nextAssocTrack(&fAssociatedTracks);
   TIter nextJpsi(&fJpsiCandidates);
@@ -297,7 +345,7 @@ void AliReducedAnalysisJpsi2eeCorrelations::RunSameEventCorrelation(TString pair
         // TODO: isMCTruth must be handled; can be either a Bool or a bit map
         //             Not sure if we need MC truth for correlation -> if so remove from code
         Bool_t isMCTruth = kFALSE;
-        FillCorrelationHistograms(jpsi, assoc, Form("CorrSE%s", pairTypeNames[(Int_t)jpsi->PairType()].Data()), isMCTruth);
+        FillCorrelationHistClasses(jpsi, assoc, fCorrHistClasses[(Int_t)jpsi->PairType()], isMCTruth);
      }  // end loop over associated tracks
   }  // end loop over jpsi candidates
 }
@@ -307,13 +355,17 @@ void AliReducedAnalysisJpsi2eeCorrelations::FillAssociatedTrackHistograms(TStrin
   //
   // fill associated track histograms
   //
+  if(!fHistClassesResolved) ResolveHistClasses();
+  std::vector<Int_t> otherHistClasses[kNAssocTrackHistClassTypes][2];
+  const std::vector<Int_t> (*histClasses)[2] = fAssocTrackHistClasses;
+  if(trackClass!="AssociatedTrack") {ResolveAssociatedTrackHistClasses(trackClass.Data(), otherHistClasses); histClasses = otherHistClasses;}
   AliReducedTrackInfo* track=0;
   TIter nextAssocTrack(&fAssociatedTracks);
   for(Int_t i=0;i<fAssociatedTracks.GetEntries();++i) {
     track = (AliReducedTrackInfo*)nextAssocTrack();
     AliReducedVarManager::FillTrackInfo(track, fValues);
     AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues);
-    FillAssociatedTrackHistograms(track, trackClass);
+    FillAssociatedTrackHistClasses(track, histClasses);
   }
 }
 
@@ -322,26 +374,38 @@ void AliReducedAnalysisJpsi2eeCorrelations::FillAssociatedTrackHistograms(AliRed
   //
   // fill associated track histograms
   //
+  if(!fHistClassesResolved) ResolveHistClasses();
+  if(trackClass=="AssociatedTrack") {FillAssociatedTrackHistClasses(track, fAssocTrackHistClasses); return;}
+  std::vector<Int_t> otherHistClasses[kNAssocTrackHistClassTypes][2];
+  ResolveAssociatedTrackHistClasses(trackClass.Data(), otherHistClasses);
+  FillAssociatedTrackHistClasses(track, otherHistClasses);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::FillAssociatedTrackHistClasses(AliReducedTrackInfo* track, const std::vector<Int_t> (*histClasses)[2]) {
+  //
+  // fill associated track histograms, classes as resolved by ResolveAssociatedTrackHistClasses()
+  //
   //Bool_t isMCTruth = fOptionRunOverMC && track->IsMCTruth();
   Bool_t isMCTruth = kFALSE;     // TODO: handle the MC info if needed
   for(Int_t icut=0; icut<fAssociatedTrackCuts.GetEntries(); ++icut) {
     if(track->TestFlag(icut)) {
-      fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
-      //if(isMCTruth) fHistosManager->FillHistClass(Form("%s_%s_MCTruth", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
+      fHistosManager->FillHistClass(histClasses[kAssocTrackHistos][0][icut], fValues);
+      //if(isMCTruth) fHistosManager->FillHistClass(histClasses[kAssocTrackHistos][1][icut], fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
         AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-        fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
-        if(isMCTruth) fHistosManager->FillHistClass(Form("%sStatusFlags_%s_MCTruth", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
+        fHistosManager->FillHistClass(histClasses[kAssocTrackStatusFlagsHistos][0][icut], fValues);
+        if(isMCTruth) fHistosManager->FillHistClass(histClasses[kAssocTrackStatusFlagsHistos][1][icut], fValues);
       }
       for(Int_t iLayer=0; iLayer<6; ++iLayer) {
         AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-        fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
-        if(isMCTruth) fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_MCTruth", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
+        fHistosManager->FillHistClass(histClasses[kAssocTrackITSclusterMapHistos][0][icut], fValues);
+        if(isMCTruth) fHistosManager->FillHistClass(histClasses[kAssocTrackITSclusterMapHistos][1][icut], fValues);
       }
       for(Int_t iLayer=0; iLayer<8; ++iLayer) {
         AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-        fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
-        if(isMCTruth) fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_MCTruth", trackClass.Data(), fAssociatedTrackCuts.At(icut)->GetName()), fValues);
+        fHistosManager->FillHistClass(histClasses[kAssocTrackTPCclusterMapHistos][0][icut], fValues);
+        if(isMCTruth) fHistosManager->FillHistClass(histClasses[kAssocTrackTPCclusterMapHistos][1][icut], fValues);
       }
     }
   }
@@ -352,10 +416,20 @@ void AliReducedAnalysisJpsi2eeCorrelations::FillCorrelationHistograms(AliReduced
   //
   // fill correlation histograms
   //
+  std::vector<Int_t> histClasses[2];
+  ResolveCorrelationHistClasses(corrClass.Data(), histClasses);
+  FillCorrelationHistClasses(jpsi, assoc, histClasses, isMCTruth);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeCorrelations::FillCorrelationHistClasses(AliReducedPairInfo* jpsi, AliReducedBaseTrack* assoc, const std::vector<Int_t>* histClasses, Bool_t isMCTruth/*=kFALSE*/) {
+  //
+  // fill correlation histograms, classes as resolved by ResolveCorrelationHistClasses()
+  //
   ULong_t mask = jpsi->GetFlags() & assoc->GetFlags();
   for(Int_t iCut=0; iCut<fAssociatedTrackCuts.GetEntries(); ++iCut) {
      if(!(mask & (ULong_t(1)<<iCut))) continue;
-     fHistosManager->FillHistClass(Form("%s_%s_%s", corrClass.Data(), fTrackCuts.At(iCut)->GetName(), fAssociatedTrackCuts.At(iCut)->GetName()), fValues);
-     if(isMCTruth) fHistosManager->FillHistClass(Form("%s_%s_%s_MCTruth", corrClass.Data(), fTrackCuts.At(iCut)->GetName(), fAssociatedTrackCuts.At(iCut)->GetName()), fValues);
+     fHistosManager->FillHistClass(histClasses[0][iCut], fValues);
+     if(isMCTruth) fHistosManager->FillHistClass(histClasses[1][iCut], fValues);
   }
 }
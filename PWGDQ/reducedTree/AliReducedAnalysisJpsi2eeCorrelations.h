@@ -12,6 +12,8 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EECORRELATIONS_H
 #define ALIREDUCEDANALYSISJPSI2EECORRELATIONS_H
 
+#include <vector>
+
 #include <TList.h>
 
 #include "AliReducedAnalysisTaskSE.h"
@@ -81,7 +83,26 @@ protected:
   void FillAssociatedTrackHistograms(AliReducedTrackInfo* track, TString trackClass = "AssociatedTrack");
   void FillCorrelationHistograms(AliReducedPairInfo* jpsi, AliReducedBaseTrack* assoc, TString corrClass="CorrSE", Bool_t isMCTruth=kFALSE);
 
-  ClassDef(AliReducedAnalysisJpsi2eeCorrelations, 4);
+  // histogram classes of the associated tracks and correlations, resolved together with the ones of AliReducedAnalysisJpsi2ee
+  enum EAssocHistClasses {
+    kHistAssocTrackBeforeCuts=0, kHistAssocTrackStatusFlagsBeforeCuts, kHistAssocTrackITSclusterMapBeforeCuts, kHistAssocTrackTPCclusterMapBeforeCuts,
+    kNAssocHistClasses
+  };
+  enum EAssocTrackHistClassTypes {
+    kAssocTrackHistos=0, kAssocTrackStatusFlagsHistos, kAssocTrackITSclusterMapHistos, kAssocTrackTPCclusterMapHistos,
+    kNAssocTrackHistClassTypes
+  };
+  Int_t fAssocHistClasses[kNAssocHistClasses];                               //! classes with fixed names, see EAssocHistClasses
+  std::vector<Int_t> fAssocTrackHistClasses[kNAssocTrackHistClassTypes][2];  //! AssociatedTrack<type>_<cut>[_MCTruth], see EAssocTrackHistClassTypes
+  std::vector<Int_t> fCorrHistClasses[3][2];                                 //! CorrSE<PP,PM,MM>_<cut>_<associated cut>[_MCTruth]
+
+  virtual void ResolveHistClasses();
+  void ResolveAssociatedTrackHistClasses(const Char_t* trackClass, std::vector<Int_t> (*histClasses)[2]) const;
+  void ResolveCorrelationHistClasses(const Char_t* corrClass, std::vector<Int_t>* histClasses) const;
+  void FillAssociatedTrackHistClasses(AliReducedTrackInfo* track, const std::vector<Int_t> (*histClasses)[2]);
+  void FillCorrelationHistClasses(AliReducedPairInfo* jpsi, AliReducedBaseTrack* assoc, const std::vector<Int_t>* histClasses, Bool_t isMCTruth=kFALSE);
+
+  ClassDef(AliReducedAnalysisJpsi2eeCorrelations, 5);
 };
 
 #endif
@@ -45,7 +45,12 @@ AliReducedAnalysisJpsi2eeMult::AliReducedAnalysisJpsi2eeMult() :
   fNegTracks(),
   fPrefilterPosTracks(),
   fPrefilterNegTracks(),
-  fEventCounter(0)
+  fEventCounter(0),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fTrackHistClasses(),
+  fPairHistClasses(),
+  fRotationPairHistClasses()
 {
   //
   // default constructor
@@ -74,7 +79,12 @@ AliReducedAnalysisJpsi2eeMult::AliReducedAnalysisJpsi2eeMult(const Char_t* name,
   fNegTracks(),
   fPrefilterPosTracks(),
   fPrefilterNegTracks(),
-  fEventCounter(0)
+  fEventCounter(0),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fTrackHistClasses(),
+  fPairHistClasses(),
+  fRotationPairHistClasses()
 {
   //
   // named constructor
@@ -207,6 +217,57 @@ void AliReducedAnalysisJpsi2eeMult::Init() {
 }
 
 
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeMult::ResolveHistClasses() {
+  //
+  // Resolve the histogram classes filled in the event loop, once at the first event when all the classes are defined.
+  // The fills then use AliHistogramManager::FillHistClass(Int_t, Float_t*) instead of looking up the class names
+  //
+  const Char_t* classNames[kNHistClasses] = {
+     "Event_BeforeCuts", "EventTag_BeforeCuts", "EventTriggers_BeforeCuts",
+     "Event_AfterCuts", "EventTag_AfterCuts", "EventTriggers_AfterCuts",
+     "Track_BeforeCuts", "TrackStatusFlags_BeforeCuts", "TrackITSclusterMap_BeforeCuts", "TrackTPCclusterMap_BeforeCuts",
+     "MCTruth_BeforeSelection", "MCTruth_AfterSelection"
+  };
+  for(Int_t i=0; i<kNHistClasses; ++i) fHistClasses[i] = GetHistClassIndex(classNames[i]);
+  const Char_t* chargeNames[3] = {"", "+", "-"};
+  for(Int_t i=0; i<3; ++i) ResolveTrackHistClasses((TString("Track")+chargeNames[i]).Data(), fTrackHistClasses[i]);
+  ResolvePairHistClasses("PairSE", fPairHistClasses);
+  ResolvePairHistClasses("PairTR", fRotationPairHistClasses);
+  fHistClassesResolved = kTRUE;
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeMult::ResolveTrackHistClasses(const Char_t* trackClass, std::vector<Int_t> (*histClasses)[2]) const {
+  //
+  // histogram classes <trackClass><type>_<cut> and <trackClass><type>_<cut>_MCTruth, for all ETrackHistClassTypes
+  //
+  const Char_t* typeNames[kNTrackHistClassTypes] = {"", "StatusFlags", "ITSclusterMap", "TPCclusterMap"};
+  TString className;
+  for(Int_t i=0; i<kNTrackHistClassTypes; ++i) {
+     className = Form("%s%s", trackClass, typeNames[i]);
+     histClasses[i][0] = GetHistClassIndices(className.Data(), fTrackCuts);
+     histClasses[i][1] = GetHistClassIndices(className.Data(), fTrackCuts, 0x0, "_MCTruth");
+  }
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeMult::ResolvePairHistClasses(const Char_t* pairClass, std::vector<Int_t> (*histClasses)[2]) const {
+  //
+  // histogram classes <pairClass><PP,PM,MM>_<cut> and <pairClass><PP,PM,MM>_<cut>_MCTruth
+  //
+  const Char_t* typeNames[3] = {"PP", "PM", "MM"};
+  TString className;
+  for(Int_t i=0; i<3; ++i) {
+     className = Form("%s%s", pairClass, typeNames[i]);
+     histClasses[i][0] = GetHistClassIndices(className.Data(), fTrackCuts);
+     histClasses[i][1] = GetHistClassIndices(className.Data(), fTrackCuts, 0x0, "_MCTruth");
+  }
+}
+
+
 //___________________________________________________________________________
 void AliReducedAnalysisJpsi2eeMult::Process() {
   //
@@ -226,6 +287,7 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
        cout << "Event no. " << fEventCounter << endl;
   }
   fEventCounter++;
+  if(!fHistClassesResolved) ResolveHistClasses();
   
   AliReducedVarManager::SetEvent(fEvent);
   
@@ -235,14 +297,14 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
   
   // fill event information before event cuts
   AliReducedVarManager::FillEventInfo(fEvent, fValues);
-  fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventBeforeCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTagBeforeCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
       AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-      fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersBeforeCuts], fValues);
   }
   
   
@@ -284,14 +346,14 @@ void AliReducedAnalysisJpsi2eeMult::Process() {
     RunSameEventPairing();
  
   // fill event info histograms after cuts
-  fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventAfterCuts], fValues);
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-     fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTagAfterCuts], fValues);
   }
   for(UShort_t ibit=0; ibit<64; ++ibit) {
      AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-     fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersAfterCuts], fValues);
   }
 }
 
@@ -301,6 +363,13 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
    //
    // Fill all track histograms
    //
+   std::vector<Int_t> otherHistClasses[3][kNTrackHistClassTypes][2];
+   std::vector<Int_t> (*histClasses)[kNTrackHistClassTypes][2] = fTrackHistClasses;
+   if(trackClass!="Track") {
+      const Char_t* chargeNames[3] = {"", "+", "-"};
+      for(Int_t i=0; i<3; ++i) ResolveTrackHistClasses((trackClass+chargeNames[i]).Data(), otherHistClasses[i]);
+      histClasses = otherHistClasses;
+   }
    for(Int_t i=0;i<36; ++i) fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+i] = 0.;
    AliReducedTrackInfo* track=0;
    TIter nextPosTrack(&fPosTracks);
@@ -310,8 +379,8 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
       AliReducedVarManager::FillTrackInfo(track, fValues);
       AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues);
-      FillTrackHistograms(track, Form("%s+", trackClass.Data()) );
-      FillTrackHistograms(track, Form("%s", trackClass.Data()) );
+      FillTrackHistClasses(track, histClasses[1]);
+      FillTrackHistClasses(track, histClasses[0]);
    }
    TIter nextNegTrack(&fNegTracks);
    for(Int_t i=0;i<fNegTracks.GetEntries();++i) {
@@ -320,8 +389,8 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(TString trackClass /*= "
       fValues[AliReducedVarManager::kNtracksAnalyzedInPhiBins+(track->Eta()<0.0 ? 0 : 18) + TMath::FloorNint(18.*track->Phi()/TMath::TwoPi())] += 1;
       AliReducedVarManager::FillTrackInfo(track, fValues);
       AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues);
-      FillTrackHistograms(track, Form("%s-", trackClass.Data()) );
-      FillTrackHistograms(track, Form("%s", trackClass.Data()) );
+      FillTrackHistClasses(track, histClasses[2]);
+      FillTrackHistClasses(track, histClasses[0]);
       //cout << "Neg track " << i << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
    }
 }
@@ -332,25 +401,36 @@ void AliReducedAnalysisJpsi2eeMult::FillTrackHistograms(AliReducedTrackInfo* tra
    //
    // fill track level histograms
    //
+   std::vector<Int_t> histClasses[kNTrackHistClassTypes][2];
+   ResolveTrackHistClasses(trackClass.Data(), histClasses);
+   FillTrackHistClasses(track, histClasses);
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeMult::FillTrackHistClasses(AliReducedTrackInfo* track, const std::vector<Int_t> (*histClasses)[2]) {
+   //
+   // fill track level histograms, classes as resolved by ResolveTrackHistClasses()
+   //
    Bool_t isMCTruth = fOptionRunOverMC && IsMCTruth(track);
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(track->TestFlag(icut)) {
-         fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(isMCTruth) fHistosManager->FillHistClass(Form("%s_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+         fHistosManager->FillHistClass(histClasses[kTrackHistos][0][icut], fValues);
+         if(isMCTruth) fHistosManager->FillHistClass(histClasses[kTrackHistos][1][icut], fValues);
          for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
             AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-            fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sStatusFlags_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(histClasses[kTrackStatusFlagsHistos][0][icut], fValues);
+            if(isMCTruth) fHistosManager->FillHistClass(histClasses[kTrackStatusFlagsHistos][1][icut], fValues);
          }
          for(Int_t iLayer=0; iLayer<6; ++iLayer) {
             AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(histClasses[kTrackITSclusterMapHistos][0][icut], fValues);
+            if(isMCTruth) fHistosManager->FillHistClass(histClasses[kTrackITSclusterMapHistos][1][icut], fValues);
          }
          for(Int_t iLayer=0; iLayer<8; ++iLayer) {
             AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-            fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-            if(isMCTruth) fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_MCTruth", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
+            fHistosManager->FillHistClass(histClasses[kTrackTPCclusterMapHistos][0][icut], fValues);
+            if(isMCTruth) fHistosManager->FillHistClass(histClasses[kTrackTPCclusterMapHistos][1][icut], fValues);
          }
       } // end if(track->TestFlag(icut))
    }  // end loop over cuts
@@ -362,11 +442,21 @@ void AliReducedAnalysisJpsi2eeMult::FillPairHistograms(ULong_t mask, Int_t pairT
    //
    // fill pair level histograms
    // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
-   TString typeStr[3] = {"PP", "PM", "MM"};
+   std::vector<Int_t> histClasses[3][2];
+   ResolvePairHistClasses(pairClass.Data(), histClasses);
+   FillPairHistClasses(mask, pairType, histClasses, isMCTruth);
+}
+
+
+//___________________________________________________________________________
+void AliReducedAnalysisJpsi2eeMult::FillPairHistClasses(ULong_t mask, Int_t pairType, const std::vector<Int_t> (*histClasses)[2], Bool_t isMCTruth /* = kFALSE*/) {
+   //
+   // fill pair level histograms, classes as resolved by ResolvePairHistClasses()
+   // NOTE: pairType can be 0,1 or 2 corresponding to ++, +- or -- pairs
    for(Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
       if(mask & (ULong_t(1)<<icut)) {
-         fHistosManager->FillHistClass(Form("%s%s_%s", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
-         if(isMCTruth && pairType==1) fHistosManager->FillHistClass(Form("%s%s_%s_MCTruth", pairClass.Data(), typeStr[pairType].Data(), fTrackCuts.At(icut)->GetName()), fValues);
+         fHistosManager->FillHistClass(histClasses[pairType][0][icut], fValues);
+         if(isMCTruth && pairType==1) fHistosManager->FillHistClass(histClasses[pairType][1][icut], fValues);
       }
          
    }  // end loop over cuts
@@ -392,19 +482,19 @@ void AliReducedAnalysisJpsi2eeMult::RunTrackSelection() {
       //cout << "track " << it << ": "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
       AliReducedVarManager::FillTrackInfo(track, fValues);
       AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues);
-      fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistTrackBeforeCuts], fValues);
       for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
          //cout << "track / tracking flags :: " << track << " / "; AliReducedVarManager::PrintBits(track->Status()); cout << endl;
          AliReducedVarManager::FillTrackingFlag(track, iflag, fValues);
-         fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistTrackStatusFlagsBeforeCuts], fValues);
       }
       for(Int_t iLayer=0; iLayer<6; ++iLayer) {
          AliReducedVarManager::FillITSlayerFlag(track, iLayer, fValues);
-         fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistTrackITSclusterMapBeforeCuts], fValues);
       }
       for(Int_t iLayer=0; iLayer<8; ++iLayer) {
          AliReducedVarManager::FillTPCclusterBitFlag(track, iLayer, fValues);
-         fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistTrackTPCclusterMapBeforeCuts], fValues);
       }
       if(IsTrackSelected(track, fValues)) {
          fValues[AliReducedVarManager::kEvAverageTPCchi2] += track->TPCchi2();
@@ -425,6 +515,9 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
    // Run the same event pairing
    //
    fValues[AliReducedVarManager::kNpairsSelected] = 0;
+   std::vector<Int_t> otherHistClasses[3][2];
+   const std::vector<Int_t> (*histClasses)[2] = fPairHistClasses;
+   if(pairClass!="PairSE") {ResolvePairHistClasses(pairClass.Data(), otherHistClasses); histClasses = otherHistClasses;}
    
    TIter nextPosTrack(&fPosTracks);
    TIter nextNegTrack(&fNegTracks);
@@ -451,7 +544,7 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
          }
          AliReducedVarManager::FillPairInfo(pTrack, nTrack, AliReducedPairInfo::kJpsiToEE, fValues);
          if(IsPairSelected(fValues)) {
-            FillPairHistograms(pTrack->GetFlags() & nTrack->GetFlags(), 1, pairClass, fOptionRunOverMC && IsMCTruth(pTrack, nTrack));    // 1 is for +- pairs 
+            FillPairHistClasses(pTrack->GetFlags() & nTrack->GetFlags(), 1, histClasses, fOptionRunOverMC && IsMCTruth(pTrack, nTrack));    // 1 is for +- pairs 
             fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
          }
       }  // end loop over negative tracks
@@ -471,7 +564,7 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
             }
             AliReducedVarManager::FillPairInfo(pTrack, pTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
-               FillPairHistograms(pTrack->GetFlags() & pTrack2->GetFlags(), 0, pairClass);       // 0 is for ++ pairs 
+               FillPairHistClasses(pTrack->GetFlags() & pTrack2->GetFlags(), 0, histClasses);       // 0 is for ++ pairs 
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
             }
          }  // end loop over positive tracks
@@ -497,7 +590,7 @@ void AliReducedAnalysisJpsi2eeMult::RunSameEventPairing(TString pairClass /*="Pa
             }
             AliReducedVarManager::FillPairInfo(nTrack, nTrack2, AliReducedPairInfo::kJpsiToEE, fValues);
             if(IsPairSelected(fValues)) {
-               FillPairHistograms(nTrack->GetFlags() & nTrack2->GetFlags(), 2, pairClass);      // 2 is for -- pairs
+               FillPairHistClasses(nTrack->GetFlags() & nTrack2->GetFlags(), 2, histClasses);      // 2 is for -- pairs
                fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
             }
          }  // end loop over negative tracks
@@ -646,14 +739,14 @@ void AliReducedAnalysisJpsi2eeMult::FillMCTruthHistograms() {
        leg1 = (leg1Id>-1 ? (AliReducedTrackInfo*)fEvent->GetTrack(leg1Id) : 0x0);
        leg2 = (leg2Id>-1 ? (AliReducedTrackInfo*)fEvent->GetTrack(leg2Id) : 0x0);
        AliReducedVarManager::FillMCTruthInfo(track, fValues, leg1, leg2);
-       fHistosManager->FillHistClass("MCTruth_BeforeSelection", fValues);
+       fHistosManager->FillHistClass(fHistClasses[kHistMCTruthBeforeSelection], fValues);
        if(!leg1) continue;
        if(!leg2) continue;
        if(TMath::Abs(leg1->EtaMC())>0.9) continue;                       // TODO: use dynamic kinematic cut on legs
        if(TMath::Abs(leg2->EtaMC())>0.9) continue;
        if(leg1->PtMC()<1.0) continue;
        if(leg2->PtMC()<1.0) continue;
-       fHistosManager->FillHistClass("MCTruth_AfterSelection", fValues);
+       fHistosManager->FillHistClass(fHistClasses[kHistMCTruthAfterSelection], fValues);
      }
   }
 }
@@ -685,7 +778,6 @@ void AliReducedAnalysisJpsi2eeMult::FindJpsiTruthLegs(AliReducedTrackInfo* mothe
 
 void AliReducedAnalysisJpsi2eeMult::RunTrackRotation(AliReducedTrackInfo &pTrack, AliReducedTrackInfo &nTrack, Int_t pairType){
 
-  TString pairClass = "PairTR";
   Double_t phi1 = TMath::TwoPi() * gRandom->Rndm();
   Double_t phi2 = TMath::TwoPi() * gRandom->Rndm();
 
@@ -702,7 +794,7 @@ void AliReducedAnalysisJpsi2eeMult::RunTrackRotation(AliReducedTrackInfo &pTrack
 
   AliReducedVarManager::FillPairInfo( (&pTrack), (&nTrack), AliReducedPairInfo::kJpsiToEE, fValues);
   if(IsPairSelected(fValues)) {
-    FillPairHistograms(pTrack.GetFlags() & nTrack.GetFlags(), pairType, pairClass, fOptionRunOverMC && IsMCTruth((&pTrack), (&nTrack) ));
+    FillPairHistClasses(pTrack.GetFlags() & nTrack.GetFlags(), pairType, fRotationPairHistClasses, fOptionRunOverMC && IsMCTruth((&pTrack), (&nTrack) ));
   }
 }
 
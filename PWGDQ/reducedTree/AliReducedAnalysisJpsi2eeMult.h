@@ -5,6 +5,8 @@
 #ifndef ALIREDUCEDANALYSISJPSI2EEMULT_H
 #define ALIREDUCEDANALYSISJPSI2EEMULT_H
 
+#include <vector>
+
 #include <TList.h>
 
 #include "AliReducedAnalysisTaskSE.h"
@@ -84,6 +86,24 @@ protected:
    
    ULong_t fEventCounter;   // event counter
    
+   // histogram classes filled in the event loop, resolved at the first event (see ResolveHistClasses())
+   enum EHistClasses {
+      kHistEventBeforeCuts=0, kHistEventTagBeforeCuts, kHistEventTriggersBeforeCuts,
+      kHistEventAfterCuts, kHistEventTagAfterCuts, kHistEventTriggersAfterCuts,
+      kHistTrackBeforeCuts, kHistTrackStatusFlagsBeforeCuts, kHistTrackITSclusterMapBeforeCuts, kHistTrackTPCclusterMapBeforeCuts,
+      kHistMCTruthBeforeSelection, kHistMCTruthAfterSelection,
+      kNHistClasses
+   };
+   enum ETrackHistClassTypes {
+      kTrackHistos=0, kTrackStatusFlagsHistos, kTrackITSclusterMapHistos, kTrackTPCclusterMapHistos,
+      kNTrackHistClassTypes
+   };
+   Bool_t fHistClassesResolved;                                        //! the histogram classes below are resolved
+   Int_t  fHistClasses[kNHistClasses];                                 //! classes with fixed names, see EHistClasses
+   std::vector<Int_t> fTrackHistClasses[3][kNTrackHistClassTypes][2];  //! Track<"",+,-><type>_<cut>[_MCTruth], see ETrackHistClassTypes
+   std::vector<Int_t> fPairHistClasses[3][2];                          //! PairSE<PP,PM,MM>_<cut>[_MCTruth]
+   std::vector<Int_t> fRotationPairHistClasses[3][2];                  //! PairTR<PP,PM,MM>_<cut>[_MCTruth]
+   
   Bool_t IsEventSelected(AliReducedBaseEvent* event, Float_t* values=0x0);
   Bool_t IsTrackSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
   Bool_t IsTrackPrefilterSelected(AliReducedBaseTrack* track, Float_t* values=0x0);
@@ -102,7 +122,13 @@ protected:
   void FillMCTruthHistograms();
   void RunTrackRotation(AliReducedTrackInfo &pTrack, AliReducedTrackInfo &nTrack, Int_t pairType);
   
-  ClassDef(AliReducedAnalysisJpsi2eeMult,3);
+  void ResolveHistClasses();
+  void ResolveTrackHistClasses(const Char_t* trackClass, std::vector<Int_t> (*histClasses)[2]) const;
+  void ResolvePairHistClasses(const Char_t* pairClass, std::vector<Int_t> (*histClasses)[2]) const;
+  void FillTrackHistClasses(AliReducedTrackInfo* track, const std::vector<Int_t> (*histClasses)[2]);
+  void FillPairHistClasses(ULong_t mask, Int_t pairType, const std::vector<Int_t> (*histClasses)[2], Bool_t isMCTruth = kFALSE);
+  
+  ClassDef(AliReducedAnalysisJpsi2eeMult,4);
 };
 
 #endif
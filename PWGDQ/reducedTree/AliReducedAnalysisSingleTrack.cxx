@@ -59,7 +59,12 @@ AliReducedAnalysisSingleTrack::AliReducedAnalysisSingleTrack() :
   fClusters(),
   fClusterTrackMatcherHistograms(0x0),
   fClusterTrackMatcherMultipleMatchesBefore(0x0),
-  fClusterTrackMatcherMultipleMatchesAfter(0x0)
+  fClusterTrackMatcherMultipleMatchesAfter(0x0),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fTrackHistClasses(),
+  fClusterHistClasses(),
+  fMCTruthHistClasses()
 {
   //
   // default constructor
@@ -81,7 +86,12 @@ AliReducedAnalysisSingleTrack::AliReducedAnalysisSingleTrack(const Char_t* name,
   fClusters(),
   fClusterTrackMatcherHistograms(0x0),
   fClusterTrackMatcherMultipleMatchesBefore(0x0),
-  fClusterTrackMatcherMultipleMatchesAfter(0x0)
+  fClusterTrackMatcherMultipleMatchesAfter(0x0),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fTrackHistClasses(),
+  fClusterHistClasses(),
+  fMCTruthHistClasses()
 {
   //
   // named constructor
@@ -198,7 +208,7 @@ void AliReducedAnalysisSingleTrack::FillMCTruthHistograms() {
     // loop over track selections and fill histograms
     for (Int_t iCut = 0; iCut<fMCSignalCuts.GetEntries(); ++iCut) {
       if (!(mcDecisionMap & (UInt_t(1)<<iCut)))  continue;
-      fHistosManager->FillHistClass(Form("%s_PureMCTruth", fMCSignalCuts.At(iCut)->GetName()), fValues);
+      fHistosManager->FillHistClass(fMCTruthHistClasses[iCut], fValues);
     }
   }
 }
@@ -230,24 +240,24 @@ void AliReducedAnalysisSingleTrack::RunTrackSelection() {
     AliReducedVarManager::FillTrackInfo(track, fValues);
     if (fClusterCuts.GetEntries())  AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, &fClusters, fClusterTrackMatcher);
     else                            AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, NULL, fClusterTrackMatcher);
-    fHistosManager->FillHistClass("Track_BeforeCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistTrackBeforeCuts], fValues);
     
     if (track->IsA() == AliReducedTrackInfo::Class()) {
       AliReducedTrackInfo* trackInfo = dynamic_cast<AliReducedTrackInfo*>(track);
       if (trackInfo) {
         for (UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingStatus; ++iflag) {
           AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-          fHistosManager->FillHistClass("TrackStatusFlags_BeforeCuts", fValues);
+          fHistosManager->FillHistClass(fHistClasses[kHistTrackStatusFlagsBeforeCuts], fValues);
         }
         for (Int_t iLayer=0; iLayer<6; ++iLayer) {
           AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-          fHistosManager->FillHistClass("TrackITSclusterMap_BeforeCuts", fValues);
+          fHistosManager->FillHistClass(fHistClasses[kHistTrackITSclusterMapBeforeCuts], fValues);
           AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-          fHistosManager->FillHistClass("TrackITSsharedClusterMap_BeforeCuts", fValues);
+          fHistosManager->FillHistClass(fHistClasses[kHistTrackITSsharedClusterMapBeforeCuts], fValues);
         }
         for (Int_t iLayer=0; iLayer<8; ++iLayer) {
           AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-          fHistosManager->FillHistClass("TrackTPCclusterMap_BeforeCuts", fValues);
+          fHistosManager->FillHistClass(fHistClasses[kHistTrackTPCclusterMapBeforeCuts], fValues);
         }
       }
     }
@@ -264,6 +274,9 @@ void AliReducedAnalysisSingleTrack::FillTrackHistograms(TString trackClass/*="Tr
   //
   // fill track histograms
   //
+  std::vector<Int_t> otherHistClasses[kNTrackHistClassTypes];
+  const std::vector<Int_t>* histClasses = fTrackHistClasses;
+  if (trackClass!="Track") {ResolveTrackHistClasses(trackClass.Data(), otherHistClasses); histClasses = otherHistClasses;}
   if (fClusterTrackMatcher) {
     fClusterTrackMatcher->ClearMatchedClusterIDsBefore();
     fClusterTrackMatcher->ClearMatchedClusterIDsAfter();
@@ -282,7 +295,7 @@ void AliReducedAnalysisSingleTrack::FillTrackHistograms(TString trackClass/*="Tr
     AliReducedVarManager::FillTrackInfo(track, fValues);
     if (fClusterCuts.GetEntries())  AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, &fClusters, fClusterTrackMatcher);
     else                            AliReducedVarManager::FillClusterMatchedTrackInfo(track, fValues, NULL, fClusterTrackMatcher);
-    FillTrackHistograms(track, trackClass);
+    FillTrackHistClasses(track, histClasses);
   }
 
   if (fClusterTrackMatcher) {
@@ -296,19 +309,23 @@ void AliReducedAnalysisSingleTrack::FillTrackHistograms(AliReducedBaseTrack* tra
   //
   // fill track level histograms
   //
+  if (trackClass=="Track") {FillTrackHistClasses(track, fTrackHistClasses); return;}
+  std::vector<Int_t> histClasses[kNTrackHistClassTypes];
+  ResolveTrackHistClasses(trackClass.Data(), histClasses);
+  FillTrackHistClasses(track, histClasses);
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisSingleTrack::FillTrackHistClasses(AliReducedBaseTrack* track, const std::vector<Int_t>* histClasses) {
+  //
+  // fill track level histograms, classes as resolved by ResolveTrackHistClasses()
+  //
   UInt_t mcDecisionMap = 0;
   if (fOptionRunOverMC) mcDecisionMap = CheckTrackMCTruth(track);
   
   for (Int_t icut=0; icut<fTrackCuts.GetEntries(); ++icut) {
     if (track->TestFlag(icut)) {
-      fHistosManager->FillHistClass(Form("%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-      if (mcDecisionMap) {
-        for (Int_t iMC=0; iMC<=fMCSignalCuts.GetEntries(); ++iMC) {
-          if (mcDecisionMap & (UInt_t(1)<<iMC))
-            fHistosManager->FillHistClass(Form("%s_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                               fMCSignalCuts.At(iMC)->GetName()), fValues);
-        }
-      }
+      FillTrackHistClass(histClasses[kTrackHistos], icut, mcDecisionMap);
       
       if (track->IsA() != AliReducedTrackInfo::Class()) continue;
       
@@ -317,50 +334,36 @@ void AliReducedAnalysisSingleTrack::FillTrackHistograms(AliReducedBaseTrack* tra
       
       for (UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
         AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-        fHistosManager->FillHistClass(Form("%sStatusFlags_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-        if (mcDecisionMap) {
-          for (Int_t iMC=0; iMC<=fMCSignalCuts.GetEntries(); ++iMC) {
-            if (mcDecisionMap & (UInt_t(1)<<iMC))
-              fHistosManager->FillHistClass(Form("%sStatusFlags_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                 fMCSignalCuts.At(iMC)->GetName()), fValues);
-          }
-        }
+        FillTrackHistClass(histClasses[kTrackStatusFlagsHistos], icut, mcDecisionMap);
       }
       for (Int_t iLayer=0; iLayer<6; ++iLayer) {
         AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-        fHistosManager->FillHistClass(Form("%sITSclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-        if (mcDecisionMap) {
-          for (Int_t iMC=0; iMC<=fMCSignalCuts.GetEntries(); ++iMC) {
-            if (mcDecisionMap & (UInt_t(1)<<iMC))
-              fHistosManager->FillHistClass(Form("%sITSclusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                 fMCSignalCuts.At(iMC)->GetName()), fValues);
-          }
-        }
+        FillTrackHistClass(histClasses[kTrackITSclusterMapHistos], icut, mcDecisionMap);
         AliReducedVarManager::FillITSsharedLayerFlag(trackInfo, iLayer, fValues);
-        fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-        if (mcDecisionMap) {
-          for (Int_t iMC=0; iMC<=fMCSignalCuts.GetEntries(); ++iMC) {
-            if (mcDecisionMap & (UInt_t(1)<<iMC))
-              fHistosManager->FillHistClass(Form("%sITSsharedClusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                 fMCSignalCuts.At(iMC)->GetName()), fValues);
-          }
-        }
+        FillTrackHistClass(histClasses[kTrackITSsharedClusterMapHistos], icut, mcDecisionMap);
       }
       for (Int_t iLayer=0; iLayer<8; ++iLayer) {
         AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-        fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName()), fValues);
-        if (mcDecisionMap) {
-          for (Int_t iMC=0; iMC<=fMCSignalCuts.GetEntries(); ++iMC) {
-            if (mcDecisionMap & (UInt_t(1)<<iMC))
-              fHistosManager->FillHistClass(Form("%sTPCclusterMap_%s_%s", trackClass.Data(), fTrackCuts.At(icut)->GetName(),
-                                                 fMCSignalCuts.At(iMC)->GetName()), fValues);
-          }
-        }
+        FillTrackHistClass(histClasses[kTrackTPCclusterMapHistos], icut, mcDecisionMap);
       }
     } // end if (track->TestFlag(icut))
   } // end loop over cuts
 }
 
+//___________________________________________________________________________
+void AliReducedAnalysisSingleTrack::FillTrackHistClass(const std::vector<Int_t>& histClasses, Int_t icut, UInt_t mcDecisionMap) {
+  //
+  // fill the class <trackClass><type>_<cut> and, for tracks identified as MC truth, the classes <trackClass><type>_<cut>_<MC signal cut>
+  //
+  const Int_t nMCcuts = fMCSignalCuts.GetEntries();
+  fHistosManager->FillHistClass(histClasses[HistClassSlot(icut, -1, nMCcuts)], fValues);
+  if (!mcDecisionMap) return;
+  for (Int_t iMC=0; iMC<nMCcuts; ++iMC) {
+    if (mcDecisionMap & (UInt_t(1)<<iMC))
+      fHistosManager->FillHistClass(histClasses[HistClassSlot(icut, iMC, nMCcuts)], fValues);
+  }
+}
+
 //___________________________________________________________________________
 void AliReducedAnalysisSingleTrack::RunClusterSelection() {
   //
@@ -379,7 +382,7 @@ void AliReducedAnalysisSingleTrack::RunClusterSelection() {
     for (Int_t i=AliReducedVarManager::kEMCALclusterEnergy; i<=AliReducedVarManager::kNEMCALvars; ++i) fValues[i] = -9999.;
 
     AliReducedVarManager::FillCaloClusterInfo(cluster, fValues);
-    fHistosManager->FillHistClass("CaloCluster_BeforeCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistCaloClusterBeforeCuts], fValues);
 
     if (IsClusterSelected(cluster, fValues)) fClusters.Add(cluster);
   }
@@ -390,13 +393,16 @@ void AliReducedAnalysisSingleTrack::FillClusterHistograms(TString clusterClass/*
   //
   // fill cluster histograms
   //
+  std::vector<Int_t> otherHistClasses;
+  if (clusterClass!="CaloCluster") otherHistClasses = GetHistClassIndices(clusterClass.Data(), fClusterCuts);
+  const std::vector<Int_t>& histClasses = (clusterClass=="CaloCluster" ? fClusterHistClasses : otherHistClasses);
   AliReducedCaloClusterInfo* cluster = NULL;
   TIter nextCluster(&fClusters);
   for (Int_t i=0; i<fClusters.GetEntries(); ++i) {
     cluster = (AliReducedCaloClusterInfo*)nextCluster();
     for (Int_t i=AliReducedVarManager::kEMCALclusterEnergy; i<=AliReducedVarManager::kNEMCALvars; ++i) fValues[i] = -9999.;
     AliReducedVarManager::FillCaloClusterInfo(cluster, fValues);
-    FillClusterHistograms(cluster, clusterClass);
+    FillClusterHistClasses(cluster, histClasses);
   }
 }
 
@@ -405,8 +411,17 @@ void AliReducedAnalysisSingleTrack::FillClusterHistograms(AliReducedCaloClusterI
   //
   // fill cluster histograms
   //
+  if (clusterClass=="CaloCluster") FillClusterHistClasses(cluster, fClusterHistClasses);
+  else                             FillClusterHistClasses(cluster, GetHistClassIndices(clusterClass.Data(), fClusterCuts));
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisSingleTrack::FillClusterHistClasses(AliReducedCaloClusterInfo* cluster, const std::vector<Int_t>& histClasses) {
+  //
+  // fill cluster histograms, classes <clusterClass>_<cut>
+  //
   for (Int_t icut=0; icut<fClusterCuts.GetEntries(); ++icut) {
-    if (cluster->TestFlag(icut)) fHistosManager->FillHistClass(Form("%s_%s", clusterClass.Data(), fClusterCuts.At(icut)->GetName()), fValues);
+    if (cluster->TestFlag(icut)) fHistosManager->FillHistClass(histClasses[icut], fValues);
   }
 }
 
@@ -431,6 +446,38 @@ void AliReducedAnalysisSingleTrack::Init() {
   }
 }
 
+//___________________________________________________________________________
+void AliReducedAnalysisSingleTrack::ResolveHistClasses() {
+  //
+  // Resolve the histogram classes filled in the event loop, once at the first event when all the classes are defined.
+  // The fills then use AliHistogramManager::FillHistClass(Int_t, Float_t*) instead of looking up the class names
+  //
+  const Char_t* classNames[kNHistClasses] = {
+    "Event_BeforeCuts", "EventTag_BeforeCuts", "EventTriggers_BeforeCuts",
+    "Event_AfterCuts", "EventTag_AfterCuts", "EventTriggers_AfterCuts",
+    "CaloCluster_BeforeCuts", "Track_BeforeCuts", "TrackStatusFlags_BeforeCuts",
+    "TrackITSclusterMap_BeforeCuts", "TrackITSsharedClusterMap_BeforeCuts", "TrackTPCclusterMap_BeforeCuts"
+  };
+  for (Int_t i=0; i<kNHistClasses; ++i) fHistClasses[i] = GetHistClassIndex(classNames[i]);
+  ResolveTrackHistClasses("Track", fTrackHistClasses);
+  fClusterHistClasses = GetHistClassIndices("CaloCluster", fClusterCuts);
+  fMCTruthHistClasses = GetHistClassIndices("", fMCSignalCuts, 0x0, "_PureMCTruth");
+  fHistClassesResolved = kTRUE;
+}
+
+//___________________________________________________________________________
+void AliReducedAnalysisSingleTrack::ResolveTrackHistClasses(const Char_t* trackClass, std::vector<Int_t>* histClasses) const {
+  //
+  // histogram classes <trackClass><type>_<cut>[_<MC signal cut>], for all ETrackHistClassTypes
+  //
+  const Char_t* typeNames[kNTrackHistClassTypes] = {"", "StatusFlags", "ITSclusterMap", "ITSsharedClusterMap", "TPCclusterMap"};
+  TString className;
+  for (Int_t i=0; i<kNTrackHistClassTypes; ++i) {
+    className = Form("%s%s", trackClass, typeNames[i]);
+    histClasses[i] = GetHistClassIndices(className.Data(), fTrackCuts, &fMCSignalCuts);
+  }
+}
+
 //___________________________________________________________________________
 void AliReducedAnalysisSingleTrack::Process() {
   //
@@ -446,6 +493,7 @@ void AliReducedAnalysisSingleTrack::Process() {
   if (fOptionRunOverMC && (fEventCounter%10000==0)) cout << "Event no. " << fEventCounter << endl;
   else if (fEventCounter%100000==0)                 cout << "Event no. " << fEventCounter << endl;
   fEventCounter++;
+  if (!fHistClassesResolved) ResolveHistClasses();
   
   AliReducedVarManager::SetEvent(fEvent);
   
@@ -455,14 +503,14 @@ void AliReducedAnalysisSingleTrack::Process() {
 
   // fill event information before event cuts
   AliReducedVarManager::FillEventInfo(fEvent, fValues);
-  fHistosManager->FillHistClass("Event_BeforeCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventBeforeCuts], fValues);
   for (UShort_t ibit=0; ibit<64; ++ibit) {
     AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-    fHistosManager->FillHistClass("EventTag_BeforeCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistEventTagBeforeCuts], fValues);
   }
   for (UShort_t ibit=0; ibit<64; ++ibit) {
     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-    fHistosManager->FillHistClass("EventTriggers_BeforeCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersBeforeCuts], fValues);
   }
 
   // apply event selection
@@ -486,14 +534,14 @@ void AliReducedAnalysisSingleTrack::Process() {
   FillTrackHistograms();
   
   // fill event info histograms after cuts
-  fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+  fHistosManager->FillHistClass(fHistClasses[kHistEventAfterCuts], fValues);
   for (UShort_t ibit=0; ibit<64; ++ibit) {
     AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-    fHistosManager->FillHistClass("EventTag_AfterCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistEventTagAfterCuts], fValues);
   }
   for (UShort_t ibit=0; ibit<64; ++ibit) {
     AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-    fHistosManager->FillHistClass("EventTriggers_AfterCuts", fValues);
+    fHistosManager->FillHistClass(fHistClasses[kHistEventTriggersAfterCuts], fValues);
   }
 }
 
@@ -10,6 +10,8 @@
 #ifndef ALIREDUCEDANALYSISSINGLETRACK_H
 #define ALIREDUCEDANALYSISSINGLETRACK_H
 
+#include <vector>
+
 #include <TList.h>
 
 #include "AliReducedAnalysisTaskSE.h"
@@ -89,7 +91,31 @@ protected:
   void    FillClusterHistograms(TString clusterClass="CaloCluster");
   void    FillClusterHistograms(AliReducedCaloClusterInfo* cluster, TString clusterClass="CaloCluster");
 
-  ClassDef(AliReducedAnalysisSingleTrack,3);
+  // histogram classes filled in the event loop, resolved at the first event (see ResolveHistClasses())
+  enum EHistClasses {
+    kHistEventBeforeCuts=0, kHistEventTagBeforeCuts, kHistEventTriggersBeforeCuts,
+    kHistEventAfterCuts, kHistEventTagAfterCuts, kHistEventTriggersAfterCuts,
+    kHistCaloClusterBeforeCuts, kHistTrackBeforeCuts, kHistTrackStatusFlagsBeforeCuts,
+    kHistTrackITSclusterMapBeforeCuts, kHistTrackITSsharedClusterMapBeforeCuts, kHistTrackTPCclusterMapBeforeCuts,
+    kNHistClasses
+  };
+  enum ETrackHistClassTypes {
+    kTrackHistos=0, kTrackStatusFlagsHistos, kTrackITSclusterMapHistos, kTrackITSsharedClusterMapHistos, kTrackTPCclusterMapHistos,
+    kNTrackHistClassTypes
+  };
+  Bool_t              fHistClassesResolved;                         //! the histogram classes below are resolved
+  Int_t               fHistClasses[kNHistClasses];                  //! classes with fixed names, see EHistClasses
+  std::vector<Int_t>  fTrackHistClasses[kNTrackHistClassTypes];     //! Track<type>_<cut>[_<MC signal cut>], see ETrackHistClassTypes
+  std::vector<Int_t>  fClusterHistClasses;                          //! CaloCluster_<cut>
+  std::vector<Int_t>  fMCTruthHistClasses;                          //! <MC signal cut>_PureMCTruth
+
+  void    ResolveHistClasses();
+  void    ResolveTrackHistClasses(const Char_t* trackClass, std::vector<Int_t>* histClasses) const;
+  void    FillTrackHistClasses(AliReducedBaseTrack* track, const std::vector<Int_t>* histClasses);
+  void    FillTrackHistClass(const std::vector<Int_t>& histClasses, Int_t icut, UInt_t mcDecisionMap);
+  void    FillClusterHistClasses(AliReducedCaloClusterInfo* cluster, const std::vector<Int_t>& histClasses);
+
+  ClassDef(AliReducedAnalysisSingleTrack,4);
 };
 
 #endif
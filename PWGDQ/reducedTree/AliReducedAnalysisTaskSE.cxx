@@ -10,6 +10,8 @@
 #include "AliReducedAnalysisTaskSE.h"
 #include "AliReducedEventInfo.h"
 
+#include <TList.h>
+
 ClassImp(AliReducedAnalysisTaskSE);
 
 
@@ -25,7 +27,8 @@ AliReducedAnalysisTaskSE::AliReducedAnalysisTaskSE() :
   fFilteredEvent(0x0),
   fFilteredTreeWritingOption(kBaseEventsWithBaseTracks),
   fProcessMCInfo(kFALSE),
-  fEventCounter(0)
+  fEventCounter(0),
+  fVarContext(0x0)
 {
   //
   // default constructor
@@ -48,7 +51,8 @@ AliReducedAnalysisTaskSE::AliReducedAnalysisTaskSE(const Char_t* name, const Cha
   fFilteredEvent(0x0),
   fFilteredTreeWritingOption(kBaseEventsWithBaseTracks),
   fProcessMCInfo(kFALSE),
-  fEventCounter(0)
+  fEventCounter(0),
+  fVarContext(0x0)
 {
   //
   // named constructor
@@ -127,3 +131,35 @@ void AliReducedAnalysisTaskSE::Finish() {
    // finish, to be executed after all events were processed
    //
 }
+
+//___________________________________________________________________________
+Int_t AliReducedAnalysisTaskSE::GetHistClassIndex(const Char_t* className) const {
+   //
+   // index of the histogram class, to be resolved once and used with AliHistogramManager::FillHistClass(Int_t, Float_t*)
+   //
+   AliHistogramManager* histos = GetHistogramManager();
+   return (histos ? histos->GetHistClassIndex(className) : -1);
+}
+
+//___________________________________________________________________________
+std::vector<Int_t> AliReducedAnalysisTaskSE::GetHistClassIndices(const Char_t* prefix, const TList& cuts, 
+                                                                 const TList* subCuts /*=0x0*/, const Char_t* suffix /*=""*/) const {
+   //
+   // indices of the histogram classes <prefix>_<cut>[_<subCut>]<suffix> for all cuts and sub-cuts,
+   // at the positions given by HistClassSlot(icut, isub, nSubCuts)
+   //
+   Int_t nSubCuts = (subCuts ? subCuts->GetEntries() : 0);
+   std::vector<Int_t> indices(cuts.GetEntries()*(nSubCuts+1), -1);
+   TString className;
+   for(Int_t icut=0; icut<cuts.GetEntries(); ++icut) {
+      for(Int_t isub=-1; isub<nSubCuts; ++isub) {
+         className = prefix;
+         if(!className.IsNull()) className += "_";
+         className += cuts.At(icut)->GetName();
+         if(isub>=0) {className += "_"; className += subCuts->At(isub)->GetName();}
+         className += suffix;
+         indices[HistClassSlot(icut, isub, nSubCuts)] = GetHistClassIndex(className.Data());
+      }
+   }
+   return indices;
+}
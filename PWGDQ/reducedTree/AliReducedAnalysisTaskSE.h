@@ -11,6 +11,8 @@
 #ifndef ALIREDUCEDANALYSISTASKSE_H
 #define ALIREDUCEDANALYSISTASKSE_H
 
+#include <vector>
+
 #include <TObject.h>
 #include <TString.h> 
 
@@ -18,6 +20,9 @@
 #include "AliHistogramManager.h"
 #include "AliReducedBaseEvent.h"
 
+class AliReducedVarContext;
+class TList;
+
 //________________________________________________________________
 class AliReducedAnalysisTaskSE : public TObject {
   
@@ -51,6 +56,7 @@ public:
   void SetFilteredTreeActiveBranch(TString b)   {fActiveBranches+=b+";";}
   void SetFilteredTreeInactiveBranch(TString b) {fInactiveBranches+=b+";";}
   void SetProcessMC(Bool_t option=kTRUE) {fProcessMCInfo=option;}
+  void SetVarContext(AliReducedVarContext* context) {fVarContext = context;}
   
   // getters
   virtual AliHistogramManager* GetHistogramManager() const = 0;
@@ -58,11 +64,20 @@ public:
   TTree* GetFilteredTree() {return fFilteredTree;}
   Int_t GetFilteredTreeWritingOption() const {return fFilteredTreeWritingOption;}
   Bool_t ProcessMC() const {return fProcessMCInfo;}
+  AliReducedVarContext* GetVarContext() const {return fVarContext;}
   
 protected:
   AliReducedAnalysisTaskSE(const AliReducedAnalysisTaskSE& task);             
   AliReducedAnalysisTaskSE& operator=(const AliReducedAnalysisTaskSE& task);      
   
+  // Histogram classes are resolved once (at the first event) and filled in the event loop via 
+  // AliHistogramManager::FillHistClass(Int_t, Float_t*). Classes which are not defined get the index -1 (nothing filled)
+  Int_t GetHistClassIndex(const Char_t* className) const;
+  // indices of the classes <prefix>_<cut> and <prefix>_<cut>_<subCut> (all with <suffix> appended), or <cut>... for an empty prefix,
+  // ordered as given by HistClassSlot()
+  std::vector<Int_t> GetHistClassIndices(const Char_t* prefix, const TList& cuts, const TList* subCuts=0x0, const Char_t* suffix="") const;
+  static Int_t HistClassSlot(Int_t icut, Int_t isub, Int_t nSubCuts) {return icut*(nSubCuts+1)+isub+1;}   // isub=-1: class without sub-cut
+  
   TString fName;             // name
   TString fTitle;                // title
     
@@ -78,7 +93,9 @@ protected:
   
   ULong_t fEventCounter;   // event counter
   
-  ClassDef(AliReducedAnalysisTaskSE, 4)
+  AliReducedVarContext* fVarContext;   //! variable manager context used by this task (0x0: shared default context)
+  
+  ClassDef(AliReducedAnalysisTaskSE, 5)
 };
 
 #endif
@@ -36,7 +36,12 @@ AliReducedAnalysisTest::AliReducedAnalysisTest() :
   fTrackCuts(),
   fPairCuts(),
   fTrackFilterBitNames(""),
-  fMCBitsNames("")
+  fMCBitsNames(""),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fPairHistClasses(),
+  fPureMCqaHistClasses(),
+  fTrackFilterBitHistClasses()
 {
   //
   // default constructor
@@ -60,7 +65,12 @@ AliReducedAnalysisTest::AliReducedAnalysisTest(const Char_t* name, const Char_t*
   fTrackCuts(),
   fPairCuts(),
   fTrackFilterBitNames(""),
-  fMCBitsNames("")
+  fMCBitsNames(""),
+  fHistClassesResolved(kFALSE),
+  fHistClasses(),
+  fPairHistClasses(),
+  fPureMCqaHistClasses(),
+  fTrackFilterBitHistClasses()
 {
   //
   // named constructor
@@ -137,6 +147,59 @@ void AliReducedAnalysisTest::Init() {
 }
 
 
+//___________________________________________________________________________
+void AliReducedAnalysisTest::ResolveHistClasses() {
+  //
+  // Resolve the histogram classes filled in the event loop, once at the first event when all the classes are defined.
+  // The fills then use AliHistogramManager::FillHistClass(Int_t, Float_t*) instead of looking up the class names
+  //
+   const Char_t* classNames[kNHistClasses] = {
+      "Event_NoCuts", "OnlineTriggers_NoCuts", "TriggerCorrelation_NoCuts",
+      "OnlineTriggers_AfterCuts", "TriggerCorrelation_AfterCuts",
+      "OnlineTriggers_vs_L0TrigInputs", "OnlineTriggers_vs_L1TrigInputs", "OnlineTriggers_vs_L2TrigInputs",
+      "EvtTags", "L0TriggerInput", "L0InputCorrelation", "L1TriggerInput", "L1InputCorrelation",
+      "L2TriggerInput", "L2InputCorrelation", "CaloClusters", "EventMC_SPDtrkBins_AfterCuts",
+      "Event_AfterCuts", "V0Channels", "PureMCflags", "CorrelationMCflags",
+      "TrackQA_AllTracks", "TrackingFlags", "TrackQualityFlags", "CorrelationQualityFlagsTracks",
+      "ITSclusterMap", "TPCclusterMap",
+      "TrackQA_GammaLeg", "TrackQualityFlags_GammaLeg", "TrackQA_PureGammaLeg",
+      "TrackQA_K0sLeg", "TrackQualityFlags_K0sLeg", "TrackQA_PureK0sLeg",
+      "TrackQA_LambdaPosLeg", "TrackQA_LambdaNegLeg", "TrackQA_PureLambdaPosLeg", "TrackQA_PureLambdaNegLeg",
+      "TrackQA_ALambdaPosLeg", "TrackQA_ALambdaNegLeg", "TrackQA_PureALambdaPosLeg", "TrackQA_PureALambdaNegLeg"
+   };
+   for(Int_t i=0; i<kNHistClasses; ++i) fHistClasses[i] = GetHistClassIndex(classNames[i]);
+   
+   const Char_t* v0TypeNames[3] = {"Offline", "OnTheFly", ""};
+   const Char_t* pairTypeNames[3] = {"PP", "PM", "MM"};
+   for(Int_t i=0; i<3; ++i) {
+      fPairHistClasses[i][kPairQualityFlags] = GetHistClassIndex(Form("PairQualityFlags_%s", v0TypeNames[i]));
+      fPairHistClasses[i][kCorrelationQualityFlagsPairs] = GetHistClassIndex(Form("CorrelationQualityFlagsPairs_%s", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAGamma] = GetHistClassIndex(Form("PairQA_%sGamma", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAPureGamma] = GetHistClassIndex(Form("PairQA_%sPureGamma", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAK0s] = GetHistClassIndex(Form("PairQA_%sK0s", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAPureK0s] = GetHistClassIndex(Form("PairQA_%sPureK0s", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQALambda] = GetHistClassIndex(Form("PairQA_%sLambda", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAPureLambda] = GetHistClassIndex(Form("PairQA_%sPureLambda", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAALambda] = GetHistClassIndex(Form("PairQA_%sALambda", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAPureALambda] = GetHistClassIndex(Form("PairQA_%sPureALambda", v0TypeNames[i]));
+      fPairHistClasses[i][kPairQAJpsi2EE] = GetHistClassIndex(Form("PairQA_Jpsi2EE_%s", pairTypeNames[i]));
+      fPairHistClasses[i][kPairQAADzeroToKplusPiminus] = GetHistClassIndex(Form("PairQA_ADzeroToKplusPiminus_%s", pairTypeNames[i]));
+   }
+   
+   TObjArray* namesArr = fMCBitsNames.Tokenize(";");
+   fPureMCqaHistClasses.assign(namesArr->GetEntries(), -1);
+   for(Int_t iflag=0; iflag<namesArr->GetEntries(); ++iflag)
+      fPureMCqaHistClasses[iflag] = GetHistClassIndex(Form("PureMCqa_%s", namesArr->At(iflag)->GetName()));
+   delete namesArr;
+   TObjArray* namesBitArr = fTrackFilterBitNames.Tokenize(";");
+   fTrackFilterBitHistClasses.assign(namesBitArr->GetEntries(), -1);
+   for(Int_t iflag=0; iflag<namesBitArr->GetEntries(); ++iflag)
+      fTrackFilterBitHistClasses[iflag] = GetHistClassIndex(Form("TrackQA_%s", namesBitArr->At(iflag)->GetName()));
+   delete namesBitArr;
+   fHistClassesResolved = kTRUE;
+}
+
+
 //___________________________________________________________________________
 void AliReducedAnalysisTest::Process() {
   //
@@ -153,6 +216,7 @@ void AliReducedAnalysisTest::Process() {
         cout << "Event no. " << fEventCounter << endl;
   }
   fEventCounter++;
+  if(!fHistClassesResolved) ResolveHistClasses();
   
   AliReducedVarManager::SetEvent(fEvent);
   
@@ -160,16 +224,16 @@ void AliReducedAnalysisTest::Process() {
       AliReducedVarManager::FillEventInfo(fEvent, fValues);
   }
   if(fFillEventHistograms) 
-     fHistosManager->FillHistClass("Event_NoCuts", fValues);
+     fHistosManager->FillHistClass(fHistClasses[kHistEventNoCuts], fValues);
   
   if(fFillTriggerHistograms) {
      if(fEvent->IsA()==AliReducedEventInfo::Class()) {
         for(UShort_t ibit=0; ibit<64; ++ibit) {
          AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-         fHistosManager->FillHistClass("OnlineTriggers_NoCuts", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistOnlineTriggersNoCuts], fValues);
          for(UShort_t ibit2=0; ibit2<64; ++ibit2) {
             AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, ibit2);
-            fHistosManager->FillHistClass("TriggerCorrelation_NoCuts", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistTriggerCorrelationNoCuts], fValues);
          }
        }
      }
@@ -184,22 +248,22 @@ void AliReducedAnalysisTest::Process() {
       if(eventInfo) {
       for(UShort_t ibit=0; ibit<64; ++ibit) {
          AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues);
-         fHistosManager->FillHistClass("OnlineTriggers_AfterCuts", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistOnlineTriggersAfterCuts], fValues);
          for(UShort_t ibit2=0; ibit2<64; ++ibit2) {
             AliReducedVarManager::FillEventOnlineTrigger(ibit, fValues, ibit2);
-            fHistosManager->FillHistClass("TriggerCorrelation_AfterCuts", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistTriggerCorrelationAfterCuts], fValues);
          }
          for(UShort_t i=0; i<32; ++i) {
             AliReducedVarManager::FillL0TriggerInputs(eventInfo, i, fValues);
-            fHistosManager->FillHistClass("OnlineTriggers_vs_L0TrigInputs", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistOnlineTriggersVsL0TrigInputs], fValues);
          }
          for(UShort_t i=0; i<32; ++i) {
             AliReducedVarManager::FillL1TriggerInputs(eventInfo, i, fValues);
-            fHistosManager->FillHistClass("OnlineTriggers_vs_L1TrigInputs", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistOnlineTriggersVsL1TrigInputs], fValues);
          }
          for(UShort_t i=0; i<16; ++i) {
             AliReducedVarManager::FillL2TriggerInputs(eventInfo, i, fValues);
-            fHistosManager->FillHistClass("OnlineTriggers_vs_L2TrigInputs", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistOnlineTriggersVsL2TrigInputs], fValues);
          }
       }
     }
@@ -208,7 +272,7 @@ void AliReducedAnalysisTest::Process() {
   if(fFillEventHistograms) {
       for(UShort_t ibit=0; ibit<64; ++ibit) {
          AliReducedVarManager::FillEventTagInput(fEvent, ibit, fValues);
-         fHistosManager->FillHistClass("EvtTags", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistEvtTags], fValues);
       }
   }
   
@@ -216,26 +280,26 @@ void AliReducedAnalysisTest::Process() {
     if(fFillTriggerHistograms) {
          for(UShort_t ibit=0; ibit<32; ++ibit) {
             AliReducedVarManager::FillL0TriggerInputs(eventInfo, ibit, fValues);
-            fHistosManager->FillHistClass("L0TriggerInput", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistL0TriggerInput], fValues);
             for(UShort_t ibit2=0; ibit2<32; ++ibit2) {
                AliReducedVarManager::FillL0TriggerInputs(eventInfo, ibit, fValues, ibit2);
-               fHistosManager->FillHistClass("L0InputCorrelation", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistL0InputCorrelation], fValues);
             }
          }
          for(UShort_t ibit=0; ibit<32; ++ibit) {
             AliReducedVarManager::FillL1TriggerInputs(eventInfo, ibit, fValues);
-            fHistosManager->FillHistClass("L1TriggerInput", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistL1TriggerInput], fValues);
             for(UShort_t ibit2=0; ibit2<32; ++ibit2) {
                AliReducedVarManager::FillL1TriggerInputs(eventInfo, ibit, fValues, ibit2);
-               fHistosManager->FillHistClass("L1InputCorrelation", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistL1InputCorrelation], fValues);
             }
          }
          for(UShort_t ibit=0; ibit<16; ++ibit) {
             AliReducedVarManager::FillL2TriggerInputs(eventInfo, ibit, fValues);
-            fHistosManager->FillHistClass("L2TriggerInput", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistL2TriggerInput], fValues);
             for(UShort_t ibit2=0; ibit2<16; ++ibit2) {
                AliReducedVarManager::FillL2TriggerInputs(eventInfo, ibit, fValues, ibit2);
-               fHistosManager->FillHistClass("L2InputCorrelation", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistL2InputCorrelation], fValues);
             }
          }
     }  // end if(fFillTriggerHistograms)
@@ -243,7 +307,7 @@ void AliReducedAnalysisTest::Process() {
     if(fFillCaloClusterHistograms) {
       for(Int_t icl=0; icl<eventInfo->GetNCaloClusters(); ++icl) {
          AliReducedVarManager::FillCaloClusterInfo(eventInfo->GetCaloCluster(icl), fValues);
-         fHistosManager->FillHistClass("CaloClusters", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistCaloClusters], fValues);
       }
     }
   }
@@ -281,7 +345,7 @@ void AliReducedAnalysisTest::Process() {
      for(Int_t ibin=0; ibin<32; ibin++) {
         fValues[AliReducedVarManager::kEtaBinForSPDtracklets] = -1.6 + ibin*0.1 + 0.05;
         fValues[AliReducedVarManager::kSPDntrackletsInCurrentEtaBin] = eventInfo->SPDntracklets(ibin);
-        fHistosManager->FillHistClass("EventMC_SPDtrkBins_AfterCuts", fValues);
+        fHistosManager->FillHistClass(fHistClasses[kHistEventMCSPDtrkBinsAfterCuts], fValues);
      }
   }
   
@@ -297,53 +361,52 @@ void AliReducedAnalysisTest::Process() {
       fValues[AliReducedVarManager::kNpairsSelected] += 1.0;
       if(!fFillPairHistograms) continue;
       
-      TString pairTypeStr = "";
-      if(pair->PairType()==0) pairTypeStr = "Offline";
-      if(pair->PairType()==1) pairTypeStr = "OnTheFly";
+      // V0 pair classes: Offline, OnTheFly or other (empty type name); J/psi and D0 pair classes: PP, PM, MM
+      Int_t pairType = Int_t(pair->PairType());
+      const Int_t* pairHistClasses = fPairHistClasses[(pairType==0 || pairType==1) ? pairType : 2];
       
       for(UShort_t iflag=0; iflag<32; ++iflag) {
         AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues);
-        fHistosManager->FillHistClass(Form("PairQualityFlags_%s",pairTypeStr.Data()), fValues);
+        fHistosManager->FillHistClass(pairHistClasses[kPairQualityFlags], fValues);
         for(UShort_t iflag2=0; iflag2<32; ++iflag2) {
            AliReducedVarManager::FillPairQualityFlag(pair, iflag, fValues, iflag2);
-           fHistosManager->FillHistClass(Form("CorrelationQualityFlagsPairs_%s",pairTypeStr.Data()), fValues);
+           fHistosManager->FillHistClass(pairHistClasses[kCorrelationQualityFlagsPairs], fValues);
         }
       }
-      TString type[3]={"PP","PM","MM"};
       
       AliReducedVarManager::FillPairInfo(pair, fValues);
       switch (pair->CandidateId()) {
         case AliReducedPairInfo::kGammaConv :
-          fHistosManager->FillHistClass(Form("PairQA_%sGamma",pairTypeStr.Data()),fValues);
-	  if(pair->IsPureV0Gamma()) fHistosManager->FillHistClass(Form("PairQA_%sPureGamma",pairTypeStr.Data()),fValues);
+          fHistosManager->FillHistClass(pairHistClasses[kPairQAGamma],fValues);
+	  if(pair->IsPureV0Gamma()) fHistosManager->FillHistClass(pairHistClasses[kPairQAPureGamma],fValues);
           break;
         case AliReducedPairInfo::kK0sToPiPi :
-	  fHistosManager->FillHistClass(Form("PairQA_%sK0s",pairTypeStr.Data()),fValues);
-	  if(pair->IsPureV0K0s()) fHistosManager->FillHistClass(Form("PairQA_%sPureK0s",pairTypeStr.Data()),fValues);
+	  fHistosManager->FillHistClass(pairHistClasses[kPairQAK0s],fValues);
+	  if(pair->IsPureV0K0s()) fHistosManager->FillHistClass(pairHistClasses[kPairQAPureK0s],fValues);
 	  break;
         case AliReducedPairInfo::kLambda0ToPPi :
-	  fHistosManager->FillHistClass(Form("PairQA_%sLambda", pairTypeStr.Data()),fValues);
-	  if(pair->IsPureV0Lambda()) fHistosManager->FillHistClass(Form("PairQA_%sPureLambda",pairTypeStr.Data()),fValues);
+	  fHistosManager->FillHistClass(pairHistClasses[kPairQALambda],fValues);
+	  if(pair->IsPureV0Lambda()) fHistosManager->FillHistClass(pairHistClasses[kPairQAPureLambda],fValues);
 	  break;
         case AliReducedPairInfo::kALambda0ToPPi :
-	  fHistosManager->FillHistClass(Form("PairQA_%sALambda", pairTypeStr.Data()),fValues);
-	  if(pair->IsPureV0ALambda()) fHistosManager->FillHistClass(Form("PairQA_%sPureALambda",pairTypeStr.Data()),fValues);
+	  fHistosManager->FillHistClass(pairHistClasses[kPairQAALambda],fValues);
+	  if(pair->IsPureV0ALambda()) fHistosManager->FillHistClass(pairHistClasses[kPairQAPureALambda],fValues);
 	  break;
         case AliReducedPairInfo::kJpsiToEE :
-           fHistosManager->FillHistClass(Form("PairQA_Jpsi2EE_%s", type[Int_t(pair->PairType())].Data()),fValues);
+           if(pairType>=0 && pairType<3) fHistosManager->FillHistClass(fPairHistClasses[pairType][kPairQAJpsi2EE],fValues);
            break;  
         case AliReducedPairInfo::kADzeroToKplusPiminus :
-           fHistosManager->FillHistClass(Form("PairQA_ADzeroToKplusPiminus_%s", type[Int_t(pair->PairType())].Data()),fValues);
+           if(pairType>=0 && pairType<3) fHistosManager->FillHistClass(fPairHistClasses[pairType][kPairQAADzeroToKplusPiminus],fValues);
            break;     
       };
     }  // end loop over pairs
   }  // end if(pairList)
     
   if(fFillEventHistograms) {
-      fHistosManager->FillHistClass("Event_AfterCuts", fValues);
+      fHistosManager->FillHistClass(fHistClasses[kHistEventAfterCuts], fValues);
       for(UShort_t ich=0; ich<64; ++ich) {
          AliReducedVarManager::FillV0Channel(ich, fValues);
-         fHistosManager->FillHistClass("V0Channels", fValues);
+         fHistosManager->FillHistClass(fHistClasses[kHistV0Channels], fValues);
       }
   }
 }
@@ -382,17 +445,16 @@ void AliReducedAnalysisTest::FillTrackHistograms(TClonesArray* trackList) {
                      fValues[AliReducedVarManager::kMCNchSPDacc] += 1.0;
                }*/
                
-               TObjArray* namesArr = fMCBitsNames.Tokenize(";");
-               for(Int_t iflag = 0; iflag<namesArr->GetEntries(); ++iflag)
-                  if(track->TestMCFlag(iflag)) fHistosManager->FillHistClass(Form("PureMCqa_%s", namesArr->At(iflag)->GetName()), fValues);
+               for(Int_t iflag = 0; iflag<(Int_t)fPureMCqaHistClasses.size(); ++iflag)
+                  if(track->TestMCFlag(iflag)) fHistosManager->FillHistClass(fPureMCqaHistClasses[iflag], fValues);
                   
                if(fFillTrackMCTruthHistograms) {
                   for(UShort_t iflag=0; iflag<32; ++iflag) {
                      AliReducedVarManager::FillTrackMCFlag(track, iflag, fValues);
-                     fHistosManager->FillHistClass("PureMCflags", fValues);
+                     fHistosManager->FillHistClass(fHistClasses[kHistPureMCflags], fValues);
                      for(UShort_t iflag2=0; iflag2<32; ++iflag2) {
                         AliReducedVarManager::FillTrackMCFlag(track, iflag, fValues, iflag2);
-                        fHistosManager->FillHistClass("CorrelationMCflags", fValues);
+                        fHistosManager->FillHistClass(fHistClasses[kHistCorrelationMCflags], fValues);
                      }
                   }
                }
@@ -404,13 +466,12 @@ void AliReducedAnalysisTest::FillTrackHistograms(TClonesArray* trackList) {
          AliReducedVarManager::FillTrackInfo(track,fValues);
          AliReducedVarManager::FillClusterMatchedTrackInfo(track,fValues);
          if(fFillTrackHistograms)
-            fHistosManager->FillHistClass("TrackQA_AllTracks", fValues);
+            fHistosManager->FillHistClass(fHistClasses[kHistTrackQAAllTracks], fValues);
          
-         TObjArray* namesBitArr = fTrackFilterBitNames.Tokenize(";");
          if(fFillTrackHistograms)
-            for(Int_t iflag = 0; iflag<namesBitArr->GetEntries(); ++iflag)
+            for(Int_t iflag = 0; iflag<(Int_t)fTrackFilterBitHistClasses.size(); ++iflag)
                if(track->TestQualityFlag(iflag+32)) 
-                  fHistosManager->FillHistClass(Form("TrackQA_%s", namesBitArr->At(iflag)->GetName()), fValues);
+                  fHistosManager->FillHistClass(fTrackFilterBitHistClasses[iflag], fValues);
          
          
          AliReducedTrackInfo* trackInfo = NULL;
@@ -420,61 +481,61 @@ void AliReducedAnalysisTest::FillTrackHistograms(TClonesArray* trackList) {
             if(trackInfo) {
                for(UInt_t iflag=0; iflag<AliReducedVarManager::kNTrackingFlags; ++iflag) {
                   AliReducedVarManager::FillTrackingFlag(trackInfo, iflag, fValues);
-                  fHistosManager->FillHistClass("TrackingFlags", fValues);
+                  fHistosManager->FillHistClass(fHistClasses[kHistTrackingFlags], fValues);
                }
             }
          
             for(UShort_t iflag=0; iflag<64; ++iflag) {
                AliReducedVarManager::FillTrackQualityFlag(track, iflag, fValues);
-               fHistosManager->FillHistClass("TrackQualityFlags", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackQualityFlags], fValues);
                for(UShort_t iflag2=0; iflag2<64; ++iflag2) {
                   AliReducedVarManager::FillTrackQualityFlag(track, iflag, fValues,iflag2);
-                  fHistosManager->FillHistClass("CorrelationQualityFlagsTracks", fValues);
+                  fHistosManager->FillHistClass(fHistClasses[kHistCorrelationQualityFlagsTracks], fValues);
                }
             }
             if(trackInfo) {
                for(Int_t iLayer=0; iLayer<6; ++iLayer) {
                   AliReducedVarManager::FillITSlayerFlag(trackInfo, iLayer, fValues);
-                  fHistosManager->FillHistClass("ITSclusterMap", fValues);
+                  fHistosManager->FillHistClass(fHistClasses[kHistITSclusterMap], fValues);
                }
                for(Int_t iLayer=0; iLayer<8; ++iLayer) {
                   AliReducedVarManager::FillTPCclusterBitFlag(trackInfo, iLayer, fValues);
-                  fHistosManager->FillHistClass("TPCclusterMap", fValues);
+                  fHistosManager->FillHistClass(fHistClasses[kHistTPCclusterMap], fValues);
                }
             }
          }
          if(fFillTrackV0Histograms) {
             if(track->IsGammaLeg()) {
-               fHistosManager->FillHistClass("TrackQA_GammaLeg", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackQAGammaLeg], fValues);
                for(UShort_t iflag=0; iflag<64; ++iflag) {
                   AliReducedVarManager::FillTrackQualityFlag(track, iflag, fValues);
-                  fHistosManager->FillHistClass("TrackQualityFlags_GammaLeg", fValues);
+                  fHistosManager->FillHistClass(fHistClasses[kHistTrackQualityFlagsGammaLeg], fValues);
                }
             }
-            if(track->IsPureGammaLeg()) fHistosManager->FillHistClass("TrackQA_PureGammaLeg", fValues);
+            if(track->IsPureGammaLeg()) fHistosManager->FillHistClass(fHistClasses[kHistTrackQAPureGammaLeg], fValues);
             if(track->IsK0sLeg()) {
-               fHistosManager->FillHistClass("TrackQA_K0sLeg", fValues);
+               fHistosManager->FillHistClass(fHistClasses[kHistTrackQAK0sLeg], fValues);
                for(UShort_t iflag=0; iflag<64; ++iflag) {
                   AliReducedVarManager::FillTrackQualityFlag(track, iflag, fValues);
-                  fHistosManager->FillHistClass("TrackQualityFlags_K0sLeg", fValues);
+                  fHistosManager->FillHistClass(fHistClasses[kHistTrackQualityFlagsK0sLeg], fValues);
                }
             }
-            if(track->IsPureK0sLeg()) fHistosManager->FillHistClass("TrackQA_PureK0sLeg", fValues);
+            if(track->IsPureK0sLeg()) fHistosManager->FillHistClass(fHistClasses[kHistTrackQAPureK0sLeg], fValues);
             if(track->IsLambdaLeg()) {
-               if(track->Charge()>0) fHistosManager->FillHistClass("TrackQA_LambdaPosLeg", fValues);
-               else fHistosManager->FillHistClass("TrackQA_LambdaNegLeg", fValues);
+               if(track->Charge()>0) fHistosManager->FillHistClass(fHistClasses[kHistTrackQALambdaPosLeg], fValues);
+               else fHistosManager->FillHistClass(fHistClasses[kHistTrackQALambdaNegLeg], fValues);
             }
             if(track->IsPureLambdaLeg()) {
-               if(track->Charge()>0) fHistosManager->FillHistClass("TrackQA_PureLambdaPosLeg", fValues);
-               else fHistosManager->FillHistClass("TrackQA_PureLambdaNegLeg", fValues);
+               if(track->Charge()>0) fHistosManager->FillHistClass(fHistClasses[kHistTrackQAPureLambdaPosLeg], fValues);
+               else fHistosManager->FillHistClass(fHistClasses[kHistTrackQAPureLambdaNegLeg], fValues);
             }
             if(track->IsALambdaLeg()) {
-               if(track->Charge()>0) fHistosManager->FillHistClass("TrackQA_ALambdaPosLeg", fValues);
-               else fHistosManager->FillHistClass("TrackQA_ALambdaNegLeg", fValues);
+               if(track->Charge()>0) fHistosManager->FillHistClass(fHistClasses[kHistTrackQAALambdaPosLeg], fValues);
+               else fHistosManager->FillHistClass(fHistClasses[kHistTrackQAALambdaNegLeg], fValues);
             }
             if(track->IsPureALambdaLeg()) {
-               if(track->Charge()>0) fHistosManager->FillHistClass("TrackQA_PureALambdaPosLeg", fValues);
-               else fHistosManager->FillHistClass("TrackQA_PureALambdaNegLeg", fValues);
+               if(track->Charge()>0) fHistosManager->FillHistClass(fHistClasses[kHistTrackQAPureALambdaPosLeg], fValues);
+               else fHistosManager->FillHistClass(fHistClasses[kHistTrackQAPureALambdaNegLeg], fValues);
             }  
          }        // end if(fFillTrackV0Histograms)
       }  // end loop over tracks
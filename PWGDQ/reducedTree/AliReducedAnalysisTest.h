@@ -5,6 +5,8 @@
 #ifndef ALIREDUCEDANALYSISTEST_H
 #define ALIREDUCEDANALYSISTEST_H
 
+#include <vector>
+
 #include <TList.h>
 #include <TClonesArray.h>
 #include <TString.h>
@@ -77,13 +79,43 @@ protected:
    TString fTrackFilterBitNames;      // names for track filter bits, separated by ";"
    TString fMCBitsNames;     // names of MC bits, separated by ";"
    
+   // histogram classes filled in the event loop, resolved at the first event (see ResolveHistClasses())
+   enum EHistClasses {
+      kHistEventNoCuts=0, kHistOnlineTriggersNoCuts, kHistTriggerCorrelationNoCuts,
+      kHistOnlineTriggersAfterCuts, kHistTriggerCorrelationAfterCuts,
+      kHistOnlineTriggersVsL0TrigInputs, kHistOnlineTriggersVsL1TrigInputs, kHistOnlineTriggersVsL2TrigInputs,
+      kHistEvtTags, kHistL0TriggerInput, kHistL0InputCorrelation, kHistL1TriggerInput, kHistL1InputCorrelation,
+      kHistL2TriggerInput, kHistL2InputCorrelation, kHistCaloClusters, kHistEventMCSPDtrkBinsAfterCuts,
+      kHistEventAfterCuts, kHistV0Channels, kHistPureMCflags, kHistCorrelationMCflags,
+      kHistTrackQAAllTracks, kHistTrackingFlags, kHistTrackQualityFlags, kHistCorrelationQualityFlagsTracks,
+      kHistITSclusterMap, kHistTPCclusterMap,
+      kHistTrackQAGammaLeg, kHistTrackQualityFlagsGammaLeg, kHistTrackQAPureGammaLeg,
+      kHistTrackQAK0sLeg, kHistTrackQualityFlagsK0sLeg, kHistTrackQAPureK0sLeg,
+      kHistTrackQALambdaPosLeg, kHistTrackQALambdaNegLeg, kHistTrackQAPureLambdaPosLeg, kHistTrackQAPureLambdaNegLeg,
+      kHistTrackQAALambdaPosLeg, kHistTrackQAALambdaNegLeg, kHistTrackQAPureALambdaPosLeg, kHistTrackQAPureALambdaNegLeg,
+      kNHistClasses
+   };
+   // pair classes, for each pair type (V0s: Offline, OnTheFly, other; J/psi and D0: PP, PM, MM)
+   enum EPairHistClasses {
+      kPairQualityFlags=0, kCorrelationQualityFlagsPairs,
+      kPairQAGamma, kPairQAPureGamma, kPairQAK0s, kPairQAPureK0s, kPairQALambda, kPairQAPureLambda, kPairQAALambda, kPairQAPureALambda,
+      kPairQAJpsi2EE, kPairQAADzeroToKplusPiminus,
+      kNPairHistClasses
+   };
+   Bool_t fHistClassesResolved;                     //! the histogram classes below are resolved
+   Int_t  fHistClasses[kNHistClasses];              //! classes with fixed names, see EHistClasses
+   Int_t  fPairHistClasses[3][kNPairHistClasses];   //! pair classes, see EPairHistClasses
+   std::vector<Int_t> fPureMCqaHistClasses;         //! PureMCqa_<MC bit name>
+   std::vector<Int_t> fTrackFilterBitHistClasses;   //! TrackQA_<track filter bit name>
+   
   Bool_t IsEventSelected(AliReducedBaseEvent* event);
   Bool_t IsTrackSelected(AliReducedBaseTrack* track);
   Bool_t IsPairSelected(AliReducedBaseTrack* pair);
   
   void FillTrackHistograms(TClonesArray* trackList);
+  void ResolveHistClasses();
   
-  ClassDef(AliReducedAnalysisTest,4);
+  ClassDef(AliReducedAnalysisTest,5);
 };
 
 #endif
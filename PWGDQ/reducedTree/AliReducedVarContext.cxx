@@ -0,0 +1,238 @@
+/*
+***********************************************************
+  Implementation of AliReducedVarContext
+  Per-configuration state of AliReducedVarManager
+  *********************************************************
+*/
+
+#include "AliReducedVarContext.h"
+
+ClassImp(AliReducedVarContext)
+
+//__________________________________________________________________
+AliReducedVarContext::AliReducedVarContext() :
+  TObject(),
+  fCurrentRunNumber(-1),
+  fBeamMomentum(1380.),
+  fEvent(0x0),
+  fEventPlane(0x0),
+  fUsedVarList(),
+  fTPCelectronCentroidMap(0x0),
+  fTPCelectronWidthMap(0x0),
+  fVarDependencyX(AliReducedVarManager::kNothing),
+  fVarDependencyY(AliReducedVarManager::kNothing),
+  fPairEffMap(0x0),
+  fEffMapVarDependencyX(AliReducedVarManager::kNothing),
+  fEffMapVarDependencyY(AliReducedVarManager::kNothing),
+  fAssocHadronEffMap1D(0x0),
+  fAssocHadronEffMap2D(0x0),
+  fAssocHadronEffMap3D(0x0),
+  fAssocHadronEffMapVarDependencyX(AliReducedVarManager::kNothing),
+  fAssocHadronEffMapVarDependencyY(AliReducedVarManager::kNothing),
+  fAssocHadronEffMapVarDependencyZ(AliReducedVarManager::kNothing),
+  fRunTotalLuminosity(0x0),
+  fRunTotalIntensity0(0x0),
+  fRunTotalIntensity1(0x0),
+  fRunLHCFillNumber(0x0),
+  fRunDipolePolarity(0x0),
+  fRunL3Polarity(0x0),
+  fRunTimeStart(0x0),
+  fRunTimeEnd(0x0),
+  fRunInstLumiGraphs(),
+  fRunInstLumi(0x0),
+  fRunNumbers(),
+  fRunID(-1),
+  fVZEROCalibrationPath(""),
+  fOptionCalibrateVZEROqVec(kFALSE),
+  fOptionRecenterVZEROqVec(kFALSE),
+  fOptionRecenterTPCqVec(kFALSE),
+  fOptionEventRes(kFALSE)
+{
+  //
+  // default constructor
+  //
+  Reset();
+  for(Int_t i=0; i<AliReducedVarManager::kNMultiplicityEstimators; ++i) {
+    fAvgMultVsVtxGlobal[i] = 0x0;
+    fAvgMultVsVtxRunwise[i] = 0x0;
+    fAvgMultVsRun[i] = 0x0;
+    fAvgMultVsVtxAndRun[i] = 0x0;
+    for(Int_t j=0; j<AliReducedVarManager::kNReferenceMultiplicities; ++j) {
+      fRefMultVsVtxGlobal[i][j] = 0.;
+      fRefMultVsVtxRunwise[i][j] = 0.;
+      fRefMultVsRun[i][j] = 0.;
+      fRefMultVsVtxAndRun[i][j] = 0.;
+    }
+  }
+  for(Int_t i=0; i<64; ++i) fAvgVZEROChannelMult[i] = 0x0;
+  for(Int_t i=0; i<4; ++i) fVZEROqVecRecentering[i] = 0x0;
+  for(Int_t i=0; i<2; ++i) fTPCqVecRecentering[i] = 0x0;
+}
+
+//__________________________________________________________________
+AliReducedVarContext::AliReducedVarContext(const AliReducedVarContext& c) :
+  TObject(c),
+  fCurrentRunNumber(-1),
+  fBeamMomentum(1380.),
+  fEvent(0x0),
+  fEventPlane(0x0),
+  fUsedVarList(),
+  fTPCelectronCentroidMap(0x0),
+  fTPCelectronWidthMap(0x0),
+  fVarDependencyX(AliReducedVarManager::kNothing),
+  fVarDependencyY(AliReducedVarManager::kNothing),
+  fPairEffMap(0x0),
+  fEffMapVarDependencyX(AliReducedVarManager::kNothing),
+  fEffMapVarDependencyY(AliReducedVarManager::kNothing),
+  fAssocHadronEffMap1D(0x0),
+  fAssocHadronEffMap2D(0x0),
+  fAssocHadronEffMap3D(0x0),
+  fAssocHadronEffMapVarDependencyX(AliReducedVarManager::kNothing),
+  fAssocHadronEffMapVarDependencyY(AliReducedVarManager::kNothing),
+  fAssocHadronEffMapVarDependencyZ(AliReducedVarManager::kNothing),
+  fRunTotalLuminosity(0x0),
+  fRunTotalIntensity0(0x0),
+  fRunTotalIntensity1(0x0),
+  fRunLHCFillNumber(0x0),
+  fRunDipolePolarity(0x0),
+  fRunL3Polarity(0x0),
+  fRunTimeStart(0x0),
+  fRunTimeEnd(0x0),
+  fRunInstLumiGraphs(),
+  fRunInstLumi(0x0),
+  fRunNumbers(),
+  fRunID(-1),
+  fVZEROCalibrationPath(""),
+  fOptionCalibrateVZEROqVec(kFALSE),
+  fOptionRecenterVZEROqVec(kFALSE),
+  fOptionRecenterTPCqVec(kFALSE),
+  fOptionEventRes(kFALSE)
+{
+  //
+  // copy constructor
+  // The configuration (used variables, maps, calibration inputs) is shared with c,
+  // the per-event state starts from scratch
+  //
+  *this = c;
+}
+
+//__________________________________________________________________
+AliReducedVarContext& AliReducedVarContext::operator=(const AliReducedVarContext& c) {
+  //
+  // assignment operator, see the copy constructor
+  //
+  if(this==&c) return *this;
+  TObject::operator=(c);
+  fCurrentRunNumber = -1;
+  fBeamMomentum = c.fBeamMomentum;
+  fEvent = 0x0;
+  fEventPlane = 0x0;
+  for(Int_t i=0; i<AliReducedVarManager::kNVars; ++i) {
+    fUsedVars[i] = c.fUsedVars[i];
+    fDenseIndex[i] = c.fDenseIndex[i];
+  }
+  fUsedVarList = c.fUsedVarList;
+  fTPCelectronCentroidMap = c.fTPCelectronCentroidMap;
+  fTPCelectronWidthMap = c.fTPCelectronWidthMap;
+  fVarDependencyX = c.fVarDependencyX;
+  fVarDependencyY = c.fVarDependencyY;
+  fPairEffMap = c.fPairEffMap;
+  fEffMapVarDependencyX = c.fEffMapVarDependencyX;
+  fEffMapVarDependencyY = c.fEffMapVarDependencyY;
+  fAssocHadronEffMap1D = c.fAssocHadronEffMap1D;
+  fAssocHadronEffMap2D = c.fAssocHadronEffMap2D;
+  fAssocHadronEffMap3D = c.fAssocHadronEffMap3D;
+  fAssocHadronEffMapVarDependencyX = c.fAssocHadronEffMapVarDependencyX;
+  fAssocHadronEffMapVarDependencyY = c.fAssocHadronEffMapVarDependencyY;
+  fAssocHadronEffMapVarDependencyZ = c.fAssocHadronEffMapVarDependencyZ;
+  fRunTotalLuminosity = c.fRunTotalLuminosity;
+  fRunTotalIntensity0 = c.fRunTotalIntensity0;
+  fRunTotalIntensity1 = c.fRunTotalIntensity1;
+  fRunLHCFillNumber = c.fRunLHCFillNumber;
+  fRunDipolePolarity = c.fRunDipolePolarity;
+  fRunL3Polarity = c.fRunL3Polarity;
+  fRunTimeStart = c.fRunTimeStart;
+  fRunTimeEnd = c.fRunTimeEnd;
+  fRunInstLumiGraphs = c.fRunInstLumiGraphs;
+  fRunInstLumi = 0x0;
+  fRunNumbers = c.fRunNumbers;
+  fRunID = -1;
+  for(Int_t i=0; i<AliReducedVarManager::kNMultiplicityEstimators; ++i) {
+    fAvgMultVsVtxGlobal[i] = c.fAvgMultVsVtxGlobal[i];
+    fAvgMultVsVtxRunwise[i] = c.fAvgMultVsVtxRunwise[i];
+    fAvgMultVsRun[i] = c.fAvgMultVsRun[i];
+    fAvgMultVsVtxAndRun[i] = c.fAvgMultVsVtxAndRun[i];
+    for(Int_t j=0; j<AliReducedVarManager::kNReferenceMultiplicities; ++j) {
+      fRefMultVsVtxGlobal[i][j] = c.fRefMultVsVtxGlobal[i][j];
+      fRefMultVsVtxRunwise[i][j] = c.fRefMultVsVtxRunwise[i][j];
+      fRefMultVsRun[i][j] = c.fRefMultVsRun[i][j];
+      fRefMultVsVtxAndRun[i][j] = c.fRefMultVsVtxAndRun[i][j];
+    }
+  }
+  fVZEROCalibrationPath = c.fVZEROCalibrationPath;
+  for(Int_t i=0; i<64; ++i) fAvgVZEROChannelMult[i] = c.fAvgVZEROChannelMult[i];
+  for(Int_t i=0; i<4; ++i) fVZEROqVecRecentering[i] = c.fVZEROqVecRecentering[i];
+  for(Int_t i=0; i<2; ++i) fTPCqVecRecentering[i] = c.fTPCqVecRecentering[i];
+  fOptionCalibrateVZEROqVec = c.fOptionCalibrateVZEROqVec;
+  fOptionRecenterVZEROqVec = c.fOptionRecenterVZEROqVec;
+  fOptionRecenterTPCqVec = c.fOptionRecenterTPCqVec;
+  fOptionEventRes = c.fOptionEventRes;
+  return *this;
+}
+
+//__________________________________________________________________
+AliReducedVarContext::~AliReducedVarContext() {
+  //
+  // destructor
+  // The maps and calibration histograms are not owned by the context
+  //
+}
+
+//__________________________________________________________________
+void AliReducedVarContext::Reset() {
+  //
+  // clear the used variables and the per-event state; calibration inputs are kept
+  //
+  fCurrentRunNumber = -1;
+  fEvent = 0x0;
+  fEventPlane = 0x0;
+  for(Int_t i=0; i<AliReducedVarManager::kNVars; ++i) {
+    fUsedVars[i] = kFALSE;
+    fDenseIndex[i] = -1;
+  }
+  fUsedVarList.clear();
+}
+
+//__________________________________________________________________
+void AliReducedVarContext::UpdateDenseIndex() {
+  //
+  // rebuild the list of used variables and their position in the dense vector
+  //
+  fUsedVarList.clear();
+  for(Int_t i=0; i<AliReducedVarManager::kNVars; ++i) {
+    if(fUsedVars[i]) {
+      fDenseIndex[i] = fUsedVarList.size();
+      fUsedVarList.push_back(i);
+    }
+    else
+      fDenseIndex[i] = -1;
+  }
+}
+
+//__________________________________________________________________
+void AliReducedVarContext::Pack(const Float_t* values, Float_t* dense) const {
+  //
+  // copy the used variables from the full kNVars array into a dense vector of GetNUsedVars() entries
+  //
+  const Int_t n = fUsedVarList.size();
+  for(Int_t i=0; i<n; ++i) dense[i] = values[fUsedVarList[i]];
+}
+
+//__________________________________________________________________
+void AliReducedVarContext::Unpack(const Float_t* dense, Float_t* values) const {
+  //
+  // copy a dense vector back into the full kNVars array; unused variables are left untouched
+  //
+  const Int_t n = fUsedVarList.size();
+  for(Int_t i=0; i<n; ++i) values[fUsedVarList[i]] = dense[i];
+}
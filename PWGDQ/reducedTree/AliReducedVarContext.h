@@ -0,0 +1,117 @@
+//
+// Variable manager context
+//
+// Holds the state used by AliReducedVarManager when filling variables: the used-variable mask,
+// the current event pointers and the calibration / correction inputs.
+// The static AliReducedVarManager API works on the context installed for the calling thread
+// (see AliReducedVarManager::SetContext()); by default all threads share one default context.
+// Tasks which need an independent configuration, or which process events on several threads,
+// create their own context, typically as a copy of an already configured one.
+//
+
+#ifndef ALIREDUCEDVARCONTEXT_H
+#define ALIREDUCEDVARCONTEXT_H
+
+#include <map>
+#include <vector>
+
+#include <TObject.h>
+#include <TString.h>
+
+#include "AliReducedVarManager.h"
+
+class TH1;
+class TH1F;
+class TH1I;
+class TH2;
+class TH2F;
+class TH3F;
+class TProfile2D;
+class TGraphErrors;
+class AliReducedBaseEvent;
+class AliReducedEventPlaneInfo;
+
+//_____________________________________________________________________
+class AliReducedVarContext : public TObject {
+
+  friend class AliReducedVarManager;
+
+ public:
+  AliReducedVarContext();
+  AliReducedVarContext(const AliReducedVarContext& c);
+  AliReducedVarContext& operator=(const AliReducedVarContext& c);
+  virtual ~AliReducedVarContext();
+
+  void Reset();
+
+  Bool_t GetUsedVar(Int_t var) const {return fUsedVars[var];}
+  const Bool_t* GetUsedVars() const {return fUsedVars;}
+
+  // dense view of the used variables
+  Int_t GetNUsedVars() const {return fUsedVarList.size();}
+  const Int_t* GetUsedVarList() const {return (fUsedVarList.empty() ? 0x0 : &fUsedVarList[0]);}
+  Int_t GetDenseIndex(Int_t var) const {return fDenseIndex[var];}
+  void Pack(const Float_t* values, Float_t* dense) const;
+  void Unpack(const Float_t* dense, Float_t* values) const;
+
+  AliReducedBaseEvent* GetEvent() const {return fEvent;}
+  AliReducedEventPlaneInfo* GetEventPlane() const {return fEventPlane;}
+
+ private:
+  void UpdateDenseIndex();
+
+  Int_t     fCurrentRunNumber;                      // current run number
+  Float_t fBeamMomentum;                          // beam energy (needed when calculating polarization angles)
+  AliReducedBaseEvent* fEvent;                    //! pointer to the current event
+  AliReducedEventPlaneInfo* fEventPlane;          //! pointer to the current event plane
+  Bool_t fUsedVars[AliReducedVarManager::kNVars]; // array of flags toggled when the corresponding variable is required
+  Int_t fDenseIndex[AliReducedVarManager::kNVars]; // position of each used variable in the dense vector (-1 if not used)
+  std::vector<Int_t> fUsedVarList;                // list of used variables, in increasing order
+
+  TH2F* fTPCelectronCentroidMap;    //! TPC electron centroid 2D map
+  TH2F* fTPCelectronWidthMap;       //! TPC electron width 2D map
+  AliReducedVarManager::Variables fVarDependencyX;        // varX in the 2-D electron correction maps
+  AliReducedVarManager::Variables fVarDependencyY;        // varY in the 2-D electron correction maps
+  TH2F* fPairEffMap;                //! 2D pair efficiency map
+  AliReducedVarManager::Variables fEffMapVarDependencyX;        // varX in the pair eff maps
+  AliReducedVarManager::Variables fEffMapVarDependencyY;        // varY in the pair eff maps
+  TH1F* fAssocHadronEffMap1D;       //! 1D pair efficiency map
+  TH2F* fAssocHadronEffMap2D;       //! 2D pair efficiency map
+  TH3F* fAssocHadronEffMap3D;       //! 3D pair efficiency map
+  AliReducedVarManager::Variables fAssocHadronEffMapVarDependencyX; // varX in assoc hadron eff map
+  AliReducedVarManager::Variables fAssocHadronEffMapVarDependencyY; // varY in assoc hadron eff map
+  AliReducedVarManager::Variables fAssocHadronEffMapVarDependencyZ; // varZ in assoc hadron eff map
+
+  TH1F* fRunTotalLuminosity;        //! total luminosity, GRP/GRP/LHCData::GetLumiAliceSBDelivered()
+  TH1F* fRunTotalIntensity0;        //! total intensity beam 1, GRP/GRP/LHCData::GetTotalIntensity(0)
+  TH1F* fRunTotalIntensity1;        //! total intensity beam 2, GRP/GRP/LHCData::GetTotalIntensity(1)
+  TH1I* fRunLHCFillNumber;          //! LHC fill number, GRP/GRP/LHCData::GetFillNumber()
+  TH1I* fRunDipolePolarity;         //! dipole magnet polarity, GRP/GRP/Data::GetDipolePolarity()
+  TH1I* fRunL3Polarity;             //! L3 magnet polarity, GRP/GRP/Data::GetL3Polarity()
+  TH1I* fRunTimeStart;              //! run start time, GRP/GRP/Data::GetTimeStart()
+  TH1I* fRunTimeEnd;                //! run stop time, GRP/GRP/Data::GetTimeEnd()
+  std::map<Int_t, TGraphErrors*> fRunInstLumiGraphs;  //! instantaneous lumi vs. time per run, read from the GRP file by SetupGRPinformation()
+  TGraphErrors* fRunInstLumi;       //! time dependence of the instantaneous lumi for the current run
+  std::vector<Int_t> fRunNumbers;   // vector with run numbers (for histograms vs. run number)
+  Int_t fRunID;                     // run ID
+  TH1* fAvgMultVsVtxGlobal      [AliReducedVarManager::kNMultiplicityEstimators];   //! average multiplicity vs. z-vertex position (global)
+  TH1* fAvgMultVsVtxRunwise     [AliReducedVarManager::kNMultiplicityEstimators];   //! average multiplicity vs. z-vertex position (run-by-run)
+  TH1* fAvgMultVsRun            [AliReducedVarManager::kNMultiplicityEstimators];   //! average multiplicity vs. run number
+  TH2* fAvgMultVsVtxAndRun      [AliReducedVarManager::kNMultiplicityEstimators];   //! 2D : average multiplicity vs. run number and z-vertex position
+  Double_t fRefMultVsVtxGlobal  [AliReducedVarManager::kNMultiplicityEstimators] [AliReducedVarManager::kNReferenceMultiplicities];  // reference multiplicity for z-vertex correction (global)
+  Double_t fRefMultVsVtxRunwise [AliReducedVarManager::kNMultiplicityEstimators] [AliReducedVarManager::kNReferenceMultiplicities];  // reference multiplicity for z-vertex correction (run-by-run)
+  Double_t fRefMultVsRun        [AliReducedVarManager::kNMultiplicityEstimators] [AliReducedVarManager::kNReferenceMultiplicities];  // reference multiplicity for run correction
+  Double_t fRefMultVsVtxAndRun  [AliReducedVarManager::kNMultiplicityEstimators] [AliReducedVarManager::kNReferenceMultiplicities];  // reference multiplicity for run, vtx correction
+  TString fVZEROCalibrationPath;            // path to the VZERO calibration histograms
+  TProfile2D* fAvgVZEROChannelMult[64];     //! average multiplicity in VZERO channels vs (vtxZ,centSPD)
+  TProfile2D* fVZEROqVecRecentering[4];     //! (vtxZ,centSPD) maps of the VZERO A and C recentering Qvector offsets
+  TProfile2D* fTPCqVecRecentering[2];       //! (vtxZ,centV0) maps of the TPC recentering Qvector offsets
+  Bool_t fOptionCalibrateVZEROqVec;         // option to calibrate V0
+  Bool_t fOptionRecenterVZEROqVec;          // option to do Q vector recentering for V0
+  Bool_t fOptionRecenterTPCqVec;            // option to do Q vector recentering for TPC
+  Bool_t fOptionEventRes;                   // option to divide by resolution
+
+  ClassDef(AliReducedVarContext, 2);
+};
+
+#endif
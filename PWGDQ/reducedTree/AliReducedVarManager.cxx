@@ -9,6 +9,7 @@
 #ifndef ALIREDUCEDVARMANAGER_H
 #include "AliReducedVarManager.h"
 #endif
+#include "AliReducedVarContext.h"
 
 #include <iostream>
 using std::cout;
@@ -27,6 +28,7 @@ using std::ifstream;
 #include <TProfile2D.h>
 #include <TGraphErrors.h>
 #include <TFile.h>
+#include <TKey.h>
 #include <THashList.h>
 
 #include "AliReducedBaseEvent.h"
@@ -129,7 +131,6 @@ const Double_t AliReducedVarManager::fgkVZEROAz = 340.0;   // cm
 const Double_t AliReducedVarManager::fgkVZEROCz = 90.0;    // cm
 const Double_t AliReducedVarManager::fgkVZEROminMult = -0.01;   // minimum VZERO channel multiplicity
 const Float_t  AliReducedVarManager::fgkTPCQvecRapGap = 0.8;    // symmetric interval in the middle of the TPC excluded from EP calculation
-      Float_t  AliReducedVarManager::fgBeamMomentum = 1380.;   // beam momentum in GeV/c
      
 const Double_t AliReducedVarManager::fgkSPDEtaCutsVsVtxZ[20][2] = {
    {-0.5, 1.0}, {-0.6, 1.0}, {-0.8, 1.0}, {-0.9, 1.0}, {-1.0, 1.0},
@@ -138,55 +139,14 @@ const Double_t AliReducedVarManager::fgkSPDEtaCutsVsVtxZ[20][2] = {
    {-1.0, 1.0}, {-1.0, 0.9}, {-1.0, 0.8}, {-1.0, 0.7}, {-1.0, 0.6}
 };
      
-Int_t      AliReducedVarManager::fgCurrentRunNumber = -1;
 TString AliReducedVarManager::fgVariableNames[AliReducedVarManager::kNVars] = {""};
 TString AliReducedVarManager::fgVariableUnits[AliReducedVarManager::kNVars] = {""};
-AliReducedBaseEvent* AliReducedVarManager::fgEvent = 0x0;
-AliReducedEventPlaneInfo* AliReducedVarManager::fgEventPlane = 0x0;
-Bool_t AliReducedVarManager::fgUsedVars[AliReducedVarManager::kNVars] = {kFALSE};
-TH2F* AliReducedVarManager::fgTPCelectronCentroidMap = 0x0;
-TH2F* AliReducedVarManager::fgTPCelectronWidthMap = 0x0;
-AliReducedVarManager::Variables AliReducedVarManager::fgVarDependencyX = kNothing;
-AliReducedVarManager::Variables AliReducedVarManager::fgVarDependencyY = kNothing;
-TH2F* AliReducedVarManager::fgPairEffMap = 0x0;
-AliReducedVarManager::Variables AliReducedVarManager::fgEffMapVarDependencyX = kNothing;
-AliReducedVarManager::Variables AliReducedVarManager::fgEffMapVarDependencyY = kNothing;
-TH1F* AliReducedVarManager::fgAssocHadronEffMap1D = 0x0;
-TH2F* AliReducedVarManager::fgAssocHadronEffMap2D = 0x0;
-TH3F* AliReducedVarManager::fgAssocHadronEffMap3D = 0x0;
-AliReducedVarManager::Variables AliReducedVarManager::fgAssocHadronEffMapVarDependencyX = kNothing;
-AliReducedVarManager::Variables AliReducedVarManager::fgAssocHadronEffMapVarDependencyY = kNothing;
-AliReducedVarManager::Variables AliReducedVarManager::fgAssocHadronEffMapVarDependencyZ = kNothing;
-TH1F* AliReducedVarManager::fgRunTotalLuminosity = 0x0;
-TH1F* AliReducedVarManager::fgRunTotalIntensity0 = 0x0;
-TH1F* AliReducedVarManager::fgRunTotalIntensity1 = 0x0;
-TH1I* AliReducedVarManager::fgRunLHCFillNumber = 0x0;
-TH1I* AliReducedVarManager::fgRunDipolePolarity = 0x0;
-TH1I* AliReducedVarManager::fgRunL3Polarity = 0x0;
-TH1I* AliReducedVarManager::fgRunTimeStart = 0x0;
-TH1I* AliReducedVarManager::fgRunTimeEnd = 0x0;
-TFile* AliReducedVarManager::fgGRPfile = 0x0;
-TGraphErrors* AliReducedVarManager::fgRunInstLumi = 0x0;
-std::vector<Int_t>  AliReducedVarManager::fgRunNumbers;
-Int_t AliReducedVarManager::fgRunID = -1;
-TH1* AliReducedVarManager::fgAvgMultVsVtxGlobal      [kNMultiplicityEstimators] = {0x0};
-TH1* AliReducedVarManager::fgAvgMultVsVtxRunwise     [kNMultiplicityEstimators] = {0x0};
-TH1* AliReducedVarManager::fgAvgMultVsRun            [kNMultiplicityEstimators] = {0x0};
-TH2* AliReducedVarManager::fgAvgMultVsVtxAndRun      [kNMultiplicityEstimators] = {0x0};
-
-Double_t AliReducedVarManager::fgRefMultVsVtxGlobal  [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
-Double_t AliReducedVarManager::fgRefMultVsVtxRunwise [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
-Double_t AliReducedVarManager::fgRefMultVsRun        [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
-Double_t AliReducedVarManager::fgRefMultVsVtxAndRun  [kNMultiplicityEstimators] [kNReferenceMultiplicities] = {0.};
-
-TString AliReducedVarManager::fgVZEROCalibrationPath = "";
-TProfile2D* AliReducedVarManager::fgAvgVZEROChannelMult[64] = {0x0};
-TProfile2D* AliReducedVarManager::fgVZEROqVecRecentering[4] = {0x0};
-TProfile2D* AliReducedVarManager::fgTPCqVecRecentering[2] = {0x0};
-Bool_t AliReducedVarManager::fgOptionCalibrateVZEROqVec = kFALSE;
-Bool_t AliReducedVarManager::fgOptionRecenterVZEROqVec = kFALSE;
-Bool_t AliReducedVarManager::fgOptionRecenterTPCqVec = kFALSE;
-Bool_t AliReducedVarManager::fgOptionEventRes = kFALSE;
+
+// Variable manager state: the shared default context and the context installed for the current thread
+static AliReducedVarContext gDefaultReducedVarContext;
+static thread_local AliReducedVarContext* gReducedVarContext = &gDefaultReducedVarContext;
+
+
 //__________________________________________________________________
 AliReducedVarManager::AliReducedVarManager() :
   TObject()
@@ -214,146 +174,223 @@ AliReducedVarManager::~AliReducedVarManager() {
   //
 }
 
+//__________________________________________________________________
+AliReducedVarContext* AliReducedVarManager::GetDefaultContext() {
+  //
+  // context used by all threads which did not install their own
+  //
+  return &gDefaultReducedVarContext;
+}
+
+//__________________________________________________________________
+AliReducedVarContext* AliReducedVarManager::GetContext() {
+  //
+  // context used by the calling thread
+  //
+  return gReducedVarContext;
+}
+
+//__________________________________________________________________
+AliReducedVarContext* AliReducedVarManager::SetContext(AliReducedVarContext* context) {
+  //
+  // install a context for the calling thread (0x0 restores the default context)
+  // Returns the previously installed context, such that it can be restored by the caller
+  //
+  AliReducedVarContext* previous = gReducedVarContext;
+  gReducedVarContext = (context ? context : &gDefaultReducedVarContext);
+  return previous;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetBeamMomentum(Float_t beamMom) {
+  gReducedVarContext->fBeamMomentum = beamMom;
+}
+
+//__________________________________________________________________
+Float_t AliReducedVarManager::GetBeamMomentum() {
+  return gReducedVarContext->fBeamMomentum;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetEvent(AliReducedBaseEvent* const ev) {
+  gReducedVarContext->fEvent = ev;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetEventPlane(AliReducedEventPlaneInfo* const ev) {
+  gReducedVarContext->fEventPlane = ev;
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetUseVariable(Variables var) {
+  gReducedVarContext->fUsedVars[var] = kTRUE;
+  SetVariableDependencies();
+}
+
+//__________________________________________________________________
+void AliReducedVarManager::SetUseVars(Bool_t* usedVars) {
+  //
+  // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
+  //
+  AliReducedVarContext& context = *gReducedVarContext;
+  for(Int_t i=0;i<kNVars;++i) {
+    if(usedVars[i]) context.fUsedVars[i]=kTRUE;
+  }
+  SetVariableDependencies();
+}
+
+//__________________________________________________________________
+Bool_t AliReducedVarManager::GetUsedVar(Variables var) {
+  return gReducedVarContext->fUsedVars[var];
+}
+
 //__________________________________________________________________
 void AliReducedVarManager::SetVariableDependencies() {
   //
   // Set as used those variables on which other variables calculation depends
   //
-  if(fgUsedVars[kDeltaVtxZ]) {
-    fgUsedVars[kVtxZ] = kTRUE;
-    fgUsedVars[kVtxZtpc] = kTRUE;
+  AliReducedVarContext& context = *gReducedVarContext;
+  if(context.fUsedVars[kDeltaVtxZ]) {
+    context.fUsedVars[kVtxZ] = kTRUE;
+    context.fUsedVars[kVtxZtpc] = kTRUE;
   }
-  if(fgUsedVars[kRap] || fgUsedVars[kRapAbs]) {
-    fgUsedVars[kMass] = kTRUE;
-    fgUsedVars[kP] = kTRUE;
-    fgUsedVars[kEta] = kTRUE;
+  if(context.fUsedVars[kRap] || context.fUsedVars[kRapAbs]) {
+    context.fUsedVars[kMass] = kTRUE;
+    context.fUsedVars[kP] = kTRUE;
+    context.fUsedVars[kEta] = kTRUE;
   }
-  if(fgUsedVars[kTriggerRap] || fgUsedVars[kTriggerRapAbs]) {
-	  fgUsedVars[kMass] = kTRUE;
-	  fgUsedVars[kP] = kTRUE;
-	  fgUsedVars[kEta] = kTRUE;
+  if(context.fUsedVars[kTriggerRap] || context.fUsedVars[kTriggerRapAbs]) {
+	  context.fUsedVars[kMass] = kTRUE;
+	  context.fUsedVars[kP] = kTRUE;
+	  context.fUsedVars[kEta] = kTRUE;
   }
 
-  if(fgUsedVars[kEta]) fgUsedVars[kP] = kTRUE;
+  if(context.fUsedVars[kEta]) context.fUsedVars[kP] = kTRUE;
   
   for(Int_t ih=0; ih<6; ++ih) {
-    if(fgUsedVars[kVZEROQvecX+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+    if(context.fUsedVars[kVZEROQvecX+2*6+ih]) {
+      context.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE;
+      context.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZEROQvecY+2*6+ih]) {
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(context.fUsedVars[kVZEROQvecY+2*6+ih]) {
+      context.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE;
+      context.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZERORP+2*6+ih]) {
-      fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(context.fUsedVars[kVZERORP+2*6+ih]) {
+      context.fUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
+      context.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+      context.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kVZEROQaQcSP+ih] || fgUsedVars[kVZEROQaQcSPsine+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih]    = kTRUE; fgUsedVars[kVZERORP+1*6+ih]    = kTRUE;
-      fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-      fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+    if(context.fUsedVars[kVZEROQaQcSP+ih] || context.fUsedVars[kVZEROQaQcSPsine+ih]) {
+      context.fUsedVars[kVZERORP+0*6+ih]    = kTRUE; context.fUsedVars[kVZERORP+1*6+ih]    = kTRUE;
+      context.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+      context.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPXtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
+    if(context.fUsedVars[kRPXtpcXvzeroa+ih]) {
+      context.fUsedVars[kTPCQvecX+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPXtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
+    if(context.fUsedVars[kRPXtpcXvzeroc+ih]) {
+      context.fUsedVars[kTPCQvecX+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+6+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPYtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
+    if(context.fUsedVars[kRPYtpcYvzeroa+ih]) {
+      context.fUsedVars[kTPCQvecY+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPYtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
+    if(context.fUsedVars[kRPYtpcYvzeroc+ih]) {
+      context.fUsedVars[kTPCQvecY+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPXtpcYvzeroa+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+ih] = kTRUE;
+    if(context.fUsedVars[kRPXtpcYvzeroa+ih]) {
+      context.fUsedVars[kTPCQvecX+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPXtpcYvzeroc+ih]) {
-      fgUsedVars[kTPCQvecX+ih] = kTRUE; fgUsedVars[kVZEROQvecY+6+ih] = kTRUE;
+    if(context.fUsedVars[kRPXtpcYvzeroc+ih]) {
+      context.fUsedVars[kTPCQvecX+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPYtpcXvzeroa+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+ih] = kTRUE;
+    if(context.fUsedVars[kRPYtpcXvzeroa+ih]) {
+      context.fUsedVars[kTPCQvecY+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPYtpcXvzeroc+ih]) {
-      fgUsedVars[kTPCQvecY+ih] = kTRUE; fgUsedVars[kVZEROQvecX+6+ih] = kTRUE;
+    if(context.fUsedVars[kRPYtpcXvzeroc+ih]) {
+      context.fUsedVars[kTPCQvecY+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+6+ih] = kTRUE;
     }  
-    if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) {
-      fgUsedVars[kVZERORP+0*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
+    if(context.fUsedVars[kRPdeltaVZEROAtpc+ih]) {
+      context.fUsedVars[kVZERORP+0*6+ih] = kTRUE; context.fUsedVars[kTPCRP+ih] = kTRUE;
+    }
+    if(context.fUsedVars[kRPdeltaVZEROCtpc+ih]) {
+      context.fUsedVars[kVZERORP+1*6+ih] = kTRUE; context.fUsedVars[kTPCRP+ih] = kTRUE;
     }
-    if(fgUsedVars[kRPdeltaVZEROCtpc+ih]) {
-      fgUsedVars[kVZERORP+1*6+ih] = kTRUE; fgUsedVars[kTPCRP+ih] = kTRUE;
+    if(context.fUsedVars[kTPCsubResCos+ih]) {
+      context.fUsedVars[kTPCRPleft+ih] = kTRUE; context.fUsedVars[kTPCRPright+ih] = kTRUE;
     }
-    if(fgUsedVars[kTPCsubResCos+ih]) {
-      fgUsedVars[kTPCRPleft+ih] = kTRUE; fgUsedVars[kTPCRPright+ih] = kTRUE;
+    if(context.fUsedVars[kVZEROARPres+ih] || context.fUsedVars[kVZEROCRPres+ih] || context.fUsedVars[kVZEROTPCRPres+ih]) {
+      context.fUsedVars[kTPCRPres+0*6+ih] = kTRUE; context.fUsedVars[kTPCRPres+1*6+ih] = kTRUE;
+      context.fUsedVars[kVZERORPres+ih] = kTRUE;
     }
     for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
-      if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
-	 fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
-	fgUsedVars[kPhi] = kTRUE; fgUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
-	if(iVZEROside<2 && (fgUsedVars[kVZEROuQ+iVZEROside*6+ih] || fgUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
-	  fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+      if(context.fUsedVars[kVZEROFlowVn+iVZEROside*6+ih] || context.fUsedVars[kVZEROFlowSine+iVZEROside*6+ih] ||
+	 context.fUsedVars[kVZEROuQ+iVZEROside*6+ih] || context.fUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
+	context.fUsedVars[kPhi] = kTRUE; context.fUsedVars[kVZERORP+iVZEROside*6+ih] = kTRUE;
+	if(iVZEROside<2 && (context.fUsedVars[kVZEROuQ+iVZEROside*6+ih] || context.fUsedVars[kVZEROuQsine+iVZEROside*6+ih])) {
+	  context.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+          context.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
 	}
         if(iVZEROside==2) {
-	  fgUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
-          fgUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; fgUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
+	  context.fUsedVars[kVZEROQvecX+2*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+2*6+ih] = kTRUE;
+          context.fUsedVars[kVZEROQvecX+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecX+1*6+ih] = kTRUE;
+          context.fUsedVars[kVZEROQvecY+0*6+ih] = kTRUE; context.fUsedVars[kVZEROQvecY+1*6+ih] = kTRUE;
 	}
       }
     }
-    if(fgUsedVars[kTPCFlowVn+ih] || fgUsedVars[kTPCFlowSine+ih] || fgUsedVars[kTPCuQ+ih] || fgUsedVars[kTPCuQsine+ih]) {
-      fgUsedVars[kPhi] = kTRUE;
-      fgUsedVars[kTPCQvecXtotal+ih] = kTRUE;
-      fgUsedVars[kTPCQvecYtotal+ih] = kTRUE;
+    if(context.fUsedVars[kTPCFlowVn+ih] || context.fUsedVars[kTPCFlowSine+ih] || context.fUsedVars[kTPCuQ+ih] || context.fUsedVars[kTPCuQsine+ih]) {
+      context.fUsedVars[kPhi] = kTRUE;
+      context.fUsedVars[kTPCQvecXtotal+ih] = kTRUE;
+      context.fUsedVars[kTPCQvecYtotal+ih] = kTRUE;
     }
    
   } // end loop over harmonics
   for(Int_t ich=0; ich<64; ++ich) {
-    if(fgUsedVars[kVZEROflowV2TPC+ich]) {
-      fgUsedVars[kVZEROChannelMult+ich] = kTRUE; fgUsedVars[kTPCRP+1] = kTRUE;
+    if(context.fUsedVars[kVZEROflowV2TPC+ich]) {
+      context.fUsedVars[kVZEROChannelMult+ich] = kTRUE; context.fUsedVars[kTPCRP+1] = kTRUE;
     }
   }
-  if(fgUsedVars[kPtSquared]) fgUsedVars[kPt]=kTRUE;  
-  if(fgUsedVars[kTPCnSigCorrected+kElectron]) {
-     fgUsedVars[kTPCnSig+kElectron] = kTRUE; 
-     fgUsedVars[fgVarDependencyX] = kTRUE; 
-     fgUsedVars[fgVarDependencyY] = kTRUE;
+  if(context.fUsedVars[kPtSquared]) context.fUsedVars[kPt]=kTRUE;  
+  if(context.fUsedVars[kOneOverSqrtPt]) context.fUsedVars[kPt]=kTRUE;
+  if(context.fUsedVars[kTPCnSigCorrected+kElectron]) {
+     context.fUsedVars[kTPCnSig+kElectron] = kTRUE; 
+     if(context.fVarDependencyX!=kNothing) context.fUsedVars[context.fVarDependencyX] = kTRUE;
+     if(context.fVarDependencyY!=kNothing) context.fUsedVars[context.fVarDependencyY] = kTRUE;
   }
-  if(fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]){
-    fgUsedVars[fgEffMapVarDependencyX] = kTRUE;
-    fgUsedVars[fgEffMapVarDependencyY] = kTRUE;
+  if(context.fUsedVars[kPairEff] || context.fUsedVars[kOneOverPairEff] || context.fUsedVars[kOneOverPairEffSq]){
+    if(context.fEffMapVarDependencyX!=kNothing) context.fUsedVars[context.fEffMapVarDependencyX] = kTRUE;
+    if(context.fEffMapVarDependencyY!=kNothing) context.fUsedVars[context.fEffMapVarDependencyY] = kTRUE;
   }
-  if(fgUsedVars[kAssocHadronEff] || fgUsedVars[kOneOverAssocHadronEff]){
-    fgUsedVars[fgAssocHadronEffMapVarDependencyX] = kTRUE;
-    fgUsedVars[fgAssocHadronEffMapVarDependencyY] = kTRUE;
-    fgUsedVars[fgAssocHadronEffMapVarDependencyZ] = kTRUE;
+  if(context.fUsedVars[kAssocHadronEff] || context.fUsedVars[kOneOverAssocHadronEff]){
+    if(context.fAssocHadronEffMapVarDependencyX!=kNothing) context.fUsedVars[context.fAssocHadronEffMapVarDependencyX] = kTRUE;
+    if(context.fAssocHadronEffMapVarDependencyY!=kNothing) context.fUsedVars[context.fAssocHadronEffMapVarDependencyY] = kTRUE;
+    if(context.fAssocHadronEffMapVarDependencyZ!=kNothing) context.fUsedVars[context.fAssocHadronEffMapVarDependencyZ] = kTRUE;
   }
-  if(fgUsedVars[kNTracksITSoutVsSPDtracklets] || fgUsedVars[kNTracksTPCoutVsSPDtracklets] ||
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] || fgUsedVars[kNTracksTRDoutVsSPDtracklets])
-     fgUsedVars[kSPDntracklets] = kTRUE;
+  if(context.fUsedVars[kNTracksITSoutVsSPDtracklets] || context.fUsedVars[kNTracksTPCoutVsSPDtracklets] ||
+     context.fUsedVars[kNTracksTOFoutVsSPDtracklets] || context.fUsedVars[kNTracksTRDoutVsSPDtracklets])
+     context.fUsedVars[kSPDntracklets] = kTRUE;
   
-  if(fgUsedVars[kRapMC] || fgUsedVars[kRapMCAbs]) fgUsedVars[kMassMC] = kTRUE;
+  if(context.fUsedVars[kRapMC] || context.fUsedVars[kRapMCAbs]) context.fUsedVars[kMassMC] = kTRUE;
 
-  if(fgUsedVars[kPairPhiV]){
-    fgUsedVars[kL3Polarity] = kTRUE;
+  if(context.fUsedVars[kPairPhiV]){
+    context.fUsedVars[kL3Polarity] = kTRUE;
   }
-  if(fgUsedVars[kMassDcaPtCorr] ) {
-    fgUsedVars[kMass]          = kTRUE;
-    fgUsedVars[kPt]            = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt] = kTRUE;
+  if(context.fUsedVars[kMassDcaPtCorr] ) {
+    context.fUsedVars[kMass]          = kTRUE;
+    context.fUsedVars[kPt]            = kTRUE;
+    context.fUsedVars[kPairDcaXYSqrt] = kTRUE;
   }
-  if(fgUsedVars[kOpAngDcaPtCorr] ) {
-    fgUsedVars[kPairOpeningAngle] = kTRUE;
-    fgUsedVars[kOneOverSqrtPt]    = kTRUE;
-    fgUsedVars[kPt]               = kTRUE;
-    fgUsedVars[kPairDcaXYSqrt]    = kTRUE;
+  if(context.fUsedVars[kOpAngDcaPtCorr] ) {
+    context.fUsedVars[kPairOpeningAngle] = kTRUE;
+    context.fUsedVars[kOneOverSqrtPt]    = kTRUE;
+    context.fUsedVars[kPt]               = kTRUE;
+    context.fUsedVars[kPairDcaXYSqrt]    = kTRUE;
   }
-  if(fgUsedVars[kNTPCclustersFromPileupRelative]) {
-    fgUsedVars[kNTPCclusters] = kTRUE;
-    fgUsedVars[kNTPCclustersFromPileup] = kTRUE;
+  if(context.fUsedVars[kNTPCclustersFromPileupRelative]) {
+    context.fUsedVars[kNTPCclusters] = kTRUE;
+    context.fUsedVars[kNTPCclustersFromPileup] = kTRUE;
   }
+  context.UpdateDenseIndex();
 }
 
 //__________________________________________________________________
@@ -361,7 +398,8 @@ void AliReducedVarManager::FillEventInfo(Float_t* values) {
   //
   // Fill event information
   //
-  FillEventInfo(fgEvent, values, fgEventPlane);
+  AliReducedVarContext& context = *gReducedVarContext;
+  FillEventInfo(context.fEvent, values, context.fEventPlane);
 }
 
 void AliReducedVarManager::FillMCEventInfo(AliReducedEventInfo* event, Float_t* values) {
@@ -376,269 +414,273 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   //
   // fill event wise info
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   // Basic event information
 
-  values[kVtxX]                      = baseEvent->Vertex(0);
-  values[kVtxY]                       = baseEvent->Vertex(1);
-  values[kVtxZ]                      = baseEvent->Vertex(2);
-  values[kNVtxContributors]= baseEvent->VertexNContributors(); 
-  
-  values[kCentVZERO]         = baseEvent->CentralityVZERO();
-  values[kCentSPD]              = baseEvent->CentralitySPD();
-  values[kCentTPC]              = baseEvent->CentralityTPC();
-  values[kCentZDC]             = baseEvent->CentralityZEMvsZDC();
-  values[kCentVZEROA]      = baseEvent->CentralityVZEROA();
-  values[kCentVZEROC]      = baseEvent->CentralityVZEROC();
-  values[kCentZNA]             = baseEvent->CentralityZNA();
-  values[kCentQuality]        = baseEvent->CentralityQuality();
-  
-  values[kNV0total]             = baseEvent->NV0CandidatesTotal();
-  values[kNV0selected]       = baseEvent->NV0Candidates();
-  values[kNtracksTotal]       = baseEvent->NTracksTotal();
-  values[kNtracksSelected] = baseEvent->NTracks();
+  if(context.fUsedVars[kVtxX]) values[kVtxX]                      = baseEvent->Vertex(0);
+  if(context.fUsedVars[kVtxY]) values[kVtxY]                       = baseEvent->Vertex(1);
+  values[kVtxZ]                      = baseEvent->Vertex(2);      // always filled, input of the VZERO channel eta and multiplicity corrections
+  if(context.fUsedVars[kNVtxContributors]) values[kNVtxContributors]= baseEvent->VertexNContributors(); 
+  
+  if(context.fUsedVars[kCentVZERO]) values[kCentVZERO]         = baseEvent->CentralityVZERO();
+  if(context.fUsedVars[kCentSPD]) values[kCentSPD]              = baseEvent->CentralitySPD();
+  if(context.fUsedVars[kCentTPC]) values[kCentTPC]              = baseEvent->CentralityTPC();
+  if(context.fUsedVars[kCentZDC]) values[kCentZDC]             = baseEvent->CentralityZEMvsZDC();
+  if(context.fUsedVars[kCentVZEROA]) values[kCentVZEROA]      = baseEvent->CentralityVZEROA();
+  if(context.fUsedVars[kCentVZEROC]) values[kCentVZEROC]      = baseEvent->CentralityVZEROC();
+  if(context.fUsedVars[kCentZNA]) values[kCentZNA]             = baseEvent->CentralityZNA();
+  if(context.fUsedVars[kCentQuality]) values[kCentQuality]        = baseEvent->CentralityQuality();
+  
+  if(context.fUsedVars[kNV0total]) values[kNV0total]             = baseEvent->NV0CandidatesTotal();
+  if(context.fUsedVars[kNV0selected]) values[kNV0selected]       = baseEvent->NV0Candidates();
+  if(context.fUsedVars[kNtracksTotal]) values[kNtracksTotal]       = baseEvent->NTracksTotal();
+  if(context.fUsedVars[kNtracksSelected]) values[kNtracksSelected] = baseEvent->NTracks();
   
   if(baseEvent->IsA()!=EVENT::Class()) return;
   
   EVENT* event = (EVENT*)baseEvent;
   
   // Update run wise information if available (needed for the first event filled and whenever the run changes)
-  if(fgCurrentRunNumber!=baseEvent->RunNo()) {
-    fgCurrentRunNumber = baseEvent->RunNo();
+  if(context.fCurrentRunNumber!=baseEvent->RunNo()) {
+    context.fCurrentRunNumber = baseEvent->RunNo();
     // GRP and LHC information
-    if(fgRunTotalLuminosity) values[kTotalLuminosity] = fgRunTotalLuminosity->GetBinContent(fgRunTotalLuminosity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTotalIntensity0) values[kBeamIntensity0] = fgRunTotalIntensity0->GetBinContent(fgRunTotalIntensity0->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTotalIntensity1) values[kBeamIntensity1] = fgRunTotalIntensity1->GetBinContent(fgRunTotalIntensity1->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunLHCFillNumber) values[kLHCFillNumber] = fgRunLHCFillNumber->GetBinContent(fgRunLHCFillNumber->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunDipolePolarity) values[kDipolePolarity] = fgRunDipolePolarity->GetBinContent(fgRunDipolePolarity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunL3Polarity) values[kL3Polarity] = fgRunL3Polarity->GetBinContent(fgRunL3Polarity->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTimeStart) values[kRunTimeStart] = fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgRunTimeEnd) values[kRunTimeEnd] = fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber)));
-    if(fgGRPfile) {
-       fgRunInstLumi = (TGraphErrors*)fgGRPfile->Get(Form("InstLumi_Run%d", fgCurrentRunNumber));
-       //cout << "Lumi hist loaded " << fgRunInstLumi << endl;
-    }
+    if(context.fRunTotalLuminosity) values[kTotalLuminosity] = context.fRunTotalLuminosity->GetBinContent(context.fRunTotalLuminosity->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunTotalIntensity0) values[kBeamIntensity0] = context.fRunTotalIntensity0->GetBinContent(context.fRunTotalIntensity0->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunTotalIntensity1) values[kBeamIntensity1] = context.fRunTotalIntensity1->GetBinContent(context.fRunTotalIntensity1->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunLHCFillNumber) values[kLHCFillNumber] = context.fRunLHCFillNumber->GetBinContent(context.fRunLHCFillNumber->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunDipolePolarity) values[kDipolePolarity] = context.fRunDipolePolarity->GetBinContent(context.fRunDipolePolarity->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunL3Polarity) values[kL3Polarity] = context.fRunL3Polarity->GetBinContent(context.fRunL3Polarity->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunTimeStart) values[kRunTimeStart] = context.fRunTimeStart->GetBinContent(context.fRunTimeStart->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    if(context.fRunTimeEnd) values[kRunTimeEnd] = context.fRunTimeEnd->GetBinContent(context.fRunTimeEnd->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber)));
+    std::map<Int_t, TGraphErrors*>::const_iterator lumiGraph = context.fRunInstLumiGraphs.find(context.fCurrentRunNumber);
+    context.fRunInstLumi = (lumiGraph!=context.fRunInstLumiGraphs.end() ? lumiGraph->second : 0x0);
     
     // VZERO calibration
-    if(fgVZEROCalibrationPath.Data()[0]!='\0') {
-       cout << "AliReducedVarManager::Info  Attempting to load VZERO calibration and/or recentering histograms from path: " << endl << fgVZEROCalibrationPath.Data() << endl;
-      TFile* calibFile = TFile::Open(Form("%s/000%d/dstAnalysisHistograms.root", fgVZEROCalibrationPath.Data(), fgCurrentRunNumber));
+    if(context.fVZEROCalibrationPath.Data()[0]!='\0') {
+       cout << "AliReducedVarManager::Info  Attempting to load VZERO calibration and/or recentering histograms from path: " << endl << context.fVZEROCalibrationPath.Data() << endl;
+      TFile* calibFile = TFile::Open(Form("%s/000%d/dstAnalysisHistograms.root", context.fVZEROCalibrationPath.Data(), context.fCurrentRunNumber));
       THashList* mainList = (THashList*)calibFile->Get("jpsi2eeHistos");
       THashList* calibList = (THashList*)mainList->FindObject("Event_AfterCuts");
       if(!calibList) {
-         cout << "AliReducedVarManager::Info  Cannot open calibration file for run " << fgCurrentRunNumber << endl;
+         cout << "AliReducedVarManager::Info  Cannot open calibration file for run " << context.fCurrentRunNumber << endl;
          cout << "                        Will run uncalibrated and not-recentered!" << endl;
-         fgOptionCalibrateVZEROqVec = kFALSE;
-         fgOptionRecenterVZEROqVec = kFALSE;
-         fgOptionRecenterTPCqVec = kFALSE;
+         context.fOptionCalibrateVZEROqVec = kFALSE;
+         context.fOptionRecenterVZEROqVec = kFALSE;
+         context.fOptionRecenterTPCqVec = kFALSE;
       }
-      cout << "AliReducedVarManager::Info  Loading VZERO calibration and/or recentering parameters for run " << fgCurrentRunNumber << endl;
-      if(fgOptionCalibrateVZEROqVec) {
+      cout << "AliReducedVarManager::Info  Loading VZERO calibration and/or recentering parameters for run " << context.fCurrentRunNumber << endl;
+      if(context.fOptionCalibrateVZEROqVec) {
         for(Int_t iCh=0; iCh<64; ++iCh) {
            
-           fgAvgVZEROChannelMult[iCh] = (TProfile2D*)calibList->FindObject(Form("VZEROmult_ch%d_VtxCent_prof", iCh))->Clone(Form("run%d_ch%d", fgCurrentRunNumber, iCh));
-           fgAvgVZEROChannelMult[iCh]->SetDirectory(0x0);
+           context.fAvgVZEROChannelMult[iCh] = (TProfile2D*)calibList->FindObject(Form("VZEROmult_ch%d_VtxCent_prof", iCh))->Clone(Form("run%d_ch%d", context.fCurrentRunNumber, iCh));
+           context.fAvgVZEROChannelMult[iCh]->SetDirectory(0x0);
         }
       }
-      if(fgOptionRecenterVZEROqVec){
-         fgVZEROqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROA", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[0]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROA", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[1]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[2] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROC", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[2]->SetDirectory(0x0);
-         fgVZEROqVecRecentering[3] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROC", fgCurrentRunNumber));
-         fgVZEROqVecRecentering[3]->SetDirectory(0x0);
+      if(context.fOptionRecenterVZEROqVec){
+         context.fVZEROqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROA", context.fCurrentRunNumber));
+         context.fVZEROqVecRecentering[0]->SetDirectory(0x0);
+         context.fVZEROqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideA_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROA", context.fCurrentRunNumber));
+         context.fVZEROqVecRecentering[1]->SetDirectory(0x0);
+         context.fVZEROqVecRecentering[2] = (TProfile2D*)calibList->FindObject(Form("QvecX_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecX_VZEROC", context.fCurrentRunNumber));
+         context.fVZEROqVecRecentering[2]->SetDirectory(0x0);
+         context.fVZEROqVecRecentering[3] = (TProfile2D*)calibList->FindObject(Form("QvecY_sideC_h2_CentSPDVtxZ_prof"))->Clone(Form("run%d_QvecY_VZEROC", context.fCurrentRunNumber));
+         context.fVZEROqVecRecentering[3]->SetDirectory(0x0);
         
       }
       
-      if(fgOptionRecenterTPCqVec){
-         fgTPCqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_TPC_h2_CentV0VtxZ_prof"))->Clone(Form("run%d_QvecX_TPC", fgCurrentRunNumber));
-         fgTPCqVecRecentering[0]->SetDirectory(0x0);
-         fgTPCqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_TPC_h2_CentV0VtxZ_prof"))->Clone(Form("run%d_QvecY_TPC", fgCurrentRunNumber));
-         fgTPCqVecRecentering[1]->SetDirectory(0x0);
+      if(context.fOptionRecenterTPCqVec){
+         context.fTPCqVecRecentering[0] = (TProfile2D*)calibList->FindObject(Form("QvecX_TPC_h2_CentV0VtxZ_prof"))->Clone(Form("run%d_QvecX_TPC", context.fCurrentRunNumber));
+         context.fTPCqVecRecentering[0]->SetDirectory(0x0);
+         context.fTPCqVecRecentering[1] = (TProfile2D*)calibList->FindObject(Form("QvecY_TPC_h2_CentV0VtxZ_prof"))->Clone(Form("run%d_QvecY_TPC", context.fCurrentRunNumber));
+         context.fTPCqVecRecentering[1]->SetDirectory(0x0);
          
       }
       calibFile->Close();
     }
 
-    if(fgUsedVars[kRunID] && fgRunNumbers.size() && fgRunID < 0  ){
-      for( fgRunID = 0; fgRunNumbers[ fgRunID ] != fgCurrentRunNumber && fgRunID< (Int_t) fgRunNumbers.size() ; ++fgRunID );
+    if(context.fUsedVars[kRunID] && context.fRunNumbers.size() && context.fRunID < 0  ){
+      for( context.fRunID = 0; context.fRunNumbers[ context.fRunID ] != context.fCurrentRunNumber && context.fRunID< (Int_t) context.fRunNumbers.size() ; ++context.fRunID );
     }
     for( int iEstimator =0 ; iEstimator < kNMultiplicityEstimators ; ++iEstimator ){
-      if( fgAvgMultVsVtxAndRun[iEstimator] ){
-        Bool_t fillGlobal = !fgAvgMultVsVtxGlobal[iEstimator];
-        fgAvgMultVsVtxRunwise  [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxRunwise%d",iEstimator ), fgRunID, fgRunID );
+      if( context.fAvgMultVsVtxAndRun[iEstimator] ){
+        Bool_t fillGlobal = !context.fAvgMultVsVtxGlobal[iEstimator];
+        context.fAvgMultVsVtxRunwise  [iEstimator] = context.fAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxRunwise%d",iEstimator ), context.fRunID, context.fRunID );
         if( fillGlobal ){
-          fgAvgMultVsVtxGlobal [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxGlobal%d", iEstimator) );
-          fgAvgMultVsVtxGlobal [iEstimator] -> Scale(1. / fgAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->GetNbins());
-          fgAvgMultVsRun       [iEstimator] = fgAvgMultVsVtxAndRun[iEstimator]->ProjectionX( Form("AvgMultVsRun%d", iEstimator)  );
-          fgAvgMultVsRun       [iEstimator] -> Scale(1. / fgAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->GetNbins());
+          context.fAvgMultVsVtxGlobal [iEstimator] = context.fAvgMultVsVtxAndRun[iEstimator]->ProjectionY( Form("AvgMultVsVtxGlobal%d", iEstimator) );
+          context.fAvgMultVsVtxGlobal [iEstimator] -> Scale(1. / context.fAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->GetNbins());
+          context.fAvgMultVsRun       [iEstimator] = context.fAvgMultVsVtxAndRun[iEstimator]->ProjectionX( Form("AvgMultVsRun%d", iEstimator)  );
+          context.fAvgMultVsRun       [iEstimator] -> Scale(1. / context.fAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->GetNbins());
         }
         for( int iReference = 0; iReference < kNReferenceMultiplicities; ++ iReference  ){
           Double_t refVsVtx, refVsVtxGlobal, refVsRun, refVsVtxAndRun;
           switch ( iReference ){
             case kMaximumMultiplicity :
-              refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum();
+              refVsVtx = context.fAvgMultVsVtxRunwise[iEstimator]->GetMaximum();
               if( fillGlobal ){
-                refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum();
-                refVsRun       = fgAvgMultVsRun[iEstimator]->GetMaximum();
-                refVsVtxAndRun = fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum();
+                refVsVtxGlobal = context.fAvgMultVsVtxGlobal[iEstimator]->GetMaximum();
+                refVsRun       = context.fAvgMultVsRun[iEstimator]->GetMaximum();
+                refVsVtxAndRun = context.fAvgMultVsVtxAndRun[iEstimator]->GetMaximum();
               }
               break;
             case kMinimumMultiplicity :
-              refVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum();
+              refVsVtx = context.fAvgMultVsVtxRunwise[iEstimator]->GetMinimum();
               if( fillGlobal ){
-                refVsVtxGlobal = fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum();
-                refVsRun       = fgAvgMultVsRun[iEstimator]->GetMinimum();
-                refVsVtxAndRun = fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum();
+                refVsVtxGlobal = context.fAvgMultVsVtxGlobal[iEstimator]->GetMinimum();
+                refVsRun       = context.fAvgMultVsRun[iEstimator]->GetMinimum();
+                refVsVtxAndRun = context.fAvgMultVsVtxAndRun[iEstimator]->GetMinimum();
               }
               break;
             case kMeanMultiplicity :
-              refVsVtx = 0.5 * ( fgAvgMultVsVtxRunwise[iEstimator]->GetMaximum() +  fgAvgMultVsVtxRunwise[iEstimator]->GetMinimum() );
+              refVsVtx = 0.5 * ( context.fAvgMultVsVtxRunwise[iEstimator]->GetMaximum() +  context.fAvgMultVsVtxRunwise[iEstimator]->GetMinimum() );
               if( fillGlobal ){
-                refVsVtxGlobal = 0.5 * ( fgAvgMultVsVtxGlobal[iEstimator]->GetMaximum() + fgAvgMultVsVtxGlobal[iEstimator]->GetMinimum() ) ;
-                refVsRun       = 0.5 * ( fgAvgMultVsRun[iEstimator]->GetMaximum() + fgAvgMultVsRun[iEstimator]->GetMinimum() );
-                refVsVtxAndRun = 0.5 * ( fgAvgMultVsVtxAndRun[iEstimator]->GetMaximum() + fgAvgMultVsVtxAndRun[iEstimator]->GetMinimum() );
+                refVsVtxGlobal = 0.5 * ( context.fAvgMultVsVtxGlobal[iEstimator]->GetMaximum() + context.fAvgMultVsVtxGlobal[iEstimator]->GetMinimum() ) ;
+                refVsRun       = 0.5 * ( context.fAvgMultVsRun[iEstimator]->GetMaximum() + context.fAvgMultVsRun[iEstimator]->GetMinimum() );
+                refVsVtxAndRun = 0.5 * ( context.fAvgMultVsVtxAndRun[iEstimator]->GetMaximum() + context.fAvgMultVsVtxAndRun[iEstimator]->GetMinimum() );
               }
               break;
           }
-          fgRefMultVsVtxRunwise  [iEstimator][iReference] = refVsVtx;
+          context.fRefMultVsVtxRunwise  [iEstimator][iReference] = refVsVtx;
           if(fillGlobal){
-            fgRefMultVsVtxGlobal [iEstimator][iReference] = refVsVtxGlobal;
-            fgRefMultVsRun       [iEstimator][iReference] = refVsRun;
-            fgRefMultVsVtxAndRun [iEstimator][iReference] = refVsVtxAndRun;
+            context.fRefMultVsVtxGlobal [iEstimator][iReference] = refVsVtxGlobal;
+            context.fRefMultVsRun       [iEstimator][iReference] = refVsRun;
+            context.fRefMultVsVtxAndRun [iEstimator][iReference] = refVsVtxAndRun;
           }
         }
       }
     }
   }
 
-  values[kRunNo] = fgCurrentRunNumber;
-  values[kRunID] = fgRunID;
+  if(context.fUsedVars[kRunNo]) values[kRunNo] = context.fCurrentRunNumber;
+  if(context.fUsedVars[kRunID]) values[kRunID] = context.fRunID;
   
-  values[kEventNumberInFile]    = event->EventNumberInFile();
-  values[kBC]                   = event->BC();
-  values[kTimeStamp]            = event->TimeStamp();
+  if(context.fUsedVars[kEventNumberInFile]) values[kEventNumberInFile]    = event->EventNumberInFile();
+  if(context.fUsedVars[kBC]) values[kBC]                   = event->BC();
+  if(context.fUsedVars[kTimeStamp]) values[kTimeStamp]            = event->TimeStamp();
   Int_t timeSOR = 0; Int_t timeEOR = 0;
-  if(fgUsedVars[kTimeRelativeSOR] || fgUsedVars[kTimeRelativeSORfraction]) {
-     timeSOR = (fgRunTimeStart ? fgRunTimeStart->GetBinContent(fgRunTimeStart->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber))) : 0);
-     timeEOR = (fgRunTimeEnd ? fgRunTimeEnd->GetBinContent(fgRunTimeEnd->GetXaxis()->FindBin(Form("%d",fgCurrentRunNumber))) : 0);
+  if(context.fUsedVars[kTimeRelativeSOR] || context.fUsedVars[kTimeRelativeSORfraction]) {
+     timeSOR = (context.fRunTimeStart ? context.fRunTimeStart->GetBinContent(context.fRunTimeStart->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber))) : 0);
+     timeEOR = (context.fRunTimeEnd ? context.fRunTimeEnd->GetBinContent(context.fRunTimeEnd->GetXaxis()->FindBin(Form("%d",context.fCurrentRunNumber))) : 0);
   }
-  if(fgUsedVars[kTimeRelativeSOR]) {
+  if(context.fUsedVars[kTimeRelativeSOR]) {
      values[kTimeRelativeSOR] = Double_t(event->TimeStamp() - timeSOR) / 60.;     // in minutes
   }
-  if(fgUsedVars[kTimeRelativeSORfraction] && 
+  if(context.fUsedVars[kTimeRelativeSORfraction] && 
      (values[kRunTimeEnd]-values[kRunTimeStart])>1.)   // the run should be longer than 1 second ... 
      values[kTimeRelativeSORfraction] = (event->TimeStamp() - timeSOR) / (timeEOR - timeSOR);
-  if(fgRunInstLumi) {
-     values[kInstLumi]          = fgRunInstLumi->Eval(event->TimeStamp()); 
-  }
-  values[kEventType]            = event->EventType();
-  values[kTriggerMask]          = event->TriggerMask();
-  values[kINT7Triggered]        = event->TriggerMask() & kINT7 ?1:0;
-  values[kTRDTriggeredType]     = event->TRDfired();
-  values[kHighMultV0Triggered]  = event->TriggerMask() & kHighMultV0 ?1:0;
-  values[kIsPhysicsSelection]   = (event->IsPhysicsSelection() ? 1.0 : 0.0);
-  values[kIsSPDPileup]          = event->IsSPDPileup();
-  values[kIsSPDPileup5]         = event->EventTag(11);
-  values[kIsPileupMV]           = event->EventTag(1);
-  values[kIsSPDPileupMultBins]  = event->IsSPDPileupMultBins();
-  values[kNSPDpileups]          = event->NpileupSPD();
-  values[kNTrackPileups]        = event->NpileupTracks();
-  values[kIRIntClosestIntMap]   = event->IRIntClosestIntMap(0);
-  values[kIRIntClosestIntMap+1] = event->IRIntClosestIntMap(1);
-  values[kNPMDtracks]           = event->NPMDtracks();
-  values[kNTRDtracks]           = event->NTRDtracks();
-  values[kNTRDtracklets]        = event->NTRDtracklets();
-  values[kNVtxTPCContributors]  = event->VertexTPCContributors();
-  values[kVtxXtpc]              = event->VertexTPC(0);
-  values[kVtxYtpc]              = event->VertexTPC(1);
-  values[kVtxZtpc]              = event->VertexTPC(2);
-  values[kNVtxTPCContributors]  = event->VertexTPCContributors();
-  values[kVtxXspd]              = event->VertexSPD(0);
-  values[kVtxYspd]              = event->VertexSPD(1);
-  values[kVtxZspd]              = event->VertexSPD(2);
-  values[kNVtxSPDContributors]  = event->VertexSPDContributors();
-  if(fgUsedVars[kDeltaVtxZ]) values[kDeltaVtxZ] = values[kVtxZ] - values[kVtxZtpc];
-  if(fgUsedVars[kDeltaVtxZspd]) values[kDeltaVtxZspd] = values[kVtxZ] - values[kVtxZspd];
-  values[kTPCpileupZAC]         = event->TPCpileupZ();
-  values[kTPCpileupZA]          = event->TPCpileupZ(1);
-  values[kTPCpileupZC]          = event->TPCpileupZ(2);
-  values[kTPCpileupContributorsAC] = event->TPCpileupContributors();
-  values[kTPCpileupContributorsA]  = event->TPCpileupContributors(1);
-  values[kTPCpileupContributorsC]  = event->TPCpileupContributors(2);
+  if(context.fUsedVars[kInstLumi] && context.fRunInstLumi) {
+     values[kInstLumi]          = context.fRunInstLumi->Eval(event->TimeStamp()); 
+  }
+  if(context.fUsedVars[kEventType]) values[kEventType]            = event->EventType();
+  if(context.fUsedVars[kTriggerMask]) values[kTriggerMask]          = event->TriggerMask();
+  if(context.fUsedVars[kINT7Triggered]) values[kINT7Triggered]        = event->TriggerMask() & kINT7 ?1:0;
+  if(context.fUsedVars[kTRDTriggeredType]) values[kTRDTriggeredType]     = event->TRDfired();
+  if(context.fUsedVars[kHighMultV0Triggered]) values[kHighMultV0Triggered]  = event->TriggerMask() & kHighMultV0 ?1:0;
+  if(context.fUsedVars[kIsPhysicsSelection]) values[kIsPhysicsSelection]   = (event->IsPhysicsSelection() ? 1.0 : 0.0);
+  if(context.fUsedVars[kIsSPDPileup]) values[kIsSPDPileup]          = event->IsSPDPileup();
+  if(context.fUsedVars[kIsSPDPileup5]) values[kIsSPDPileup5]         = event->EventTag(11);
+  if(context.fUsedVars[kIsPileupMV]) values[kIsPileupMV]           = event->EventTag(1);
+  if(context.fUsedVars[kIsSPDPileupMultBins]) values[kIsSPDPileupMultBins]  = event->IsSPDPileupMultBins();
+  if(context.fUsedVars[kNSPDpileups]) values[kNSPDpileups]          = event->NpileupSPD();
+  if(context.fUsedVars[kNTrackPileups]) values[kNTrackPileups]        = event->NpileupTracks();
+  if(context.fUsedVars[kIRIntClosestIntMap]) values[kIRIntClosestIntMap]   = event->IRIntClosestIntMap(0);
+  if(context.fUsedVars[kIRIntClosestIntMap+1]) values[kIRIntClosestIntMap+1] = event->IRIntClosestIntMap(1);
+  if(context.fUsedVars[kNPMDtracks]) values[kNPMDtracks]           = event->NPMDtracks();
+  if(context.fUsedVars[kNTRDtracks]) values[kNTRDtracks]           = event->NTRDtracks();
+  if(context.fUsedVars[kNTRDtracklets]) values[kNTRDtracklets]        = event->NTRDtracklets();
+  if(context.fUsedVars[kNVtxTPCContributors]) values[kNVtxTPCContributors]  = event->VertexTPCContributors();
+  if(context.fUsedVars[kVtxXtpc]) values[kVtxXtpc]              = event->VertexTPC(0);
+  if(context.fUsedVars[kVtxYtpc]) values[kVtxYtpc]              = event->VertexTPC(1);
+  if(context.fUsedVars[kVtxZtpc]) values[kVtxZtpc]              = event->VertexTPC(2);
+  if(context.fUsedVars[kNVtxTPCContributors]) values[kNVtxTPCContributors]  = event->VertexTPCContributors();
+  if(context.fUsedVars[kVtxXspd]) values[kVtxXspd]              = event->VertexSPD(0);
+  if(context.fUsedVars[kVtxYspd]) values[kVtxYspd]              = event->VertexSPD(1);
+  if(context.fUsedVars[kVtxZspd]) values[kVtxZspd]              = event->VertexSPD(2);
+  if(context.fUsedVars[kNVtxSPDContributors]) values[kNVtxSPDContributors]  = event->VertexSPDContributors();
+  if(context.fUsedVars[kDeltaVtxZ]) values[kDeltaVtxZ] = values[kVtxZ] - event->VertexTPC(2);
+  if(context.fUsedVars[kDeltaVtxZspd]) values[kDeltaVtxZspd] = values[kVtxZ] - event->VertexSPD(2);
+  if(context.fUsedVars[kTPCpileupZAC]) values[kTPCpileupZAC]         = event->TPCpileupZ();
+  if(context.fUsedVars[kTPCpileupZA]) values[kTPCpileupZA]          = event->TPCpileupZ(1);
+  if(context.fUsedVars[kTPCpileupZC]) values[kTPCpileupZC]          = event->TPCpileupZ(2);
+  if(context.fUsedVars[kTPCpileupContributorsAC]) values[kTPCpileupContributorsAC] = event->TPCpileupContributors();
+  if(context.fUsedVars[kTPCpileupContributorsA]) values[kTPCpileupContributorsA]  = event->TPCpileupContributors(1);
+  if(context.fUsedVars[kTPCpileupContributorsC]) values[kTPCpileupContributorsC]  = event->TPCpileupContributors(2);
     
   for(Int_t iflag=0;iflag<32;++iflag) 
-    values[kNTracksPerTrackingStatus+iflag] = event->TracksPerTrackingFlag(iflag);
-  values[kNTracksTPCoutBeforeClean] = event->TracksWithTPCout();
-  
-  // set the fgUsedVars to true as these might have been set to false in the previous event
-  fgUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
-  if(TMath::Abs(values[kNTracksPerTrackingStatus+kITSout])>0.01) {
-    values[kNTracksTPCoutVsITSout] = values[kNTracksPerTrackingStatus+kTPCout]/values[kNTracksPerTrackingStatus+kITSout];
-    values[kNTracksTRDoutVsITSout] = values[kNTracksPerTrackingStatus+kTRDout]/values[kNTracksPerTrackingStatus+kITSout]; 
-    values[kNTracksTOFoutVsITSout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kITSout];
+    if(context.fUsedVars[kNTracksPerTrackingStatus+iflag]) values[kNTracksPerTrackingStatus+iflag] = event->TracksPerTrackingFlag(iflag);
+  // inputs of the track ratios below, which are always computed
+  const Float_t nTracksITSout = event->TracksPerTrackingFlag(kITSout);
+  const Float_t nTracksTPCout = event->TracksPerTrackingFlag(kTPCout);
+  const Float_t nTracksTRDout = event->TracksPerTrackingFlag(kTRDout);
+  const Float_t nTracksTOFout = event->TracksPerTrackingFlag(kTOFout);
+  if(context.fUsedVars[kNTracksTPCoutBeforeClean]) values[kNTracksTPCoutBeforeClean] = event->TracksWithTPCout();
+  
+  // set the context.fUsedVars to true as these might have been set to false in the previous event
+  context.fUsedVars[kNTracksTPCoutVsITSout] = kTRUE;
+  context.fUsedVars[kNTracksTRDoutVsITSout] = kTRUE;
+  context.fUsedVars[kNTracksTOFoutVsITSout] = kTRUE;
+  context.fUsedVars[kNTracksTRDoutVsTPCout] = kTRUE;
+  context.fUsedVars[kNTracksTOFoutVsTPCout] = kTRUE;
+  context.fUsedVars[kNTracksTOFoutVsTRDout] = kTRUE;
+  if(TMath::Abs(nTracksITSout)>0.01) {
+    values[kNTracksTPCoutVsITSout] = nTracksTPCout/nTracksITSout;
+    values[kNTracksTRDoutVsITSout] = nTracksTRDout/nTracksITSout; 
+    values[kNTracksTOFoutVsITSout] = nTracksTOFout/nTracksITSout;
   }
   else {
-     // if these values are undefined, set fgUsedVars as false such that the values are not filled in histograms
-     fgUsedVars[kNTracksTPCoutVsITSout] = kFALSE; fgUsedVars[kNTracksTRDoutVsITSout] = kFALSE; fgUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
+     // if these values are undefined, set context.fUsedVars as false such that the values are not filled in histograms
+     context.fUsedVars[kNTracksTPCoutVsITSout] = kFALSE; context.fUsedVars[kNTracksTRDoutVsITSout] = kFALSE; context.fUsedVars[kNTracksTOFoutVsITSout] = kFALSE;
   }
   
-  if(TMath::Abs(values[kNTracksPerTrackingStatus+kTPCout])>0.01) {
-    values[kNTracksTRDoutVsTPCout] = values[kNTracksPerTrackingStatus+kTRDout]/values[kNTracksPerTrackingStatus+kTPCout];
-    values[kNTracksTOFoutVsTPCout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTPCout];
+  if(TMath::Abs(nTracksTPCout)>0.01) {
+    values[kNTracksTRDoutVsTPCout] = nTracksTRDout/nTracksTPCout;
+    values[kNTracksTOFoutVsTPCout] = nTracksTOFout/nTracksTPCout;
   }
   else {
-     fgUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; fgUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
+     context.fUsedVars[kNTracksTRDoutVsTPCout] = kFALSE; context.fUsedVars[kNTracksTOFoutVsTPCout] = kFALSE; 
   }
   
-  if(TMath::Abs(values[kNTracksPerTrackingStatus+kTRDout])>0.01)
-    values[kNTracksTOFoutVsTRDout] = values[kNTracksPerTrackingStatus+kTOFout]/values[kNTracksPerTrackingStatus+kTRDout];
+  if(TMath::Abs(nTracksTRDout)>0.01)
+    values[kNTracksTOFoutVsTRDout] = nTracksTOFout/nTracksTRDout;
   else
-     fgUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
+     context.fUsedVars[kNTracksTOFoutVsTRDout] = kFALSE;
 
   // Multiplicity estimators
+  // NOTE: the total VZERO multiplicities and the SPD tracklets are always filled, they are inputs of the ratios and pileup variables below
 
-  values[ kVZEROATotalMult ] = event->MultVZEROA();
-  values[ kVZEROCTotalMult ] = event->MultVZEROC();
+  if(context.fUsedVars[kVZEROATotalMult]) values[ kVZEROATotalMult ] = event->MultVZEROA();
+  if(context.fUsedVars[kVZEROCTotalMult]) values[ kVZEROCTotalMult ] = event->MultVZEROC();
   values[ kVZEROTotalMult  ] = event->MultVZERO();
   
-  values[ kVZEROATotalMultFromChannels ] = event->MultVZEROA(kTRUE);
-  values[ kVZEROCTotalMultFromChannels ] = event->MultVZEROC(kTRUE);
+  if(context.fUsedVars[kVZEROATotalMultFromChannels]) values[ kVZEROATotalMultFromChannels ] = event->MultVZEROA(kTRUE);
+  if(context.fUsedVars[kVZEROCTotalMultFromChannels]) values[ kVZEROCTotalMultFromChannels ] = event->MultVZEROC(kTRUE);
   values[ kVZEROTotalMultFromChannels  ] = event->MultVZERO(kTRUE);
-  if(TMath::Abs(values[kVZEROTotalMultFromChannels])>1.0e-6) 
-     values[kVZEROTPCoutDiff] = (values[kVZEROTotalMultFromChannels]-values[kNTracksPerTrackingStatus+kTPCout]) / (values[kVZEROTotalMultFromChannels]);
-  else
-     values[kVZEROTPCoutDiff] = 0.0;
+  if(context.fUsedVars[kVZEROTPCoutDiff]) {
+    if(TMath::Abs(values[kVZEROTotalMultFromChannels])>1.0e-6) 
+       values[kVZEROTPCoutDiff] = (values[kVZEROTotalMultFromChannels]-nTracksTPCout) / (values[kVZEROTotalMultFromChannels]);
+    else
+       values[kVZEROTPCoutDiff] = 0.0;
+  }
   
-  values[ kVZEROACTotalMult ] = event->MultVZEROA() + event->MultVZEROC();
+  if(context.fUsedVars[kVZEROACTotalMult]) values[ kVZEROACTotalMult ] = event->MultVZEROA() + event->MultVZEROC();
 
   values[ kSPDntracklets ]   = event->SPDntracklets();
-  values[ kSPDntracklets08 ] = 0.;
-  values[ kSPDntracklets16 ] = 0.;
-  values[ kSPDntrackletsOuterEta ] = 0.;
-  values[ kSPDnTracklets10EtaVtxCorr ] = 0.;
-  
-  
-  
+  if(context.fUsedVars[kSPDntracklets08]) values[ kSPDntracklets08 ] = 0.;
+  if(context.fUsedVars[kSPDntracklets16]) values[ kSPDntracklets16 ] = 0.;
+  if(context.fUsedVars[kSPDntrackletsOuterEta]) values[ kSPDntrackletsOuterEta ] = 0.;
+  if(context.fUsedVars[kSPDnTracklets10EtaVtxCorr]) values[ kSPDnTracklets10EtaVtxCorr ] = 0.;
   
   for(Int_t ieta=0;ieta<32;++ieta) {
-    values[ kSPDntrackletsEtaBin+ieta ] = event->SPDntracklets(ieta);
-    if( ieta > 7 && ieta < 24 ) values[ kSPDntracklets08 ] += event->SPDntracklets(ieta);
-    if( ieta < 8 || ieta > 23 ) values[ kSPDntrackletsOuterEta ] += event->SPDntracklets(ieta);
+    if(context.fUsedVars[kSPDntrackletsEtaBin+ieta]) values[ kSPDntrackletsEtaBin+ieta ] = event->SPDntracklets(ieta);
+    if( context.fUsedVars[kSPDntracklets08] && ieta > 7 && ieta < 24 ) values[ kSPDntracklets08 ] += event->SPDntracklets(ieta);
+    if( context.fUsedVars[kSPDntrackletsOuterEta] && (ieta < 8 || ieta > 23) ) values[ kSPDntrackletsOuterEta ] += event->SPDntracklets(ieta);
   }
 
   for( Int_t iEstimator = 0; iEstimator < kNMultiplicityEstimators; ++iEstimator){
     Int_t estimator = kMultiplicity + iEstimator;
-    if( fgAvgMultVsVtxAndRun[iEstimator] ){
-      Int_t vtxBin = fgAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->FindBin( values[kVtxZ] );
-      Int_t runBin = fgAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->FindBin( values[kRunID] );
-      Double_t multRaw = values[ estimator ];
+    if( context.fAvgMultVsVtxAndRun[iEstimator] ){
+      Int_t vtxBin = context.fAvgMultVsVtxAndRun[iEstimator]->GetYaxis()->FindBin( values[kVtxZ] );
+      Int_t runBin = context.fAvgMultVsVtxAndRun[iEstimator]->GetXaxis()->FindBin( context.fRunID );
+      Double_t multRaw = values[ estimator ];   // filled, SetMultiplicityProfile() marks the estimator as used
       for( Int_t iCorrection = 0; iCorrection < kNCorrections; ++iCorrection  ){
         for(Int_t iReference = 0 ; iReference <  kNReferenceMultiplicities; ++iReference ){
           Int_t indexNotSmeared = GetCorrectedMultiplicity( estimator, iCorrection, iReference, kNoSmearing );
@@ -647,8 +689,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
           Double_t multCorrSmeared = multRaw;
     // apply vertex and gain loss correction simultaneously
           if( iCorrection == kVertexCorrection2D  ){
-            Double_t localAvg = fgAvgMultVsVtxAndRun[iEstimator]->GetBinContent( runBin, vtxBin );
-            Double_t refMult  = fgRefMultVsVtxAndRun[iEstimator][iReference];
+            Double_t localAvg = context.fAvgMultVsVtxAndRun[iEstimator]->GetBinContent( runBin, vtxBin );
+            Double_t refMult  = context.fRefMultVsVtxAndRun[iEstimator][iReference];
             multCorr *=  localAvg ?  refMult / localAvg : 1.;
             Double_t deltaM =  localAvg ?  multRaw * ( refMult/localAvg - 1) : 0.;
             multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
@@ -659,13 +701,13 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
             switch( iCorrection ){
               case kVertexCorrectionGlobal:
               case kVertexCorrectionGlobalGainLoss:
-                localAvgVsVtx = fgAvgMultVsVtxGlobal[iEstimator]->GetBinContent( vtxBin );
-                refMultVsVtx  = fgRefMultVsVtxGlobal[iEstimator][iReference];
+                localAvgVsVtx = context.fAvgMultVsVtxGlobal[iEstimator]->GetBinContent( vtxBin );
+                refMultVsVtx  = context.fRefMultVsVtxGlobal[iEstimator][iReference];
                 break;
               case kVertexCorrectionRunwise:
               case kVertexCorrectionRunwiseGainLoss:
-                localAvgVsVtx = fgAvgMultVsVtxRunwise[iEstimator]->GetBinContent( vtxBin );
-                refMultVsVtx  = fgRefMultVsVtxRunwise[iEstimator][iReference];
+                localAvgVsVtx = context.fAvgMultVsVtxRunwise[iEstimator]->GetBinContent( vtxBin );
+                refMultVsVtx  = context.fRefMultVsVtxRunwise[iEstimator][iReference];
                 break;
               default:
                 localAvgVsVtx = 0.;
@@ -679,8 +721,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
             if( iCorrection == kVertexCorrectionGlobalGainLoss || 
                 iCorrection == kVertexCorrectionRunwiseGainLoss || 
                 iCorrection == kGainLossCorrection   ){
-              Double_t localAvgVsRun = fgAvgMultVsRun[iEstimator]->GetBinContent( runBin );
-              Double_t refMultVsRun  = fgRefMultVsRun[iEstimator][iReference];
+              Double_t localAvgVsRun = context.fAvgMultVsRun[iEstimator]->GetBinContent( runBin );
+              Double_t refMultVsRun  = context.fRefMultVsRun[iEstimator][iReference];
               multCorr        *= localAvgVsRun ? refMultVsRun / localAvgVsRun : 1.;
               deltaM           = localAvgVsRun ? multCorrSmeared  * ( refMultVsRun/localAvgVsRun - 1) : 0;
               multCorrSmeared += (deltaM>0 ? 1. : -1.) * gRandom->Poisson(TMath::Abs(deltaM));
@@ -688,13 +730,13 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
           }
           values[ indexNotSmeared ] = multCorr;
           values[ indexSmeared ]    = multCorrSmeared;
-          fgUsedVars [indexNotSmeared] = kTRUE;
-          fgUsedVars [indexSmeared] = kTRUE;
+          context.fUsedVars [indexNotSmeared] = kTRUE;
+          context.fUsedVars [indexSmeared] = kTRUE;
         }
       }
     }
-    else if( ( estimator == kVZEROACTotalMult && fgAvgMultVsVtxAndRun[kVZEROATotalMult-kMultiplicity] && fgAvgMultVsVtxAndRun[kVZEROCTotalMult-kMultiplicity]  )  
-      || (estimator == kSPDnTracklets10EtaVtxCorr && fgAvgMultVsVtxAndRun[kSPDntrackletsEtaBin-kMultiplicity] ) ){
+    else if( ( estimator == kVZEROACTotalMult && context.fAvgMultVsVtxAndRun[kVZEROATotalMult-kMultiplicity] && context.fAvgMultVsVtxAndRun[kVZEROCTotalMult-kMultiplicity]  )  
+      || (estimator == kSPDnTracklets10EtaVtxCorr && context.fAvgMultVsVtxAndRun[kSPDntrackletsEtaBin-kMultiplicity] ) ){
       for( Int_t iCorrection = 0; iCorrection < kNCorrections; ++iCorrection  ){
         for(Int_t iReference = 0 ; iReference <  kNReferenceMultiplicities; ++iReference ){
           Int_t indexNotSmeared = GetCorrectedMultiplicity( estimator, iCorrection, iReference, kNoSmearing );
@@ -703,12 +745,12 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
           values[indexSmeared] = 0.;
           if( estimator == kSPDnTracklets10EtaVtxCorr ){
             for( Int_t ieta=6; ieta<26; ++ieta ) {
-              Int_t vtxBin = fgAvgMultVsVtxAndRun[kSPDntrackletsEtaBin+ieta-kMultiplicity]->GetYaxis()->FindBin( values[kVtxZ] );
-              if( fgAvgMultVsVtxGlobal[kSPDntrackletsEtaBin+ieta-kMultiplicity]->GetBinContent( vtxBin ) > .3 ){
+              Int_t vtxBin = context.fAvgMultVsVtxAndRun[kSPDntrackletsEtaBin+ieta-kMultiplicity]->GetYaxis()->FindBin( values[kVtxZ] );
+              if( context.fAvgMultVsVtxGlobal[kSPDntrackletsEtaBin+ieta-kMultiplicity]->GetBinContent( vtxBin ) > .3 ){
                 Int_t indexBinNotSmeared = GetCorrectedMultiplicity( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kNoSmearing );
                 Int_t indexBinSmeared    = GetCorrectedMultiplicity( kSPDntrackletsEtaBin+ieta, iCorrection, iReference, kPoissonSmearing );
-                if( fgUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
-                if( fgUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
+                if( context.fUsedVars[indexBinNotSmeared]) values[ indexNotSmeared ] += values[ indexBinNotSmeared ];
+                if( context.fUsedVars[indexBinSmeared]) values[ indexSmeared ] += values[ indexBinSmeared ];
               }
             }
           }
@@ -727,90 +769,88 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     }
   }
 
-  fgUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
-  fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
-  fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
+  context.fUsedVars[kNTracksITSoutVsSPDtracklets] = kTRUE;  
+  context.fUsedVars[kNTracksTPCoutVsSPDtracklets] = kTRUE;
+  context.fUsedVars[kNTracksTRDoutVsSPDtracklets] = kTRUE;
+  context.fUsedVars[kNTracksTOFoutVsSPDtracklets] = kTRUE;
   if(values[kSPDntracklets]>0.01) {
-    values[kNTracksITSoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kITSout] / values[kSPDntracklets];
-    values[kNTracksTPCoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTPCout] / values[kSPDntracklets];
-    values[kNTracksTRDoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTRDout] / values[kSPDntracklets];
-    values[kNTracksTOFoutVsSPDtracklets] = values[kNTracksPerTrackingStatus+kTOFout] / values[kSPDntracklets];
+    values[kNTracksITSoutVsSPDtracklets] = nTracksITSout / values[kSPDntracklets];
+    values[kNTracksTPCoutVsSPDtracklets] = nTracksTPCout / values[kSPDntracklets];
+    values[kNTracksTRDoutVsSPDtracklets] = nTracksTRDout / values[kSPDntracklets];
+    values[kNTracksTOFoutVsSPDtracklets] = nTracksTOFout / values[kSPDntracklets];
   }
   else {
-     fgUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
-     fgUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
-     fgUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
+     context.fUsedVars[kNTracksITSoutVsSPDtracklets] = kFALSE;  
+     context.fUsedVars[kNTracksTPCoutVsSPDtracklets] = kFALSE;
+     context.fUsedVars[kNTracksTRDoutVsSPDtracklets] = kFALSE;
+     context.fUsedVars[kNTracksTOFoutVsSPDtracklets] = kFALSE;
   }
     
-  values[kNCaloClusters]   = event->GetNCaloClusters();
-  values[kNTPCclusters]    = event->NTPCClusters();
+  if(context.fUsedVars[kNCaloClusters]) values[kNCaloClusters]   = event->GetNCaloClusters();
+  values[kNTPCclusters]    = event->NTPCClusters();   // input of the pileup variables below
 
-  
-  
-  for(Int_t i=0;i<2;++i) values[kSPDFiredChips+i] = event->SPDFiredChips(i+1);
-  for(Int_t i=0;i<6;++i) values[kITSnClusters+i] = event->ITSClusters(i+1);
-  values[kSPDnSingleClusters] = event->SPDnSingleClusters();
+  for(Int_t i=0;i<2;++i) if(context.fUsedVars[kSPDFiredChips+i]) values[kSPDFiredChips+i] = event->SPDFiredChips(i+1);
+  for(Int_t i=0;i<6;++i) if(context.fUsedVars[kITSnClusters+i]) values[kITSnClusters+i] = event->ITSClusters(i+1);
+  if(context.fUsedVars[kSPDnSingleClusters]) values[kSPDnSingleClusters] = event->SPDnSingleClusters();
 
   //VZERO detector information
-  fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
+  context.fUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kTRUE;
   if(values[kVZEROTotalMult]>1.0e-5)
-     values[kNTracksTPCoutVsVZEROTotalMult] = values[kNTracksPerTrackingStatus+kTPCout] / values[kVZEROTotalMult];
+     values[kNTracksTPCoutVsVZEROTotalMult] = nTracksTPCout / values[kVZEROTotalMult];
   else
-     fgUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
+     context.fUsedVars[kNTracksTPCoutVsVZEROTotalMult] = kFALSE;
   
   values[kVZEROAemptyChannels] = 0;
   values[kVZEROCemptyChannels] = 0;
-  for(Int_t ich=0;ich<64;++ich) fgUsedVars[kVZEROChannelMult+ich] = kTRUE; 
+  for(Int_t ich=0;ich<64;++ich) context.fUsedVars[kVZEROChannelMult+ich] = kTRUE; 
   Float_t theta=0.0;
   for(Int_t ich=0;ich<64;++ich) {
-    if(fgUsedVars[kVZEROChannelMult+ich]) {
+    if(context.fUsedVars[kVZEROChannelMult+ich]) {
       values[kVZEROChannelMult+ich] = event->MultChannelVZERO(ich);
       if(values[kVZEROChannelMult+ich]<fgkVZEROminMult) {
-        fgUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
+        context.fUsedVars[kVZEROChannelMult+ich] = kFALSE;   // will not be filled in histograms by the histogram manager
         if(ich<32) values[kVZEROCemptyChannels] += 1;
         else values[kVZEROAemptyChannels] += 1;
       }
     }
-    if(fgUsedVars[kVZEROChannelEta+ich]) {
+    if(context.fUsedVars[kVZEROChannelEta+ich]) {
       if(ich<32) theta = TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROCz-values[kVtxZ]));
       else theta = TMath::Pi()-TMath::ATan(fgkVZEROChannelRadii[ich]/(fgkVZEROAz-values[kVtxZ]));
       values[kVZEROChannelEta+ich] = -1.0*TMath::Log(TMath::Tan(theta/2.0));
     }
   }
   
-  fgUsedVars[kNTracksTPCoutFromPileup] = kTRUE;
+  context.fUsedVars[kNTracksTPCoutFromPileup] = kTRUE;
   if(values[kVZEROTotalMultFromChannels]>0.0)
      values[kNTracksTPCoutFromPileup] = 0.0;
-  else fgUsedVars[kNTracksTPCoutFromPileup] = kFALSE;
+  else context.fUsedVars[kNTracksTPCoutFromPileup] = kFALSE;
   
   Float_t tpcClustersExpectationWOpileup = 0.001;
-  if(fgUsedVars[kNTPCclustersFromPileup] && values[kVZEROTotalMultFromChannels]>0.0) {
+  if(context.fUsedVars[kNTPCclustersFromPileup] && values[kVZEROTotalMultFromChannels]>0.0) {
      tpcClustersExpectationWOpileup = (-0.0132+TMath::Sqrt(0.0132*0.0132-4.0*(-200.0-values[kVZEROTotalMultFromChannels])*1.4e-9))/2.0/1.4e-9;
      values[kNTPCclustersFromPileup] = values[kNTPCclusters] - tpcClustersExpectationWOpileup;
   }
   else 
      values[kNTPCclustersFromPileup] = 0.0;
   
-  if(fgUsedVars[kNTPCclustersFromPileupRelative] && values[kNTPCclusters]>0.0)
+  if(context.fUsedVars[kNTPCclustersFromPileupRelative] && values[kNTPCclusters]>0.0)
      values[kNTPCclustersFromPileupRelative] = values[kNTPCclustersFromPileup] / tpcClustersExpectationWOpileup;
   
-  if(fgUsedVars[kVZEROQvecX+0*6+1] || fgUsedVars[kVZEROQvecY+0*6+1] || fgUsedVars[kVZERORP+0*6+1]) {
+  if(context.fUsedVars[kVZEROQvecX+0*6+1] || context.fUsedVars[kVZEROQvecY+0*6+1] || context.fUsedVars[kVZERORP+0*6+1]) {
     Double_t qvecVZEROA[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
     Double_t qvecVZEROC[EVENTPLANE::fgkNMaxHarmonics][2] = {{0.0}};
-    if(fgOptionCalibrateVZEROqVec && fgAvgVZEROChannelMult[0]) {
+    if(context.fOptionCalibrateVZEROqVec && context.fAvgVZEROChannelMult[0]) {
        Float_t calibVZEROMult[64] = {0.};
        Float_t refMult=0;
-      for(Int_t ich=0;ich<64;++ich) fgUsedVars[kVZEROChannelMultCalib+ich] = kTRUE; 
+      for(Int_t ich=0;ich<64;++ich) context.fUsedVars[kVZEROChannelMultCalib+ich] = kTRUE; 
        
       for(Int_t iCh=0; iCh<64; ++iCh) {
          if(event->MultChannelVZERO(iCh)>=fgkVZEROminMult) {
                          
-            Float_t avMult = fgAvgVZEROChannelMult[iCh]->GetBinContent(fgAvgVZEROChannelMult[iCh]->FindBin(event->Vertex(2), event->CentralitySPD()));
+            Float_t avMult = context.fAvgVZEROChannelMult[iCh]->GetBinContent(context.fAvgVZEROChannelMult[iCh]->FindBin(event->Vertex(2), event->CentralitySPD()));
             Int_t refCh = iCh-(iCh%8);
             if(iCh==refCh)
-                refMult=fgAvgVZEROChannelMult[iCh]->GetBinContent(fgAvgVZEROChannelMult[iCh]->GetXaxis()->FindBin(0.0),fgAvgVZEROChannelMult[iCh]->GetYaxis()->FindBin(event->CentralitySPD()));
+                refMult=context.fAvgVZEROChannelMult[iCh]->GetBinContent(context.fAvgVZEROChannelMult[iCh]->GetXaxis()->FindBin(0.0),context.fAvgVZEROChannelMult[iCh]->GetYaxis()->FindBin(event->CentralitySPD()));
             
             calibVZEROMult[iCh] = event->MultChannelVZERO(iCh) / (avMult>1.0e-6 ? avMult : 1.0)*refMult;
             values[kVZEROChannelMultCalib+iCh]=calibVZEROMult[iCh];
@@ -819,7 +859,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
             
          }
          else
-             fgUsedVars[kVZEROChannelMultCalib+iCh] = kFALSE; // will not be filled in histograms by the histogram manager
+             context.fUsedVars[kVZEROChannelMultCalib+iCh] = kFALSE; // will not be filled in histograms by the histogram manager
       }
       event->GetVZEROQvector(qvecVZEROA, EVENTPLANE::kVZEROA, calibVZEROMult);
       event->GetVZEROQvector(qvecVZEROC, EVENTPLANE::kVZEROC, calibVZEROMult);
@@ -830,9 +870,9 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
       event->GetVZEROQvector(qvecVZEROA, EVENTPLANE::kVZEROA);
       event->GetVZEROQvector(qvecVZEROC, EVENTPLANE::kVZEROC);
     }
-    if(fgOptionRecenterVZEROqVec && fgVZEROqVecRecentering[0]) {
-         Float_t recenterOffset = fgVZEROqVecRecentering[0]->GetBinContent(fgVZEROqVecRecentering[0]->FindBin(event->CentralitySPD(), event->Vertex(2)));
-         Float_t widthEqVZERO = fgVZEROqVecRecentering[0]->GetBinError(fgVZEROqVecRecentering[0]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+    if(context.fOptionRecenterVZEROqVec && context.fVZEROqVecRecentering[0]) {
+         Float_t recenterOffset = context.fVZEROqVecRecentering[0]->GetBinContent(context.fVZEROqVecRecentering[0]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+         Float_t widthEqVZERO = context.fVZEROqVecRecentering[0]->GetBinError(context.fVZEROqVecRecentering[0]->FindBin(event->CentralitySPD(), event->Vertex(2)));
 
          qvecVZEROA[1][0] -= recenterOffset;
            if(widthEqVZERO >0.0)
@@ -840,24 +880,24 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
            else
              qvecVZEROA[1][0]=0;
                 
-        recenterOffset = fgVZEROqVecRecentering[1]->GetBinContent(fgVZEROqVecRecentering[1]->FindBin(event->CentralitySPD(), event->Vertex(2)));
-        widthEqVZERO = fgVZEROqVecRecentering[1]->GetBinError(fgVZEROqVecRecentering[1]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+        recenterOffset = context.fVZEROqVecRecentering[1]->GetBinContent(context.fVZEROqVecRecentering[1]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+        widthEqVZERO = context.fVZEROqVecRecentering[1]->GetBinError(context.fVZEROqVecRecentering[1]->FindBin(event->CentralitySPD(), event->Vertex(2)));
         qvecVZEROA[1][1] -= recenterOffset;
            if(widthEqVZERO >0.0)
               qvecVZEROA[1][1] /=widthEqVZERO;
            else
             qvecVZEROA[1][1]=0;
           
-        recenterOffset = fgVZEROqVecRecentering[2]->GetBinContent(fgVZEROqVecRecentering[2]->FindBin(event->CentralitySPD(), event->Vertex(2)));
-        widthEqVZERO = fgVZEROqVecRecentering[2]->GetBinError(fgVZEROqVecRecentering[2]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+        recenterOffset = context.fVZEROqVecRecentering[2]->GetBinContent(context.fVZEROqVecRecentering[2]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+        widthEqVZERO = context.fVZEROqVecRecentering[2]->GetBinError(context.fVZEROqVecRecentering[2]->FindBin(event->CentralitySPD(), event->Vertex(2)));
         qvecVZEROC[1][0] -= recenterOffset;
            if(widthEqVZERO >0.0)
               qvecVZEROC[1][0] /=widthEqVZERO;
            else
               qvecVZEROC[1][0]=0;
        
-        recenterOffset = fgVZEROqVecRecentering[3]->GetBinContent(fgVZEROqVecRecentering[3]->FindBin(event->CentralitySPD(), event->Vertex(2)));
-        widthEqVZERO = fgVZEROqVecRecentering[3]->GetBinError(fgVZEROqVecRecentering[3]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+        recenterOffset = context.fVZEROqVecRecentering[3]->GetBinContent(context.fVZEROqVecRecentering[3]->FindBin(event->CentralitySPD(), event->Vertex(2)));
+        widthEqVZERO = context.fVZEROqVecRecentering[3]->GetBinError(context.fVZEROqVecRecentering[3]->FindBin(event->CentralitySPD(), event->Vertex(2)));
         qvecVZEROC[1][1] -= recenterOffset;
            if(widthEqVZERO >0.0)
               qvecVZEROC[1][1] /=widthEqVZERO;
@@ -877,39 +917,41 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
        values[kVZEROQvecY+2*6+ih] = qvecVZEROA[ih][1] + qvecVZEROC[ih][1];
        values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih], values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
      
-       if(fgUsedVars[kVZEROQaQcSP+ih]) {
+       if(context.fUsedVars[kVZEROQaQcSP+ih]) {
           values[kVZEROQaQcSP+ih] = TMath::Cos((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
           values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
           values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
           values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+1*6+ih]*values[kVZEROQvecX+1*6+ih]+
           values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
        }
-       values[kVZEROQaQcSPsine+ih] = TMath::Sin((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
-       values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
-       values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
-       values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+1*6+ih]*values[kVZEROQvecX+1*6+ih]+
-       values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
+       if(context.fUsedVars[kVZEROQaQcSPsine+ih]) {
+          values[kVZEROQaQcSPsine+ih] = TMath::Sin((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
+          values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
+          values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
+          values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+1*6+ih]*values[kVZEROQvecX+1*6+ih]+
+          values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
+       }
        values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
        // cos (n*(psi_A-psi_C))
-       if(fgUsedVars[kVZERORPres + ih]) {
+       if(context.fUsedVars[kVZERORPres + ih]) {
           values[kVZERORPres + ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kVZERORP+1*6+ih]);
           values[kVZERORPres + ih] = TMath::Cos(values[kVZERORPres + ih]*(ih+1));
        }
        // Qx,Qy correlations for VZERO
-       if(fgUsedVars[kVZEROXaXc+ih]) 
+       if(context.fUsedVars[kVZEROXaXc+ih]) 
           values[kVZEROXaXc+ih] = qvecVZEROA[ih][0]*qvecVZEROC[ih][0];
-       if(fgUsedVars[kVZEROXaYa+ih]) 
+       if(context.fUsedVars[kVZEROXaYa+ih]) 
           values[kVZEROXaYa+ih] = qvecVZEROA[ih][0]*qvecVZEROA[ih][1];
-       if(fgUsedVars[kVZEROXaYc+ih]) 
+       if(context.fUsedVars[kVZEROXaYc+ih]) 
           values[kVZEROXaYc+ih] = qvecVZEROA[ih][0]*qvecVZEROC[ih][1];
-       if(fgUsedVars[kVZEROYaXc+ih]) 
+       if(context.fUsedVars[kVZEROYaXc+ih]) 
           values[kVZEROYaXc+ih] = qvecVZEROA[ih][1]*qvecVZEROC[ih][0];
-       if(fgUsedVars[kVZEROYaYc+ih]) 
+       if(context.fUsedVars[kVZEROYaYc+ih]) 
           values[kVZEROYaYc+ih] = qvecVZEROA[ih][1]*qvecVZEROC[ih][1];
-       if(fgUsedVars[kVZEROXcYc+ih]) 
+       if(context.fUsedVars[kVZEROXcYc+ih]) 
           values[kVZEROXcYc+ih] = qvecVZEROC[ih][0]*qvecVZEROC[ih][1];
        // Psi_A - Psi_C
-       if(fgUsedVars[kVZEROdeltaRPac+ih])
+       if(context.fUsedVars[kVZEROdeltaRPac+ih])
           values[kVZEROdeltaRPac+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kVZERORP+1*6+ih]);
     }    // end loop over harmonics
   }
@@ -922,9 +964,9 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
         values[kTPCRPtree+ih] = event->GetEventPlane(EVENTPLANE::kTPC,ih+1);
         
           //TPC Q vector recentering       
-          if(fgOptionRecenterTPCqVec && fgTPCqVecRecentering[0] && ih==1) {
-            Float_t recenterOffsetTPC = fgTPCqVecRecentering[0]->GetBinContent(fgTPCqVecRecentering[0]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
-            Double_t widthEqTPC = fgTPCqVecRecentering[0]->GetBinError(fgTPCqVecRecentering[0]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
+          if(context.fOptionRecenterTPCqVec && context.fTPCqVecRecentering[0] && ih==1) {
+            Float_t recenterOffsetTPC = context.fTPCqVecRecentering[0]->GetBinContent(context.fTPCqVecRecentering[0]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
+            Double_t widthEqTPC = context.fTPCqVecRecentering[0]->GetBinError(context.fTPCqVecRecentering[0]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
             values[kTPCQvecXtree+1] -= recenterOffsetTPC;
 
                 if(widthEqTPC >0.0)
@@ -932,8 +974,8 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
                 else
                    values[kTPCQvecXtree+1]=0;
                 
-            recenterOffsetTPC = fgTPCqVecRecentering[1]->GetBinContent(fgTPCqVecRecentering[1]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
-            widthEqTPC = fgTPCqVecRecentering[1]->GetBinError(fgTPCqVecRecentering[1]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
+            recenterOffsetTPC = context.fTPCqVecRecentering[1]->GetBinContent(context.fTPCqVecRecentering[1]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
+            widthEqTPC = context.fTPCqVecRecentering[1]->GetBinError(context.fTPCqVecRecentering[1]->FindBin(event->CentralityVZERO(), event->Vertex(2)));
             values[kTPCQvecYtree+1] -= recenterOffsetTPC;
                 
                 if(widthEqTPC >0.0)
@@ -947,48 +989,48 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
  
      }
      if(event->GetEventPlaneStatus(EVENTPLANE::kTPCptWeights,ih+1)!=EVENTPLANE::kUnset) {
-        values[kTPCQvecXptWeightsTree+ih] = event->GetQx(EVENTPLANE::kTPCptWeights,ih+1);
-        values[kTPCQvecYptWeightsTree+ih] = event->GetQy(EVENTPLANE::kTPCptWeights,ih+1);
-        values[kTPCRPptWeightsTree+ih] = event->GetEventPlane(EVENTPLANE::kTPCptWeights,ih+1);
+        if(context.fUsedVars[kTPCQvecXptWeightsTree+ih]) values[kTPCQvecXptWeightsTree+ih] = event->GetQx(EVENTPLANE::kTPCptWeights,ih+1);
+        if(context.fUsedVars[kTPCQvecYptWeightsTree+ih]) values[kTPCQvecYptWeightsTree+ih] = event->GetQy(EVENTPLANE::kTPCptWeights,ih+1);
+        if(context.fUsedVars[kTPCRPptWeightsTree+ih]) values[kTPCRPptWeightsTree+ih] = event->GetEventPlane(EVENTPLANE::kTPCptWeights,ih+1);
      }
      if(event->GetEventPlaneStatus(EVENTPLANE::kTPCpos,ih+1)!=EVENTPLANE::kUnset) {
-        values[kTPCQvecXposTree+ih] = event->GetQx(EVENTPLANE::kTPCpos,ih+1);
-        values[kTPCQvecYposTree+ih] = event->GetQy(EVENTPLANE::kTPCpos,ih+1);
-        values[kTPCRPposTree+ih] = event->GetEventPlane(EVENTPLANE::kTPCpos,ih+1);
+        if(context.fUsedVars[kTPCQvecXposTree+ih]) values[kTPCQvecXposTree+ih] = event->GetQx(EVENTPLANE::kTPCpos,ih+1);
+        if(context.fUsedVars[kTPCQvecYposTree+ih]) values[kTPCQvecYposTree+ih] = event->GetQy(EVENTPLANE::kTPCpos,ih+1);
+        if(context.fUsedVars[kTPCRPposTree+ih]) values[kTPCRPposTree+ih] = event->GetEventPlane(EVENTPLANE::kTPCpos,ih+1);
      }
      if(event->GetEventPlaneStatus(EVENTPLANE::kTPCneg,ih+1)!=EVENTPLANE::kUnset) {
-        values[kTPCQvecXnegTree+ih] = event->GetQx(EVENTPLANE::kTPCneg,ih+1);
-        values[kTPCQvecYnegTree+ih] = event->GetQy(EVENTPLANE::kTPCneg,ih+1);
-        values[kTPCRPnegTree+ih] = event->GetEventPlane(EVENTPLANE::kTPCneg,ih+1);
+        if(context.fUsedVars[kTPCQvecXnegTree+ih]) values[kTPCQvecXnegTree+ih] = event->GetQx(EVENTPLANE::kTPCneg,ih+1);
+        if(context.fUsedVars[kTPCQvecYnegTree+ih]) values[kTPCQvecYnegTree+ih] = event->GetQy(EVENTPLANE::kTPCneg,ih+1);
+        if(context.fUsedVars[kTPCRPnegTree+ih]) values[kTPCRPnegTree+ih] = event->GetEventPlane(EVENTPLANE::kTPCneg,ih+1);
      }
      
       // TPC VZERO Q-vector correlations
-     if(fgUsedVars[kRPXtpcXvzeroa+ih]) 
+     if(context.fUsedVars[kRPXtpcXvzeroa+ih]) 
 	values[kRPXtpcXvzeroa+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecX+ih];
-     if(fgUsedVars[kRPXtpcXvzeroc+ih]) 
+     if(context.fUsedVars[kRPXtpcXvzeroc+ih]) 
 	values[kRPXtpcXvzeroc+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecX+6+ih];
-     if(fgUsedVars[kRPYtpcYvzeroa+ih]) 
+     if(context.fUsedVars[kRPYtpcYvzeroa+ih]) 
 	values[kRPYtpcYvzeroa+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecY+ih];
-     if(fgUsedVars[kRPYtpcYvzeroc+ih]) 
+     if(context.fUsedVars[kRPYtpcYvzeroc+ih]) 
 	values[kRPYtpcYvzeroc+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecY+6+ih];
-     if(fgUsedVars[kRPXtpcYvzeroa+ih]) 
+     if(context.fUsedVars[kRPXtpcYvzeroa+ih]) 
 	values[kRPXtpcYvzeroa+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecY+ih];
-     if(fgUsedVars[kRPXtpcYvzeroc+ih]) 
+     if(context.fUsedVars[kRPXtpcYvzeroc+ih]) 
 	values[kRPXtpcYvzeroc+ih] = values[kTPCQvecXtree+ih]*values[kVZEROQvecY+6+ih];
-     if(fgUsedVars[kRPYtpcXvzeroa+ih]) 
+     if(context.fUsedVars[kRPYtpcXvzeroa+ih]) 
 	values[kRPYtpcXvzeroa+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecX+ih];
-     if(fgUsedVars[kRPYtpcXvzeroc+ih]) 
+     if(context.fUsedVars[kRPYtpcXvzeroc+ih]) 
 	values[kRPYtpcXvzeroc+ih] = values[kTPCQvecYtree+ih]*values[kVZEROQvecX+6+ih];
       // Psi_TPC - Psi_VZERO A/C      
-     if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) 
+     if(context.fUsedVars[kRPdeltaVZEROAtpc+ih]) 
 	values[kRPdeltaVZEROAtpc+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kTPCRPtree+ih]);
-     if(fgUsedVars[kRPdeltaVZEROCtpc+ih])
+     if(context.fUsedVars[kRPdeltaVZEROCtpc+ih])
         values[kRPdeltaVZEROCtpc+ih] = DeltaPhi(values[kVZERORP+1*6+ih], values[kTPCRPtree+ih]);
      
      
      // cos(n(EPtpc-EPvzero A/C))
      for(Int_t iVZEROside=0; iVZEROside<2; ++iVZEROside) {
-          if(fgUsedVars[kTPCRPres+iVZEROside*6+ih]) {
+          if(context.fUsedVars[kTPCRPres+iVZEROside*6+ih]) {
 	  values[kTPCRPres+iVZEROside*6+ih] = DeltaPhi(values[kTPCRPtree+ih], values[kVZERORP+iVZEROside*6+ih]);
           values[kTPCRPres+iVZEROside*6+ih] = TMath::Cos(values[kTPCRPres+iVZEROside*6+ih]*(ih+1));
 	}
@@ -998,7 +1040,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
 //      cout<<values[kTPCRPres+1*6+ih]<<endl;
 //      cout<<values[kVZERORPres+ih]<<endl;
       //resolution of V0A, V0C or TPC as reference detector
-      if(fgOptionEventRes && (fgUsedVars[kVZEROARPres+ih]||fgUsedVars[kVZEROCRPres+ih]||fgUsedVars[kVZEROTPCRPres+ih])){
+      if(context.fOptionEventRes && (context.fUsedVars[kVZEROARPres+ih]||context.fUsedVars[kVZEROCRPres+ih]||context.fUsedVars[kVZEROTPCRPres+ih])){
          
          if(values[kTPCRPres+1*6+ih]>1.0e-7 && values[kTPCRPres+0*6+ih]>1.0e-7 && values[kVZERORPres+ih]>1.0e-7){
     
@@ -1011,7 +1053,7 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
           values[kVZEROCRPres+ih]=0;
           values[kVZEROTPCRPres+ih]=0;
         }
-    }//end if fgOptionEventRes
+    }//end if context.fOptionEventRes
      
   }// end loop over harmonics
   
@@ -1023,99 +1065,101 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
   if(eventF) {
    for(Int_t ih=0; ih<6; ++ih) {
      // VZERO event plane variables
-     values[kVZEROQvecX+2*6+ih] = 0.0;
-     values[kVZEROQvecY+2*6+ih] = 0.0;
-     values[kVZERORP   +2*6+ih] = 0.0;
+     if(context.fUsedVars[kVZEROQvecX+2*6+ih]) values[kVZEROQvecX+2*6+ih] = 0.0;
+     if(context.fUsedVars[kVZEROQvecY+2*6+ih]) values[kVZEROQvecY+2*6+ih] = 0.0;
+     if(context.fUsedVars[kVZERORP   +2*6+ih]) values[kVZERORP   +2*6+ih] = 0.0;
      for(Int_t iVZEROside=0; iVZEROside<2; ++iVZEROside) {
-       values[kVZEROQvecX+iVZEROside*6+ih] = eventF->Qx(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-       values[kVZEROQvecY+iVZEROside*6+ih] = eventF->Qy(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-       if(fgUsedVars[kVZERORP+iVZEROside*6+ih]) 
+       if(context.fUsedVars[kVZEROQvecX+iVZEROside*6+ih]) values[kVZEROQvecX+iVZEROside*6+ih] = eventF->Qx(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
+       if(context.fUsedVars[kVZEROQvecY+iVZEROside*6+ih]) values[kVZEROQvecY+iVZEROside*6+ih] = eventF->Qy(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
+       if(context.fUsedVars[kVZERORP+iVZEROside*6+ih]) 
         values[kVZERORP+iVZEROside*6+ih] = eventF->EventPlane(EVENTPLANE::kVZEROA+iVZEROside, ih+1);
-	if(fgUsedVars[kVZEROQvecX+2*6+ih])
+	if(context.fUsedVars[kVZEROQvecX+2*6+ih])
 	  values[kVZEROQvecX+2*6+ih] += values[kVZEROQvecX+iVZEROside*6+ih];
-	if(fgUsedVars[kVZEROQvecY+2*6+ih])
+	if(context.fUsedVars[kVZEROQvecY+2*6+ih])
 	  values[kVZEROQvecY+2*6+ih] += values[kVZEROQvecY+iVZEROside*6+ih];
 	// cos(n(EPtpc-EPvzero A/C))	
-        if(fgUsedVars[kTPCRPres+iVZEROside*6+ih]) {
+        if(context.fUsedVars[kTPCRPres+iVZEROside*6+ih]) {
 	  values[kTPCRPres+iVZEROside*6+ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kTPC, ih+1), eventF->EventPlane(EVENTPLANE::kVZEROA+iVZEROside, ih+1));
           values[kTPCRPres+iVZEROside*6+ih] = TMath::Cos(values[kTPCRPres+iVZEROside*6+ih]*(ih+1));
 	}
       }
       
-      if(fgUsedVars[kVZEROQaQcSP+ih]) {
+      if(context.fUsedVars[kVZEROQaQcSP+ih]) {
         values[kVZEROQaQcSP+ih] = TMath::Cos((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
         values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
                                                values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
         values[kVZEROQaQcSP+ih] *= TMath::Sqrt(values[kVZEROQvecX+1*6+ih]*values[kVZEROQvecX+1*6+ih]+
                                                values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
       }
-      values[kVZEROQaQcSPsine+ih] = TMath::Sin((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
-      values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
-                                             values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
-      values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+1*6+ih]*values[kVZEROQvecX+1*6+ih]+
-                                             values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
-      values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
+      if(context.fUsedVars[kVZEROQaQcSPsine+ih]) {
+        values[kVZEROQaQcSPsine+ih] = TMath::Sin((ih+1)*(values[kVZERORP+0*6+ih]-values[kVZERORP+1*6+ih]));
+        values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+0*6+ih]*values[kVZEROQvecX+0*6+ih]+
+                                               values[kVZEROQvecY+0*6+ih]*values[kVZEROQvecY+0*6+ih]);
+        values[kVZEROQaQcSPsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+1*6+ih]*values[kVZEROQvecX+1*6+ih]+
+                                               values[kVZEROQvecY+1*6+ih]*values[kVZEROQvecY+1*6+ih]);
+      }
+      if(context.fUsedVars[kVZERORP   +2*6+ih]) values[kVZERORP   +2*6+ih] = TMath::ATan2(values[kVZEROQvecY+2*6+ih],values[kVZEROQvecX+2*6+ih])/Double_t(ih+1);
       // cos (n*(psi_A-psi_C))
-      if(fgUsedVars[kVZERORPres + ih]) {
+      if(context.fUsedVars[kVZERORPres + ih]) {
 	values[kVZERORPres + ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kVZEROA, ih+1), 
 					    eventF->EventPlane(EVENTPLANE::kVZEROC, ih+1));
         values[kVZERORPres + ih] = TMath::Cos(values[kVZERORPres + ih]*(ih+1));
       }
       // Qx,Qy correlations for VZERO
-      if(fgUsedVars[kVZEROXaXc+ih]) 
+      if(context.fUsedVars[kVZEROXaXc+ih]) 
 	values[kVZEROXaXc+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qx(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROXaYa+ih]) 
+      if(context.fUsedVars[kVZEROXaYa+ih]) 
 	values[kVZEROXaYa+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROA, ih+1);
-      if(fgUsedVars[kVZEROXaYc+ih]) 
+      if(context.fUsedVars[kVZEROXaYc+ih]) 
 	values[kVZEROXaYc+ih] = eventF->Qx(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROYaXc+ih]) 
+      if(context.fUsedVars[kVZEROYaXc+ih]) 
 	values[kVZEROYaXc+ih] = eventF->Qy(EVENTPLANE::kVZEROA, ih+1)*eventF->Qx(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROYaYc+ih]) 
+      if(context.fUsedVars[kVZEROYaYc+ih]) 
 	values[kVZEROYaYc+ih] = eventF->Qy(EVENTPLANE::kVZEROA, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
-      if(fgUsedVars[kVZEROXcYc+ih]) 
+      if(context.fUsedVars[kVZEROXcYc+ih]) 
 	values[kVZEROXcYc+ih] = eventF->Qx(EVENTPLANE::kVZEROC, ih+1)*eventF->Qy(EVENTPLANE::kVZEROC, ih+1);
       // Psi_A - Psi_C
-      if(fgUsedVars[kVZEROdeltaRPac+ih])
+      if(context.fUsedVars[kVZEROdeltaRPac+ih])
         values[kVZEROdeltaRPac+ih] = DeltaPhi(eventF->EventPlane(EVENTPLANE::kVZEROA, ih+1), 
 	  				      eventF->EventPlane(EVENTPLANE::kVZEROC, ih+1));
       
       // TPC event plane
-      values[kTPCQvecX+ih] = eventF->Qx(EVENTPLANE::kTPC, ih+1);
-      values[kTPCQvecY+ih] = eventF->Qy(EVENTPLANE::kTPC, ih+1);
-      if(fgUsedVars[kTPCRP+ih]) 
+      if(context.fUsedVars[kTPCQvecX+ih]) values[kTPCQvecX+ih] = eventF->Qx(EVENTPLANE::kTPC, ih+1);
+      if(context.fUsedVars[kTPCQvecY+ih]) values[kTPCQvecY+ih] = eventF->Qy(EVENTPLANE::kTPC, ih+1);
+      if(context.fUsedVars[kTPCRP+ih]) 
 	values[kTPCRP+ih] = eventF->EventPlane(EVENTPLANE::kTPC, ih+1);
       // TPC VZERO Q-vector correlations
-      if(fgUsedVars[kRPXtpcXvzeroa+ih]) 
+      if(context.fUsedVars[kRPXtpcXvzeroa+ih]) 
 	values[kRPXtpcXvzeroa+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecX+ih];
-      if(fgUsedVars[kRPXtpcXvzeroc+ih]) 
+      if(context.fUsedVars[kRPXtpcXvzeroc+ih]) 
 	values[kRPXtpcXvzeroc+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecX+6+ih];
-      if(fgUsedVars[kRPYtpcYvzeroa+ih]) 
+      if(context.fUsedVars[kRPYtpcYvzeroa+ih]) 
 	values[kRPYtpcYvzeroa+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecY+ih];
-      if(fgUsedVars[kRPYtpcYvzeroc+ih]) 
+      if(context.fUsedVars[kRPYtpcYvzeroc+ih]) 
 	values[kRPYtpcYvzeroc+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecY+6+ih];
-      if(fgUsedVars[kRPXtpcYvzeroa+ih]) 
+      if(context.fUsedVars[kRPXtpcYvzeroa+ih]) 
 	values[kRPXtpcYvzeroa+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecY+ih];
-      if(fgUsedVars[kRPXtpcYvzeroc+ih]) 
+      if(context.fUsedVars[kRPXtpcYvzeroc+ih]) 
 	values[kRPXtpcYvzeroc+ih] = values[kTPCQvecX+ih]*values[kVZEROQvecY+6+ih];
-      if(fgUsedVars[kRPYtpcXvzeroa+ih]) 
+      if(context.fUsedVars[kRPYtpcXvzeroa+ih]) 
 	values[kRPYtpcXvzeroa+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecX+ih];
-      if(fgUsedVars[kRPYtpcXvzeroc+ih]) 
+      if(context.fUsedVars[kRPYtpcXvzeroc+ih]) 
 	values[kRPYtpcXvzeroc+ih] = values[kTPCQvecY+ih]*values[kVZEROQvecX+6+ih];
       // Psi_TPC - Psi_VZERO A/C      
-      if(fgUsedVars[kRPdeltaVZEROAtpc+ih]) 
+      if(context.fUsedVars[kRPdeltaVZEROAtpc+ih]) 
 	values[kRPdeltaVZEROAtpc+ih] = DeltaPhi(values[kVZERORP+0*6+ih], values[kTPCRP+ih]);
-      if(fgUsedVars[kRPdeltaVZEROCtpc+ih])
+      if(context.fUsedVars[kRPdeltaVZEROCtpc+ih])
         values[kRPdeltaVZEROCtpc+ih] = DeltaPhi(values[kVZERORP+1*6+ih], values[kTPCRP+ih]);
       // TPC event planes with sub-event method
-      values[kTPCQvecXleft+ih] = eventF->Qx(EVENTPLANE::kTPCneg, ih+1);
-      values[kTPCQvecYleft+ih] = eventF->Qy(EVENTPLANE::kTPCneg, ih+1);
-      if(fgUsedVars[kTPCRPleft+ih])
+      if(context.fUsedVars[kTPCQvecXleft+ih]) values[kTPCQvecXleft+ih] = eventF->Qx(EVENTPLANE::kTPCneg, ih+1);
+      if(context.fUsedVars[kTPCQvecYleft+ih]) values[kTPCQvecYleft+ih] = eventF->Qy(EVENTPLANE::kTPCneg, ih+1);
+      if(context.fUsedVars[kTPCRPleft+ih])
 	values[kTPCRPleft+ih] = eventF->EventPlane(EVENTPLANE::kTPCneg, ih+1);
-      values[kTPCQvecXright+ih] = eventF->Qx(EVENTPLANE::kTPCpos, ih+1);
-      values[kTPCQvecYright+ih] = eventF->Qy(EVENTPLANE::kTPCpos, ih+1);
-      if(fgUsedVars[kTPCRPright+ih])
+      if(context.fUsedVars[kTPCQvecXright+ih]) values[kTPCQvecXright+ih] = eventF->Qx(EVENTPLANE::kTPCpos, ih+1);
+      if(context.fUsedVars[kTPCQvecYright+ih]) values[kTPCQvecYright+ih] = eventF->Qy(EVENTPLANE::kTPCpos, ih+1);
+      if(context.fUsedVars[kTPCRPright+ih])
         values[kTPCRPright+ih] = eventF->EventPlane(EVENTPLANE::kTPCpos, ih+1); 
-      if(fgUsedVars[kTPCsubResCos+ih]) 
+      if(context.fUsedVars[kTPCsubResCos+ih]) 
 	values[kTPCsubResCos+ih] = TMath::Cos(Double_t(ih+1)*(values[kTPCRPleft+ih]-values[kTPCRPright+ih]));
     }  // end loop over harmonics
     
@@ -1123,49 +1167,49 @@ void AliReducedVarManager::FillEventInfo(BASEEVENT* baseEvent, Float_t* values,
     Double_t vzeroChannelPhi[8] = {0.3927, 1.1781, 1.9635, 2.7489, -2.7489, -1.9635, -1.1781, -0.3927};
     
     for(Int_t ich=0; ich<64; ++ich) {
-      if(fgUsedVars[kVZEROflowV2TPC+ich])
+      if(context.fUsedVars[kVZEROflowV2TPC+ich])
 	values[kVZEROflowV2TPC+ich] = values[kVZEROChannelMult+ich]*
                                       TMath::Cos(2.0*DeltaPhi(vzeroChannelPhi[ich%8],values[kTPCRP+1]));
     } 
   }  // end if (eventF)
     
-  for(Int_t izdc=0;izdc<10;++izdc) values[kZDCnEnergyCh+izdc] = event->EnergyZDCnTree(izdc);
-  for(Int_t izdc=0;izdc<10;++izdc) values[kZDCpEnergyCh+izdc] = event->EnergyZDCpTree(izdc);
-  for(Int_t itzero=0;itzero<26;++itzero) values[kTZEROAmplitudeCh+itzero] = event->AmplitudeTZEROch(itzero);
-  for(Int_t itzero=0;itzero<3;++itzero) values[kTZEROTOF+itzero] = event->EventTZEROStartTimeTOFfirst(itzero);
-  for(Int_t itzero=0;itzero<3;++itzero) values[kTZEROTOFbest+itzero] = event->EventTZEROStartTimeTOFbest(itzero);
-  values[kTZEROzVtx] = event->VertexTZERO();
-  values[kTZEROstartTime] = event->EventTZEROStartTime();
-  values[kTZEROpileup] = event->IsPileupTZERO();
-  values[kTZEROsatellite] = event->IsSatteliteCollisionTZERO();  
-
-  values[kMultEstimatorV0M]          = event->MultEstimatorV0M();
-  values[kMultEstimatorV0A]          = event->MultEstimatorV0A();
-  values[kMultEstimatorV0C]          = event->MultEstimatorV0C();
-  values[kMultEstimatorOnlineV0M]    = event->MultEstimatorOnlineV0M();
-  values[kMultEstimatorOnlineV0A]    = event->MultEstimatorOnlineV0A();
-  values[kMultEstimatorOnlineV0C]    = event->MultEstimatorOnlineV0C();
-  values[kMultEstimatorADM]          = event->MultEstimatorADM();
-  values[kMultEstimatorADA]          = event->MultEstimatorADA();
-  values[kMultEstimatorADC]          = event->MultEstimatorADC();
-  values[kMultEstimatorSPDClusters]  = event->MultEstimatorSPDClusters();
-  values[kMultEstimatorSPDTracklets] = event->MultEstimatorSPDTracklets();
-  values[kMultEstimatorRefMult05]    = event->MultEstimatorRefMult05();
-  values[kMultEstimatorRefMult08]    = event->MultEstimatorRefMult08();
-
-  values[kMultEstimatorPercentileV0M]    = event->MultEstimatorPercentileV0M();
-  values[kMultEstimatorPercentileV0A]    = event->MultEstimatorPercentileV0A();
-  values[kMultEstimatorPercentileV0C]    = event->MultEstimatorPercentileV0C();
-  values[kMultEstimatorPercentileOnlineV0M]    = event->MultEstimatorPercentileOnlineV0M();
-  values[kMultEstimatorPercentileOnlineV0A]    = event->MultEstimatorPercentileOnlineV0A();
-  values[kMultEstimatorPercentileOnlineV0C]    = event->MultEstimatorPercentileOnlineV0C();
-  values[kMultEstimatorPercentileADM]          = event->MultEstimatorPercentileADM();
-  values[kMultEstimatorPercentileADA]          = event->MultEstimatorPercentileADA();
-  values[kMultEstimatorPercentileADC]          = event->MultEstimatorPercentileADC();
-  values[kMultEstimatorPercentileSPDClusters]  = event->MultEstimatorPercentileSPDClusters();
-  values[kMultEstimatorPercentileSPDTracklets] = event->MultEstimatorPercentileSPDTracklets();
-  values[kMultEstimatorPercentileRefMult05]    = event->MultEstimatorPercentileRefMult05();
-  values[kMultEstimatorPercentileRefMult08]    = event->MultEstimatorPercentileRefMult08();
+  for(Int_t izdc=0;izdc<10;++izdc) if(context.fUsedVars[kZDCnEnergyCh+izdc]) values[kZDCnEnergyCh+izdc] = event->EnergyZDCnTree(izdc);
+  for(Int_t izdc=0;izdc<10;++izdc) if(context.fUsedVars[kZDCpEnergyCh+izdc]) values[kZDCpEnergyCh+izdc] = event->EnergyZDCpTree(izdc);
+  for(Int_t itzero=0;itzero<26;++itzero) if(context.fUsedVars[kTZEROAmplitudeCh+itzero]) values[kTZEROAmplitudeCh+itzero] = event->AmplitudeTZEROch(itzero);
+  for(Int_t itzero=0;itzero<3;++itzero) if(context.fUsedVars[kTZEROTOF+itzero]) values[kTZEROTOF+itzero] = event->EventTZEROStartTimeTOFfirst(itzero);
+  for(Int_t itzero=0;itzero<3;++itzero) if(context.fUsedVars[kTZEROTOFbest+itzero]) values[kTZEROTOFbest+itzero] = event->EventTZEROStartTimeTOFbest(itzero);
+  if(context.fUsedVars[kTZEROzVtx]) values[kTZEROzVtx] = event->VertexTZERO();
+  if(context.fUsedVars[kTZEROstartTime]) values[kTZEROstartTime] = event->EventTZEROStartTime();
+  if(context.fUsedVars[kTZEROpileup]) values[kTZEROpileup] = event->IsPileupTZERO();
+  if(context.fUsedVars[kTZEROsatellite]) values[kTZEROsatellite] = event->IsSatteliteCollisionTZERO();  
+
+  if(context.fUsedVars[kMultEstimatorV0M]) values[kMultEstimatorV0M]          = event->MultEstimatorV0M();
+  if(context.fUsedVars[kMultEstimatorV0A]) values[kMultEstimatorV0A]          = event->MultEstimatorV0A();
+  if(context.fUsedVars[kMultEstimatorV0C]) values[kMultEstimatorV0C]          = event->MultEstimatorV0C();
+  if(context.fUsedVars[kMultEstimatorOnlineV0M]) values[kMultEstimatorOnlineV0M]    = event->MultEstimatorOnlineV0M();
+  if(context.fUsedVars[kMultEstimatorOnlineV0A]) values[kMultEstimatorOnlineV0A]    = event->MultEstimatorOnlineV0A();
+  if(context.fUsedVars[kMultEstimatorOnlineV0C]) values[kMultEstimatorOnlineV0C]    = event->MultEstimatorOnlineV0C();
+  if(context.fUsedVars[kMultEstimatorADM]) values[kMultEstimatorADM]          = event->MultEstimatorADM();
+  if(context.fUsedVars[kMultEstimatorADA]) values[kMultEstimatorADA]          = event->MultEstimatorADA();
+  if(context.fUsedVars[kMultEstimatorADC]) values[kMultEstimatorADC]          = event->MultEstimatorADC();
+  if(context.fUsedVars[kMultEstimatorSPDClusters]) values[kMultEstimatorSPDClusters]  = event->MultEstimatorSPDClusters();
+  if(context.fUsedVars[kMultEstimatorSPDTracklets]) values[kMultEstimatorSPDTracklets] = event->MultEstimatorSPDTracklets();
+  if(context.fUsedVars[kMultEstimatorRefMult05]) values[kMultEstimatorRefMult05]    = event->MultEstimatorRefMult05();
+  if(context.fUsedVars[kMultEstimatorRefMult08]) values[kMultEstimatorRefMult08]    = event->MultEstimatorRefMult08();
+
+  if(context.fUsedVars[kMultEstimatorPercentileV0M]) values[kMultEstimatorPercentileV0M]    = event->MultEstimatorPercentileV0M();
+  if(context.fUsedVars[kMultEstimatorPercentileV0A]) values[kMultEstimatorPercentileV0A]    = event->MultEstimatorPercentileV0A();
+  if(context.fUsedVars[kMultEstimatorPercentileV0C]) values[kMultEstimatorPercentileV0C]    = event->MultEstimatorPercentileV0C();
+  if(context.fUsedVars[kMultEstimatorPercentileOnlineV0M]) values[kMultEstimatorPercentileOnlineV0M]    = event->MultEstimatorPercentileOnlineV0M();
+  if(context.fUsedVars[kMultEstimatorPercentileOnlineV0A]) values[kMultEstimatorPercentileOnlineV0A]    = event->MultEstimatorPercentileOnlineV0A();
+  if(context.fUsedVars[kMultEstimatorPercentileOnlineV0C]) values[kMultEstimatorPercentileOnlineV0C]    = event->MultEstimatorPercentileOnlineV0C();
+  if(context.fUsedVars[kMultEstimatorPercentileADM]) values[kMultEstimatorPercentileADM]          = event->MultEstimatorPercentileADM();
+  if(context.fUsedVars[kMultEstimatorPercentileADA]) values[kMultEstimatorPercentileADA]          = event->MultEstimatorPercentileADA();
+  if(context.fUsedVars[kMultEstimatorPercentileADC]) values[kMultEstimatorPercentileADC]          = event->MultEstimatorPercentileADC();
+  if(context.fUsedVars[kMultEstimatorPercentileSPDClusters]) values[kMultEstimatorPercentileSPDClusters]  = event->MultEstimatorPercentileSPDClusters();
+  if(context.fUsedVars[kMultEstimatorPercentileSPDTracklets]) values[kMultEstimatorPercentileSPDTracklets] = event->MultEstimatorPercentileSPDTracklets();
+  if(context.fUsedVars[kMultEstimatorPercentileRefMult05]) values[kMultEstimatorPercentileRefMult05]    = event->MultEstimatorPercentileRefMult05();
+  if(context.fUsedVars[kMultEstimatorPercentileRefMult08]) values[kMultEstimatorPercentileRefMult08]    = event->MultEstimatorPercentileRefMult08();
 
 }
 
@@ -1175,7 +1219,7 @@ void AliReducedVarManager::FillITSlayerFlag(TRACK* track, Int_t layer, Float_t*
   // fill the ITS layer hit
   //
   values[kITSlayerHit] = -1.0*(layer+1);
-  if(fgUsedVars[kITSlayerHit] && track->ITSLayerHit(layer)) values[kITSlayerHit] = layer+1;
+  if(gReducedVarContext->fUsedVars[kITSlayerHit] && track->ITSLayerHit(layer)) values[kITSlayerHit] = layer+1;
 }
 
 //_________________________________________________________________
@@ -1184,7 +1228,7 @@ void AliReducedVarManager::FillITSsharedLayerFlag(TRACK* track, Int_t layer, Flo
    // fill the ITS layer having shared cluster
    //
    values[kITSlayerShared] = -1.0*(layer+1);
-   if(fgUsedVars[kITSlayerShared] && track->ITSLayerHit(layer) && track->ITSClusterIsShared(layer)) values[kITSlayerShared] = layer+1;
+   if(gReducedVarContext->fUsedVars[kITSlayerShared] && track->ITSLayerHit(layer) && track->ITSClusterIsShared(layer)) values[kITSlayerShared] = layer+1;
 }
 
 //_________________________________________________________________
@@ -1192,10 +1236,11 @@ void AliReducedVarManager::FillL0TriggerInputs(EVENT* event, Int_t input, Float_
   //
   // fill the L0 trigger inputs
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   values[kL0TriggerInput] = -1.0;
-  if(fgUsedVars[kL0TriggerInput] && event->L0TriggerInput(input)) values[kL0TriggerInput] = input;
+  if(context.fUsedVars[kL0TriggerInput] && event->L0TriggerInput(input)) values[kL0TriggerInput] = input;
   values[kL0TriggerInput2] = -1.0;
-  if(fgUsedVars[kL0TriggerInput2] && event->L0TriggerInput(input2)) values[kL0TriggerInput2] = input2;
+  if(context.fUsedVars[kL0TriggerInput2] && event->L0TriggerInput(input2)) values[kL0TriggerInput2] = input2;
 }
 
 
@@ -1204,10 +1249,11 @@ void AliReducedVarManager::FillL1TriggerInputs(EVENT* event, Int_t input, Float_
   //
   // fill the L1 trigger inputs
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   values[kL1TriggerInput] = -1.0;
-  if(fgUsedVars[kL1TriggerInput] && event->L1TriggerInput(input)) values[kL1TriggerInput] = input;
+  if(context.fUsedVars[kL1TriggerInput] && event->L1TriggerInput(input)) values[kL1TriggerInput] = input;
   values[kL1TriggerInput2] = -1.0;
-  if(fgUsedVars[kL1TriggerInput2] && event->L1TriggerInput(input2)) values[kL1TriggerInput2] = input2;
+  if(context.fUsedVars[kL1TriggerInput2] && event->L1TriggerInput(input2)) values[kL1TriggerInput2] = input2;
 }
 
 //_________________________________________________________________
@@ -1215,10 +1261,11 @@ void AliReducedVarManager::FillL2TriggerInputs(EVENT* event, Int_t input, Float_
   //
   // fill the L2 trigger inputs
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   values[kL2TriggerInput] = -1.0;
-  if(fgUsedVars[kL2TriggerInput] && event->L2TriggerInput(input)) values[kL2TriggerInput] = input;
+  if(context.fUsedVars[kL2TriggerInput] && event->L2TriggerInput(input)) values[kL2TriggerInput] = input;
   values[kL2TriggerInput2] = -1.0;
-  if(fgUsedVars[kL2TriggerInput2] && event->L2TriggerInput(input2)) values[kL2TriggerInput2] = input2;
+  if(context.fUsedVars[kL2TriggerInput2] && event->L2TriggerInput(input2)) values[kL2TriggerInput2] = input2;
 }
 
 //_________________________________________________________________
@@ -1227,7 +1274,7 @@ void AliReducedVarManager::FillEventTagInput(BASEEVENT* event, Int_t input, Floa
   // fill the event tag inputs
   //
   values[kEventTag] = -1.0;
-  if(fgUsedVars[kEventTag] && event->EventTag(input)) values[kEventTag] = input;
+  if(gReducedVarContext->fUsedVars[kEventTag] && event->EventTag(input)) values[kEventTag] = input;
 }
 
 //_________________________________________________________________
@@ -1236,7 +1283,7 @@ void AliReducedVarManager::FillTPCclusterBitFlag(TRACK* track, Int_t bit, Float_
   // fill the TPC cluster map
   //
   values[kTPCclusBitFired] = -1;
-  if(fgUsedVars[kTPCclusBitFired] && track->TPCClusterMapBitFired(bit)) values[kTPCclusBitFired] = bit;
+  if(gReducedVarContext->fUsedVars[kTPCclusBitFired] && track->TPCClusterMapBitFired(bit)) values[kTPCclusBitFired] = bit;
 }
 
 
@@ -1245,8 +1292,9 @@ void AliReducedVarManager::FillTrackingStatus(TRACK* p, Float_t* values) {
   //
   // Fill tracking flags
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   for(Int_t i=0; i<kNTrackingStatus; i++)
-    values[kTrackingStatus+i] = p->CheckTrackStatus(i)+10e-6;
+    if(context.fUsedVars[kTrackingStatus+i]) values[kTrackingStatus+i] = p->CheckTrackStatus(i)+10e-6;
 }
 
 
@@ -1297,8 +1345,9 @@ void AliReducedVarManager::FillEventOnlineTriggers(AliReducedEventInfo* event, F
   //
   // fill the trigger bit input
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   for(UShort_t i=0; i<kNTriggers; i++){
-    values[kOnlineTriggersFired+i] = (event->TriggerMask()&(ULong_t(1)<<i) ? 1.0 : 0.0);
+    if(context.fUsedVars[kOnlineTriggersFired+i]) values[kOnlineTriggersFired+i] = (event->TriggerMask()&(ULong_t(1)<<i) ? 1.0 : 0.0);
   }
 }
 
@@ -1308,13 +1357,14 @@ void AliReducedVarManager::FillEventOnlineTrigger(UShort_t triggerBit, Float_t*
   // fill the trigger bit input
   //  The second trigger bit (triggerBit2) is used for correlation histograms between the different trigger inputs
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   if(triggerBit>=64) return;
-  if(!fgEvent) return;
+  if(!context.fEvent) return;
   values[kOnlineTrigger] = triggerBit;
-  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(ULong_t(1)<<triggerBit) ? triggerBit : -1.0);
+  values[kOnlineTriggerFired] = (((AliReducedEventInfo*)context.fEvent)->TriggerMask()&(ULong_t(1)<<triggerBit) ? triggerBit : -1.0);
   values[kOnlineTriggerFired2] = 0.0;
   if(triggerBit<64)
-     values[kOnlineTriggerFired2] = (((AliReducedEventInfo*)fgEvent)->TriggerMask()&(ULong_t(1)<<triggerBit2) ? triggerBit2 : -1.0);
+     values[kOnlineTriggerFired2] = (((AliReducedEventInfo*)context.fEvent)->TriggerMask()&(ULong_t(1)<<triggerBit2) ? triggerBit2 : -1.0);
 }
 
 //________________________________________________________________
@@ -1339,30 +1389,31 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    //
    //  Fill pure MC truth information
    //
-   if(fgUsedVars[kPtMC]) values[kPtMC] = p->PtMC();
-   if(fgUsedVars[kPMC]) values[kPMC] = p->PMC();
-   values[kPxMC] = p->MCmom(0);
-   values[kPyMC] = p->MCmom(1);
-   values[kPzMC] = p->MCmom(2);
-   if(fgUsedVars[kThetaMC]) values[kThetaMC] = p->ThetaMC();
-   if(fgUsedVars[kEtaMC]) values[kEtaMC] = p->EtaMC();
-   if(fgUsedVars[kPhiMC]) values[kPhiMC] = p->PhiMC();
-   if(fgUsedVars[kMassMC]) {
+   AliReducedVarContext& context = *gReducedVarContext;
+   if(context.fUsedVars[kPtMC]) values[kPtMC] = p->PtMC();
+   if(context.fUsedVars[kPMC]) values[kPMC] = p->PMC();
+   if(context.fUsedVars[kPxMC]) values[kPxMC] = p->MCmom(0);
+   if(context.fUsedVars[kPyMC]) values[kPyMC] = p->MCmom(1);
+   if(context.fUsedVars[kPzMC]) values[kPzMC] = p->MCmom(2);
+   if(context.fUsedVars[kThetaMC]) values[kThetaMC] = p->ThetaMC();
+   if(context.fUsedVars[kEtaMC]) values[kEtaMC] = p->EtaMC();
+   if(context.fUsedVars[kPhiMC]) values[kPhiMC] = p->PhiMC();
+   if(context.fUsedVars[kMassMC]) {
       if(TMath::Abs(p->MCPdg(0))==443)
       values[kMassMC] = fgkPairMass[AliReducedPairInfo::kJpsiToEE];  
    }
-   if(fgUsedVars[kRapMC]) {
+   if(context.fUsedVars[kRapMC]) {
       if(TMath::Abs(p->MCPdg(0))==443)
          values[kRapMC] = p->RapidityMC(fgkPairMass[AliReducedPairInfo::kJpsiToEE]); 
    }
-  if(fgUsedVars[kRapMCAbs]) {
+  if(context.fUsedVars[kRapMCAbs]) {
     if(TMath::Abs(p->MCPdg(0))==443)
       values[kRapMCAbs] = TMath::Abs(p->RapidityMC(fgkPairMass[AliReducedPairInfo::kJpsiToEE]));
   }
 
-  if(fgUsedVars[kPseudoProperDecayTimeMC]){
-     if(fgEvent->IsA()==EVENT::Class()){
-     EVENT* eventInfo = (EVENT*)fgEvent;
+  if(context.fUsedVars[kPseudoProperDecayTimeMC]){
+     if(context.fEvent->IsA()==EVENT::Class()){
+     EVENT* eventInfo = (EVENT*)context.fEvent;
      Double_t lxyMC = ( (p->MCFreezeout(0) - eventInfo->VertexMC(0)) * p->MCmom(0) + (p->MCFreezeout(1) - eventInfo->VertexMC(1)) * p->MCmom(1) ) / p->PtMC();
      values[kPseudoProperDecayTimeMC] = lxyMC * (fgkPairMass[AliReducedPairInfo::kJpsiToEE])/p->PtMC();
      }
@@ -1370,11 +1421,11 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
    // compute MC truth variables from decay legs, e.g. from the 2 electrons of a J/psi decay
    // NOTE: this may be different from the kinematics of the mother, if not all decay legs are considered / tracked
    Bool_t requestMCfromLegs = kFALSE;
-   if(fgUsedVars[kPtMCfromLegs] || fgUsedVars[kPMCfromLegs] || 
-      fgUsedVars[kPxMCfromLegs] || fgUsedVars[kPyMCfromLegs] || fgUsedVars[kPzMCfromLegs] ||
-      fgUsedVars[kThetaMCfromLegs] || fgUsedVars[kEtaMCfromLegs] || fgUsedVars[kPhiMCfromLegs] ||
-      fgUsedVars[kMassMCfromLegs] || fgUsedVars[kRapMCfromLegs] ||
-      fgUsedVars[kPairLegPtMC] || fgUsedVars[kPairLegPtMC+1] || fgUsedVars[kPairLegPtMCSum]) 
+   if(context.fUsedVars[kPtMCfromLegs] || context.fUsedVars[kPMCfromLegs] || 
+      context.fUsedVars[kPxMCfromLegs] || context.fUsedVars[kPyMCfromLegs] || context.fUsedVars[kPzMCfromLegs] ||
+      context.fUsedVars[kThetaMCfromLegs] || context.fUsedVars[kEtaMCfromLegs] || context.fUsedVars[kPhiMCfromLegs] ||
+      context.fUsedVars[kMassMCfromLegs] || context.fUsedVars[kRapMCfromLegs] ||
+      context.fUsedVars[kPairLegPtMC] || context.fUsedVars[kPairLegPtMC+1] || context.fUsedVars[kPairLegPtMCSum]) 
       requestMCfromLegs = kTRUE;
    
    if(leg1 && leg2 && requestMCfromLegs) {
@@ -1415,14 +1466,12 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* p, Float_t* values, TRACK* leg
       }
    }
    
-   values[kPdgMC] = p->MCPdg(0);
-   values[kPdgMC+1] = p->MCPdg(1);
-   values[kPdgMC+2] = p->MCPdg(2);
-   values[kPdgMC+3] = p->MCPdg(3);
+   for(Int_t i=0; i<4; ++i)
+      if(context.fUsedVars[kPdgMC+i]) values[kPdgMC+i] = p->MCPdg(i);
    
    // polarization variables
    Bool_t usePolarization=kFALSE;
-   if(leg1 && leg2 && (fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE]))
+   if(leg1 && leg2 && (context.fUsedVars[kPairThetaCS] || context.fUsedVars[kPairThetaHE] || context.fUsedVars[kPairPhiCS] || context.fUsedVars[kPairPhiHE]))
       usePolarization = kTRUE;
    if(usePolarization)
       GetThetaPhiCM(leg1, leg2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
@@ -1436,59 +1485,74 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* leg1, TRACK* leg2, Float_t* va
    // NOTE: This function is done specifically for pairs of MC particles which do not have any mother in the stack, e.g. electrons from gamma-gamma processes produced with Starlight
    //      All quantities are computed just from the leg kinematics
    //
+   AliReducedVarContext& context = *gReducedVarContext;
    
-   values[kPxMCfromLegs] = leg1->MCmom(0) + leg2->MCmom(0);
-   values[kPyMCfromLegs] = leg1->MCmom(1) + leg2->MCmom(1);
-   values[kPzMCfromLegs] = leg1->MCmom(2) + leg2->MCmom(2);
-   values[kPtMCfromLegs] = TMath::Sqrt(values[kPxMCfromLegs]*values[kPxMCfromLegs]+values[kPyMCfromLegs]*values[kPyMCfromLegs]);
-   values[kPMCfromLegs] = TMath::Sqrt(values[kPtMCfromLegs]*values[kPtMCfromLegs]+values[kPzMCfromLegs]*values[kPzMCfromLegs]);
-   values[kThetaMCfromLegs] = (values[kPMCfromLegs]>=1.0e-6 ? TMath::ACos(values[kPzMCfromLegs]/values[kPMCfromLegs]) : 0.0);
-   values[kEtaMCfromLegs] = TMath::Tan(0.5*values[kThetaMCfromLegs]);
-   values[kEtaMCfromLegs] = (values[kEtaMCfromLegs]>1.0e-6 ? -1.0*TMath::Log(values[kEtaMCfromLegs]) : 0.0);
-   values[kPhiMCfromLegs] = TMath::ATan2(values[kPyMCfromLegs],values[kPxMCfromLegs]);
-   values[kPhiMCfromLegs] = (values[kPhiMCfromLegs]<0.0 ? (TMath::TwoPi()+values[kPhiMCfromLegs]) : values[kPhiMCfromLegs]);
-   values[kPairLegPtMC+0] = TMath::Sqrt(leg1->MCmom(0)*leg1->MCmom(0)+leg1->MCmom(1)*leg1->MCmom(1));
-   values[kPairLegPtMC+1] = TMath::Sqrt(leg2->MCmom(0)*leg2->MCmom(0)+leg2->MCmom(1)*leg2->MCmom(1));
-   values[kPairLegPtMCSum] = values[kPairLegPtMC]+values[kPairLegPtMC+1];
+   // all the variables below are computed from the same leg sums, skip them if none is used
+   Bool_t requestMCfromLegs = kFALSE;
+   if(context.fUsedVars[kPtMCfromLegs] || context.fUsedVars[kPMCfromLegs] || 
+      context.fUsedVars[kPxMCfromLegs] || context.fUsedVars[kPyMCfromLegs] || context.fUsedVars[kPzMCfromLegs] ||
+      context.fUsedVars[kThetaMCfromLegs] || context.fUsedVars[kEtaMCfromLegs] || context.fUsedVars[kPhiMCfromLegs] ||
+      context.fUsedVars[kMassMCfromLegs] || context.fUsedVars[kRapMCfromLegs] ||
+      context.fUsedVars[kPairLegPtMC] || context.fUsedVars[kPairLegPtMC+1] || context.fUsedVars[kPairLegPtMCSum] ||
+      context.fUsedVars[kPtMC] || context.fUsedVars[kPMC] ||
+      context.fUsedVars[kPxMC] || context.fUsedVars[kPyMC] || context.fUsedVars[kPzMC] ||
+      context.fUsedVars[kThetaMC] || context.fUsedVars[kEtaMC] || context.fUsedVars[kPhiMC] ||
+      context.fUsedVars[kMassMC] || context.fUsedVars[kRapMC] || context.fUsedVars[kRapMCAbs])
+      requestMCfromLegs = kTRUE;
    
-   // NOTE: for other particle species, check the PDG code of the particles
-   Float_t m1 = fgkParticleMass[kElectron];
-   Float_t m2 = fgkParticleMass[kElectron];
-   values[kMassMCfromLegs] = m1*m1+m2*m2 + 
-      2.0*(TMath::Sqrt(m1*m1+leg1->P()*leg1->P())*TMath::Sqrt(m2*m2+leg2->P()*leg2->P()) - 
-            leg1->Px()*leg2->Px() - leg1->Py()*leg2->Py() - leg1->Pz()*leg2->Pz());
-   if(values[kMassMCfromLegs]<0.0) {
-      cout << "FillMCTruthInfo(track1, track2, values): Warning: Very small squared mass found. "
-      << "   Could be negative due to resolution of Float_t so it will be set to a small positive value." << endl; 
-      cout << "   mass^2: " << values[kMassMCfromLegs] << endl;
-      cout << "p1(p,x,y,z): " << leg1->P() << ", " << leg1->Px() << ", " << leg1->Py() << ", " << leg1->Pz() << endl;
-      cout << "p2(p,x,y,z): " << leg2->P() << ", " << leg2->Px() << ", " << leg2->Py() << ", " << leg2->Pz() << endl;
-      values[kMassMCfromLegs] = 0.0;
-   }
-   else
-      values[kMassMCfromLegs] = TMath::Sqrt(values[kMassMCfromLegs]);
-   values[kMassMC] = values[kMassMCfromLegs];
+   if(requestMCfromLegs) {
+      values[kPxMCfromLegs] = leg1->MCmom(0) + leg2->MCmom(0);
+      values[kPyMCfromLegs] = leg1->MCmom(1) + leg2->MCmom(1);
+      values[kPzMCfromLegs] = leg1->MCmom(2) + leg2->MCmom(2);
+      values[kPtMCfromLegs] = TMath::Sqrt(values[kPxMCfromLegs]*values[kPxMCfromLegs]+values[kPyMCfromLegs]*values[kPyMCfromLegs]);
+      values[kPMCfromLegs] = TMath::Sqrt(values[kPtMCfromLegs]*values[kPtMCfromLegs]+values[kPzMCfromLegs]*values[kPzMCfromLegs]);
+      values[kThetaMCfromLegs] = (values[kPMCfromLegs]>=1.0e-6 ? TMath::ACos(values[kPzMCfromLegs]/values[kPMCfromLegs]) : 0.0);
+      values[kEtaMCfromLegs] = TMath::Tan(0.5*values[kThetaMCfromLegs]);
+      values[kEtaMCfromLegs] = (values[kEtaMCfromLegs]>1.0e-6 ? -1.0*TMath::Log(values[kEtaMCfromLegs]) : 0.0);
+      values[kPhiMCfromLegs] = TMath::ATan2(values[kPyMCfromLegs],values[kPxMCfromLegs]);
+      values[kPhiMCfromLegs] = (values[kPhiMCfromLegs]<0.0 ? (TMath::TwoPi()+values[kPhiMCfromLegs]) : values[kPhiMCfromLegs]);
+      values[kPairLegPtMC+0] = TMath::Sqrt(leg1->MCmom(0)*leg1->MCmom(0)+leg1->MCmom(1)*leg1->MCmom(1));
+      values[kPairLegPtMC+1] = TMath::Sqrt(leg2->MCmom(0)*leg2->MCmom(0)+leg2->MCmom(1)*leg2->MCmom(1));
+      values[kPairLegPtMCSum] = values[kPairLegPtMC]+values[kPairLegPtMC+1];
    
-   Float_t e = TMath::Sqrt(values[kPMCfromLegs]*values[kPMCfromLegs] + values[kMassMCfromLegs] * values[kMassMCfromLegs]);
-   Float_t factor = e - values[kPzMCfromLegs];
-   values[kRapMCfromLegs] = (TMath::Abs(factor)>1.0e-6 ? (e+values[kPzMCfromLegs])/factor : 0.0);
-   values[kRapMCfromLegs] = (values[kRapMCfromLegs]>1.0e-6 ? 0.5*TMath::Log(values[kRapMCfromLegs]) : 0.0);
+      // NOTE: for other particle species, check the PDG code of the particles
+      Float_t m1 = fgkParticleMass[kElectron];
+      Float_t m2 = fgkParticleMass[kElectron];
+      values[kMassMCfromLegs] = m1*m1+m2*m2 + 
+         2.0*(TMath::Sqrt(m1*m1+leg1->P()*leg1->P())*TMath::Sqrt(m2*m2+leg2->P()*leg2->P()) - 
+               leg1->Px()*leg2->Px() - leg1->Py()*leg2->Py() - leg1->Pz()*leg2->Pz());
+      if(values[kMassMCfromLegs]<0.0) {
+         cout << "FillMCTruthInfo(track1, track2, values): Warning: Very small squared mass found. "
+         << "   Could be negative due to resolution of Float_t so it will be set to a small positive value." << endl; 
+         cout << "   mass^2: " << values[kMassMCfromLegs] << endl;
+         cout << "p1(p,x,y,z): " << leg1->P() << ", " << leg1->Px() << ", " << leg1->Py() << ", " << leg1->Pz() << endl;
+         cout << "p2(p,x,y,z): " << leg2->P() << ", " << leg2->Px() << ", " << leg2->Py() << ", " << leg2->Pz() << endl;
+         values[kMassMCfromLegs] = 0.0;
+      }
+      else
+         values[kMassMCfromLegs] = TMath::Sqrt(values[kMassMCfromLegs]);
    
-   values[kPtMC] = values[kPtMCfromLegs];
-   values[kPMC] = values[kPMCfromLegs];
-   values[kPxMC] = values[kPxMCfromLegs];
-   values[kPyMC] = values[kPyMCfromLegs];
-   values[kPzMC] = values[kPzMCfromLegs];
-   values[kThetaMC] = values[kThetaMCfromLegs];
-   values[kEtaMC] = values[kEtaMCfromLegs];
-   values[kPhiMC] = values[kPhiMCfromLegs];
-   values[kMassMC] = values[kMassMCfromLegs];
-   values[kRapMC] = values[kRapMCfromLegs];
-   values[kRapMCAbs] = TMath::Abs(values[kRapMCfromLegs]); 
+      Float_t e = TMath::Sqrt(values[kPMCfromLegs]*values[kPMCfromLegs] + values[kMassMCfromLegs] * values[kMassMCfromLegs]);
+      Float_t factor = e - values[kPzMCfromLegs];
+      values[kRapMCfromLegs] = (TMath::Abs(factor)>1.0e-6 ? (e+values[kPzMCfromLegs])/factor : 0.0);
+      values[kRapMCfromLegs] = (values[kRapMCfromLegs]>1.0e-6 ? 0.5*TMath::Log(values[kRapMCfromLegs]) : 0.0);
+
+      if(context.fUsedVars[kPtMC]) values[kPtMC] = values[kPtMCfromLegs];
+      if(context.fUsedVars[kPMC]) values[kPMC] = values[kPMCfromLegs];
+      if(context.fUsedVars[kPxMC]) values[kPxMC] = values[kPxMCfromLegs];
+      if(context.fUsedVars[kPyMC]) values[kPyMC] = values[kPyMCfromLegs];
+      if(context.fUsedVars[kPzMC]) values[kPzMC] = values[kPzMCfromLegs];
+      if(context.fUsedVars[kThetaMC]) values[kThetaMC] = values[kThetaMCfromLegs];
+      if(context.fUsedVars[kEtaMC]) values[kEtaMC] = values[kEtaMCfromLegs];
+      if(context.fUsedVars[kPhiMC]) values[kPhiMC] = values[kPhiMCfromLegs];
+      if(context.fUsedVars[kMassMC]) values[kMassMC] = values[kMassMCfromLegs];
+      if(context.fUsedVars[kRapMC]) values[kRapMC] = values[kRapMCfromLegs];
+      if(context.fUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(values[kRapMCfromLegs]);
+   }
       
    // polarization variables
    Bool_t usePolarization=kFALSE;
-   if(leg1 && leg2 && (fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE]))
+   if(leg1 && leg2 && (context.fUsedVars[kPairThetaCS] || context.fUsedVars[kPairThetaHE] || context.fUsedVars[kPairPhiCS] || context.fUsedVars[kPairPhiHE]))
       usePolarization = kTRUE;
    if(usePolarization)
       GetThetaPhiCM(leg1, leg2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
@@ -1500,35 +1564,36 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   //
   // fill track information
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   
   // Fill base track information
-  if(fgUsedVars[kPt])        values[kPt]        = p->Pt();
-  if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
-  if(fgUsedVars[kOneOverSqrtPt]) {
+  if(context.fUsedVars[kPt])        values[kPt]        = p->Pt();
+  if(context.fUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+  if(context.fUsedVars[kOneOverSqrtPt]) {
     values[kOneOverSqrtPt] = values[kPt] > 0. ? 1./TMath::Sqrt(values[kPt]) : 999.;
   }
-  if(fgUsedVars[kP])         values[kP]         = p->P();
-  if(fgUsedVars[kPx])        values[kPx]        = p->Px();
-  if(fgUsedVars[kPy])        values[kPy]        = p->Py();
-  if(fgUsedVars[kPz])        values[kPz]        = p->Pz();
-  if(fgUsedVars[kTheta])     values[kTheta]     = p->Theta();
-  if(fgUsedVars[kPhi])       values[kPhi]       = p->Phi();
-  if(fgUsedVars[kEta])       values[kEta]       = p->Eta();
+  if(context.fUsedVars[kP])         values[kP]         = p->P();
+  if(context.fUsedVars[kPx])        values[kPx]        = p->Px();
+  if(context.fUsedVars[kPy])        values[kPy]        = p->Py();
+  if(context.fUsedVars[kPz])        values[kPz]        = p->Pz();
+  if(context.fUsedVars[kTheta])     values[kTheta]     = p->Theta();
+  if(context.fUsedVars[kPhi])       values[kPhi]       = p->Phi();
+  if(context.fUsedVars[kEta])       values[kEta]       = p->Eta();
   for(Int_t ih=1; ih<=6; ++ih) {
-     if(fgUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
-     if(fgUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
+     if(context.fUsedVars[kCosNPhi+ih-1]) values[kCosNPhi+ih-1] = TMath::Cos(p->Phi()*ih);
+     if(context.fUsedVars[kSinNPhi+ih-1]) values[kSinNPhi+ih-1] = TMath::Sin(p->Phi()*ih);
   }
-  values[kCharge] = p->Charge();
+  if(context.fUsedVars[kCharge]) values[kCharge] = p->Charge();
   
   //pair efficiency variables
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
-    Int_t binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]);
+  if((context.fUsedVars[kPairEff] || context.fUsedVars[kOneOverPairEff] || context.fUsedVars[kOneOverPairEffSq]) && context.fPairEffMap) {
+    Int_t binX = context.fPairEffMap->GetXaxis()->FindBin(values[context.fEffMapVarDependencyX]);
     if(binX==0) binX = 1;
-    if(binX==fgPairEffMap->GetXaxis()->GetNbins()+1) binX -= 1;
-    Int_t binY = fgPairEffMap->GetYaxis()->FindBin(values[fgEffMapVarDependencyY]);
+    if(binX==context.fPairEffMap->GetXaxis()->GetNbins()+1) binX -= 1;
+    Int_t binY = context.fPairEffMap->GetYaxis()->FindBin(values[context.fEffMapVarDependencyY]);
     if(binY==0) binY=1;
-    if(binY==fgPairEffMap->GetYaxis()->GetNbins()+1) binY -= 1;
-    Float_t pairEff = fgPairEffMap->GetBinContent(binX, binY);
+    if(binY==context.fPairEffMap->GetYaxis()->GetNbins()+1) binY -= 1;
+    Float_t pairEff = context.fPairEffMap->GetBinContent(binX, binY);
     Float_t oneOverPairEff = 1;
     if (pairEff > 1.0e-6) oneOverPairEff = 1/pairEff;
     values[kPairEff] = pairEff;
@@ -1539,17 +1604,17 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   // Fill VZERO flow variables
   for(Int_t iVZEROside=0; iVZEROside<3; ++iVZEROside) {
      for(Int_t ih=0; ih<6; ++ih) {
-        if(fgUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
+        if(context.fUsedVars[kVZEROFlowVn+iVZEROside*6+ih])
            values[kVZEROFlowVn+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
-        if(fgUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
+        if(context.fUsedVars[kVZEROFlowSine+iVZEROside*6+ih])
            values[kVZEROFlowSine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
         if(iVZEROside<2) {
-           if(fgUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
+           if(context.fUsedVars[kVZEROuQ+iVZEROside*6+ih]) {
               values[kVZEROuQ+iVZEROside*6+ih] = TMath::Cos((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
               values[kVZEROuQ+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
               values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
            }
-           if(fgUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
+           if(context.fUsedVars[kVZEROuQsine+iVZEROside*6+ih]) {
               values[kVZEROuQsine+iVZEROside*6+ih] = TMath::Sin((values[kPhi]-values[kVZERORP+iVZEROside*6+ih])*(ih+1));
               values[kVZEROuQsine+iVZEROside*6+ih] *= TMath::Sqrt(values[kVZEROQvecX+iVZEROside*6+ih]*values[kVZEROQvecX+iVZEROside*6+ih] +
               values[kVZEROQvecY+iVZEROside*6+ih]*values[kVZEROQvecY+iVZEROside*6+ih]); 
@@ -1562,10 +1627,10 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   // Subtract the q vector of the track or of the pair legs from the event q-vector 
   Bool_t tpcEPUsed = kFALSE;
   for(Int_t ih=0; ih<6; ++ih) {
-     if(fgUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
-     if(fgUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
+     if(context.fUsedVars[kTPCFlowVn+ih]) {tpcEPUsed = kTRUE; break;}
+     if(context.fUsedVars[kTPCFlowSine+ih]) {tpcEPUsed = kTRUE; break;}
+     if(context.fUsedVars[kTPCuQ+ih]) {tpcEPUsed = kTRUE; break;}
+     if(context.fUsedVars[kTPCuQsine+ih]) {tpcEPUsed = kTRUE; break;}
   }
 
   if(tpcEPUsed) {
@@ -1573,7 +1638,7 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 //      Double_t qVec[6][2] = {{0.0}};
 //      for(Int_t ih=0; ih<6; ++ih) {qVec[ih][0]=values[kTPCQvecXtotal+ih]; qVec[ih][1]=values[kTPCQvecYtotal+ih];}
 //      EVENT* eventInfo = NULL;
-//      if(fgEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)fgEvent;
+//      if(context.fEvent->IsA()==EVENT::Class()) eventInfo = (EVENT*)context.fEvent;
 //      if((p->IsA() == AliReducedTrackInfo::Class()) && eventInfo) {
 //         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,-0.8,-0.5*fgkTPCQvecRapGap);
 //         eventInfo->SubtractParticleFromQvector((AliReducedTrackInfo*)p,qVec,EVENTPLANE::kTPC,0.5*fgkTPCQvecRapGap,0.8);
@@ -1593,15 +1658,15 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 //         tpcEPsubtracted[ih] = TMath::ATan2(qVec[ih][1], qVec[ih][0])/Double_t(ih+1);
 //      for(Int_t ih=0; ih<6; ++ih) {
 //         // vn using Psi_n
-//         if(fgUsedVars[kTPCFlowVn+ih])
+//         if(context.fUsedVars[kTPCFlowVn+ih])
 //            values[kTPCFlowVn+ih] = TMath::Cos(DeltaPhi(values[kPhi],tpcEPsubtracted[ih])*(ih+1));
-//         if(fgUsedVars[kTPCFlowSine+ih]) 
+//         if(context.fUsedVars[kTPCFlowSine+ih]) 
 //            values[kTPCFlowSine+ih] = TMath::Sin(DeltaPhi(values[kPhi],tpcEPsubtracted[ih])*(ih+1));
-//         if(fgUsedVars[kTPCuQ+ih]) {
+//         if(context.fUsedVars[kTPCuQ+ih]) {
 //            values[kTPCuQ+ih] = TMath::Cos((values[kPhi]-tpcEPsubtracted[ih])*(ih+1));
 //            values[kTPCuQ+ih] *= TMath::Sqrt(qVec[ih][0]*qVec[ih][0] + qVec[ih][1]*qVec[ih][1]);
 //         }
-//         if(fgUsedVars[kTPCuQsine+ih]) {
+//         if(context.fUsedVars[kTPCuQsine+ih]) {
 //            values[kTPCuQsine+ih] = TMath::Sin((values[kPhi]-tpcEPsubtracted[ih])*(ih+1));
 //            values[kTPCuQsine+ih] *= TMath::Sqrt(qVec[ih][0]*qVec[ih][0] + qVec[ih][1]*qVec[ih][1]);
 //         }
@@ -1609,15 +1674,15 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
 
         for(Int_t ih=0; ih<6; ++ih) {
         // vn using Psi_n
-        if(fgUsedVars[kTPCFlowVn+ih])
+        if(context.fUsedVars[kTPCFlowVn+ih])
            values[kTPCFlowVn+ih] = TMath::Cos(DeltaPhi(values[kPhi],values[kTPCRPtree+ih])*(ih+1));
-        if(fgUsedVars[kTPCFlowSine+ih]) 
+        if(context.fUsedVars[kTPCFlowSine+ih]) 
            values[kTPCFlowSine+ih] = TMath::Sin(DeltaPhi(values[kPhi],values[kTPCRPtree+ih])*(ih+1));
-        if(fgUsedVars[kTPCuQ+ih]) {
+        if(context.fUsedVars[kTPCuQ+ih]) {
            values[kTPCuQ+ih] = TMath::Cos((values[kPhi]-values[kTPCRPtree+ih])*(ih+1));
            values[kTPCuQ+ih] *= TMath::Sqrt(values[kVZEROQvecX+ih]*values[kVZEROQvecX+ih] + values[kVZEROQvecY+ih]*values[kVZEROQvecY+ih]);
         }
-        if(fgUsedVars[kTPCuQsine+ih]) {
+        if(context.fUsedVars[kTPCuQsine+ih]) {
            values[kTPCuQsine+ih] = TMath::Sin((values[kPhi]-values[kTPCRPtree+ih])*(ih+1));
            values[kTPCuQsine+ih] *= TMath::Sqrt(values[kVZEROQvecX+ih]*values[kVZEROQvecX+ih] + values[kVZEROQvecY+ih]*values[kVZEROQvecY+ih]);
         }
@@ -1627,88 +1692,91 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   if(p->IsA()!=TRACK::Class()) return;
   TRACK* pinfo = (TRACK*)p;
 
-  values[kPtTPC]       = pinfo->PtTPC();
-  values[kTrackLength] = pinfo->TrackLength();
-  values[kChi2TPCConstrainedVsGlobal] = pinfo->Chi2TPCConstrainedVsGlobal();
-  values[kMassUsedForTracking] = pinfo->MassForTracking();
-  values[kPhiTPC]      = pinfo->PhiTPC();
-  values[kEtaTPC]      = pinfo->EtaTPC();
-  values[kPin]         = pinfo->Pin();
-  values[kDcaXY]       = pinfo->DCAxy();
-  values[kDcaZ]        = pinfo->DCAz();
-  values[kDcaXYTPC]    = pinfo->DCAxyTPC();
-  values[kDcaZTPC]     = pinfo->DCAzTPC();
-
-  if(fgUsedVars[kITSncls]) values[kITSncls] = pinfo->ITSncls();
-  values[kITSsignal] = pinfo->ITSsignal();
-  values[kITSchi2] = pinfo->ITSchi2();
-
-  if(fgUsedVars[kITSnclsShared]) values[kITSnclsShared] = pinfo->ITSnSharedCls();
-  values[kTPCncls] = pinfo->TPCncls();
-
-  if(fgUsedVars[kNclsSFracITS])
+  if(context.fUsedVars[kPtTPC])       values[kPtTPC]       = pinfo->PtTPC();
+  if(context.fUsedVars[kTrackLength]) values[kTrackLength] = pinfo->TrackLength();
+  if(context.fUsedVars[kChi2TPCConstrainedVsGlobal]) values[kChi2TPCConstrainedVsGlobal] = pinfo->Chi2TPCConstrainedVsGlobal();
+  if(context.fUsedVars[kMassUsedForTracking]) values[kMassUsedForTracking] = pinfo->MassForTracking();
+  if(context.fUsedVars[kPhiTPC])      values[kPhiTPC]      = pinfo->PhiTPC();
+  if(context.fUsedVars[kEtaTPC])      values[kEtaTPC]      = pinfo->EtaTPC();
+  if(context.fUsedVars[kPin])         values[kPin]         = pinfo->Pin();
+  if(context.fUsedVars[kDcaXY])       values[kDcaXY]       = pinfo->DCAxy();
+  if(context.fUsedVars[kDcaZ])        values[kDcaZ]        = pinfo->DCAz();
+  if(context.fUsedVars[kDcaXYTPC])    values[kDcaXYTPC]    = pinfo->DCAxyTPC();
+  if(context.fUsedVars[kDcaZTPC])     values[kDcaZTPC]     = pinfo->DCAzTPC();
+
+  if(context.fUsedVars[kITSncls]) values[kITSncls] = pinfo->ITSncls();
+  if(context.fUsedVars[kITSsignal]) values[kITSsignal] = pinfo->ITSsignal();
+  if(context.fUsedVars[kITSchi2]) values[kITSchi2] = pinfo->ITSchi2();
+
+  if(context.fUsedVars[kITSnclsShared]) values[kITSnclsShared] = pinfo->ITSnSharedCls();
+  if(context.fUsedVars[kTPCncls]) values[kTPCncls] = pinfo->TPCncls();
+
+  if(context.fUsedVars[kNclsSFracITS])
   values[kNclsSFracITS] = (pinfo-> ITSncls()>0 ? Float_t (pinfo->ITSnSharedCls())/Float_t(pinfo->ITSncls()) :0.0) ;
-  if(fgUsedVars[kTPCnclsRatio]) 
+  if(context.fUsedVars[kTPCnclsRatio]) 
     values[kTPCnclsRatio] = (pinfo->TPCFindableNcls()>0 ? Float_t(pinfo->TPCncls())/Float_t(pinfo->TPCFindableNcls()) : 0.0);
-  if(fgUsedVars[kTPCnclsRatio2]) 
+  if(context.fUsedVars[kTPCnclsRatio2]) 
     values[kTPCnclsRatio2] = (pinfo->TPCCrossedRows()>0 ? Float_t(pinfo->TPCncls())/Float_t(pinfo->TPCCrossedRows()) : 0.0);
 
-  if(fgUsedVars[kTPCcrossedRowsOverFindableClusters]) { 
+  if(context.fUsedVars[kTPCcrossedRowsOverFindableClusters]) { 
      if(pinfo->TPCFindableNcls()>0)
        values[kTPCcrossedRowsOverFindableClusters] = Float_t(pinfo->TPCCrossedRows()) / Float_t(pinfo->TPCFindableNcls());
      else 
         values[kTPCcrossedRowsOverFindableClusters] = 0.0;
   }
-  if(fgUsedVars[kTPCnclsSharedRatio]) {
+  if(context.fUsedVars[kTPCnclsSharedRatio]) {
      if(pinfo->TPCncls()>0) 
         values[kTPCnclsSharedRatio] = Float_t(pinfo->TPCnclsShared()) / Float_t(pinfo->TPCncls());
      else
         values[kTPCnclsSharedRatio] = 0.0;
   }
 
-  if(fgUsedVars[kTPCnclsRatio3])
+  if(context.fUsedVars[kTPCnclsRatio3])
     values[kTPCnclsRatio3] = (pinfo->TPCFindableNcls()>0 ? Float_t(pinfo->TPCCrossedRows())/Float_t(pinfo->TPCFindableNcls()) : 0.0);
 
-  values[kTPCnclsF]       = pinfo->TPCFindableNcls();
-  values[kTPCnclsShared]  = pinfo->TPCnclsShared();
-  values[kTPCcrossedRows] = pinfo->TPCCrossedRows();
-  values[kTPCsignal]      = pinfo->TPCsignal();
-  values[kTPCsignalN]     = pinfo->TPCsignalN();
+  if(context.fUsedVars[kTPCnclsF])       values[kTPCnclsF]       = pinfo->TPCFindableNcls();
+  if(context.fUsedVars[kTPCnclsShared])  values[kTPCnclsShared]  = pinfo->TPCnclsShared();
+  if(context.fUsedVars[kTPCcrossedRows]) values[kTPCcrossedRows] = pinfo->TPCCrossedRows();
+  if(context.fUsedVars[kTPCsignal])      values[kTPCsignal]      = pinfo->TPCsignal();
+  if(context.fUsedVars[kTPCsignalN])     values[kTPCsignalN]     = pinfo->TPCsignalN();
   for(Int_t i=0; i<4; ++i) {
-     values[kTPCdEdxQmax+i] = pinfo->TPCdEdxInfoQmax(i);
-     values[kTPCdEdxQtot+i] = pinfo->TPCdEdxInfoQtot(i);
-     values[kTPCdEdxQmaxOverQtot+i] = ( values[kTPCdEdxQtot+i]>1.0e-7 ? values[kTPCdEdxQmax+i] / values[kTPCdEdxQtot+i] : -999. );
+     if(context.fUsedVars[kTPCdEdxQmax+i]) values[kTPCdEdxQmax+i] = pinfo->TPCdEdxInfoQmax(i);
+     if(context.fUsedVars[kTPCdEdxQtot+i]) values[kTPCdEdxQtot+i] = pinfo->TPCdEdxInfoQtot(i);
+     if(context.fUsedVars[kTPCdEdxQmaxOverQtot+i]) {
+        Float_t qtot = pinfo->TPCdEdxInfoQtot(i);
+        values[kTPCdEdxQmaxOverQtot+i] = ( qtot>1.0e-7 ? pinfo->TPCdEdxInfoQmax(i) / qtot : -999. );
+     }
   }
-  values[kTPCchi2] = pinfo->TPCchi2();
-  if(fgUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
-  if(fgUsedVars[kTPCclustersPerBit]) {
+  if(context.fUsedVars[kTPCchi2]) values[kTPCchi2] = pinfo->TPCchi2();
+  if(context.fUsedVars[kTPCNclusBitsFired]) values[kTPCNclusBitsFired] = pinfo->TPCClusterMapBitsFired();
+  if(context.fUsedVars[kTPCclustersPerBit]) {
     Int_t nbits = pinfo->TPCClusterMapBitsFired();
-    values[kTPCclustersPerBit] = (nbits>0 ? values[kTPCncls]/Float_t(nbits) : 0.0);
+    values[kTPCclustersPerBit] = (nbits>0 ? Float_t(pinfo->TPCncls())/Float_t(nbits) : 0.0);
   }
 
-  values[kTOFbeta] = pinfo->TOFbeta();
-  values[kTOFdeltaBC] = pinfo->TOFdeltaBC();
-  values[kTOFtime] = pinfo->TOFtime();
-  values[kTOFdx] = pinfo->TOFdx();
-  values[kTOFdz] = pinfo->TOFdz();
-  values[kTOFmismatchProbability] = pinfo->TOFmismatchProbab();
-  values[kTOFchi2] = pinfo->TOFchi2();
+  if(context.fUsedVars[kTOFbeta]) values[kTOFbeta] = pinfo->TOFbeta();
+  if(context.fUsedVars[kTOFdeltaBC]) values[kTOFdeltaBC] = pinfo->TOFdeltaBC();
+  if(context.fUsedVars[kTOFtime]) values[kTOFtime] = pinfo->TOFtime();
+  if(context.fUsedVars[kTOFdx]) values[kTOFdx] = pinfo->TOFdx();
+  if(context.fUsedVars[kTOFdz]) values[kTOFdz] = pinfo->TOFdz();
+  if(context.fUsedVars[kTOFmismatchProbability]) values[kTOFmismatchProbability] = pinfo->TOFmismatchProbab();
+  if(context.fUsedVars[kTOFchi2]) values[kTOFchi2] = pinfo->TOFchi2();
 
   for(Int_t specie=kElectron; specie<=kProton; ++specie) {
-    values[kITSnSig+specie] = pinfo->ITSnSig(specie);
-    values[kTPCnSig+specie] = pinfo->TPCnSig(specie);
-    values[kTOFnSig+specie] = pinfo->TOFnSig(specie);
-    values[kBayes+specie]   = pinfo->GetBayesProb(specie);
+    if(context.fUsedVars[kITSnSig+specie]) values[kITSnSig+specie] = pinfo->ITSnSig(specie);
+    if(context.fUsedVars[kTPCnSig+specie]) values[kTPCnSig+specie] = pinfo->TPCnSig(specie);
+    if(context.fUsedVars[kTOFnSig+specie]) values[kTOFnSig+specie] = pinfo->TOFnSig(specie);
+    if(context.fUsedVars[kBayes+specie])   values[kBayes+specie]   = pinfo->GetBayesProb(specie);
   }
-  if(fgUsedVars[kTPCnSigCorrected+kElectron] && fgTPCelectronCentroidMap && fgTPCelectronWidthMap) {
-     Int_t binX = fgTPCelectronCentroidMap->GetXaxis()->FindBin(values[fgVarDependencyX]);
+  if(context.fUsedVars[kTPCnSigCorrected+kElectron] && context.fTPCelectronCentroidMap && context.fTPCelectronWidthMap) {
+     Int_t binX = context.fTPCelectronCentroidMap->GetXaxis()->FindBin(values[context.fVarDependencyX]);
      if(binX==0) binX = 1;
-     if(binX==fgTPCelectronCentroidMap->GetXaxis()->GetNbins()+1) binX -= 1;
-     Int_t binY = fgTPCelectronCentroidMap->GetYaxis()->FindBin(values[fgVarDependencyY]);
+     if(binX==context.fTPCelectronCentroidMap->GetXaxis()->GetNbins()+1) binX -= 1;
+     Int_t binY = context.fTPCelectronCentroidMap->GetYaxis()->FindBin(values[context.fVarDependencyY]);
      if(binY==0) binY=1;
-     if(binY==fgTPCelectronCentroidMap->GetYaxis()->GetNbins()+1) binY -= 1;
-     Float_t centroid = fgTPCelectronCentroidMap->GetBinContent(binX, binY);
-     Float_t width = fgTPCelectronWidthMap->GetBinContent(binX, binY);
+     if(binY==context.fTPCelectronCentroidMap->GetYaxis()->GetNbins()+1) binY -= 1;
+     Float_t centroid = context.fTPCelectronCentroidMap->GetBinContent(binX, binY);
+     Float_t width = context.fTPCelectronWidthMap->GetBinContent(binX, binY);
      if(TMath::Abs(width)<1.0e-6) width = 1.;
      values[kTPCnSigCorrected+kElectron] = (values[kTPCnSig+kElectron] - centroid)/width;
      /*Float_t deltaNsig = values[kTPCnSigCorrected+kElectron] - values[kTPCnSig+kElectron];
@@ -1717,42 +1785,40 @@ void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
      values[kTPCnSig+kKaon] += deltaNsig;*/
   }
 
-  values[kTRDpidProbabilitiesLQ1D]   = pinfo->TRDpidLQ1D(0);
-  values[kTRDpidProbabilitiesLQ1D+1] = pinfo->TRDpidLQ1D(1);
-  values[kTRDpidProbabilitiesLQ2D]   = pinfo->TRDpidLQ2D(0);
-  values[kTRDpidProbabilitiesLQ2D+1] = pinfo->TRDpidLQ2D(1);
-  values[kTRDntracklets]    = pinfo->TRDntracklets(0);
-  values[kTRDntrackletsPID] = pinfo->TRDntracklets(1);
+  if(context.fUsedVars[kTRDpidProbabilitiesLQ1D])   values[kTRDpidProbabilitiesLQ1D]   = pinfo->TRDpidLQ1D(0);
+  if(context.fUsedVars[kTRDpidProbabilitiesLQ1D+1]) values[kTRDpidProbabilitiesLQ1D+1] = pinfo->TRDpidLQ1D(1);
+  if(context.fUsedVars[kTRDpidProbabilitiesLQ2D])   values[kTRDpidProbabilitiesLQ2D]   = pinfo->TRDpidLQ2D(0);
+  if(context.fUsedVars[kTRDpidProbabilitiesLQ2D+1]) values[kTRDpidProbabilitiesLQ2D+1] = pinfo->TRDpidLQ2D(1);
+  if(context.fUsedVars[kTRDntracklets])    values[kTRDntracklets]    = pinfo->TRDntracklets(0);
+  if(context.fUsedVars[kTRDntrackletsPID]) values[kTRDntrackletsPID] = pinfo->TRDntracklets(1);
 
   // TRD GTU online tracks
-  values[kTRDGTUtracklets]   = pinfo->TRDGTUtracklets();
-  values[kTRDGTUlayermask]   = pinfo->TRDGTUlayermask();
-  values[kTRDGTUpt]          = pinfo->TRDGTUpt();
-  values[kTRDGTUsagitta]     = pinfo->TRDGTUsagitta();
-  values[kTRDGTUPID]         = pinfo->TRDGTUPID();
+  if(context.fUsedVars[kTRDGTUtracklets]) values[kTRDGTUtracklets]   = pinfo->TRDGTUtracklets();
+  if(context.fUsedVars[kTRDGTUlayermask]) values[kTRDGTUlayermask]   = pinfo->TRDGTUlayermask();
+  if(context.fUsedVars[kTRDGTUpt])        values[kTRDGTUpt]          = pinfo->TRDGTUpt();
+  if(context.fUsedVars[kTRDGTUsagitta])   values[kTRDGTUsagitta]     = pinfo->TRDGTUsagitta();
+  if(context.fUsedVars[kTRDGTUPID])       values[kTRDGTUPID]         = pinfo->TRDGTUPID();
 
   FillTrackingStatus(pinfo,values);
   //FillTrackingFlags(pinfo,values);
 
-  if(fgUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
-  if(fgUsedVars[kPMC]) values[kPMC] = pinfo->PMC();
-  values[kPxMC] = pinfo->MCmom(0);
-  values[kPyMC] = pinfo->MCmom(1);
-  values[kPzMC] = pinfo->MCmom(2);
-  if(fgUsedVars[kThetaMC]) values[kThetaMC] = pinfo->ThetaMC();
-  if(fgUsedVars[kEtaMC]) values[kEtaMC] = pinfo->EtaMC();
-  if(fgUsedVars[kPhiMC]) values[kPhiMC] = pinfo->PhiMC();
+  if(context.fUsedVars[kPtMC]) values[kPtMC] = pinfo->PtMC();
+  if(context.fUsedVars[kPMC]) values[kPMC] = pinfo->PMC();
+  if(context.fUsedVars[kPxMC]) values[kPxMC] = pinfo->MCmom(0);
+  if(context.fUsedVars[kPyMC]) values[kPyMC] = pinfo->MCmom(1);
+  if(context.fUsedVars[kPzMC]) values[kPzMC] = pinfo->MCmom(2);
+  if(context.fUsedVars[kThetaMC]) values[kThetaMC] = pinfo->ThetaMC();
+  if(context.fUsedVars[kEtaMC]) values[kEtaMC] = pinfo->EtaMC();
+  if(context.fUsedVars[kPhiMC]) values[kPhiMC] = pinfo->PhiMC();
   //TODO: add also the massMC and RapMC   
-  values[kPdgMC] = pinfo->MCPdg(0);
-  values[kPdgMC+1] = pinfo->MCPdg(1);
-  values[kPdgMC+2] = pinfo->MCPdg(2);
-  values[kPdgMC+3] = pinfo->MCPdg(3);
+  for(Int_t i=0; i<4; ++i)
+    if(context.fUsedVars[kPdgMC+i]) values[kPdgMC+i] = pinfo->MCPdg(i);
   
-  if(fgUsedVars[kRap] && pinfo->IsMCKineParticle())  {
+  if(context.fUsedVars[kRap] && pinfo->IsMCKineParticle())  {
      if(pinfo->MCPdg(0)==443) values[kRap] = p->Rapidity(fgkPairMass[AliReducedPairInfo::kJpsiToEE]);
      if(TMath::Abs(pinfo->MCPdg(0))==11) values[kRap] = p->Rapidity(fgkParticleMass[AliReducedVarManager::kElectron]);
   }
-  if(fgUsedVars[kRapAbs] && pinfo->IsMCKineParticle())  {
+  if(context.fUsedVars[kRapAbs] && pinfo->IsMCKineParticle())  {
     if(pinfo->MCPdg(0)==443) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkPairMass[AliReducedPairInfo::kJpsiToEE]));
     if(TMath::Abs(pinfo->MCPdg(0))==11) values[kRapAbs] = TMath::Abs(p->Rapidity(fgkParticleMass[AliReducedVarManager::kElectron]));
   }
@@ -1763,16 +1829,17 @@ void AliReducedVarManager::FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, F
   //
   // fill calorimeter cluster matched track info
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   if(p->IsA()!=TRACK::Class()) return;
   TRACK* pinfo = (TRACK*)p;
 
-  if (!fgUsedVars[kEMCALmatchedEnergy] &&
-      !fgUsedVars[kEMCALmatchedEOverP] &&
-      !fgUsedVars[kEMCALmatchedM02] &&
-      !fgUsedVars[kEMCALmatchedM20] &&
-      !fgUsedVars[kEMCALmatchedClusterId]) return;
+  if (!context.fUsedVars[kEMCALmatchedEnergy] &&
+      !context.fUsedVars[kEMCALmatchedEOverP] &&
+      !context.fUsedVars[kEMCALmatchedM02] &&
+      !context.fUsedVars[kEMCALmatchedM20] &&
+      !context.fUsedVars[kEMCALmatchedClusterId]) return;
 
-  if (fgEvent && (fgEvent->IsA()==EVENT::Class())) {
+  if (context.fEvent && (context.fEvent->IsA()==EVENT::Class())) {
     CLUSTER* cluster = NULL;
     if (clusterList) {
       for (Int_t i=0; i<clusterList->GetEntries(); ++i) {
@@ -1781,7 +1848,7 @@ void AliReducedVarManager::FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, F
         cluster = NULL;
       }
     } else {
-      cluster = ((EVENT*)fgEvent)->GetCaloClusterFromID(pinfo->CaloClusterId());
+      cluster = ((EVENT*)context.fEvent)->GetCaloClusterFromID(pinfo->CaloClusterId());
     }
     // track matcher:
     Float_t deltaPhi  = -9999.;
@@ -1790,17 +1857,17 @@ void AliReducedVarManager::FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, F
     if (matcher) {
       if (!matcher->IsClusterMatchedToTrack(pinfo, cluster, deltaPhi, deltaEta, dist)) cluster = NULL;
     }
-    if (fgUsedVars[kEMCALmatchedClusterId])       values[kEMCALmatchedClusterId]      = (cluster ? pinfo->CaloClusterId() : -9999.);
-    if (fgUsedVars[kEMCALmatchedEnergy])          values[kEMCALmatchedEnergy]         = (cluster ? cluster->Energy() : -9999.);
-    if (fgUsedVars[kEMCALmatchedM02])             values[kEMCALmatchedM02]            = (cluster ? cluster->M02() : -9999.);
-    if (fgUsedVars[kEMCALmatchedM20])             values[kEMCALmatchedM20]            = (cluster ? cluster->M20() : -9999.);
-    if (fgUsedVars[kEMCALmatchedNCells])          values[kEMCALmatchedNCells]         = (cluster ? cluster->NCells() : -9999.);
-    if (fgUsedVars[kEMCALmatchedNMatchedTracks])  values[kEMCALmatchedNMatchedTracks] = (cluster ? cluster->NMatchedTracks() : -9999.);
-    if (fgUsedVars[kEMCALmatchedNSigmaElectron])  values[kEMCALmatchedNSigmaElectron] = (cluster ? pinfo->EMCALnSigEle() : -9999.);
-    if (fgUsedVars[kEMCALmatchedDeltaPhi])        values[kEMCALmatchedDeltaPhi]       = (cluster ? deltaPhi : -9999.);
-    if (fgUsedVars[kEMCALmatchedDeltaEta])        values[kEMCALmatchedDeltaEta]       = (cluster ? deltaEta : -9999.);
-    if (fgUsedVars[kEMCALmatchedDistance])        values[kEMCALmatchedDistance]       = (cluster ? dist : -9999.);
-    if (fgUsedVars[kEMCALmatchedEOverP]) {
+    if (context.fUsedVars[kEMCALmatchedClusterId])       values[kEMCALmatchedClusterId]      = (cluster ? pinfo->CaloClusterId() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedEnergy])          values[kEMCALmatchedEnergy]         = (cluster ? cluster->Energy() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedM02])             values[kEMCALmatchedM02]            = (cluster ? cluster->M02() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedM20])             values[kEMCALmatchedM20]            = (cluster ? cluster->M20() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedNCells])          values[kEMCALmatchedNCells]         = (cluster ? cluster->NCells() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedNMatchedTracks])  values[kEMCALmatchedNMatchedTracks] = (cluster ? cluster->NMatchedTracks() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedNSigmaElectron])  values[kEMCALmatchedNSigmaElectron] = (cluster ? pinfo->EMCALnSigEle() : -9999.);
+    if (context.fUsedVars[kEMCALmatchedDeltaPhi])        values[kEMCALmatchedDeltaPhi]       = (cluster ? deltaPhi : -9999.);
+    if (context.fUsedVars[kEMCALmatchedDeltaEta])        values[kEMCALmatchedDeltaEta]       = (cluster ? deltaEta : -9999.);
+    if (context.fUsedVars[kEMCALmatchedDistance])        values[kEMCALmatchedDistance]       = (cluster ? dist : -9999.);
+    if (context.fUsedVars[kEMCALmatchedEOverP]) {
       Float_t               mom = 0.0;
       if (pinfo->PonCalo()) mom = pinfo->PonCalo();
       else                  mom = pinfo->P();
@@ -1814,20 +1881,23 @@ void AliReducedVarManager::FillCaloClusterInfo(CLUSTER* cl, Float_t* values) {
   //
   // Fill calorimeter cluster information
   //
-  values[kEMCALclusterEnergy] = cl->Energy();
-  values[kEMCALclusterDx] = cl->Dx();
-  values[kEMCALclusterDz] = cl->Dz();
-  values[kEMCALdetector] = (cl->IsEMCAL() ? CLUSTER::kEMCAL : CLUSTER::kPHOS);
-  values[kEMCALm02] = cl->M02();
-  values[kEMCALm20] = cl->M20();
-  values[kEMCALdispersion] = cl->Dispersion();
-  values[kEMCALnCells] = cl->NCells();
-  values[kEMCALnMatchedTracks] = cl->NMatchedTracks();
-  TVector3 clusterVector(cl->X(), cl->Y(), cl->Z());
-  Float_t phiCluster = clusterVector.Phi();
-  if (phiCluster<0) phiCluster += 2*TMath::Pi();
-  values[kEMCALclusterPhi] = phiCluster;
-  values[kEMCALclusterEta] = clusterVector.Eta();
+  AliReducedVarContext& context = *gReducedVarContext;
+  if(context.fUsedVars[kEMCALclusterEnergy]) values[kEMCALclusterEnergy] = cl->Energy();
+  if(context.fUsedVars[kEMCALclusterDx]) values[kEMCALclusterDx] = cl->Dx();
+  if(context.fUsedVars[kEMCALclusterDz]) values[kEMCALclusterDz] = cl->Dz();
+  if(context.fUsedVars[kEMCALdetector]) values[kEMCALdetector] = (cl->IsEMCAL() ? CLUSTER::kEMCAL : CLUSTER::kPHOS);
+  if(context.fUsedVars[kEMCALm02]) values[kEMCALm02] = cl->M02();
+  if(context.fUsedVars[kEMCALm20]) values[kEMCALm20] = cl->M20();
+  if(context.fUsedVars[kEMCALdispersion]) values[kEMCALdispersion] = cl->Dispersion();
+  if(context.fUsedVars[kEMCALnCells]) values[kEMCALnCells] = cl->NCells();
+  if(context.fUsedVars[kEMCALnMatchedTracks]) values[kEMCALnMatchedTracks] = cl->NMatchedTracks();
+  if(context.fUsedVars[kEMCALclusterPhi] || context.fUsedVars[kEMCALclusterEta]) {
+    TVector3 clusterVector(cl->X(), cl->Y(), cl->Z());
+    Float_t phiCluster = clusterVector.Phi();
+    if (phiCluster<0) phiCluster += 2*TMath::Pi();
+    values[kEMCALclusterPhi] = phiCluster;
+    values[kEMCALclusterEta] = clusterVector.Eta();
+  }
 }
 
 //_________________________________________________________________
@@ -1897,13 +1967,14 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   //
   // fill pair information
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   FillTrackInfo(p, values);
   
-  values[kCandidateId]   = p->CandidateId();
-  values[kPairType]      = p->PairType();
-  values[kPairTypeSPD]      = p->PairTypeSPD();
-  values[kPairChisquare] = p->Chi2();
-  if(fgUsedVars[kMass]) {
+  if(context.fUsedVars[kCandidateId])   values[kCandidateId]   = p->CandidateId();
+  if(context.fUsedVars[kPairType])      values[kPairType]      = p->PairType();
+  if(context.fUsedVars[kPairTypeSPD])   values[kPairTypeSPD]   = p->PairTypeSPD();
+  if(context.fUsedVars[kPairChisquare]) values[kPairChisquare] = p->Chi2();
+  if(context.fUsedVars[kMass]) {
     values[kMass] = p->Mass();
     if(p->CandidateId()==PAIR::kLambda0ToPPi)  values[kMass] = p->Mass(1);
     if(p->CandidateId()==PAIR::kALambda0ToPPi) values[kMass] = p->Mass(2);
@@ -1913,23 +1984,21 @@ void AliReducedVarManager::FillPairInfo(PAIR* p, Float_t* values) {
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(p->CandidateId(),m1,m2); 
   
-  values[kMassV0]   = p->Mass(0);
-  values[kMassV0+1] = p->Mass(1);
-  values[kMassV0+2] = p->Mass(2);
-  values[kMassV0+3] = p->Mass(3);
+  for(Int_t i=0; i<4; ++i)
+    if(context.fUsedVars[kMassV0+i]) values[kMassV0+i] = p->Mass(i);
   
-  if(fgUsedVars[kRap])    values[kRap]              = p->Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs]           = TMath::Abs(p->Rapidity());
-                          values[kPairLxy]          = p->Lxy();
-                          values[kPairPointingAngle]= p->PointingAngle();
+  if(context.fUsedVars[kRap])    values[kRap]              = p->Rapidity();
+  if(context.fUsedVars[kRapAbs]) values[kRapAbs]           = TMath::Abs(p->Rapidity());
+  if(context.fUsedVars[kPairLxy])           values[kPairLxy]          = p->Lxy();
+  if(context.fUsedVars[kPairPointingAngle]) values[kPairPointingAngle]= p->PointingAngle();
 
   // polarization variables
   Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
+  if(context.fUsedVars[kPairThetaCS] || context.fUsedVars[kPairThetaHE] || context.fUsedVars[kPairPhiCS] || context.fUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
   if(usePolarization)
-    GetThetaPhiCM(fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
-		  fgEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
+    GetThetaPhiCM(context.fEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(0)), 
+		  context.fEvent->GetTrack(((AliReducedPairInfo*)p)->LegId(1)), 
 		  values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS], m1, m2);
 }
 
@@ -1942,6 +2011,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   PAIR p;
   p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
   p.CandidateId(type);
@@ -1950,19 +2020,21 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
   if(t1->Charge()*t2->Charge()<0) p.PairType(1);
   else if(t1->Charge()>0)         p.PairType(0);
   else                            p.PairType(2);
-  values[kPairType] = p.PairType();
-  values[kPairTypeSPD] = -1.;
-  if(t1->IsA()==TRACK::Class() && t2->IsA()==TRACK::Class() ){
-   TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
-   values[kPairTypeSPD] = ti1->ITSLayerHit(0)+ti2->ITSLayerHit(0);
+  if(context.fUsedVars[kPairType]) values[kPairType] = p.PairType();
+  if(context.fUsedVars[kPairTypeSPD]) {
+   values[kPairTypeSPD] = -1.;
+   if(t1->IsA()==TRACK::Class() && t2->IsA()==TRACK::Class() ){
+    TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
+    values[kPairTypeSPD] = ti1->ITSLayerHit(0)+ti2->ITSLayerHit(0);
+   }
   }
-  values[kCandidateId] = type;
-  values[kPairChisquare] = -999.;
+  if(context.fUsedVars[kCandidateId]) values[kCandidateId] = type;
+  if(context.fUsedVars[kPairChisquare]) values[kPairChisquare] = -999.;
   
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
     
-  if(fgUsedVars[kMass]) {     
+  if(context.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                          t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -1979,54 +2051,52 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     p.SetMass(values[kMass]);
   }
 
-  if(fgUsedVars[kRap])    values[kRap]    = p.Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
-  values[kPairLegPt+0] = t1->Pt();
-  values[kPairLegPt+1] = t2->Pt();
-  values[kPairLegPtSum] = t1->Pt()+t2->Pt();
+  if(context.fUsedVars[kRap])    values[kRap]    = p.Rapidity();
+  if(context.fUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
+  if(context.fUsedVars[kPairLegPt+0]) values[kPairLegPt+0] = t1->Pt();
+  if(context.fUsedVars[kPairLegPt+1]) values[kPairLegPt+1] = t2->Pt();
+  if(context.fUsedVars[kPairLegPtSum]) values[kPairLegPtSum] = t1->Pt()+t2->Pt();
   
-  values[kMassV0]   = -999.0;
-  values[kMassV0+1] = -999.0;
-  values[kMassV0+2] = -999.0;
-  values[kMassV0+3] = -999.0;
+  for(Int_t i=0; i<4; ++i)
+    if(context.fUsedVars[kMassV0+i]) values[kMassV0+i] = -999.0;
 
   FillTrackInfo(&p, values);
   
   // polarization variables
   Bool_t usePolarization=kFALSE;
-  if(fgUsedVars[kPairThetaCS] || fgUsedVars[kPairThetaHE] || fgUsedVars[kPairPhiCS] || fgUsedVars[kPairPhiHE])
+  if(context.fUsedVars[kPairThetaCS] || context.fUsedVars[kPairThetaHE] || context.fUsedVars[kPairPhiCS] || context.fUsedVars[kPairPhiHE])
     usePolarization = kTRUE;
   if(usePolarization)
     GetThetaPhiCM(t1, t2, values[kPairThetaHE], values[kPairPhiHE], values[kPairThetaCS], values[kPairPhiCS]);
   
-  if(fgUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if(context.fUsedVars[kDMA] && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
      values[kDMA]=TMath::Sqrt((ti1->HelixX()-ti2->HelixX())*(ti1->HelixX()-ti2->HelixX())+(ti1->HelixY()-ti2->HelixY())*(ti1->HelixY()-ti2->HelixY()))-ti1->HelixR()-ti2->HelixR();   
   }
   
-  if((fgUsedVars[kPairLegTPCchi2] || fgUsedVars[kPairLegTPCchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if((context.fUsedVars[kPairLegTPCchi2] || context.fUsedVars[kPairLegTPCchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
      values[kPairLegTPCchi2] = ti1->TPCchi2();
      values[kPairLegTPCchi2+1] = ti2->TPCchi2();
   }
-  if((fgUsedVars[kPairLegITSchi2] || fgUsedVars[kPairLegITSchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
+  if((context.fUsedVars[kPairLegITSchi2] || context.fUsedVars[kPairLegITSchi2+1]) && (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class())) {
      TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
     values[kPairLegITSchi2] = ti1->ITSchi2();
     values[kPairLegITSchi2+1] = ti2->ITSchi2();
   }
   
-  if((fgUsedVars[kPseudoProperDecayTime] || fgUsedVars[kPairLxy]) &&  
+  if((context.fUsedVars[kPseudoProperDecayTime] || context.fUsedVars[kPairLxy]) &&  
      (t1->IsA()==TRACK::Class()) && (t2->IsA()==TRACK::Class()) && 
-     (fgEvent->IsA()==EVENT::Class())) {
+     (context.fEvent->IsA()==EVENT::Class())) {
      TRACK* ti1=(TRACK*)t1; 
      TRACK* ti2=(TRACK*)t2;
      AliKFParticle pairKF = BuildKFcandidate(ti1,m1,ti2,m2);
      Double_t errPseudoProperTime2;
-     EVENT* eventInfo = (EVENT*)fgEvent;
+     EVENT* eventInfo = (EVENT*)context.fEvent;
      AliKFParticle primVtx = BuildKFvertex(eventInfo);
-     if(fgUsedVars[kPseudoProperDecayTime]) 
+     if(context.fUsedVars[kPseudoProperDecayTime]) 
         values[kPseudoProperDecayTime] = pairKF.GetPseudoProperDecayTime(primVtx, fgkPairMass[type], &errPseudoProperTime2);
-     if(fgUsedVars[kPairLxy]) values[kPairLxy] =  ( (pairKF.X() - primVtx.X())*p.Px() + (pairKF.Y() - primVtx.Y())*p.Py() )/p.Pt(); // = values[kPseudoProperDecayTime]*(p.Pt()/PAIR::fgkPairMass[type]);
+     if(context.fUsedVars[kPairLxy]) values[kPairLxy] =  ( (pairKF.X() - primVtx.X())*p.Px() + (pairKF.Y() - primVtx.Y())*p.Py() )/p.Pt(); // = values[kPseudoProperDecayTime]*(p.Pt()/PAIR::fgkPairMass[type]);
   }
   
   // fill MC information
@@ -2042,15 +2112,15 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
      else
         pMC.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
      pMC.CandidateId(type);
-     if(fgUsedVars[kPtMC]) values[kPtMC] = pMC.Pt();
-     if(fgUsedVars[kPMC]) values[kPMC] = pMC.P();
-     values[kPxMC] = pMC.Px();
-     values[kPyMC] = pMC.Py();
-     values[kPzMC] = pMC.Pz();
-     if(fgUsedVars[kThetaMC]) values[kThetaMC] = pMC.Theta();
-     if(fgUsedVars[kEtaMC]) values[kEtaMC] = pMC.Eta();
-     if(fgUsedVars[kPhiMC]) values[kPhiMC] = pMC.Phi();
-     if(fgUsedVars[kMassMC]) {
+     if(context.fUsedVars[kPtMC]) values[kPtMC] = pMC.Pt();
+     if(context.fUsedVars[kPMC]) values[kPMC] = pMC.P();
+     if(context.fUsedVars[kPxMC]) values[kPxMC] = pMC.Px();
+     if(context.fUsedVars[kPyMC]) values[kPyMC] = pMC.Py();
+     if(context.fUsedVars[kPzMC]) values[kPzMC] = pMC.Pz();
+     if(context.fUsedVars[kThetaMC]) values[kThetaMC] = pMC.Theta();
+     if(context.fUsedVars[kEtaMC]) values[kEtaMC] = pMC.Eta();
+     if(context.fUsedVars[kPhiMC]) values[kPhiMC] = pMC.Phi();
+     if(context.fUsedVars[kMassMC]) {
         if(pinfo1 && pinfo2 && !pinfo1->IsMCTruth() && !pinfo2->IsMCTruth())
            values[kMassMC] = m1*m1+m2*m2 + 
               2.0*(TMath::Sqrt(m1*m1+pinfo1->PMC()*pinfo1->PMC())*TMath::Sqrt(m2*m2+pinfo2->PMC()*pinfo2->PMC()) - 
@@ -2070,14 +2140,14 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
      }
      
      // TODO: think about whether to use the PDG mass or the calculated mass from the legs for rapidity
-     if(fgUsedVars[kRapMC]) {
+     if(context.fUsedVars[kRapMC]) {
        pMC.SetMass(values[kMassMC]);
        values[kRapMC] = pMC.Rapidity();   
      }
-     if(fgUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(pMC.Rapidity());
+     if(context.fUsedVars[kRapMCAbs]) values[kRapMCAbs] = TMath::Abs(pMC.Rapidity());
   }
 
-   if( fgUsedVars[kPairPhiV] ){
+   if( context.fUsedVars[kPairPhiV] ){
     // implementation taken from AliDielectronPair.cxx
     Double_t px1=-9999.,py1=-9999.,pz1=-9999.;
     Double_t px2=-9999.,py2=-9999.,pz2=-9999.;
@@ -2188,7 +2258,7 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     values[kPairPhiV] = phiv;
   }
 
-  if( fgUsedVars[kPairOpeningAngle] ){
+  if( context.fUsedVars[kPairOpeningAngle] ){
     TVector3 v1(t1->Px(), t1->Py(), t1->Pz());
     TVector3 v2(t2->Px(), t2->Py(), t2->Pz());
     values[kPairOpeningAngle] = v1.Angle(v2);
@@ -2198,22 +2268,22 @@ void AliReducedVarManager::FillPairInfo(BASETRACK* t1, BASETRACK* t2, Int_t type
     TRACK* ti1=(TRACK*)t1;
     TRACK* ti2=(TRACK*)t2;
 
-    if( fgUsedVars[kPairDca]   ) values[kPairDca]   = TMath::Sqrt(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz());
-    if( fgUsedVars[kPairDcaXY] ) values[kPairDcaXY] = TMath::Sqrt( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() );
-    if( fgUsedVars[kPairDcaZ]  ) values[kPairDcaZ]  = TMath::Sqrt(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz() );
+    if( context.fUsedVars[kPairDca]   ) values[kPairDca]   = TMath::Sqrt(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz());
+    if( context.fUsedVars[kPairDcaXY] ) values[kPairDcaXY] = TMath::Sqrt( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() );
+    if( context.fUsedVars[kPairDcaZ]  ) values[kPairDcaZ]  = TMath::Sqrt(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz() );
 
-    if( fgUsedVars[kPairDcaSqrt]   ) values[kPairDcaSqrt]   = TMath::Power(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
-    if( fgUsedVars[kPairDcaXYSqrt] ) values[kPairDcaXYSqrt] = TMath::Power( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy(), 0.25);
-    if( fgUsedVars[kPairDcaZSqrt]  ) values[kPairDcaZSqrt]  = TMath::Power(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
+    if( context.fUsedVars[kPairDcaSqrt]   ) values[kPairDcaSqrt]   = TMath::Power(ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy() + ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
+    if( context.fUsedVars[kPairDcaXYSqrt] ) values[kPairDcaXYSqrt] = TMath::Power( ti1->DCAxy() * ti1->DCAxy() + ti2->DCAxy() * ti2->DCAxy(), 0.25);
+    if( context.fUsedVars[kPairDcaZSqrt]  ) values[kPairDcaZSqrt]  = TMath::Power(ti1->DCAz() * ti1->DCAz() + ti2->DCAz() * ti2->DCAz(), 0.25);
 
-    if( fgUsedVars[kOpAngDcaPtCorr] ) {
+    if( context.fUsedVars[kOpAngDcaPtCorr] ) {
       Float_t a = -1.56316e-03;
       Float_t b =  1.22515e-02;
       Float_t c =  3.39455e-03;
       Float_t d =  1.00681e-01;
       values[kOpAngDcaPtCorr] = values[kPairOpeningAngle] - a - b * values[kPairDcaXYSqrt] - c * values[kOneOverSqrtPt] -  d * values[kPairDcaXYSqrt]  * values[kOneOverSqrtPt];
     }
-    if( fgUsedVars[kMassDcaPtCorr] ) {
+    if( context.fUsedVars[kMassDcaPtCorr] ) {
       Float_t a =  1.87774e-03;
       Float_t b =  4.53156e-02;
       Float_t c = -9.72947e-05;
@@ -2233,36 +2303,53 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  Int_t nSPDhits = -1;
+  if(t1->IsA()==TRACK::Class() && t2->IsA()==TRACK::Class() ){
+    TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
+    nSPDhits = ti1->ITSLayerHit(0)+ti2->ITSLayerHit(0);
+  }
+  FillPairInfoME(t1->Px(), t1->Py(), t1->Pz(), t1->P(), t1->Pt(), t1->Charge(),
+                 t2->Px(), t2->Py(), t2->Pz(), t2->P(), t2->Pt(), t2->Charge(),
+                 type, values, nSPDhits);
+}
+
+
+//_________________________________________________________________
+void AliReducedVarManager::FillPairInfoME(Float_t px1, Float_t py1, Float_t pz1, Float_t p1, Float_t pt1, Int_t charge1,
+                                          Float_t px2, Float_t py2, Float_t pz2, Float_t p2, Float_t pt2, Int_t charge2,
+                                          Int_t type, Float_t* values, Int_t nSPDhits /*=-1*/) {
+  //
+  // Lightweight fill pair information from the kinematics of the 2 legs
+  // NOTE: Used by the event mixing running on the contiguous track pools (no track objects available)
+  //       nSPDhits is the number of legs with a hit in the first ITS layer (-1 if not available)
+  //
+  AliReducedVarContext& context = *gReducedVarContext;
   PAIR p;
-  p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
+  p.PxPyPz(px1+px2, py1+py2, pz1+pz2);
   p.CandidateId(type);
  
-  values[kPairTypeSPD] = -1.;
-   if(t1->IsA()==TRACK::Class() && t2->IsA()==TRACK::Class() ){
-   TRACK* ti1=(TRACK*)t1; TRACK* ti2=(TRACK*)t2;
-   values[kPairTypeSPD] = ti1->ITSLayerHit(0)+ti2->ITSLayerHit(0);
-   }
+  if(context.fUsedVars[kPairTypeSPD]) values[kPairTypeSPD] = nSPDhits;
    
-  if(t1->Charge()*t2->Charge()<0) p.PairType(1);
-  else if(t1->Charge()>0)         p.PairType(0);
-  else                            p.PairType(2);
-  values[kPairType] = p.PairType();
-  values[kCandidateId] = type;
-  values[kPairChisquare] = -999.;
+  if(charge1*charge2<0) p.PairType(1);
+  else if(charge1>0)    p.PairType(0);
+  else                  p.PairType(2);
+  if(context.fUsedVars[kPairType]) values[kPairType] = p.PairType();
+  if(context.fUsedVars[kCandidateId]) values[kCandidateId] = type;
+  if(context.fUsedVars[kPairChisquare]) values[kPairChisquare] = -999.;
   
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
     
-  if(fgUsedVars[kMass]) {     
+  if(context.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
-                    2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
-                    t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
+                    2.0*(TMath::Sqrt(m1*m1+p1*p1)*TMath::Sqrt(m2*m2+p2*p2) - 
+                    px1*px2 - py1*py2 - pz1*pz2);
     if(values[kMass]<0.0) {
       cout << "FillPairInfoME(track, track, type, values): Warning: Very small squared mass found. "
            << "   Could be negative due to resolution of Float_t so it will be set to a small positive value." << endl; 
       cout << "   mass2: " << values[kMass] << endl;
-      cout << "p1(p,x,y,z): " << t1->P() << ", " << t1->Px() << ", " << t1->Py() << ", " << t1->Pz() << endl;
-      cout << "p2(p,x,y,z): " << t2->P() << ", " << t2->Px() << ", " << t2->Py() << ", " << t2->Pz() << endl;
+      cout << "p1(p,x,y,z): " << p1 << ", " << px1 << ", " << py1 << ", " << pz1 << endl;
+      cout << "p2(p,x,y,z): " << p2 << ", " << px2 << ", " << py2 << ", " << pz2 << endl;
       values[kMass] = 0.0;
     }
     else
@@ -2270,31 +2357,31 @@ void AliReducedVarManager::FillPairInfoME(BASETRACK* t1, BASETRACK* t2, Int_t ty
     p.SetMass(values[kMass]);
   }
   
-  values[kPx] = p.Px();
-  values[kPy] = p.Py();
-  values[kPz] = p.Pz();
-  if(fgUsedVars[kPt] || fgUsedVars[kPtSquared]) {
+  if(context.fUsedVars[kPx]) values[kPx] = p.Px();
+  if(context.fUsedVars[kPy]) values[kPy] = p.Py();
+  if(context.fUsedVars[kPz]) values[kPz] = p.Pz();
+  if(context.fUsedVars[kPt] || context.fUsedVars[kPtSquared]) {
     values[kPt] = p.Pt();
-    if(fgUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
-  }
-  values[kPairLegPt] = t1->Pt();
-  values[kPairLegPt+1] = t2->Pt();
-  values[kPairLegPtSum] = t1->Pt() + t2->Pt();
-  if(fgUsedVars[kP])      values[kP]      = p.P();
-  if(fgUsedVars[kEta])    values[kEta]    = p.Eta();
-  if(fgUsedVars[kRap])    values[kRap]    = p.Rapidity();
-  if(fgUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
-  if(fgUsedVars[kPhi])    values[kPhi]    = p.Phi();
-  if(fgUsedVars[kTheta])  values[kTheta]  = p.Theta();
-  
-  if((fgUsedVars[kPairEff] || fgUsedVars[kOneOverPairEff] || fgUsedVars[kOneOverPairEffSq]) && fgPairEffMap) {
-    Int_t binX = fgPairEffMap->GetXaxis()->FindBin(values[fgEffMapVarDependencyX]); //make sure the values[XVar] are filled for EM
+    if(context.fUsedVars[kPtSquared]) values[kPtSquared] = values[kPt]*values[kPt];
+  }
+  if(context.fUsedVars[kPairLegPt])   values[kPairLegPt] = pt1;
+  if(context.fUsedVars[kPairLegPt+1]) values[kPairLegPt+1] = pt2;
+  if(context.fUsedVars[kPairLegPtSum]) values[kPairLegPtSum] = pt1 + pt2;
+  if(context.fUsedVars[kP])      values[kP]      = p.P();
+  if(context.fUsedVars[kEta])    values[kEta]    = p.Eta();
+  if(context.fUsedVars[kRap])    values[kRap]    = p.Rapidity();
+  if(context.fUsedVars[kRapAbs]) values[kRapAbs] = TMath::Abs(p.Rapidity());
+  if(context.fUsedVars[kPhi])    values[kPhi]    = p.Phi();
+  if(context.fUsedVars[kTheta])  values[kTheta]  = p.Theta();
+  
+  if((context.fUsedVars[kPairEff] || context.fUsedVars[kOneOverPairEff] || context.fUsedVars[kOneOverPairEffSq]) && context.fPairEffMap) {
+    Int_t binX = context.fPairEffMap->GetXaxis()->FindBin(values[context.fEffMapVarDependencyX]); //make sure the values[XVar] are filled for EM
     if(binX==0) binX = 1;
-    if(binX==fgPairEffMap->GetXaxis()->GetNbins()+1) binX -= 1;
-    Int_t binY = fgPairEffMap->GetYaxis()->FindBin(values[fgEffMapVarDependencyY]); //make sure the values[YVar] are filled for EM
+    if(binX==context.fPairEffMap->GetXaxis()->GetNbins()+1) binX -= 1;
+    Int_t binY = context.fPairEffMap->GetYaxis()->FindBin(values[context.fEffMapVarDependencyY]); //make sure the values[YVar] are filled for EM
     if(binY==0) binY=1;
-    if(binY==fgPairEffMap->GetYaxis()->GetNbins()+1) binY -= 1;
-    Float_t pairEff = fgPairEffMap->GetBinContent(binX, binY);
+    if(binY==context.fPairEffMap->GetYaxis()->GetNbins()+1) binY -= 1;
+    Float_t pairEff = context.fPairEffMap->GetBinContent(binX, binY);
     Float_t oneOverPairEff = 1;
     if (pairEff > 1.0e-6) oneOverPairEff = 1/pairEff;
     values[kPairEff] = pairEff;
@@ -2313,18 +2400,19 @@ void AliReducedVarManager::FillPairInfo(PAIR* t1, BASETRACK* t2, Int_t type, Flo
   // type - Parameter encoding the resonance type 
   //        This is needed for making a mass assumption on the legs
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   PAIR p;
   p.PxPyPz(t1->Px()+t2->Px(), t1->Py()+t2->Py(), t1->Pz()+t2->Pz());
   p.CandidateId(type);
   
-  values[kPairType]  = 1;
-  values[kCandidateId] = type;
-  values[kPairChisquare] = -999.;
+  if(context.fUsedVars[kPairType])      values[kPairType]  = 1;
+  if(context.fUsedVars[kCandidateId])   values[kCandidateId] = type;
+  if(context.fUsedVars[kPairChisquare]) values[kPairChisquare] = -999.;
   
   Float_t m1 = 0.0; Float_t m2 = 0.0;
   GetLegMassAssumption(type,m1,m2); 
   
-  if(fgUsedVars[kMass]) {     
+  if(context.fUsedVars[kMass]) {     
     values[kMass] = m1*m1+m2*m2 + 
                     2.0*(TMath::Sqrt(m1*m1+t1->P()*t1->P())*TMath::Sqrt(m2*m2+t2->P()*t2->P()) - 
                     t1->Px()*t2->Px() - t1->Py()*t2->Py() - t1->Pz()*t2->Pz());
@@ -2340,10 +2428,8 @@ void AliReducedVarManager::FillPairInfo(PAIR* t1, BASETRACK* t2, Int_t type, Flo
       values[kMass] = TMath::Sqrt(values[kMass]);
     p.SetMass(values[kMass]);
   }  
-  values[kMassV0] = -1.0;
-  values[kMassV0+1] = -1.0;
-  values[kMassV0+2] = -1.0;
-  values[kMassV0+3] = -1.0;
+  for(Int_t i=0; i<4; ++i)
+    if(context.fUsedVars[kMassV0+i]) values[kMassV0+i] = -1.0;
   
   FillTrackInfo(&p, values);
 }
@@ -2355,18 +2441,19 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
   // fill pair-track correlation information
   // NOTE:  Add here only NEEDED information because this function is called during event mixing in the innermost loop
   //
-  if(fgUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
-  if(fgUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
-  if(fgUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
-  if(fgUsedVars[kAssociatedPt]) values[kAssociatedPt] = assoc->Pt();
-  if(fgUsedVars[kAssociatedEta]) values[kAssociatedEta] = assoc->Eta();
-  if(fgUsedVars[kAssociatedPhi]) values[kAssociatedPhi] = assoc->Phi();
+  AliReducedVarContext& context = *gReducedVarContext;
+  if(context.fUsedVars[kTriggerPt]) values[kTriggerPt] = trig->Pt();
+  if(context.fUsedVars[kTriggerRap] && (trig->IsA()==PAIR::Class())) 	  values[kTriggerRap]     = ((PAIR*)trig)->Rapidity();
+  if(context.fUsedVars[kTriggerRapAbs] && (trig->IsA()==PAIR::Class()))  values[kTriggerRapAbs]  = TMath::Abs(((PAIR*)trig)->Rapidity());
+  if(context.fUsedVars[kAssociatedPt]) values[kAssociatedPt] = assoc->Pt();
+  if(context.fUsedVars[kAssociatedEta]) values[kAssociatedEta] = assoc->Eta();
+  if(context.fUsedVars[kAssociatedPhi]) values[kAssociatedPhi] = assoc->Phi();
 
   // values after boost of hadrons to pair rest frame
   // NOTE: Are the boosted quantities reasonable?
   if (trig->IsA()==PAIR::Class() &&
-      (fgUsedVars[kDeltaPhiBoosted] || fgUsedVars[kDeltaPhiSymBoosted] || fgUsedVars[kDeltaThetaBoosted] || fgUsedVars[kDeltaEtaBoosted] ||
-       fgUsedVars[kDeltaEtaAbsBoosted] || fgUsedVars[kAssociatedPtBoosted] || fgUsedVars[kAssociatedEtaBoosted] || fgUsedVars[kAssociatedPhiBoosted])) {
+      (context.fUsedVars[kDeltaPhiBoosted] || context.fUsedVars[kDeltaPhiSymBoosted] || context.fUsedVars[kDeltaThetaBoosted] || context.fUsedVars[kDeltaEtaBoosted] ||
+       context.fUsedVars[kDeltaEtaAbsBoosted] || context.fUsedVars[kAssociatedPtBoosted] || context.fUsedVars[kAssociatedEtaBoosted] || context.fUsedVars[kAssociatedPhiBoosted])) {
 
     // get boost vector
     TLorentzVector trigVec;
@@ -2378,77 +2465,77 @@ void AliReducedVarManager::FillCorrelationInfo(BASETRACK* trig, BASETRACK* assoc
     assocVec.SetPtEtaPhiM(assoc->Pt(), assoc->Eta(), assoc->Phi(), 0.13957061); // NOTE: pion mass from PDG
     assocVec.Boost(-boostVec);
 
-    if(fgUsedVars[kAssociatedPtBoosted]) values[kAssociatedPtBoosted] = assocVec.Pt();
-    if(fgUsedVars[kAssociatedEtaBoosted]) values[kAssociatedEtaBoosted] = assocVec.Eta();
-    if(fgUsedVars[kAssociatedPhiBoosted]) values[kAssociatedPhiBoosted] = assocVec.Phi();
+    if(context.fUsedVars[kAssociatedPtBoosted]) values[kAssociatedPtBoosted] = assocVec.Pt();
+    if(context.fUsedVars[kAssociatedEtaBoosted]) values[kAssociatedEtaBoosted] = assocVec.Eta();
+    if(context.fUsedVars[kAssociatedPhiBoosted]) values[kAssociatedPhiBoosted] = assocVec.Phi();
 
-    if(fgUsedVars[kDeltaPhiBoosted]) {
+    if(context.fUsedVars[kDeltaPhiBoosted]) {
       Double_t delta = trig->Phi() - assocVec.Phi();
       if(delta>3.0/2.0*TMath::Pi()) delta -= 2.0*TMath::Pi();
       if(delta<-0.5*TMath::Pi()) delta += 2.0*TMath::Pi();
       values[kDeltaPhiBoosted] = delta;
     }
-    if(fgUsedVars[kDeltaPhiSymBoosted]) {
+    if(context.fUsedVars[kDeltaPhiSymBoosted]) {
       Double_t delta = TMath::Abs(trig->Phi() - assocVec.Phi());
       if(delta>TMath::Pi()) delta = 2*TMath::Pi()-delta;
       values[kDeltaPhiSymBoosted] = delta;
     }
 
-    if(fgUsedVars[kDeltaThetaBoosted]) values[kDeltaThetaBoosted] = trig->Theta() - assocVec.Theta();
+    if(context.fUsedVars[kDeltaThetaBoosted]) values[kDeltaThetaBoosted] = trig->Theta() - assocVec.Theta();
 
-    if(fgUsedVars[kDeltaEtaBoosted])     values[kDeltaEtaBoosted]     = trig->Eta() - assocVec.Eta();
-    if(fgUsedVars[kDeltaEtaAbsBoosted])  values[kDeltaEtaAbsBoosted]  = TMath::Abs(trig->Eta() - assocVec.Eta());
+    if(context.fUsedVars[kDeltaEtaBoosted])     values[kDeltaEtaBoosted]     = trig->Eta() - assocVec.Eta();
+    if(context.fUsedVars[kDeltaEtaAbsBoosted])  values[kDeltaEtaAbsBoosted]  = TMath::Abs(trig->Eta() - assocVec.Eta());
   }
 
-  if(fgUsedVars[kDeltaPhi]) {
+  if(context.fUsedVars[kDeltaPhi]) {
     Double_t delta = trig->Phi() - assoc->Phi();
     if(delta>3.0/2.0*TMath::Pi()) delta -= 2.0*TMath::Pi();
     if(delta<-0.5*TMath::Pi()) delta += 2.0*TMath::Pi();
     values[kDeltaPhi] = delta;
   }
-  if(fgUsedVars[kDeltaPhiSym]) {
+  if(context.fUsedVars[kDeltaPhiSym]) {
     Double_t delta = TMath::Abs(trig->Phi() - assoc->Phi());
     if(delta>TMath::Pi()) delta = 2*TMath::Pi()-delta;
     values[kDeltaPhiSym] = delta;
   }
 
-  if(fgUsedVars[kDeltaTheta]) values[kDeltaTheta] = trig->Theta() - assoc->Theta();
+  if(context.fUsedVars[kDeltaTheta]) values[kDeltaTheta] = trig->Theta() - assoc->Theta();
   
-  if(fgUsedVars[kDeltaEta])     values[kDeltaEta]     = trig->Eta() - assoc->Eta();
-  if(fgUsedVars[kDeltaEtaAbs])  values[kDeltaEtaAbs]  = TMath::Abs(trig->Eta() - assoc->Eta());
-  if(fgUsedVars[kMass] && (trig->IsA()==PAIR::Class())) values[kMass] = ((PAIR*)trig)->Mass();
+  if(context.fUsedVars[kDeltaEta])     values[kDeltaEta]     = trig->Eta() - assoc->Eta();
+  if(context.fUsedVars[kDeltaEtaAbs])  values[kDeltaEtaAbs]  = TMath::Abs(trig->Eta() - assoc->Eta());
+  if(context.fUsedVars[kMass] && (trig->IsA()==PAIR::Class())) values[kMass] = ((PAIR*)trig)->Mass();
 
   // hadron efficiency variables
-  if (fgUsedVars[kAssocHadronEff] || fgUsedVars[kOneOverAssocHadronEff]) {
+  if (context.fUsedVars[kAssocHadronEff] || context.fUsedVars[kOneOverAssocHadronEff]) {
     Float_t hadronEff         = 1.;
     Float_t oneOverHadronEff  = 1.;
-    if (fgAssocHadronEffMap1D) {
+    if (context.fAssocHadronEffMap1D) {
       // 1D map
-      Int_t binX = fgAssocHadronEffMap1D->GetXaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyX]);
+      Int_t binX = context.fAssocHadronEffMap1D->GetXaxis()->FindBin(values[context.fAssocHadronEffMapVarDependencyX]);
       if(binX==0) binX = 1;
-      if(binX==fgAssocHadronEffMap1D->GetXaxis()->GetNbins()+1) binX -= 1;
-      hadronEff = fgAssocHadronEffMap1D->GetBinContent(binX);
-    } else if (fgAssocHadronEffMap2D) {
+      if(binX==context.fAssocHadronEffMap1D->GetXaxis()->GetNbins()+1) binX -= 1;
+      hadronEff = context.fAssocHadronEffMap1D->GetBinContent(binX);
+    } else if (context.fAssocHadronEffMap2D) {
       // 2D map
-      Int_t binX = fgAssocHadronEffMap2D->GetXaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyX]);
+      Int_t binX = context.fAssocHadronEffMap2D->GetXaxis()->FindBin(values[context.fAssocHadronEffMapVarDependencyX]);
       if(binX==0) binX = 1;
-      if(binX==fgAssocHadronEffMap2D->GetXaxis()->GetNbins()+1) binX -= 1;
-      Int_t binY = fgAssocHadronEffMap2D->GetYaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyY]);
+      if(binX==context.fAssocHadronEffMap2D->GetXaxis()->GetNbins()+1) binX -= 1;
+      Int_t binY = context.fAssocHadronEffMap2D->GetYaxis()->FindBin(values[context.fAssocHadronEffMapVarDependencyY]);
       if(binY==0) binY = 1;
-      if(binY==fgAssocHadronEffMap2D->GetYaxis()->GetNbins()+1) binY -= 1;
-      hadronEff = fgAssocHadronEffMap2D->GetBinContent(binX, binY);
-    } else if (fgAssocHadronEffMap3D) {
+      if(binY==context.fAssocHadronEffMap2D->GetYaxis()->GetNbins()+1) binY -= 1;
+      hadronEff = context.fAssocHadronEffMap2D->GetBinContent(binX, binY);
+    } else if (context.fAssocHadronEffMap3D) {
       // 3D map
-      Int_t binX = fgAssocHadronEffMap3D->GetXaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyX]);
+      Int_t binX = context.fAssocHadronEffMap3D->GetXaxis()->FindBin(values[context.fAssocHadronEffMapVarDependencyX]);
       if(binX==0) binX = 1;
-      if(binX==fgAssocHadronEffMap3D->GetXaxis()->GetNbins()+1) binX -= 1;
-      Int_t binY = fgAssocHadronEffMap3D->GetYaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyY]);
+      if(binX==context.fAssocHadronEffMap3D->GetXaxis()->GetNbins()+1) binX -= 1;
+      Int_t binY = context.fAssocHadronEffMap3D->GetYaxis()->FindBin(values[context.fAssocHadronEffMapVarDependencyY]);
       if(binY==0) binY = 1;
-      if(binY==fgAssocHadronEffMap3D->GetYaxis()->GetNbins()+1) binY -= 1;
-      Int_t binZ = fgAssocHadronEffMap3D->GetZaxis()->FindBin(values[fgAssocHadronEffMapVarDependencyZ]);
+      if(binY==context.fAssocHadronEffMap3D->GetYaxis()->GetNbins()+1) binY -= 1;
+      Int_t binZ = context.fAssocHadronEffMap3D->GetZaxis()->FindBin(values[context.fAssocHadronEffMapVarDependencyZ]);
       if(binZ==0) binZ = 1;
-      if(binZ==fgAssocHadronEffMap3D->GetZaxis()->GetNbins()+1) binZ -= 1;
-      hadronEff = fgAssocHadronEffMap3D->GetBinContent(binX, binY, binZ);
+      if(binZ==context.fAssocHadronEffMap3D->GetZaxis()->GetNbins()+1) binZ -= 1;
+      hadronEff = context.fAssocHadronEffMap3D->GetBinContent(binX, binY, binZ);
     }
     if (!hadronEff) hadronEff       = 1.; // NOTE: should this be the default in case of eff=0?
     if (hadronEff) oneOverHadronEff = 1./hadronEff;
@@ -2485,12 +2572,13 @@ void AliReducedVarManager::GetThetaPhiCM(BASETRACK* leg1, BASETRACK* leg2,
   //
   // Calculate theta and phi in helicity and Collins-Soper coordinate frame
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   if(!leg1||!leg2) {cout<<"AliReducedVarManager::GetThetaPhiCM:  base leg doesn't exist"<<endl; return;}
   Double_t pxyz1[3]={leg1->Px(),leg1->Py(),leg1->Pz()};
   Double_t pxyz2[3]={leg2->Px(),leg2->Py(),leg2->Pz()};
     
-  TLorentzVector projMom(0.,0.,-fgBeamMomentum,TMath::Sqrt(fgBeamMomentum*fgBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
-  TLorentzVector targMom(0.,0., fgBeamMomentum,TMath::Sqrt(fgBeamMomentum*fgBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
+  TLorentzVector projMom(0.,0.,-context.fBeamMomentum,TMath::Sqrt(context.fBeamMomentum*context.fBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
+  TLorentzVector targMom(0.,0., context.fBeamMomentum,TMath::Sqrt(context.fBeamMomentum*context.fBeamMomentum+fgkParticleMass[kProton]*fgkParticleMass[kProton]));
   
   // first & second daughter 4-mom
   TLorentzVector p1Mom(pxyz1[0],pxyz1[1],pxyz1[2],
@@ -3311,6 +3399,7 @@ void AliReducedVarManager::SetTPCelectronCorrectionMaps(TH2F* centroidMap, TH2F*
    //
    // initialize the electron TPC pid correction maps
    //
+   AliReducedVarContext& context = *gReducedVarContext;
    if(varX>kNVars || varX<=kNothing) {
       cout << "AliReducedVarManager::SetTPCelectronCorrectionMaps() The X-dependency variable is not a valid variable defined in AliReducedVarManager" << endl;
       cout << "                           Correction maps not used! Check it out!" << endl;
@@ -3321,15 +3410,15 @@ void AliReducedVarManager::SetTPCelectronCorrectionMaps(TH2F* centroidMap, TH2F*
       cout << "                           Correction maps not used! Check it out!" << endl;
       return;
    }
-   fgVarDependencyX = varX;
-   fgVarDependencyY = varY;
+   context.fVarDependencyX = varX;
+   context.fVarDependencyY = varY;
    if(centroidMap) {
-     fgTPCelectronCentroidMap = (TH2F*)centroidMap->Clone(Form("AliReducedVarManager_TPCelectronCentroidMap"));
-     fgTPCelectronCentroidMap->SetDirectory(0x0);
+     context.fTPCelectronCentroidMap = (TH2F*)centroidMap->Clone(Form("AliReducedVarManager_TPCelectronCentroidMap"));
+     context.fTPCelectronCentroidMap->SetDirectory(0x0);
    }
    if(widthMap) {
-     fgTPCelectronWidthMap = (TH2F*)widthMap->Clone(Form("AliReducedVarManager_TPCelectronWidthMap"));
-     fgTPCelectronWidthMap->SetDirectory(0x0);
+     context.fTPCelectronWidthMap = (TH2F*)widthMap->Clone(Form("AliReducedVarManager_TPCelectronWidthMap"));
+     context.fTPCelectronWidthMap->SetDirectory(0x0);
    }
 }
 
@@ -3338,6 +3427,7 @@ void AliReducedVarManager::SetPairEfficiencyMap(TH2F* effMap, AliReducedVarManag
   //
   // initialize the pair efficiency map
   //
+  AliReducedVarContext& context = *gReducedVarContext;
   if(varX>kNVars || varX<=kNothing) {
     cout << "AliReducedVarManager::SetPairEfficiencyMap() The X-dependency variable is not a valid variable defined in AliReducedVarManager" << endl;
     cout << "                           Efficiency map not used! Check it out!" << endl;
@@ -3348,11 +3438,11 @@ void AliReducedVarManager::SetPairEfficiencyMap(TH2F* effMap, AliReducedVarManag
     cout << "                           Efficiency map not used! Check it out!" << endl;
     return;
   }
-  fgEffMapVarDependencyX = varX; 
-  fgEffMapVarDependencyY = varY;
+  context.fEffMapVarDependencyX = varX; 
+  context.fEffMapVarDependencyY = varY;
   if(effMap) {
-    fgPairEffMap = (TH2F*)effMap->Clone(Form("AliReducedVarManager_PairEffMap"));
-    fgPairEffMap->SetDirectory(0x0);
+    context.fPairEffMap = (TH2F*)effMap->Clone(Form("AliReducedVarManager_PairEffMap"));
+    context.fPairEffMap->SetDirectory(0x0);
   }
 }
 
@@ -3361,7 +3451,8 @@ void AliReducedVarManager::SetAssociatedHadronEfficiencyMap(TH1F* map, AliReduce
   //
   // initialize the associated hadron efficiency map (1D), used for correlation analysis
   //
-  if (fgAssocHadronEffMap1D || fgAssocHadronEffMap2D || fgAssocHadronEffMap3D) {
+  AliReducedVarContext& context = *gReducedVarContext;
+  if (context.fAssocHadronEffMap1D || context.fAssocHadronEffMap2D || context.fAssocHadronEffMap3D) {
     cout << "AliReducedVarManager::SetAssociatedHadronEfficiencyMap() Efficiency map already defined!" << endl;
     return;
   }
@@ -3370,10 +3461,10 @@ void AliReducedVarManager::SetAssociatedHadronEfficiencyMap(TH1F* map, AliReduce
     cout << "                           Efficiency map not used! Check it out!" << endl;
     return;
   }
-  fgAssocHadronEffMapVarDependencyX = varX;
+  context.fAssocHadronEffMapVarDependencyX = varX;
   if (map) {
-    fgAssocHadronEffMap1D = (TH1F*)map->Clone(Form("AliReducedVarManager_AssocHadronEffMap"));
-    fgAssocHadronEffMap1D->SetDirectory(0x0);
+    context.fAssocHadronEffMap1D = (TH1F*)map->Clone(Form("AliReducedVarManager_AssocHadronEffMap"));
+    context.fAssocHadronEffMap1D->SetDirectory(0x0);
   }
 }
 
@@ -3382,7 +3473,8 @@ void AliReducedVarManager::SetAssociatedHadronEfficiencyMap(TH2F* map, AliReduce
   //
   // initialize the associated hadron efficiency map (2D), used for correlation analysis
   //
-  if (fgAssocHadronEffMap1D || fgAssocHadronEffMap2D || fgAssocHadronEffMap3D) {
+  AliReducedVarContext& context = *gReducedVarContext;
+  if (context.fAssocHadronEffMap1D || context.fAssocHadronEffMap2D || context.fAssocHadronEffMap3D) {
     cout << "AliReducedVarManager::SetAssociatedHadronEfficiencyMap() Efficiency map already defined!" << endl;
     return;
   }
@@ -3396,11 +3488,11 @@ void AliReducedVarManager::SetAssociatedHadronEfficiencyMap(TH2F* map, AliReduce
     cout << "                           Efficiency map not used! Check it out!" << endl;
     return;
   }
-  fgAssocHadronEffMapVarDependencyX = varX;
-  fgAssocHadronEffMapVarDependencyY = varY;
+  context.fAssocHadronEffMapVarDependencyX = varX;
+  context.fAssocHadronEffMapVarDependencyY = varY;
   if (map) {
-    fgAssocHadronEffMap2D = (TH2F*)map->Clone(Form("AliReducedVarManager_AssocHadronEffMap"));
-    fgAssocHadronEffMap2D->SetDirectory(0x0);
+    context.fAssocHadronEffMap2D = (TH2F*)map->Clone(Form("AliReducedVarManager_AssocHadronEffMap"));
+    context.fAssocHadronEffMap2D->SetDirectory(0x0);
   }
 }
 
@@ -3409,7 +3501,8 @@ void AliReducedVarManager::SetAssociatedHadronEfficiencyMap(TH3F* map, AliReduce
   //
   // initialize the associated hadron efficiency map (3D), used for correlation analysis
   //
-  if (fgAssocHadronEffMap1D || fgAssocHadronEffMap2D || fgAssocHadronEffMap3D) {
+  AliReducedVarContext& context = *gReducedVarContext;
+  if (context.fAssocHadronEffMap1D || context.fAssocHadronEffMap2D || context.fAssocHadronEffMap3D) {
     cout << "AliReducedVarManager::SetAssociatedHadronEfficiencyMap() Efficiency map already defined!" << endl;
     return;
   }
@@ -3428,12 +3521,12 @@ void AliReducedVarManager::SetAssociatedHadronEfficiencyMap(TH3F* map, AliReduce
     cout << "                           Efficiency map not used! Check it out!" << endl;
     return;
   }
-  fgAssocHadronEffMapVarDependencyX = varX;
-  fgAssocHadronEffMapVarDependencyY = varY;
-  fgAssocHadronEffMapVarDependencyZ = varZ;
+  context.fAssocHadronEffMapVarDependencyX = varX;
+  context.fAssocHadronEffMapVarDependencyY = varY;
+  context.fAssocHadronEffMapVarDependencyZ = varZ;
   if (map) {
-    fgAssocHadronEffMap3D = (TH3F*)map->Clone(Form("AliReducedVarManager_AssocHadronEffMap"));
-    fgAssocHadronEffMap3D->SetDirectory(0x0);
+    context.fAssocHadronEffMap3D = (TH3F*)map->Clone(Form("AliReducedVarManager_AssocHadronEffMap"));
+    context.fAssocHadronEffMap3D->SetDirectory(0x0);
   }
 }
 
@@ -3442,21 +3535,22 @@ void AliReducedVarManager::SetLHCDataInfo(TH1F* totalLumi, TH1F* totalInt0, TH1F
    //
    // initialize the LHC data histograms
    //
+   AliReducedVarContext& context = *gReducedVarContext;
    if(totalLumi) {
-      fgRunTotalLuminosity = (TH1F*)totalLumi->Clone("AliReducedVarManager_TotalLuminosity");
-      fgRunTotalLuminosity->SetDirectory(0x0);
+      context.fRunTotalLuminosity = (TH1F*)totalLumi->Clone("AliReducedVarManager_TotalLuminosity");
+      context.fRunTotalLuminosity->SetDirectory(0x0);
    }
    if(totalInt0) {
-      fgRunTotalIntensity0 = (TH1F*)totalInt0->Clone("AliReducedVarManager_TotalIntensity0");
-      fgRunTotalIntensity0->SetDirectory(0x0);
+      context.fRunTotalIntensity0 = (TH1F*)totalInt0->Clone("AliReducedVarManager_TotalIntensity0");
+      context.fRunTotalIntensity0->SetDirectory(0x0);
    }
    if(totalInt1) {
-      fgRunTotalIntensity1 = (TH1F*)totalInt1->Clone("AliReducedVarManager_TotalIntensity1");
-      fgRunTotalIntensity1->SetDirectory(0x0);
+      context.fRunTotalIntensity1 = (TH1F*)totalInt1->Clone("AliReducedVarManager_TotalIntensity1");
+      context.fRunTotalIntensity1->SetDirectory(0x0);
    }
    if(fillNumber) {
-      fgRunLHCFillNumber = (TH1I*)fillNumber->Clone("AliReducedVarManager_LHCFillNumber");
-      fgRunLHCFillNumber->SetDirectory(0x0);
+      context.fRunLHCFillNumber = (TH1I*)fillNumber->Clone("AliReducedVarManager_LHCFillNumber");
+      context.fRunLHCFillNumber->SetDirectory(0x0);
    }
 }
 
@@ -3465,21 +3559,22 @@ void AliReducedVarManager::SetGRPDataInfo(TH1I* dipolePolarity, TH1I* l3Polarity
    //
    // initialize the GRP data histograms
    //
+   AliReducedVarContext& context = *gReducedVarContext;
    if(dipolePolarity) {
-      fgRunDipolePolarity = (TH1I*)dipolePolarity->Clone("AliReducedVarManager_DipolePolarity");
-      fgRunDipolePolarity->SetDirectory(0x0);
+      context.fRunDipolePolarity = (TH1I*)dipolePolarity->Clone("AliReducedVarManager_DipolePolarity");
+      context.fRunDipolePolarity->SetDirectory(0x0);
    }
    if(l3Polarity) {
-      fgRunL3Polarity = (TH1I*)l3Polarity->Clone("AliReducedVarManager_L3Polarity");
-      fgRunL3Polarity->SetDirectory(0x0);
+      context.fRunL3Polarity = (TH1I*)l3Polarity->Clone("AliReducedVarManager_L3Polarity");
+      context.fRunL3Polarity->SetDirectory(0x0);
    }
    if(timeStart) {
-      fgRunTimeStart = (TH1I*)timeStart->Clone("AliReducedVarManager_TimeStart");
-      fgRunTimeStart->SetDirectory(0x0);
+      context.fRunTimeStart = (TH1I*)timeStart->Clone("AliReducedVarManager_TimeStart");
+      context.fRunTimeStart->SetDirectory(0x0);
    }
    if(timeStop) {
-      fgRunTimeEnd = (TH1I*)timeStop->Clone("AliReducedVarManager_TimeEnd");
-      fgRunTimeEnd->SetDirectory(0x0);
+      context.fRunTimeEnd = (TH1I*)timeStop->Clone("AliReducedVarManager_TimeEnd");
+      context.fRunTimeEnd->SetDirectory(0x0);
    }
 }
 
@@ -3487,33 +3582,56 @@ void AliReducedVarManager::SetGRPDataInfo(TH1I* dipolePolarity, TH1I* l3Polarity
 void AliReducedVarManager::SetupGRPinformation(const Char_t* filename) {
    //
    // open the root file containing GRP information and initialize needed objects
+   // All objects are read here and the file is closed, such that contexts copied from this one
+   // (e.g. one per thread) only share read-only objects
    //
-   fgGRPfile = new TFile(filename);
-   fgRunTotalLuminosity = (TH1F*)fgGRPfile->Get("lumiTotal")->Clone("AliReducedVarManager_TotalLuminosity");
-   fgRunTotalLuminosity->SetDirectory(0x0);
-   fgRunTotalIntensity0 = (TH1F*)fgGRPfile->Get("intTotal0")->Clone("AliReducedVarManager_TotalIntensity0");
-   fgRunTotalIntensity0->SetDirectory(0x0);
-   fgRunTotalIntensity1 = (TH1F*)fgGRPfile->Get("intTotal1")->Clone("AliReducedVarManager_TotalIntensity1");
-   fgRunTotalIntensity1->SetDirectory(0x0);
-   fgRunLHCFillNumber = (TH1I*)fgGRPfile->Get("fillNumber")->Clone("AliReducedVarManager_LHCFillNumber");
-   fgRunLHCFillNumber->SetDirectory(0x0);
-   fgRunDipolePolarity = (TH1I*)fgGRPfile->Get("dipolePolarity")->Clone("AliReducedVarManager_DipolePolarity");
-   fgRunDipolePolarity->SetDirectory(0x0);
-   fgRunL3Polarity = (TH1I*)fgGRPfile->Get("l3Polarity")->Clone("AliReducedVarManager_L3Polarity");
-   fgRunL3Polarity->SetDirectory(0x0);
-   fgRunTimeStart = (TH1I*)fgGRPfile->Get("timeStart")->Clone("AliReducedVarManager_TimeStart");
-   fgRunTimeStart->SetDirectory(0x0);
-   fgRunTimeEnd = (TH1I*)fgGRPfile->Get("timeEnd")->Clone("AliReducedVarManager_TimeEnd");
-   fgRunTimeEnd->SetDirectory(0x0);
+   AliReducedVarContext& context = *gReducedVarContext;
+   TFile* grpFile = TFile::Open(filename, "READ");
+   if(!grpFile || grpFile->IsZombie()) {
+      cout << "AliReducedVarManager::SetupGRPinformation  Cannot open GRP file " << filename << endl;
+      delete grpFile;
+      return;
+   }
+   context.fRunTotalLuminosity = (TH1F*)grpFile->Get("lumiTotal")->Clone("AliReducedVarManager_TotalLuminosity");
+   context.fRunTotalLuminosity->SetDirectory(0x0);
+   context.fRunTotalIntensity0 = (TH1F*)grpFile->Get("intTotal0")->Clone("AliReducedVarManager_TotalIntensity0");
+   context.fRunTotalIntensity0->SetDirectory(0x0);
+   context.fRunTotalIntensity1 = (TH1F*)grpFile->Get("intTotal1")->Clone("AliReducedVarManager_TotalIntensity1");
+   context.fRunTotalIntensity1->SetDirectory(0x0);
+   context.fRunLHCFillNumber = (TH1I*)grpFile->Get("fillNumber")->Clone("AliReducedVarManager_LHCFillNumber");
+   context.fRunLHCFillNumber->SetDirectory(0x0);
+   context.fRunDipolePolarity = (TH1I*)grpFile->Get("dipolePolarity")->Clone("AliReducedVarManager_DipolePolarity");
+   context.fRunDipolePolarity->SetDirectory(0x0);
+   context.fRunL3Polarity = (TH1I*)grpFile->Get("l3Polarity")->Clone("AliReducedVarManager_L3Polarity");
+   context.fRunL3Polarity->SetDirectory(0x0);
+   context.fRunTimeStart = (TH1I*)grpFile->Get("timeStart")->Clone("AliReducedVarManager_TimeStart");
+   context.fRunTimeStart->SetDirectory(0x0);
+   context.fRunTimeEnd = (TH1I*)grpFile->Get("timeEnd")->Clone("AliReducedVarManager_TimeEnd");
+   context.fRunTimeEnd->SetDirectory(0x0);
+   
+   // instantaneous luminosity vs. time, one graph per run
+   context.fRunInstLumiGraphs.clear();
+   TIter nextKey(grpFile->GetListOfKeys());
+   TKey* key = 0x0;
+   while((key = (TKey*)nextKey())) {
+      TString keyName = key->GetName();
+      if(!keyName.BeginsWith("InstLumi_Run")) continue;
+      TGraphErrors* graph = dynamic_cast<TGraphErrors*>(key->ReadObj());
+      if(!graph) continue;
+      context.fRunInstLumiGraphs[TString(keyName(12, keyName.Length()-12)).Atoi()] = graph;
+   }
+   grpFile->Close();
+   delete grpFile;
 }
 
 //____________________________________________________________________________________
 void AliReducedVarManager::SetRunNumbers( TString runNumbers ){
+  AliReducedVarContext& context = *gReducedVarContext;
   TObjArray* runNumbersArr = runNumbers.Tokenize(";");
   runNumbersArr->SetOwner();
   for( Int_t iRun=0; iRun < runNumbersArr->GetEntries(); ++iRun){
     TString runNumberString = runNumbersArr->At(iRun)->GetName();
-    fgRunNumbers.push_back( runNumberString.Atoi() );
+    context.fRunNumbers.push_back( runNumberString.Atoi() );
   }
 }
 
@@ -3522,6 +3640,7 @@ void AliReducedVarManager::SetMultiplicityProfile(TH2* profile, Int_t estimator)
    //
    // initialize the profile for the z-vertex equalization of the multiplicity estimator
    //
+  AliReducedVarContext& context = *gReducedVarContext;
   Int_t iEstimator = estimator - kMultiplicity;
   if( iEstimator >= kNMultiplicityEstimators ){
     cout << "Multiplcity estimator " << estimator << " not defined!" <<endl;
@@ -3531,8 +3650,10 @@ void AliReducedVarManager::SetMultiplicityProfile(TH2* profile, Int_t estimator)
     cout <<"AliReducedVarManager::SetMultiplicityProfile : Profile null!"  << endl;
     return;
   }
-  fgAvgMultVsVtxAndRun[iEstimator] = (TH2*)profile->Clone( Form("profile_%d", estimator  ));
-  fgAvgMultVsVtxAndRun[iEstimator]->SetDirectory(0x0);
+  context.fAvgMultVsVtxAndRun[iEstimator] = (TH2*)profile->Clone( Form("profile_%d", estimator  ));
+  context.fAvgMultVsVtxAndRun[iEstimator]->SetDirectory(0x0);
+  // the raw estimator is the input of the correction
+  context.fUsedVars[estimator] = kTRUE;
 }
 
 //____________________________________________________________________________________
@@ -3540,7 +3661,7 @@ void AliReducedVarManager::SetVZEROCalibrationPath(const Char_t* path) {
    //
    // initialize the path to the VZERO calibration histograms
    //
-   fgVZEROCalibrationPath = path;
+   gReducedVarContext->fVZEROCalibrationPath = path;
 }
 
 //____________________________________________________________________________________
@@ -3548,7 +3669,7 @@ void AliReducedVarManager::SetCalibrateVZEROqVector(Bool_t option) {
    //
    // set the option whether to calibrate the VZERO event plane
    //
-   fgOptionCalibrateVZEROqVec = option;
+   gReducedVarContext->fOptionCalibrateVZEROqVec = option;
 }
 
 //____________________________________________________________________________________
@@ -3556,15 +3677,16 @@ void AliReducedVarManager::SetRecenterVZEROqVector(Bool_t option) {
    //
    // set the option whether to recenter the VZERO event plane
    //   
-   fgOptionRecenterVZEROqVec = option;
-   //if(fgOptionRecenterVZEROqVec) fgOptionCalibrateVZEROqVec = kTRUE;
+   AliReducedVarContext& context = *gReducedVarContext;
+   context.fOptionRecenterVZEROqVec = option;
+   //if(context.fOptionRecenterVZEROqVec) context.fOptionCalibrateVZEROqVec = kTRUE;
 }
 
 void AliReducedVarManager::SetRecenterTPCqVector(Bool_t option) {
    //
    // set the option whether to recenter the TPC event plane
    //   
-   fgOptionRecenterTPCqVec = option;
+   gReducedVarContext->fOptionRecenterTPCqVec = option;
   
 }
 
@@ -3572,7 +3694,7 @@ void AliReducedVarManager::SetEventResolution(Bool_t option) {
    //
    // set the option whether to divide by resolution the flow coefficients
    //   
-   fgOptionEventRes = option;
+   gReducedVarContext->fOptionEventRes = option;
   
 }
 
@@ -26,6 +26,7 @@ class AliReducedTrackInfo;
 class AliReducedCaloClusterInfo;
 class AliReducedCaloClusterTrackMatcher;
 class AliKFParticle;
+class AliReducedVarContext;
 
 //_____________________________________________________________________
 class AliReducedVarManager : public TObject {
@@ -683,19 +684,20 @@ class AliReducedVarManager : public TObject {
   AliReducedVarManager(const Char_t* name);
   virtual ~AliReducedVarManager();
   
-  static void SetBeamMomentum(Float_t beamMom) {fgBeamMomentum = beamMom;}
-  static Float_t GetBeamMomentum() {return fgBeamMomentum;}
+  // The variable manager state (used variables, event pointers, calibration inputs) is kept in an
+  // AliReducedVarContext. All static functions below work on the context installed for the calling thread.
+  static AliReducedVarContext* GetDefaultContext();
+  static AliReducedVarContext* GetContext();
+  static AliReducedVarContext* SetContext(AliReducedVarContext* context);
   
-  static void SetEvent(AliReducedBaseEvent* const ev) {fgEvent = ev;};
-  static void SetEventPlane(AliReducedEventPlaneInfo* const ev) {fgEventPlane = ev;};
-  static void SetUseVariable(Variables var) {fgUsedVars[var] = kTRUE; SetVariableDependencies();}
-  static void SetUseVars(Bool_t* usedVars) {
-    for(Int_t i=0;i<kNVars;++i) {
-      if(usedVars[i]) fgUsedVars[i]=kTRUE;    // overwrite only the variables that are being used since there are more channels to modify the used variables array, independently
-    }
-    SetVariableDependencies();
-  }
-  static Bool_t GetUsedVar(Variables var) {return fgUsedVars[var];}
+  static void SetBeamMomentum(Float_t beamMom);
+  static Float_t GetBeamMomentum();
+  
+  static void SetEvent(AliReducedBaseEvent* const ev);
+  static void SetEventPlane(AliReducedEventPlaneInfo* const ev);
+  static void SetUseVariable(Variables var);
+  static void SetUseVars(Bool_t* usedVars);
+  static Bool_t GetUsedVar(Variables var);
   
   static void FillEventInfo(Float_t* values);
   static void FillEventInfo(AliReducedBaseEvent* event, Float_t* values, AliReducedEventPlaneInfo* eventPlane=0x0);
@@ -719,6 +721,9 @@ class AliReducedVarManager : public TObject {
   static void FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
   static void FillPairInfo(AliReducedPairInfo* leg1, AliReducedBaseTrack* leg2, Int_t type, Float_t* values);
   static void FillPairInfoME(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
+  static void FillPairInfoME(Float_t px1, Float_t py1, Float_t pz1, Float_t p1, Float_t pt1, Int_t charge1,
+                             Float_t px2, Float_t py2, Float_t pz2, Float_t p2, Float_t pt2, Int_t charge2,
+                             Int_t type, Float_t* values, Int_t nSPDhits=-1);
   static void FillCorrelationInfo(AliReducedBaseTrack* p, AliReducedBaseTrack* t, Float_t* values);
   static void FillCaloClusterInfo(AliReducedCaloClusterInfo* cl, Float_t* values);
   static void FillTrackingStatus(AliReducedTrackInfo* p, Float_t* values);
@@ -757,12 +762,6 @@ class AliReducedVarManager : public TObject {
   static Int_t GetCorrectedMultiplicity( Int_t estimator = kMultiplicity, Int_t correction = 0, Int_t reference = 0, Int_t smearing = 0 );
   
  private:
-  static Int_t     fgCurrentRunNumber;               // current run number
-  static Float_t fgBeamMomentum;                  // beam energy (needed when calculating polarization angles) 
-  static AliReducedBaseEvent* fgEvent;            // pointer to the current event
-  static AliReducedEventPlaneInfo* fgEventPlane;  // pointer to the current event plane
-  static Bool_t fgUsedVars[kNVars];              // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
-                                                 //   when a variable is used
   static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
   
 
@@ -775,49 +774,6 @@ class AliReducedVarManager : public TObject {
   static AliKFParticle BuildKFcandidate(AliReducedTrackInfo* track1, Float_t mh1, AliReducedTrackInfo* track2, Float_t mh2);
   static AliKFParticle BuildKFvertex( AliReducedEventInfo * event );
   
-  static TH2F* fgTPCelectronCentroidMap;    // TPC electron centroid 2D map
-  static TH2F* fgTPCelectronWidthMap;       // TPC electron width 2D map
-  static Variables fgVarDependencyX;        // varX in the 2-D electron correction maps
-  static Variables fgVarDependencyY;        // varY in the 2-D electron correction maps
-  static TH2F* fgPairEffMap;       // 2D pair efficiency map
-  static Variables fgEffMapVarDependencyX;        // varX in the pair eff maps
-  static Variables fgEffMapVarDependencyY;        // varY in the pair eff maps
-  static TH1F* fgAssocHadronEffMap1D;       // 1D pair efficiency map
-  static TH2F* fgAssocHadronEffMap2D;       // 2D pair efficiency map
-  static TH3F* fgAssocHadronEffMap3D;       // 3D pair efficiency map
-  static Variables fgAssocHadronEffMapVarDependencyX; // varX in assoc hadron eff map
-  static Variables fgAssocHadronEffMapVarDependencyY; // varY in assoc hadron eff map
-  static Variables fgAssocHadronEffMapVarDependencyZ; // varZ in assoc hadron eff map
-  
-  static TH1F* fgRunTotalLuminosity;      // total luminosity, GRP/GRP/LHCData::GetLumiAliceSBDelivered()
-  static TH1F* fgRunTotalIntensity0;        // total intensity beam 1, GRP/GRP/LHCData::GetTotalIntensity(0)
-  static TH1F* fgRunTotalIntensity1;         // total intensity beam 2, GRP/GRP/LHCData::GetTotalIntensity(1)
-  static TH1I* fgRunLHCFillNumber;         // LHC fill number, GRP/GRP/LHCData::GetFillNumber()
-  static TH1I* fgRunDipolePolarity;          // dipole magnet polarity, GRP/GRP/Data::GetDipolePolarity()
-  static TH1I* fgRunL3Polarity;                // L3 magnet polarity, GRP/GRP/Data::GetL3Polarity()
-  static TH1I* fgRunTimeStart;                // run start time, GRP/GRP/Data::GetTimeStart()
-  static TH1I* fgRunTimeEnd;                  // run stop time, GRP/GRP/Data::GetTimeEnd()
-  static TFile* fgGRPfile;                    // file containing GRP information
-  static TGraphErrors* fgRunInstLumi;         // time dependence of the instantaneous lumi for the current run, AliLumiTools::GetLumiFromCTP(run)
-  static std::vector<Int_t> fgRunNumbers;     // vector with run numbers (for histograms vs. run number)
-  static Int_t fgRunID;                       // run ID
-  static TH1* fgAvgMultVsVtxGlobal      [kNMultiplicityEstimators];        // average multiplicity vs. z-vertex position (global)
-  static TH1* fgAvgMultVsVtxRunwise     [kNMultiplicityEstimators];        // average multiplicity vs. z-vertex position (run-by-run)
-  static TH1* fgAvgMultVsRun            [kNMultiplicityEstimators];           // average multiplicity vs. run number
-  static TH2* fgAvgMultVsVtxAndRun      [kNMultiplicityEstimators];  // 2D : average multiplicity vs. run number and z-vertex position
-  static Double_t fgRefMultVsVtxGlobal  [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for z-vertex correction (global)
-  static Double_t fgRefMultVsVtxRunwise [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for z-vertex correction (run-by-run)
-  static Double_t fgRefMultVsRun        [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for run correction
-  static Double_t fgRefMultVsVtxAndRun  [kNMultiplicityEstimators] [kNReferenceMultiplicities];  // reference multiplicity for run, vtx correction
-  static TString fgVZEROCalibrationPath;       // path to the VZERO calibration histograms
-  static TProfile2D* fgAvgVZEROChannelMult[64];       // average multiplicity in VZERO channels vs (vtxZ,centSPD)
-  static TProfile2D* fgVZEROqVecRecentering[4];       // (vtxZ,centSPD) maps of the VZERO A and C recentering Qvector offsets
-  static TProfile2D* fgTPCqVecRecentering[2];       // (vtxZ,centV0) maps of the TPC recentering Qvector offsets
-  static Bool_t fgOptionCalibrateVZEROqVec;         //option to calibrate V0
-  static Bool_t fgOptionRecenterVZEROqVec;         //option to do Q vector recentering for V0
-  static Bool_t fgOptionRecenterTPCqVec;           //option to do Q vector recentering for TPC
-  static Bool_t fgOptionEventRes;                 //option to divide by resolution
-  
   AliReducedVarManager(AliReducedVarManager const&);
   AliReducedVarManager& operator=(AliReducedVarManager const&);  
   
@@ -339,6 +339,9 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fWeightCentrality(NULL),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fUseCandidateTable(kFALSE),
+  fCandidateTable(NULL),
+  fShareMesonCandidates(kFALSE),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -625,6 +628,9 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fWeightCentrality(NULL),
   fEnableClusterCutsForTrigger(kFALSE),
   fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fUseCandidateTable(kFALSE),
+  fCandidateTable(NULL),
+  fShareMesonCandidates(kFALSE),
   tBrokenFiles(NULL),
   fFileNameBroken(NULL)
 {
@@ -660,6 +666,11 @@ AliAnalysisTaskGammaConvV1::~AliAnalysisTaskGammaConvV1()
     fWeightCentrality = 0x0;
   }
 
+  if(fCandidateTable){
+    delete fCandidateTable;
+    fCandidateTable = 0x0;
+  }
+
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaConvV1::InitBack(){
@@ -753,6 +764,19 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
   fV0Reader=(AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
   if(!fV0Reader){printf("Error: No V0 Reader");return;} // GetV0Reader
 
+  // Per-event table of the cut independent photon quantities, shared by the photon cuts of all cut sets
+  if(fUseCandidateTable){
+    fCandidateTable = new AliConvPhotonCandidateTable();
+    fShareMesonCandidates = fDoMesonAnalysis;
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      ((AliConversionPhotonCuts*)fCutArray->At(iCut))->SetCandidateTable(fCandidateTable);
+      if(!fDoMesonAnalysis) continue;
+      // meson candidates can only be shared if no cut set changes the photon momenta in place
+      AliConversionMesonCuts *mesonCuts = (AliConversionMesonCuts*)fMesonCutArray->At(iCut);
+      if(mesonCuts->UseMCPSmearing() && fIsMC > 0) fShareMesonCandidates = kFALSE;
+      if(mesonCuts->DoBGCalculation() && mesonCuts->BackgroundHandlerType() != 0 && mesonCuts->UseRotationMethod()) fShareMesonCandidates = kFALSE;
+    }
+  }
 
   if( ((AliConversionPhotonCuts*)fCutArray->At(0))->GetUseBDTPhotonCuts()){
       fEnableBDT  = kTRUE;
@@ -2241,6 +2265,7 @@ void AliAnalysisTaskGammaConvV1::UserExec(Option_t *)
   }
 
   fReaderGammas = fV0Reader->GetReconstructedGammas(); // Gammas from default Cut
+  if(fCandidateTable) fCandidateTable->Clear(); // new event
 
   // ------------------- BeginEvent ----------------------------
 
@@ -3914,9 +3939,15 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
         gamma0->GetTrackLabelNegative() == gamma1->GetTrackLabelPositive() ||
         gamma0->GetTrackLabelPositive() == gamma1->GetTrackLabelNegative() ) continue;
 
-        AliAODConversionMother *pi0cand = new AliAODConversionMother(gamma0,gamma1);
-        pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
-        pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        AliAODConversionMother *pi0cand = NULL;
+        if(fShareMesonCandidates){ // built once per event for all cut sets, owned by fCandidateTable
+          pi0cand = fCandidateTable->GetMesonCandidate(gamma0,gamma1,fInputEvent);
+          pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
+        } else {
+          pi0cand = new AliAODConversionMother(gamma0,gamma1);
+          pi0cand->SetLabels(firstGammaIndex,secondGammaIndex);
+          pi0cand->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        }
 
         if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(pi0cand,kTRUE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
           if(fDoCentralityFlat > 0){
@@ -4110,7 +4141,7 @@ void AliAnalysisTaskGammaConvV1::CalculatePi0Candidates(){
             }
           }
         }
-        delete pi0cand;
+        if(!fShareMesonCandidates) delete pi0cand;
         pi0cand=0x0;
       }
     }
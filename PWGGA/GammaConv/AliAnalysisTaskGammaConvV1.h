@@ -12,6 +12,7 @@
 #include "AliConversionMesonCuts.h"
 #include "AliAnalysisManager.h"
 #include "AliAnalysisTaskConvJet.h"
+#include "AliConvPhotonCandidateTable.h"
 #include "TProfile2D.h"
 #include "TH3.h"
 #include "TH3F.h"
@@ -46,6 +47,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void SetDoPlotVsCentrality(Bool_t flag)                       { fDoPlotVsCentrality         = flag    ;}
     void SetDoTHnSparse(Bool_t flag)                              { fDoTHnSparse                = flag    ;}
     void SetDoCentFlattening(Int_t flag)                          { fDoCentralityFlat           = flag    ;}
+    void SetUseCandidateTable(Bool_t flag)                        { fUseCandidateTable          = flag    ;}
     void ProcessPhotonCandidates();
     void SetFileNameBDT(TString filename) { fFileNameBDT = filename.Data() ;}
     void InitializeBDT();
@@ -387,6 +389,9 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Double_t*                         fWeightCentrality;                          //[fnCuts], weight for centrality flattening
     Bool_t                            fEnableClusterCutsForTrigger;               //enables ClusterCuts for Trigger
     Bool_t                            fDoMaterialBudgetWeightingOfGammasForTrueMesons;
+    Bool_t                            fUseCandidateTable;                         // share cut independent photon quantities and meson candidates between the cut sets
+    AliConvPhotonCandidateTable*      fCandidateTable;                            //! per-event table shared by the photon cuts of all cut sets
+    Bool_t                            fShareMesonCandidates;                      //! meson candidates can be taken from fCandidateTable (no cut set modifies the photons)
     TTree*                            tBrokenFiles;                               // tree for keeping track of broken files
     TObjString*                       fFileNameBroken;                            // string object for broken file name
 
@@ -394,7 +399,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 45);
+    ClassDef(AliAnalysisTaskGammaConvV1, 46);
 };
 
 #endif
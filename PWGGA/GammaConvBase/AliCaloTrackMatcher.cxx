@@ -24,6 +24,7 @@
 #include "AliAODEvent.h"
 #include "AliCaloTrackMatcher.h"
 #include "AliEMCALRecoUtils.h"
+#include "AliEmcalTrackExtrapolationCache.h"
 #include "AliESDEvent.h"
 #include "AliESDtrack.h"
 #include "AliESDtrackCuts.h"
@@ -57,6 +58,7 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fMatchingWindow(200),
   fMatchingResidual(0.2),
   fRunNumber(-1),
+  fUseExtrapolationCache(kTRUE),
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
   fMapTrackToCluster(),
@@ -72,7 +74,8 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fSecMap_TrID_ClID_AlreadyTried(),
   fListHistos(NULL),
   fHistControlMatches(NULL),
-  fSecHistControlMatches(NULL)
+  fSecHistControlMatches(NULL),
+  fHistExtrapolationCache(NULL)
 {
     // Default constructor
     DefineInput(0, TChain::Class());
@@ -157,6 +160,11 @@ void AliCaloTrackMatcher::UserCreateOutputObjects(){
   fSecHistControlMatches->GetXaxis()->SetBinLabel(6,"w/o match to cluster");
   fSecHistControlMatches->GetXaxis()->SetBinLabel(7,"nTr out, w/ match");
   fListHistos->Add(fSecHistControlMatches);
+
+  fHistExtrapolationCache = new TH1F(Form("ExtrapolationCache_%i_%i",fClusterType,fRunningMode),Form("ExtrapolationCache_%i_%i",fClusterType,fRunningMode),2,-0.5,1.5);
+  fHistExtrapolationCache->GetXaxis()->SetBinLabel(1,"hit");
+  fHistExtrapolationCache->GetXaxis()->SetBinLabel(2,"miss");
+  fListHistos->Add(fHistExtrapolationCache);
 }
 
 //________________________________________________________________________
@@ -233,6 +241,9 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
       return;
     }
   }
+  AliEmcalTrackExtrapolationCache *cache = NULL;
+  if(fUseExtrapolationCache) cache = AliEmcalTrackExtrapolationCache::GetCache(event);
+
   static AliESDtrackCuts *EsdTrackCuts = 0x0;
   static int prevRun = -1;
   // Using standard function for setting Cuts
@@ -360,7 +371,14 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
 
     //propagate tracks to emc surfaces
     if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
-      if (!AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt)) {
+      Bool_t propagated = kFALSE;
+      if(cache){
+        propagated = cache->ExtrapolateTrackToEMCalSurface(inTrack, &emcParam, 440., 0.139, 20., eta, phi, pt);
+        if(fHistExtrapolationCache) fHistExtrapolationCache->Fill(cache->IsLastHit() ? 0. : 1.);
+      }else{
+        propagated = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt);
+      }
+      if (!propagated) {
         delete trackParam;
         fHistControlMatches->Fill(2.,inTrack->Pt());
         continue;
@@ -640,7 +658,13 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 
   if(cluster->IsEMCAL()){
     Float_t eta = 0;Float_t phi = 0;Float_t pt = 0;
-    propagated = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt);
+    AliEmcalTrackExtrapolationCache *cache = fUseExtrapolationCache ? AliEmcalTrackExtrapolationCache::GetCache(event) : NULL;
+    if(cache){
+      propagated = cache->ExtrapolateTrackToEMCalSurface(inSecTrack, &emcParam, 430, 0.000510999, 20, eta, phi, pt);
+      if(fHistExtrapolationCache) fHistExtrapolationCache->Fill(cache->IsLastHit() ? 0. : 1.);
+    }else{
+      propagated = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt);
+    }
     if(propagated){
       if( TMath::Abs(eta) > 0.8 ) {
         delete trackParam;
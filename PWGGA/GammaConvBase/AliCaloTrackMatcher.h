@@ -9,6 +9,7 @@
 #include <utility>
 
 class TF1;
+class TH1F;
 
 using namespace std;
 
@@ -31,6 +32,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void SetAnalysisTrainMode(TString mode){fAnalysisTrainMode = mode; return;}
     void SetMatchingResidual(Float_t res) {fMatchingResidual = res; return;}
     void SetMatchingWindow(Float_t win) {fMatchingWindow = win; return;}
+    void SetUseExtrapolationCache(Bool_t b) {fUseExtrapolationCache = b; return;}
 
     // for cluster <-> primary matching
     Bool_t GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi);
@@ -107,6 +109,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     Double_t              fMatchingWindow;         // matching window to prevent unnecessary propagations
     Float_t               fMatchingResidual;       // matching residual below which track <-> cluster associations should be stored
     Int_t                 fRunNumber;              // current run number
+    Bool_t                fUseExtrapolationCache;  // share the propagations to the EMCal surface with other tasks (AliEmcalTrackExtrapolationCache)
 
     AliEMCALGeometry*     fGeomEMCAL;              // pointer to EMCAL geometry
     AliPHOSGeometry*      fGeomPHOS;               // pointer to PHOS geometry
@@ -131,8 +134,9 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     TList*                fListHistos;             // list with histogram(s)
     TH2F*                 fHistControlMatches;     // bookkeeping for processed tracks/clusters and succesful matches
     TH2F*                 fSecHistControlMatches;  // bookkeeping for processed V0-tracks/clusters and succesful matches
+    TH1F*                 fHistExtrapolationCache; // propagations to the EMCal surface found in the extrapolation cache (hit) or done (miss)
 
-    ClassDef(AliCaloTrackMatcher,5)
+    ClassDef(AliCaloTrackMatcher,6)
 };
 
 #endif
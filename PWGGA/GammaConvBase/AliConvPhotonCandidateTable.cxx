@@ -0,0 +1,121 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include "AliConvPhotonCandidateTable.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+#include "AliAODEvent.h"
+#include "AliAODv0.h"
+#include "AliPIDResponse.h"
+#include "AliAODConversionPhoton.h"
+#include "AliAODConversionMother.h"
+
+//________________________________________________________________________
+AliConvPhotonCandidateTable::AliConvPhotonCandidateTable():
+  fAODTracksByIDFilled(kFALSE),
+  fAODTracksByID(),
+  fAODV0sFilled(kFALSE),
+  fAODV0s(),
+  fNSigma(),
+  fMesonCandidates()
+{
+  // Default constructor
+}
+
+//________________________________________________________________________
+AliConvPhotonCandidateTable::~AliConvPhotonCandidateTable()
+{
+  // Destructor
+  Clear();
+}
+
+//________________________________________________________________________
+void AliConvPhotonCandidateTable::Clear()
+{
+  // Forget everything cached for the previous event
+  fAODTracksByIDFilled = kFALSE;
+  fAODTracksByID.clear();
+  fAODV0sFilled = kFALSE;
+  fAODV0s.clear();
+  fNSigma.clear();
+  for(std::map<PhotonPair,AliAODConversionMother*>::iterator it = fMesonCandidates.begin(); it != fMesonCandidates.end(); ++it){
+    delete it->second;
+  }
+  fMesonCandidates.clear();
+}
+
+//________________________________________________________________________
+AliVTrack* AliConvPhotonCandidateTable::GetAODTrackByID(AliVEvent *event, Int_t id)
+{
+  // Same result as the loop over all tracks in AliConversionPhotonCuts::GetTrack
+  // for not relabelled AODs: the first track with the given ID
+  if(!fAODTracksByIDFilled){
+    for(Int_t ii=0; ii<event->GetNumberOfTracks(); ii++){
+      AliVTrack *track = dynamic_cast<AliVTrack*>(event->GetTrack(ii));
+      if(track) fAODTracksByID.insert(std::make_pair(track->GetID(),track)); // keeps the first one
+    }
+    fAODTracksByIDFilled = kTRUE;
+  }
+  std::map<Int_t,AliVTrack*>::const_iterator it = fAODTracksByID.find(id);
+  return it != fAODTracksByID.end() ? it->second : NULL;
+}
+
+//________________________________________________________________________
+Bool_t AliConvPhotonCandidateTable::IsV0InAOD(AliVEvent *event, Int_t posID, Int_t negID)
+{
+  // Check if a V0 with the same two tracks (in any order) exists in the AOD
+  if(!fAODV0sFilled){
+    AliAODEvent *aodEvent = dynamic_cast<AliAODEvent*>(event);
+    if(aodEvent){
+      for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+        AliAODv0 *v0 = aodEvent->GetV0(iV);
+        if(!v0) continue;
+        fAODV0s.insert(std::make_pair(v0->GetPosID(),v0->GetNegID()));
+      }
+    }
+    fAODV0sFilled = kTRUE;
+  }
+  return fAODV0s.count(std::make_pair(posID,negID)) || fAODV0s.count(std::make_pair(negID,posID));
+}
+
+//________________________________________________________________________
+Float_t AliConvPhotonCandidateTable::GetNumberOfSigmas(AliPIDResponse *pidResponse, AliVTrack *track, ENSigma type)
+{
+  // PID n-sigma of the track, computed only once per event
+  NSigma &nSigma = fNSigma[track];
+  if(!nSigma.fIsSet[type]){ // value-initialized by the map: not yet computed
+    switch(type){
+      case kTPCElectron: nSigma.fValue[type] = pidResponse->NumberOfSigmasTPC(track,AliPID::kElectron); break;
+      case kTPCPion:     nSigma.fValue[type] = pidResponse->NumberOfSigmasTPC(track,AliPID::kPion);     break;
+      case kTPCKaon:     nSigma.fValue[type] = pidResponse->NumberOfSigmasTPC(track,AliPID::kKaon);     break;
+      case kTPCProton:   nSigma.fValue[type] = pidResponse->NumberOfSigmasTPC(track,AliPID::kProton);   break;
+      case kTOFElectron: nSigma.fValue[type] = pidResponse->NumberOfSigmasTOF(track,AliPID::kElectron); break;
+      case kITSElectron: nSigma.fValue[type] = pidResponse->NumberOfSigmasITS(track,AliPID::kElectron); break;
+      default: return 0.;
+    }
+    nSigma.fIsSet[type] = kTRUE;
+  }
+  return nSigma.fValue[type];
+}
+
+//________________________________________________________________________
+AliAODConversionMother* AliConvPhotonCandidateTable::GetMesonCandidate(AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1, AliVEvent *event)
+{
+  // Meson candidate from the two photons, built once per event and owned by the table.
+  // The labels depend on the photon list of the cut set and have to be set by the caller.
+  AliAODConversionMother *&mother = fMesonCandidates[PhotonPair(gamma0,gamma1)];
+  if(!mother){
+    mother = new AliAODConversionMother(gamma0,gamma1);
+    mother->CalculateDistanceOfClossetApproachToPrimVtx(event->GetPrimaryVertex());
+  }
+  return mother;
+}
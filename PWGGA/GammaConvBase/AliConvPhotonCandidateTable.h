@@ -0,0 +1,80 @@
+#ifndef ALICONVPHOTONCANDIDATETABLE_H
+#define ALICONVPHOTONCANDIDATETABLE_H
+
+#include <map>
+#include <set>
+#include <utility>
+#include "Rtypes.h"
+
+class AliVEvent;
+class AliVTrack;
+class AliPIDResponse;
+class AliAODConversionPhoton;
+class AliAODConversionMother;
+
+/**
+ * @class AliConvPhotonCandidateTable
+ * @brief Per-event cache of the cut independent quantities of the conversion photon candidates
+ * @ingroup GammaConv
+ *
+ * A task running many photon/meson cut sets on the same V0 reader output
+ * shares one table between all its AliConversionPhotonCuts objects. Every
+ * quantity which does not depend on the cut values is computed by the first
+ * cut set which needs it and is looked up by all the others:
+ *
+ * - the AOD track for a track ID (the ID map is built once per event instead
+ *   of a loop over all tracks for every call of GetTrack),
+ * - the (pos,neg) track IDs of the AOD V0s, for the check that a photon
+ *   from AliAODGammaConversion.root is contained in the AOD,
+ * - the PID n-sigma values of the daughter tracks,
+ * - the meson candidates built from two photons, which are identical for all
+ *   cut sets selecting both photons (unless the photons are smeared).
+ *
+ * Clear() has to be called at the beginning of each event.
+ */
+class AliConvPhotonCandidateTable {
+
+  public:
+    enum ENSigma {
+      kTPCElectron = 0,
+      kTPCPion,
+      kTPCKaon,
+      kTPCProton,
+      kTOFElectron,
+      kITSElectron,
+      kNNSigma
+    };
+
+    AliConvPhotonCandidateTable();
+    ~AliConvPhotonCandidateTable();
+
+    void Clear();
+
+    AliVTrack* GetAODTrackByID(AliVEvent *event, Int_t id);
+    Bool_t IsV0InAOD(AliVEvent *event, Int_t posID, Int_t negID);
+    Float_t GetNumberOfSigmas(AliPIDResponse *pidResponse, AliVTrack *track, ENSigma type);
+
+    AliAODConversionMother* GetMesonCandidate(AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1, AliVEvent *event);
+
+    Int_t GetNMesonCandidates() const { return (Int_t)fMesonCandidates.size(); }
+
+  private:
+    AliConvPhotonCandidateTable(const AliConvPhotonCandidateTable&);            // not implemented
+    AliConvPhotonCandidateTable& operator=(const AliConvPhotonCandidateTable&); // not implemented
+
+    struct NSigma {
+      Float_t fValue[kNNSigma];                                                       ///< n-sigma values
+      Bool_t  fIsSet[kNNSigma];                                                       ///< value already computed
+    };
+
+    typedef std::pair<AliAODConversionPhoton*,AliAODConversionPhoton*> PhotonPair;
+
+    Bool_t                                          fAODTracksByIDFilled;           ///< fAODTracksByID filled for this event
+    std::map<Int_t,AliVTrack*>                      fAODTracksByID;                 ///< AOD track ID -> first track with this ID
+    Bool_t                                          fAODV0sFilled;                  ///< fAODV0s filled for this event
+    std::set<std::pair<Int_t,Int_t> >               fAODV0s;                        ///< (pos,neg) track IDs of the AOD V0s
+    std::map<const AliVTrack*,NSigma>               fNSigma;                        ///< PID n-sigma values per track
+    std::map<PhotonPair,AliAODConversionMother*>    fMesonCandidates;               ///< meson candidates, owned
+};
+
+#endif
@@ -101,6 +101,7 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   AliAnalysisCuts(name,title),
   fHistograms(NULL),
   fPIDResponse(NULL),
+  fCandidateTable(NULL),
   fDoLightOutput(kFALSE),
   fV0ReaderName("V0ReaderV1"),
   fMaxR(200),
@@ -274,6 +275,7 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   AliAnalysisCuts(ref),
   fHistograms(NULL),
   fPIDResponse(NULL),
+  fCandidateTable(NULL),
   fDoLightOutput(ref.fDoLightOutput),
   fV0ReaderName("V0ReaderV1"),
   fMaxR(ref.fMaxR),
@@ -1381,12 +1383,16 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelected(AliConversionPhotonBase *photon
     Int_t v0PosID = posTrack->GetID();
     Int_t v0NegID = negTrack->GetID();
     AliAODv0* v0 = NULL;
-    for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
-      v0 = aodEvent->GetV0(iV);
-      if(!v0) continue;
-      if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
-        bFound = kTRUE;
-        break;
+    if(fCandidateTable){
+      bFound = fCandidateTable->IsV0InAOD(event,v0PosID,v0NegID);
+    } else {
+      for(Int_t iV=0; iV<aodEvent->GetNumberOfV0s(); iV++){
+        v0 = aodEvent->GetV0(iV);
+        if(!v0) continue;
+        if( (v0PosID == v0->GetPosID() && v0NegID == v0->GetNegID()) || (v0PosID == v0->GetNegID() && v0NegID == v0->GetPosID()) ){
+          bFound = kTRUE;
+          break;
+        }
       }
     }
     if(!bFound){
@@ -1744,8 +1750,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
 
   Float_t KappaPlus, KappaMinus, Kappa;
   if(fDoElecDeDxPostCalibration){
-    CentrnSig[0]=fPIDResponse->NumberOfSigmasTPC(negTrack,AliPID::kElectron);
-    CentrnSig[1]=fPIDResponse->NumberOfSigmasTPC(posTrack,AliPID::kElectron);
+    CentrnSig[0]=GetNumberOfSigmas(negTrack,AliConvPhotonCandidateTable::kTPCElectron);
+    CentrnSig[1]=GetNumberOfSigmas(posTrack,AliConvPhotonCandidateTable::kTPCElectron);
     P[0]        =negTrack->P();
     P[1]        =posTrack->P();
     Eta[0]      =negTrack->Eta();
@@ -1754,8 +1760,8 @@ Float_t AliConversionPhotonCuts::GetKappaTPC(AliConversionPhotonBase *gamma, Ali
     KappaMinus = GetCorrectedElectronTPCResponse(negTrack->Charge(),CentrnSig[0],P[0],Eta[0],R);
     KappaPlus =  GetCorrectedElectronTPCResponse(posTrack->Charge(),CentrnSig[1],P[1],Eta[1],R);
   }else{
-    KappaMinus = fPIDResponse->NumberOfSigmasTPC(negTrack, AliPID::kElectron);
-    KappaPlus =  fPIDResponse->NumberOfSigmasTPC(posTrack, AliPID::kElectron);
+    KappaMinus = GetNumberOfSigmas(negTrack,AliConvPhotonCandidateTable::kTPCElectron);
+    KappaPlus =  GetNumberOfSigmas(posTrack,AliConvPhotonCandidateTable::kTPCElectron);
   }
   Kappa = ( TMath::Abs(KappaMinus) + TMath::Abs(KappaPlus) ) / 2.0 + 2.0*(KappaMinus+KappaPlus);
 
@@ -1797,13 +1803,29 @@ Bool_t AliConversionPhotonCuts::GetBDTVariableValues(AliConversionPhotonBase *ga
   values[2]= (Float_t)negTrack->GetTPCClusterInfo(2,0,GetFirstTPCRow(gamma->GetConversionRadius())); //"fracClsTPCElectron"
   values[3]= nPosClusterITS; //"clsITSPositron"
   values[4]= nNegClusterITS; //"clsITSElectron"
-  values[5]=fPIDResponse->NumberOfSigmasTPC(negTrack,AliPID::kElectron); //"nSigmaTPCElectron"
-  values[6]=fPIDResponse->NumberOfSigmasTPC(posTrack,AliPID::kElectron); //"nSigmaTPCPositron"
+  values[5]=GetNumberOfSigmas(negTrack,AliConvPhotonCandidateTable::kTPCElectron); //"nSigmaTPCElectron"
+  values[6]=GetNumberOfSigmas(posTrack,AliConvPhotonCandidateTable::kTPCElectron); //"nSigmaTPCPositron"
 
   return kTRUE;
 }
 
 
+///________________________________________________________________________
+Float_t AliConversionPhotonCuts::GetNumberOfSigmas(AliVTrack *track, AliConvPhotonCandidateTable::ENSigma type){
+  // PID n-sigma of the track, taken from the candidate table shared by the cut sets of the task if there is one
+
+  if(fCandidateTable) return fCandidateTable->GetNumberOfSigmas(fPIDResponse,track,type);
+  switch(type){
+    case AliConvPhotonCandidateTable::kTPCElectron: return fPIDResponse->NumberOfSigmasTPC(track,AliPID::kElectron);
+    case AliConvPhotonCandidateTable::kTPCPion:     return fPIDResponse->NumberOfSigmasTPC(track,AliPID::kPion);
+    case AliConvPhotonCandidateTable::kTPCKaon:     return fPIDResponse->NumberOfSigmasTPC(track,AliPID::kKaon);
+    case AliConvPhotonCandidateTable::kTPCProton:   return fPIDResponse->NumberOfSigmasTPC(track,AliPID::kProton);
+    case AliConvPhotonCandidateTable::kTOFElectron: return fPIDResponse->NumberOfSigmasTOF(track,AliPID::kElectron);
+    case AliConvPhotonCandidateTable::kITSElectron: return fPIDResponse->NumberOfSigmasITS(track,AliPID::kElectron);
+    default: return 0.;
+  }
+}
+
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionPhotonBase* photon){
   // Supposed to use post calibration
@@ -1813,7 +1835,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
   if(!fPIDResponse){AliError("No PID Response"); return kTRUE;}// if still missing fatal error
 
   Short_t Charge    = fCurrentTrack->Charge();
-  Double_t electronNSigmaTPC = fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kElectron);
+  Double_t electronNSigmaTPC = GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCElectron);
   Double_t electronNSigmaTPCCor=0.; 
   Double_t P=0.;         
   Double_t Eta=0.;    
@@ -1848,12 +1870,12 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     // TPC Pion Line
     if( fCurrentTrack->P()>fPIDMinPnSigmaAbovePionLine && fCurrentTrack->P()<fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+        if( electronNSigmaTPCCor >fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCPion)<fPIDnSigmaAbovePionLine){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLine){
+        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCPion)<fPIDnSigmaAbovePionLine){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
@@ -1864,12 +1886,12 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
     // High Pt Pion rej
     if( fCurrentTrack->P()>fPIDMaxPnSigmaAbovePionLine ){
       if(fDoElecDeDxPostCalibration){
-        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+        if( electronNSigmaTPCCor > fPIDnSigmaBelowElectronLine && electronNSigmaTPCCor < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCPion)<fPIDnSigmaAbovePionLineHighPt){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       } else{
-        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion)<fPIDnSigmaAbovePionLineHighPt){
+        if( electronNSigmaTPC > fPIDnSigmaBelowElectronLine && electronNSigmaTPC < fPIDnSigmaAboveElectronLine && GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCPion)<fPIDnSigmaAbovePionLineHighPt){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
@@ -1881,7 +1903,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoKaonRejectionLowP == kTRUE && !fSwitchToKappa){
     if(fCurrentTrack->P()<fPIDMinPKaonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kKaon))<fPIDnSigmaAtLowPAroundKaonLine){
+      if( TMath::Abs(GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCKaon))<fPIDnSigmaAtLowPAroundKaonLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -1891,7 +1913,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoProtonRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPProtonRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kProton))<fPIDnSigmaAtLowPAroundProtonLine){
+      if( TMath::Abs(GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCProton))<fPIDnSigmaAtLowPAroundProtonLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -1901,7 +1923,7 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
 
   if(fDoPionRejectionLowP == kTRUE && !fSwitchToKappa){
     if( fCurrentTrack->P()<fPIDMinPPionRejectionLowP ){
-      if( TMath::Abs(fPIDResponse->NumberOfSigmasTPC(fCurrentTrack,AliPID::kPion))<fPIDnSigmaAtLowPAroundPionLine){
+      if( TMath::Abs(GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTPCPion))<fPIDnSigmaAtLowPAroundPionLine){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
@@ -1919,29 +1941,29 @@ Bool_t AliConversionPhotonCuts::dEdxCuts(AliVTrack *fCurrentTrack,AliConversionP
       Double_t dT = TOFsignal - t0 - times[0];
       fHistoTOFbefore->Fill(fCurrentTrack->P(),dT);
     }
-    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+    if(fHistoTOFSigbefore) fHistoTOFSigbefore->Fill(fCurrentTrack->P(),GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTOFElectron));
     if(fUseTOFpid){
-      if(fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)>fTofPIDnSigmaAboveElectronLine ||
-        fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron)<fTofPIDnSigmaBelowElectronLine ){
+      if(GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTOFElectron)>fTofPIDnSigmaAboveElectronLine ||
+        GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTOFElectron)<fTofPIDnSigmaBelowElectronLine ){
         if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
         return kFALSE;
       }
     }
-    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasTOF(fCurrentTrack, AliPID::kElectron));
+    if(fHistoTOFSigafter)fHistoTOFSigafter->Fill(fCurrentTrack->P(),GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kTOFElectron));
   }
   cutIndex++; //8
 
   if((fCurrentTrack->GetStatus() & AliESDtrack::kITSpid)){
-    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+    if(fHistoITSSigbefore) fHistoITSSigbefore->Fill(fCurrentTrack->P(),GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kITSElectron));
     if(fUseITSpid){
       if(fCurrentTrack->Pt()<=fMaxPtPIDITS){
-        if(fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)>fITSPIDnSigmaAboveElectronLine || fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron)<fITSPIDnSigmaBelowElectronLine ){
+        if(GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kITSElectron)>fITSPIDnSigmaAboveElectronLine || GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kITSElectron)<fITSPIDnSigmaBelowElectronLine ){
           if(fHistodEdxCuts)fHistodEdxCuts->Fill(cutIndex,fCurrentTrack->Pt());
           return kFALSE;
         }
       }
     }
-    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),fPIDResponse->NumberOfSigmasITS(fCurrentTrack, AliPID::kElectron));
+    if(fHistoITSSigafter)fHistoITSSigafter->Fill(fCurrentTrack->P(),GetNumberOfSigmas(fCurrentTrack,AliConvPhotonCandidateTable::kITSElectron));
   }
 
   cutIndex++; //9
@@ -2031,6 +2053,9 @@ AliVTrack *AliConversionPhotonCuts::GetTrack(AliVEvent * event, Int_t label){
       if(event->GetTrack(label)) track = dynamic_cast<AliVTrack*>(event->GetTrack(label));
       return track;
     }
+    else if(fCandidateTable){
+      return fCandidateTable->GetAODTrackByID(event,label);
+    }
     else{
       for(Int_t ii=0; ii<event->GetNumberOfTracks(); ii++) {
         if(event->GetTrack(ii)) track = dynamic_cast<AliVTrack*>(event->GetTrack(ii));
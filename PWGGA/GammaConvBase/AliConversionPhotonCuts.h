@@ -17,6 +17,7 @@
 #include "AliAnalysisManager.h"
 #include "AliDalitzAODESDMC.h"
 #include "AliDalitzEventMC.h"
+#include "AliConvPhotonCandidateTable.h"
 
 
 class AliESDEvent;
@@ -179,8 +180,10 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
 
     void SetV0ReaderName(TString name){fV0ReaderName = name; return;}
     void SetProcessAODCheck(Bool_t flag){fProcessAODCheck = flag; return;}
+    void SetCandidateTable(AliConvPhotonCandidateTable *table){fCandidateTable = table; return;}
 
     AliVTrack * GetTrack(AliVEvent * event, Int_t label);
+    Float_t GetNumberOfSigmas(AliVTrack * track, AliConvPhotonCandidateTable::ENSigma type);
     AliESDtrack *GetESDTrack(AliESDEvent * event, Int_t label);
 
     ///Cut functions
@@ -267,6 +270,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
   protected:
     TList*            fHistograms;                          ///< List of QA histograms
     AliPIDResponse*   fPIDResponse;                         ///< PID response
+    AliConvPhotonCandidateTable* fCandidateTable;           //!<! per-event cache shared with the other cut sets of the task, not owned
 
     Bool_t            fDoLightOutput;                       ///< switch for running light output, kFALSE -> normal mode, kTRUE -> light mode
     TString           fV0ReaderName;						   ///< Name of the V0 reader
@@ -422,7 +426,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
 
   private:
     /// \cond CLASSIMP
-    ClassDef(AliConversionPhotonCuts,25)
+    ClassDef(AliConversionPhotonCuts,26)
     /// \endcond
 };
 
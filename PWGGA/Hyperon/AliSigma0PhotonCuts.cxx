@@ -6,6 +6,7 @@
 #include "TMath.h"
 #include "AliV0ReaderV1.h"
 #include "AliNanoAODTrack.h"
+#include "AliLog.h"
 
 ClassImp(AliSigma0PhotonCuts)
 
@@ -229,6 +230,9 @@ void AliSigma0PhotonCuts::PhotonCuts(
       continue;
     fHistCuts->Fill(2.f);
 
+    if (pos->InheritsFrom("AliNanoAODTrackView")) {
+      AliFatal("Columnar NanoAOD tracks are not supported, write the NanoAOD without SetColumnarTracks");
+    }
     auto nanoPos = dynamic_cast<AliNanoAODTrack *>(pos);
     if(nanoPos) v0 = nullptr; // for NanoAODs we dont have a v0 matching!
 
@@ -72,6 +72,7 @@
 #include "AliESDUtils.h"
 
 #include "IClassifierReader.h"
+#include "AliHFBDTForest.h"
 
 using std::cout;
 using std::endl;
@@ -198,6 +199,7 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::AliAnalysisTaskSELc2V0bachelorTMVAApp():
   fTMVAlibName(""),
   fTMVAlibPtBin(""),
   fNamesTMVAVar(""),
+  fBDTForestFile(""),
   fBDTHisto(0),
   fBDTHistoVsMassK0S(0),
   fBDTHistoVstImpParBach(0),
@@ -342,6 +344,7 @@ AliAnalysisTaskSELc2V0bachelorTMVAApp::AliAnalysisTaskSELc2V0bachelorTMVAApp(con
   fTMVAlibName(""),
   fTMVAlibPtBin(""),
   fNamesTMVAVar(""),
+  fBDTForestFile(""),
   fBDTHisto(0),
   fBDTHistoVsMassK0S(0),
   fBDTHistoVstImpParBach(0),
@@ -989,10 +992,22 @@ void AliAnalysisTaskSELc2V0bachelorTMVAApp::UserCreateOutputObjects() {
       std::string tmpvar = variable.Data();
       inputNamesVec.push_back(tmpvar);
     }
-    void* lib = dlopen(fTMVAlibName.Data(), RTLD_NOW);
-    void* p = dlsym(lib, Form("%s", fTMVAlibPtBin.Data()));
-    IClassifierReader* (*maker1)(std::vector<std::string>&) = (IClassifierReader* (*)(std::vector<std::string>&)) p;
-    fBDTReader = maker1(inputNamesVec);
+    if (!fBDTForestFile.IsNull()) {
+      TString forestFile = fBDTForestFile;
+      gSystem->ExpandPathName(forestFile);
+      AliHFBDTForest* forest = new AliHFBDTForest(inputNamesVec);
+      if (!forest->ReadFile(forestFile.Data())) {
+	AliFatal(Form("Cannot read the BDT forest from %s", fBDTForestFile.Data()));
+      }
+      AliInfo(Form("BDT forest from %s: %d trees, %d nodes", fBDTForestFile.Data(), forest->GetNTrees(), forest->GetNNodes()));
+      fBDTReader = forest;
+    }
+    else {
+      void* lib = dlopen(fTMVAlibName.Data(), RTLD_NOW);
+      void* p = dlsym(lib, Form("%s", fTMVAlibPtBin.Data()));
+      IClassifierReader* (*maker1)(std::vector<std::string>&) = (IClassifierReader* (*)(std::vector<std::string>&)) p;
+      fBDTReader = maker1(inputNamesVec);
+    }
   }
   return;
 }
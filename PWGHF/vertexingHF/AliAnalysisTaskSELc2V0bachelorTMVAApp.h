@@ -100,6 +100,10 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   TString GetTMVAlibPtBin() {return fTMVAlibPtBin;}
   void SetNamesTMVAVariables(TString names) {fNamesTMVAVar = names;}
   TString GetNamesTMVAVariables() {return fNamesTMVAVar;}
+  /// read the BDT into an AliHFBDTForest instead of loading fTMVAlibName:
+  /// the file is either the TMVA *.class.cxx or the AliHFBDTForest format
+  void SetBDTForestFile(const char* fileName) {fBDTForestFile = fileName;}
+  TString GetBDTForestFile() {return fBDTForestFile;}
   
   /// set MC usage
   void SetMC(Bool_t theMCon) {fUseMCInfo = theMCon;}
@@ -318,6 +322,7 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   TString fTMVAlibName;                /// Name of the library to load to have the TMVA weights
   TString fTMVAlibPtBin;               /// Pt bin that will be in the library to be loaded for the TMVA
   TString fNamesTMVAVar;               /// vector of the names of the input variables
+  TString fBDTForestFile;              /// file with the BDT forest (if empty, fTMVAlibName is used)
   TH2D *fBDTHisto;                     //!<!
   TH2D *fBDTHistoVsMassK0S;            //!<! BDT classifier vs mass (pi+pi-) pairs
   TH2D *fBDTHistoVstImpParBach;        //!<! BDT classifier vs proton d0
@@ -349,7 +354,7 @@ class AliAnalysisTaskSELc2V0bachelorTMVAApp : public AliAnalysisTaskSE
   UInt_t fTimestampCut; // cut on timestamp
  
   /// \cond CLASSIMP    
-  ClassDef(AliAnalysisTaskSELc2V0bachelorTMVAApp, 8); /// class for Lc->p K0
+  ClassDef(AliAnalysisTaskSELc2V0bachelorTMVAApp, 9); /// class for Lc->p K0
   /// \endcond    
 };
 
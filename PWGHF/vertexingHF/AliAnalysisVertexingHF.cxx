@@ -70,6 +70,7 @@
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
 #include <cstring>
+#include <vector>
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisVertexingHF);
@@ -138,6 +139,7 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fMassCutBeforeVertexing2Prong(kFALSE),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -233,6 +235,7 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fMassCutBeforeVertexing2Prong(source.fMassCutBeforeVertexing2Prong),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -327,6 +330,7 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fMassCutBeforeVertexing2Prong = source.fMassCutBeforeVertexing2Prong;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -618,6 +622,27 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // partition the selected tracks by charge and flag bits: for each inner
+  // loop, index of the first track >=i that can pass its charge and flag
+  // checks (nSeleTrks if none), so that the loops jump over the other tracks.
+  // The order of the tracks in the loops is unchanged.
+  std::vector<Int_t> nextNeg(nSeleTrks+1,nSeleTrks);       // 1st loop on negative tracks
+  std::vector<Int_t> nextPos3Prong(nSeleTrks+1,nSeleTrks); // 2nd loop on positive tracks
+  std::vector<Int_t> nextNeg4Prong(nSeleTrks+1,nSeleTrks); // 3rd loop on negative tracks (4 prong)
+  std::vector<Int_t> nextNeg3Prong(nSeleTrks+1,nSeleTrks); // 2nd loop on negative tracks (3 prong -+-)
+  std::vector<Int_t> nextSoftPi(nSeleTrks+1,nSeleTrks);    // loop on soft pions
+  for(Int_t iTrk=nSeleTrks-1; iTrk>=0; iTrk--) {
+    Short_t charge=((AliESDtrack*)seleTrksArray.UncheckedAt(iTrk))->Charge();
+    Bool_t okDispl=TESTBIT(seleFlags[iTrk],kBitDispl);
+    Bool_t okDispl3Prong=okDispl && TESTBIT(seleFlags[iTrk],kBit3Prong);
+    nextNeg[iTrk]       = (okDispl && (charge<=0 || fLikeSign)) ? iTrk : nextNeg[iTrk+1];
+    nextPos3Prong[iTrk] = (okDispl3Prong && charge>=0) ? iTrk : nextPos3Prong[iTrk+1];
+    nextNeg4Prong[iTrk] = (okDispl && charge<=0) ? iTrk : nextNeg4Prong[iTrk+1];
+    nextNeg3Prong[iTrk] = (okDispl3Prong && charge<=0) ? iTrk : nextNeg3Prong[iTrk+1];
+    nextSoftPi[iTrk]    = TESTBIT(seleFlags[iTrk],kBitSoftPi) ? iTrk : nextSoftPi[iTrk+1];
+  }
+  Int_t nPairsMassPrefilter=0;
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -828,7 +853,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     if(postrack1->Charge()<0 && !fLikeSign) continue;
 
     // LOOP ON  NEGATIVE  TRACKS
-    for(iTrkN1=0; iTrkN1<nSeleTrks; iTrkN1++) {
+    for(iTrkN1=nextNeg[0]; iTrkN1<nSeleTrks; iTrkN1=nextNeg[iTrkN1+1]) {
 
       //if(iTrkN1%1==0) AliDebug(1,Form("    1st loop on neg: track number %d of %d",iTrkN1,nSeleTrks));
       //if(iTrkN1%1==0) printf("    1st loop on neg: track number %d of %d\n",iTrkN1,nSeleTrks);
@@ -866,6 +891,23 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       SetParametersAtVertex(negtrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN1));
       negtrack1->GetPxPyPz(momneg1);
 
+      // invariant mass cut with the momenta at the primary vertex, for the
+      // pairs which are not used to build 3 and 4 prong candidates
+      if(fMassCutBeforeVertexing2Prong &&
+	 !((f3Prong || (f4Prong && !isLikeSign2Prong)) &&
+	   TESTBIT(seleFlags[iTrkP1],kBit3Prong) && TESTBIT(seleFlags[iTrkN1],kBit3Prong))) {
+	Double_t momPairPos[3];
+	postrack1->GetPxPyPz(momPairPos);
+	Double_t pxDau[2]={momPairPos[0],momneg1[0]};
+	Double_t pyDau[2]={momPairPos[1],momneg1[1]};
+	Double_t pzDau[2]={momPairPos[2],momneg1[2]};
+	if(!SelectInvMassAndPt2prong(pxDau,pyDau,pzDau)) {
+	  nPairsMassPrefilter++;
+	  negtrack1=0;
+	  continue;
+	}
+      }
+
       // DCA between the two tracks
       dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
@@ -941,7 +983,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  AliNeutralTrackParam *trackD0 = new AliNeutralTrackParam(io2Prong);
 
 	  // LOOP ON TRACKS THAT PASSED THE SOFT PION CUTS
-	  for(iTrkSoftPi=0; iTrkSoftPi<nSeleTrks; iTrkSoftPi++) {
+	  for(iTrkSoftPi=nextSoftPi[0]; iTrkSoftPi<nSeleTrks; iTrkSoftPi=nextSoftPi[iTrkSoftPi+1]) {
 
 	    if(iTrkSoftPi==iTrkP1 || iTrkSoftPi==iTrkN1) continue;
 
@@ -1049,8 +1091,11 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       }
 
 
+      // tracks of the pair not selected for 3 prongs: nothing to do in the next loops
+      Bool_t okPair3Prong=(TESTBIT(seleFlags[iTrkP1],kBit3Prong) && TESTBIT(seleFlags[iTrkN1],kBit3Prong));
+
       // 2nd LOOP  ON  POSITIVE  TRACKS
-      for(iTrkP2=iTrkP1+1; iTrkP2<nSeleTrks; iTrkP2++) {
+      for(iTrkP2=(okPair3Prong ? nextPos3Prong[iTrkP1+1] : nSeleTrks); iTrkP2<nSeleTrks; iTrkP2=nextPos3Prong[iTrkP2+1]) {
 
 	if(iTrkP2==iTrkP1 || iTrkP2==iTrkN1) continue;
 
@@ -1244,7 +1289,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
           AliAODVertex* vertexp1n1p2 = ReconstructSecondaryVertex(threeTrackArray,dispersion);
 
 	  // 3rd LOOP  ON  NEGATIVE  TRACKS (for 4 prong)
-	  for(iTrkN2=iTrkN1+1; iTrkN2<nSeleTrks; iTrkN2++) {
+	  for(iTrkN2=nextNeg4Prong[iTrkN1+1]; iTrkN2<nSeleTrks; iTrkN2=nextNeg4Prong[iTrkN2+1]) {
 
 	    if(iTrkN2==iTrkP1 || iTrkN2==iTrkP2 || iTrkN2==iTrkN1) continue;
 
@@ -1333,7 +1378,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       twoTrackArray2->Clear();
 
       // 2nd LOOP  ON  NEGATIVE  TRACKS (for 3 prong -+-)
-      for(iTrkN2=iTrkN1+1; iTrkN2<nSeleTrks; iTrkN2++) {
+      for(iTrkN2=(okPair3Prong ? nextNeg3Prong[iTrkN1+1] : nSeleTrks); iTrkN2<nSeleTrks; iTrkN2=nextNeg3Prong[iTrkN2+1]) {
 
 	if(iTrkN2==iTrkP1 || iTrkN2==iTrkP2 || iTrkN2==iTrkN1) continue;
 
@@ -1501,6 +1546,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
  }  // end 1st loop on positive tracks
 
 
+  if(fMassCutBeforeVertexing2Prong) {
+    AliDebug(1,Form(" Pairs rejected by the mass cut before vertexing = %d;",nPairsMassPrefilter));
+  }
   //  AliDebug(1,Form(" Total HF vertices in event = %d;",
   //		  (Int_t)aodVerticesHFTClArr->GetEntriesFast()));
   if(fD0toKpi) {
@@ -2321,13 +2369,8 @@ AliAODRecoDecayHF2Prong *AliAnalysisVertexingHF::Make2Prong(
   px[1] = momentum[0]; py[1] = momentum[1]; pz[1] = momentum[2];
 
   if(!refill){//skip if it is called in refill step because already checked
-    // invariant mass cut (try to improve coding here..)
-    Bool_t okMassCut=kFALSE;
-    if(!okMassCut && fD0toKpi)   if(SelectInvMassAndPtD0Kpi(px,py,pz))     okMassCut=kTRUE;
-    if(!okMassCut && fJPSItoEle) if(SelectInvMassAndPtJpsiee(px,py,pz))    okMassCut=kTRUE;
-    if(!okMassCut && fDstar)     if(SelectInvMassAndPtDstarD0pi(px,py,pz)) okMassCut=kTRUE;
-    if(!okMassCut && fCascades)  if(SelectInvMassAndPtCascade(px,py,pz))   okMassCut=kTRUE;
-    if(!okMassCut) {
+    // invariant mass cut
+    if(!SelectInvMassAndPt2prong(px,py,pz)) {
       //AliDebug(2," candidate didn't pass mass cut");
       return 0x0;
     }
@@ -3065,6 +3108,21 @@ Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtDstarD0pi(TObjArray *trkArray){
   return retval;
 }
 //-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::SelectInvMassAndPt2prong(Double_t *px,
+							Double_t *py,
+							Double_t *pz){
+  /// Check invariant mass cut and pt candidate cut for all the
+  /// enabled 2 prong decays
+  //AliCodeTimerAuto("",0);
+
+  Bool_t okMassCut=kFALSE;
+  if(!okMassCut && fD0toKpi)   if(SelectInvMassAndPtD0Kpi(px,py,pz))     okMassCut=kTRUE;
+  if(!okMassCut && fJPSItoEle) if(SelectInvMassAndPtJpsiee(px,py,pz))    okMassCut=kTRUE;
+  if(!okMassCut && fDstar)     if(SelectInvMassAndPtDstarD0pi(px,py,pz)) okMassCut=kTRUE;
+  if(!okMassCut && fCascades)  if(SelectInvMassAndPtCascade(px,py,pz))   okMassCut=kTRUE;
+  return okMassCut;
+}
+//-----------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::SelectInvMassAndPtD0Kpi(Double_t *px,
 						       Double_t *py,
 						       Double_t *pz){
@@ -0,0 +1,458 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+// Flat representation of a TMVA BDT forest, see the header.
+//
+// Compact text format written by WriteFile:
+//   AliHFBDTForest
+//   variables <nVars> <name_0> ... <name_nVars-1>
+//   trees <nTrees> nodes <nNodes>
+//   <boostWeight> <rootNode>                          (one line per tree)
+//   <selector> <cut> <cutType> <left> <right> <value> (one line per node)
+// with selector=left=right=-1 for the leaves.
+//-------------------------------------------------------------------------
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "AliHFBDTForest.h"
+
+//_________________________________________________________________________
+AliHFBDTForest::AliHFBDTForest():
+  IClassifierReader(),
+  fNVars(0),
+  fInputVars(),
+  fBoostWeights(),
+  fTreeRoot(),
+  fNorm(0.),
+  fSelector(),
+  fCutValue(),
+  fCutType(),
+  fChild(),
+  fLeafValue()
+{
+  /// Default constructor, the forest has to be read before use
+  fStatusIsClean=false;
+}
+//_________________________________________________________________________
+AliHFBDTForest::AliHFBDTForest(const std::vector<std::string>& inputVars):
+  IClassifierReader(),
+  fNVars((Int_t)inputVars.size()),
+  fInputVars(inputVars),
+  fBoostWeights(),
+  fTreeRoot(),
+  fNorm(0.),
+  fSelector(),
+  fCutValue(),
+  fCutType(),
+  fChild(),
+  fLeafValue()
+{
+  /// Constructor with the names of the input variables, in the order of
+  /// the values passed to GetMvaValue. They are checked against the ones
+  /// stored in the forest file, if any.
+  fStatusIsClean=false;
+}
+//_________________________________________________________________________
+void AliHFBDTForest::Clear(){
+  /// Remove the trees
+  fBoostWeights.clear();
+  fTreeRoot.clear();
+  fNorm=0.;
+  fSelector.clear();
+  fCutValue.clear();
+  fCutType.clear();
+  fChild.clear();
+  fLeafValue.clear();
+  fStatusIsClean=false;
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::ReadFile(const char* fileName){
+  /// Read the forest from a file, either a class file generated by TMVA
+  /// (*.class.cxx) or a file in the compact format
+  std::ifstream in(fileName);
+  if(!in.good()){
+    printf("AliHFBDTForest::ReadFile: cannot open %s\n",fileName);
+    Clear();
+    return kFALSE;
+  }
+  std::stringstream text;
+  // TMVA classes split in *.class.h and *.class.cxx: the names of the input
+  // variables are in the header
+  std::string header(fileName);
+  if(header.size()>10 && header.compare(header.size()-10,10,".class.cxx")==0){
+    header.replace(header.size()-3,3,"h");
+    std::ifstream inHeader(header.c_str());
+    if(inHeader.good()) text << inHeader.rdbuf() << "\n";
+  }
+  text << in.rdbuf();
+  return ReadString(text.str());
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::ReadString(const std::string& text){
+  /// Read the forest from a string (e.g. embedded in the code),
+  /// same content as for ReadFile
+  Clear();
+  Bool_t ok=kFALSE;
+  if(text.find("fForest.push_back")!=std::string::npos) ok=ReadTMVAClass(text);
+  else ok=ReadCompact(text);
+  if(ok) ok=CheckForest();
+  if(!ok){
+    Clear();
+    return kFALSE;
+  }
+  for(UInt_t iTree=0; iTree<fBoostWeights.size(); iTree++) fNorm+=fBoostWeights[iTree]; // same order as in the generated code
+  fStatusIsClean=true;
+  return kTRUE;
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::ReadCompact(const std::string& text){
+  /// Read the compact format
+  std::istringstream in(text);
+  std::string key;
+  Int_t nVars=0,nTrees=0,nNodes=0;
+  in >> key;
+  if(key!="AliHFBDTForest"){
+    printf("AliHFBDTForest::ReadCompact: unknown format\n");
+    return kFALSE;
+  }
+  in >> key >> nVars;
+  if(!in || key!="variables" || nVars<=0){
+    printf("AliHFBDTForest::ReadCompact: bad list of variables\n");
+    return kFALSE;
+  }
+  std::vector<std::string> names(nVars);
+  for(Int_t iVar=0; iVar<nVars; iVar++) in >> names[iVar];
+  if(fInputVars.size()>0){
+    if(names!=fInputVars){
+      for(Int_t iVar=0; iVar<nVars && iVar<(Int_t)fInputVars.size(); iVar++){
+	if(names[iVar]!=fInputVars[iVar]) printf("AliHFBDTForest::ReadCompact: variable %d is %s in the forest, %s in the input\n",iVar,names[iVar].c_str(),fInputVars[iVar].c_str());
+      }
+      printf("AliHFBDTForest::ReadCompact: mismatch in input variables (%d in the forest, %d in the input)\n",nVars,(Int_t)fInputVars.size());
+      return kFALSE;
+    }
+  }
+  fInputVars=names;
+  fNVars=nVars;
+  std::string keyNodes;
+  in >> key >> nTrees >> keyNodes >> nNodes;
+  if(!in || key!="trees" || keyNodes!="nodes" || nTrees<=0 || nNodes<=0){
+    printf("AliHFBDTForest::ReadCompact: bad number of trees or nodes\n");
+    return kFALSE;
+  }
+  fBoostWeights.resize(nTrees);
+  fTreeRoot.resize(nTrees);
+  for(Int_t iTree=0; iTree<nTrees; iTree++) in >> fBoostWeights[iTree] >> fTreeRoot[iTree];
+  fSelector.resize(nNodes);
+  fCutValue.resize(nNodes);
+  fCutType.resize(nNodes);
+  fChild.resize(2*nNodes);
+  fLeafValue.resize(nNodes);
+  for(Int_t iNode=0; iNode<nNodes; iNode++){
+    Int_t cutType=0;
+    in >> fSelector[iNode] >> fCutValue[iNode] >> cutType >> fChild[2*iNode] >> fChild[2*iNode+1] >> fLeafValue[iNode];
+    fCutType[iNode]=(cutType!=0);
+  }
+  if(!in){
+    printf("AliHFBDTForest::ReadCompact: file truncated\n");
+    return kFALSE;
+  }
+  return kTRUE;
+}
+//_________________________________________________________________________
+std::string AliHFBDTForest::GetFunctionBody(const std::string& text, const char* name){
+  /// Body of the definition of the function name in the generated class,
+  /// without the // comments. Empty if not found
+  size_t pos=0;
+  const size_t len=strlen(name);
+  while((pos=text.find(name,pos))!=std::string::npos){
+    pos+=len;
+    size_t cur=text.find_first_not_of(" \t\n",pos);
+    if(cur==std::string::npos || text[cur]!='(') continue;
+    cur=text.find(')',cur);
+    if(cur==std::string::npos) break;
+    cur=text.find_first_not_of(" \t\n",cur+1);
+    if(cur!=std::string::npos && text.compare(cur,5,"const")==0) cur=text.find_first_not_of(" \t\n",cur+5);
+    if(cur==std::string::npos || text[cur]!='{') continue; // declaration or call
+    Int_t depth=0;
+    std::string body;
+    for(size_t i=cur; i<text.size(); i++){
+      if(text.compare(i,2,"//")==0){
+	i=text.find('\n',i);
+	if(i==std::string::npos) break;
+      }
+      body+=text[i];
+      if(text[i]=='{') depth++;
+      else if(text[i]=='}' && --depth==0) return body;
+    }
+    break;
+  }
+  return "";
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::ReadTMVAClass(const std::string& text){
+  /// Read the trees from the Initialize() method of a class generated by
+  /// TMVA MethodBase::MakeClass: pairs of
+  ///   fBoostWeights.push_back(w);
+  ///   fForest.push_back(NN(left,right,selector,cut,cutType,nodeType,purity,response));
+  /// with left/right either 0 or a nested NN(...)
+  /// Only AdaBoost-like forests with yes/no leaves and without input
+  /// transformations are supported (response = sum of boost weight x leaf
+  /// type / sum of the boost weights); the others are refused, since they
+  /// would give a different response than the generated class
+  std::string response=GetFunctionBody(text,"GetMvaValue__");
+  std::string input=GetFunctionBody(text,"GetMvaValue");
+  if(response.empty() || input.empty()){
+    printf("AliHFBDTForest::ReadTMVAClass: GetMvaValue__ or GetMvaValue not found\n");
+    return kFALSE;
+  }
+  if(response.find("GetResponse")!=std::string::npos){
+    printf("AliHFBDTForest::ReadTMVAClass: gradient boosted forest, not supported\n");
+    return kFALSE;
+  }
+  if(response.find("GetPurity")!=std::string::npos || response.find("GetNodeType")==std::string::npos){
+    printf("AliHFBDTForest::ReadTMVAClass: response not computed from the yes/no leaves, not supported\n");
+    return kFALSE;
+  }
+  if(input.find("Transform(")!=std::string::npos || input.find("Transform (")!=std::string::npos){
+    printf("AliHFBDTForest::ReadTMVAClass: transformation of the input variables, not supported\n");
+    return kFALSE;
+  }
+  if(input.find("NormVariable")!=std::string::npos){
+    printf("AliHFBDTForest::ReadTMVAClass: normalised input variables, not supported\n");
+    return kFALSE;
+  }
+
+  const char* weightKey="fBoostWeights.push_back(";
+  const char* forestKey="fForest.push_back(";
+  size_t pos=0;
+  while((pos=text.find(weightKey,pos))!=std::string::npos){
+    pos+=strlen(weightKey);
+    fBoostWeights.push_back(strtod(text.c_str()+pos,0x0));
+    pos=text.find(forestKey,pos);
+    if(pos==std::string::npos){
+      printf("AliHFBDTForest::ReadTMVAClass: tree %d not found\n",(Int_t)fBoostWeights.size()-1);
+      return kFALSE;
+    }
+    pos+=strlen(forestKey);
+    const char* cur=text.c_str()+pos;
+    Int_t root=ReadTMVANode(cur);
+    if(root<0){
+      printf("AliHFBDTForest::ReadTMVAClass: cannot parse tree %d\n",(Int_t)fBoostWeights.size()-1);
+      return kFALSE;
+    }
+    fTreeRoot.push_back(root);
+    pos=cur-text.c_str();
+  }
+  if(fBoostWeights.size()==0){
+    printf("AliHFBDTForest::ReadTMVAClass: no trees found\n");
+    return kFALSE;
+  }
+  return ReadTMVAInputVars(text);
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::ReadTMVAInputVars(const std::string& text){
+  /// Names of the input variables, from the constructor of the generated
+  /// class (const char* inputVars[] = { "name", ... };, in the *.class.h if
+  /// the class is split). They are checked against the ones given in the
+  /// constructor, as in the generated class
+  size_t pos=text.find("inputVars[]");
+  size_t end=(pos==std::string::npos) ? pos : text.find(';',pos);
+  if(end==std::string::npos){
+    // class body without the constructor: the names cannot be checked
+    printf("AliHFBDTForest::ReadTMVAInputVars: list of input variables not found, the names are not checked\n");
+    Int_t maxSelector=-1;
+    for(UInt_t iNode=0; iNode<fSelector.size(); iNode++) if(fSelector[iNode]>maxSelector) maxSelector=fSelector[iNode];
+    if(fNVars==0) fNVars=maxSelector+1;
+    return kTRUE;
+  }
+  std::vector<std::string> names;
+  while((pos=text.find('"',pos))<end){
+    size_t close=text.find('"',pos+1);
+    names.push_back(text.substr(pos+1,close-pos-1));
+    pos=close+1;
+  }
+  if(names.size()==0){
+    printf("AliHFBDTForest::ReadTMVAInputVars: no input variables\n");
+    return kFALSE;
+  }
+  if(fInputVars.size()>0 && names!=fInputVars){
+    for(UInt_t iVar=0; iVar<names.size() && iVar<fInputVars.size(); iVar++){
+      if(names[iVar]!=fInputVars[iVar]) printf("AliHFBDTForest::ReadTMVAInputVars: variable %d is %s in the class, %s in the input\n",iVar,names[iVar].c_str(),fInputVars[iVar].c_str());
+    }
+    printf("AliHFBDTForest::ReadTMVAInputVars: mismatch in input variables (%d in the class, %d in the input)\n",(Int_t)names.size(),(Int_t)fInputVars.size());
+    return kFALSE;
+  }
+  fInputVars=names;
+  fNVars=(Int_t)names.size();
+  return kTRUE;
+}
+//_________________________________________________________________________
+Int_t AliHFBDTForest::ReadTMVANode(const char*& pos){
+  /// Parse NN(...) at pos, append the node and its daughters and return
+  /// its index (-1 for a null daughter, -2 in case of error)
+  while(*pos && isspace(*pos)) pos++;
+  if(strncmp(pos,"NN(",3)!=0){
+    char* end=0x0;
+    Long_t null=strtol(pos,&end,10);
+    if(end==pos || null!=0) return -2;
+    pos=end;
+    return -1;
+  }
+  pos+=3;
+  Int_t iNode=(Int_t)fSelector.size();
+  fSelector.push_back(-1);
+  fCutValue.push_back(0.);
+  fCutType.push_back(0);
+  fChild.push_back(-1);
+  fChild.push_back(-1);
+  fLeafValue.push_back(0.);
+
+  Int_t daughter[2];
+  for(Int_t iD=0; iD<2; iD++){
+    daughter[iD]=ReadTMVANode(pos);
+    if(daughter[iD]<-1) return -2;
+    while(*pos && isspace(*pos)) pos++;
+    if(*pos!=',') return -2;
+    pos++;
+  }
+  // selector, cutValue, cutType, nodeType, purity, response
+  Double_t field[6];
+  for(Int_t iF=0; iF<6; iF++){
+    char* end=0x0;
+    field[iF]=strtod(pos,&end);
+    if(end==pos) return -2;
+    pos=end;
+    while(*pos && isspace(*pos)) pos++;
+    if(*pos!=(iF<5 ? ',' : ')')) return -2;
+    pos++;
+  }
+  Int_t nodeType=(Int_t)field[3];
+  if(nodeType==0){ // intermediate node, as in the generated GetMvaValue__
+    if(daughter[0]<0 || daughter[1]<0) return -2;
+    fSelector[iNode]=(Int_t)field[0];
+    fCutValue[iNode]=field[1];
+    fCutType[iNode]=(field[2]!=0.);
+    fChild[2*iNode]=daughter[0];
+    fChild[2*iNode+1]=daughter[1];
+  }else{
+    fLeafValue[iNode]=nodeType;
+  }
+  return iNode;
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::CheckForest(){
+  /// Check the consistency of the node arrays, so that the traversal
+  /// does not need any check
+  Int_t nNodes=(Int_t)fSelector.size();
+  if(fTreeRoot.size()!=fBoostWeights.size() || fTreeRoot.size()==0) return kFALSE;
+  for(UInt_t iTree=0; iTree<fTreeRoot.size(); iTree++){
+    if(fTreeRoot[iTree]<0 || fTreeRoot[iTree]>=nNodes) return kFALSE;
+  }
+  for(Int_t iNode=0; iNode<nNodes; iNode++){
+    if(fSelector[iNode]<0){
+      fSelector[iNode]=-1;
+      continue;
+    }
+    if(fSelector[iNode]>=fNVars){
+      printf("AliHFBDTForest::CheckForest: node %d uses variable %d, only %d input variables\n",iNode,fSelector[iNode],fNVars);
+      return kFALSE;
+    }
+    // daughters are stored after their mother: no loops
+    for(Int_t iD=0; iD<2; iD++){
+      Int_t daughter=fChild[2*iNode+iD];
+      if(daughter<=iNode || daughter>=nNodes){
+	printf("AliHFBDTForest::CheckForest: bad daughter of node %d\n",iNode);
+	return kFALSE;
+      }
+    }
+  }
+  return kTRUE;
+}
+//_________________________________________________________________________
+Bool_t AliHFBDTForest::WriteFile(const char* fileName) const {
+  /// Write the forest in the compact format
+  if(!IsStatusClean()) return kFALSE;
+  FILE* out=fopen(fileName,"w");
+  if(!out){
+    printf("AliHFBDTForest::WriteFile: cannot open %s\n",fileName);
+    return kFALSE;
+  }
+  fprintf(out,"AliHFBDTForest\nvariables %d",fNVars);
+  for(Int_t iVar=0; iVar<fNVars; iVar++){
+    // names are needed for the format: use var<i> if unknown
+    if(iVar<(Int_t)fInputVars.size()) fprintf(out," %s",fInputVars[iVar].c_str());
+    else fprintf(out," var%d",iVar);
+  }
+  fprintf(out,"\ntrees %d nodes %d\n",GetNTrees(),GetNNodes());
+  for(Int_t iTree=0; iTree<GetNTrees(); iTree++) fprintf(out,"%.17g %d\n",fBoostWeights[iTree],fTreeRoot[iTree]);
+  for(Int_t iNode=0; iNode<GetNNodes(); iNode++){
+    fprintf(out,"%d %.17g %d %d %d %.17g\n",fSelector[iNode],fCutValue[iNode],(Int_t)fCutType[iNode],fChild[2*iNode],fChild[2*iNode+1],fLeafValue[iNode]);
+  }
+  fclose(out);
+  return kTRUE;
+}
+//_________________________________________________________________________
+double AliHFBDTForest::GetMvaValue(const std::vector<double>& inputValues) const {
+  /// Classifier response, same as the generated ReadBDT_*::GetMvaValue
+  if(!IsStatusClean()){
+    printf("AliHFBDTForest::GetMvaValue: cannot return classifier response because status is dirty\n");
+    return 0.;
+  }
+  if((Int_t)inputValues.size()<fNVars){
+    printf("AliHFBDTForest::GetMvaValue: %d input values, %d needed\n",(Int_t)inputValues.size(),fNVars);
+    return 0.;
+  }
+  const Double_t* x=&inputValues[0];
+  Double_t mva=0.;
+  for(UInt_t iTree=0; iTree<fTreeRoot.size(); iTree++){
+    mva+=fBoostWeights[iTree]*fLeafValue[FindLeaf(fTreeRoot[iTree],x)];
+  }
+  return mva/fNorm;
+}
+//_________________________________________________________________________
+void AliHFBDTForest::GetMvaValues(Int_t nCand, Int_t nVars, const Double_t* inputValues, Double_t* mvaValues) const {
+  /// Classifier response for nCand candidates. inputValues is the row-major
+  /// [nCand][nVars] matrix, the variables in the order of GetMvaValue
+  /// (checked when the forest is read); nVars must be GetNVariables().
+  /// The loop on the candidates is inside the loop on the trees, so that
+  /// the nodes of one tree stay in the cache; the sums are done in the same
+  /// order as in GetMvaValue
+  for(Int_t iCand=0; iCand<nCand; iCand++) mvaValues[iCand]=0.;
+  if(!IsStatusClean()){
+    printf("AliHFBDTForest::GetMvaValues: cannot return classifier response because status is dirty\n");
+    return;
+  }
+  if(nVars!=fNVars){
+    printf("AliHFBDTForest::GetMvaValues: %d input values per candidate, %d needed\n",nVars,fNVars);
+    return;
+  }
+  for(UInt_t iTree=0; iTree<fTreeRoot.size(); iTree++){
+    const Int_t root=fTreeRoot[iTree];
+    const Double_t weight=fBoostWeights[iTree];
+    const Double_t* x=inputValues;
+    for(Int_t iCand=0; iCand<nCand; iCand++, x+=fNVars){
+      mvaValues[iCand]+=weight*fLeafValue[FindLeaf(root,x)];
+    }
+  }
+  for(Int_t iCand=0; iCand<nCand; iCand++) mvaValues[iCand]/=fNorm;
+}
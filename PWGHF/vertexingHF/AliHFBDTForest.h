@@ -0,0 +1,79 @@
+#ifndef ALIHFBDTFOREST_H
+#define ALIHFBDTFOREST_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+/// \class AliHFBDTForest
+/// \brief Flat representation of a TMVA BDT forest
+///
+/// Drop-in replacement of the ReadBDT_* classes generated by TMVA
+/// MethodBase::MakeClass (see TMVA/): same IClassifierReader interface and
+/// identical response, but the trees are stored as arrays of nodes
+/// (structure of arrays) instead of pointer-linked BDTNode objects.
+/// The forest is read at run time, either directly from the generated
+/// *.class.cxx file (AdaBoost-like forests with yes/no leaves and without
+/// input transformations) or from a compact text file (see WriteFile), from a
+/// file or from a string embedded in the code.
+/// GetMvaValues evaluates many candidates at once, tree by tree.
+//-------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <Rtypes.h>
+
+#include "IClassifierReader.h"
+
+class AliHFBDTForest : public IClassifierReader {
+
+ public:
+
+  AliHFBDTForest();
+  AliHFBDTForest(const std::vector<std::string>& inputVars);
+  virtual ~AliHFBDTForest() {}
+
+  Bool_t ReadFile(const char* fileName);
+  Bool_t ReadString(const std::string& text);
+  Bool_t WriteFile(const char* fileName) const;
+
+  /// response for one candidate, as ReadBDT_*::GetMvaValue
+  virtual double GetMvaValue(const std::vector<double>& inputValues) const;
+  /// response for nCand candidates, inputValues[iCand*nVars+iVar] with nVars=GetNVariables()
+  void GetMvaValues(Int_t nCand, Int_t nVars, const Double_t* inputValues, Double_t* mvaValues) const;
+
+  Int_t GetNVariables() const { return fNVars; }
+  Int_t GetNTrees() const { return (Int_t)fBoostWeights.size(); }
+  Int_t GetNNodes() const { return (Int_t)fSelector.size(); }
+
+ private:
+
+  void   Clear();
+  Bool_t ReadCompact(const std::string& text);
+  Bool_t ReadTMVAClass(const std::string& text);
+  Bool_t ReadTMVAInputVars(const std::string& text);
+  Int_t  ReadTMVANode(const char*& pos);
+  Bool_t CheckForest();
+  static std::string GetFunctionBody(const std::string& text, const char* name);
+
+  /// leaf reached by the candidate in the tree starting at node iNode
+  Int_t FindLeaf(Int_t iNode, const Double_t* x) const {
+    while(fSelector[iNode]>=0) iNode=fChild[2*iNode+((x[fSelector[iNode]]>fCutValue[iNode])==fCutType[iNode])];
+    return iNode;
+  }
+
+  Int_t fNVars;                        /// number of input variables
+  std::vector<std::string> fInputVars; /// names of the input variables (if known)
+  std::vector<Double_t> fBoostWeights; /// boost weight of each tree
+  std::vector<Int_t> fTreeRoot;        /// index of the root node of each tree
+  Double_t fNorm;                      /// sum of the boost weights
+  // nodes of all trees
+  std::vector<Int_t> fSelector;        /// index of the cut variable, -1 for leaves
+  std::vector<Double_t> fCutValue;     /// cut value
+  std::vector<UChar_t> fCutType;       /// 1: go right if value > cut, 0: go right if not
+  std::vector<Int_t> fChild;           /// [2*node]: left daughter, [2*node+1]: right daughter
+  std::vector<Double_t> fLeafValue;    /// node type (+1 signal, -1 background) of the leaves
+};
+
+#endif
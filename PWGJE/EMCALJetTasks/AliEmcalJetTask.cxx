@@ -97,8 +97,11 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fReuseGhosts(kFALSE),
+  fFillConstituentArena(kFALSE),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fConstituentArena(),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -138,8 +141,11 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fReuseGhosts(kFALSE),
+  fFillConstituentArena(kFALSE),
   fJets(0),
   fFastJetWrapper(name,name),
+  fConstituentArena(),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -334,9 +340,10 @@ Int_t AliEmcalJetTask::FindJets()
 void AliEmcalJetTask::FillJetBranch()
 {
   PrepareUtilities();
+  fConstituentArena.Clear();
 
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  const std::vector<fastjet::PseudoJet>& jets_incl = fFastJetWrapper.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -390,7 +397,7 @@ void AliEmcalJetTask::FillJetBranch()
  * @param[in] array Vector containing the list of jets obtained by the FastJet wrapper
  * @return kTRUE if at least one jet was found in array; kFALSE otherwise
  */
-Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const
+Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], const std::vector<fastjet::PseudoJet>& array) const
 {
   static Float_t pt[9999] = {0};
 
@@ -465,6 +472,7 @@ void AliEmcalJetTask::ExecOnce()
   fFastJetWrapper.SetAlgorithm(ConvertToFJAlgo(fJetAlgo));
   fFastJetWrapper.SetRecombScheme(ConvertToFJRecoScheme(fRecombScheme));
   fFastJetWrapper.SetMaxRap(1);
+  fFastJetWrapper.SetReuseGhosts(fReuseGhosts);
  
 
   // setting legacy mode
@@ -510,6 +518,10 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
   Int_t uid   = -1;
 
+  // the arena holds the constituents as found by the jet finder, i.e. not for the subtracted jets
+  const Bool_t fillArena = fFillConstituentArena && flag == 0;
+  Int_t arenaSlice = fillArena ? fConstituentArena.OpenJet() : -1;
+
   jet->SetNumberOfTracks(constituents.size());
   jet->SetNumberOfClusters(constituents.size());
 
@@ -599,6 +611,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
       if (flag == 0 || particlesSubName == "") {
         jet->AddTrackAt(fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid), nt);
+        if (fillArena) fConstituentArena.AddTrack(fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid), t->Pt(), t->Eta(), t->Phi(), t->M());
       }
       else {
         // Get the particle container and array corresponding to the subtracted particles
@@ -651,6 +664,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
       if (flag == 0 || particlesSubName == "") {
         jet->AddClusterAt(fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid), nc);
+        if (fillArena) fConstituentArena.AddCluster(fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid), cPt, cEta, nP.Phi_0_2pi(), nP.M());
       }
       else {
         // Get the cluster container and array corresponding to the subtracted particles
@@ -685,6 +699,10 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
   jet->SetMCPt(mcpt);
   jet->SetPtEmc(emcpt);
   jet->SortConstituents();
+  if (fillArena) {
+    fConstituentArena.CloseJet();
+    jet->SetConstituentArena(&fConstituentArena, arenaSlice);
+  }
 }
 
 /**
@@ -108,6 +108,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
+  void                   SetReuseGhosts(Bool_t b=kTRUE)             { if (IsLocked()) return; fReuseGhosts      = b     ; }
+  void                   SetFillConstituentArena(Bool_t b=kTRUE)    { if (IsLocked()) return; fFillConstituentArena = b ; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
   void                   SetMinJetClusPt(Double_t min);
@@ -189,7 +191,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   PrepareUtilities();
   void                   ExecuteUtilities(AliEmcalJet* jet, Int_t ij);
   void                   TerminateUtilities();
-  Bool_t                 GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const;
+  Bool_t                 GetSortedArray(Int_t indexes[], const std::vector<fastjet::PseudoJet>& array) const;
   Bool_t                 IsJetInEmcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
@@ -226,9 +228,12 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 fEnableAliBasicParticleCompatibility; ///< Flag to allow compatibility with AliBasicParticle constituents
   Bool_t                 fLegacyMode;             //!<!=true to enable FJ 2.x behavior
   Bool_t                 fFillGhost;              ///< =true ghost particles will be filled in AliEmcalJet obj
+  Bool_t                 fReuseGhosts;            ///< =true the same ghosts are used in every event (generated once)
+  Bool_t                 fFillConstituentArena;   ///< =true the jet constituents are also stored in a per-event SoA arena linked to the jets
 
   TClonesArray          *fJets;                   //!<!jet collection
   AliFJWrapper           fFastJetWrapper;         //!<!fastjet wrapper
+  PWG::JETFW::AliEmcalJetConstituentArena fConstituentArena; //!<!constituents of the jets of the current event
 
   static const Int_t     fgkConstIndexShift;      //!<!contituent index shift
 
@@ -243,7 +248,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 30);
+  ClassDef(AliEmcalJetTask, 32);
   /// \endcond
 };
 #endif
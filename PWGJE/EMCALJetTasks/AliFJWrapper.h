@@ -23,14 +23,17 @@ class AliFJWrapper
   virtual const char *ClassName()                            const { return "AliFJWrapper";              }
   virtual void  Clear(const Option_t* /*opt*/ = "");
   virtual void  ClearMemory();
+  virtual void  ClearEventMemory();
   virtual void  CopySettingsFrom (const AliFJWrapper& wrapper);
   virtual void  GetMedianAndSigma(Double_t& median, Double_t& sigma, Int_t remove = 0) const;
-  fastjet::ClusterSequenceArea*           GetClusterSequence() const   { return fClustSeq;                 }
+  fastjet::ClusterSequenceAreaBase*       GetClusterSequence() const;
   fastjet::ClusterSequence*               GetClusterSequenceSA() const { return fClustSeqSA;               }
   fastjet::ClusterSequenceActiveAreaExplicitGhosts* GetClusterSequenceGhosts() const { return fClustSeqActGhosts; }
+  fastjet::ClusterSequenceActiveAreaExplicitGhosts* GetClusterSequenceReusedGhosts() const { return fClustSeqReusedGhosts; }
   const std::vector<fastjet::PseudoJet>&  GetInputVectors()    const { return fInputVectors;               }
   const std::vector<fastjet::PseudoJet>&  GetEventSubInputVectors()    const { return fEventSubInputVectors;               }
   const std::vector<fastjet::PseudoJet>&  GetInputGhosts()     const { return fInputGhosts;                }
+  const std::vector<fastjet::PseudoJet>&  GetReusedGhosts()    const { return fGhosts;                     }
   const std::vector<fastjet::PseudoJet>&  GetInclusiveJets()   const { return fInclusiveJets;              }
   const std::vector<fastjet::PseudoJet>&  GetEventSubJets()   const { return fEventSubJets;              }
   const std::vector<fastjet::PseudoJet>&  GetFilteredJets()    const { return fFilteredJets;               }
@@ -50,6 +53,7 @@ class AliFJWrapper
   virtual std::vector<double>             GetSubtractedJetsPts(Double_t median_pt = -1, Bool_t sorted = kFALSE);
   Bool_t                                  GetLegacyMode()            { return fLegacyMode; }
   Bool_t                                  GetDoFilterArea()          { return fDoFilterArea; }
+  Bool_t                                  GetReuseGhosts()     const { return fReuseGhosts; }
   Double_t                                NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
   Double32_t                              NSubjettinessDerivativeSub(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Double_t JetR, fastjet::PseudoJet jet, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
 #ifdef FASTJET_VERSION
@@ -88,6 +92,7 @@ class AliFJWrapper
   virtual void RemoveLastInputVector();
 
   virtual Int_t Run();
+  static  Int_t RunBatch(const std::vector<AliFJWrapper*>& wrappers, Int_t nThreads = 0);
   virtual Int_t Filter();
   virtual void  DoGenericSubtraction(const fastjet::FunctionOfPseudoJet<Double32_t>& jetshape, std::vector<fastjet::contrib::GenericSubtractorInfo>& output);
   virtual Int_t DoGenericSubtractionJetMass();
@@ -143,6 +148,7 @@ class AliFJWrapper
   void SetEventSub(Bool_t b) {fEventSub = b;}
   void SetMaxDelR(Double_t r)  {fMaxDelR = r;}
   void SetAlpha(Double_t a)  {fAlpha = a;}
+  void SetReuseGhosts(Bool_t b)         { fReuseGhosts    = b;       }
 
  protected:
   TString                                fName;               //!
@@ -171,6 +177,7 @@ class AliFJWrapper
   fastjet::ClusterSequenceArea          *fClustSeqES;           //!
   fastjet::ClusterSequence              *fClustSeqSA;                //!
   fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqActGhosts; //!
+  fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqReusedGhosts; //! clustering with the reused ghosts (fReuseGhosts)
   fastjet::Strategy                      fStrategy;           //!
   fastjet::JetAlgorithm                  fAlgor;              //!
   fastjet::RecombinationScheme           fScheme;             //!
@@ -235,8 +242,34 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominator;    //!
   std::vector<double>                      fGRNumeratorSub;   //!
   std::vector<double>                      fGRDenominatorSub; //!
+  Bool_t                                   fReuseGhosts;      //! generate the ghosts once and reuse them in every event
+  std::vector<fastjet::PseudoJet>          fGhosts;           //! ghosts reused in every event
+
+  /// Settings the jet and area definitions were created with
+  struct DefinitionSettings {
+    fastjet::JetAlgorithm         fAlgor;
+    fastjet::RecombinationScheme  fScheme;
+    fastjet::Strategy             fStrategy;
+    fastjet::AreaType             fAreaType;
+    Int_t                         fNGhostRepeats;
+    Double_t                      fGhostArea;
+    Double_t                      fMaxRap;
+    Double_t                      fR;
+    Double_t                      fGridScatter;
+    Double_t                      fKtScatter;
+    Double_t                      fMeanGhostKt;
+    Int_t                         fPluginAlgor;
+    bool operator==(const DefinitionSettings& o) const;
+  };
+  DefinitionSettings                       fDefSettings;      //!
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  DefinitionSettings GetDefinitionSettings() const;
+  Bool_t         PrepareDefinitions();
+  void           ClearDefinitions();
+  Bool_t         UseReusedGhosts()   const { return fReuseGhosts && fAreaType == fastjet::active_area_explicit_ghosts; }
+  Bool_t         IsThreadSafe()      const;
+  Int_t          Cluster();
 
  private:
   AliFJWrapper();
@@ -253,6 +286,12 @@ class AliFJWrapper
 #pragma GCC system_header
 #endif
 
+#include <RConfigure.h>
+#ifdef R__USE_IMT
+#include <ROOT/TSeq.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
 namespace fj = fastjet;
 
 //_________________________________________________________________________________________________
@@ -280,6 +319,7 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fClustSeqES        (0)
   , fClustSeqSA        (0)
   , fClustSeqActGhosts (0)
+  , fClustSeqReusedGhosts (0)
   , fStrategy          (fj::Best)
   , fAlgor             (fj::kt_algorithm)
   , fScheme            (fj::BIpt_scheme)
@@ -339,6 +379,9 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fGRDenominator()
   , fGRNumeratorSub()
   , fGRDenominatorSub()
+  , fReuseGhosts(kFALSE)
+  , fGhosts()
+  , fDefSettings()
 {
   // Constructor.
 }
@@ -353,23 +396,50 @@ AliFJWrapper::~AliFJWrapper()
 //_________________________________________________________________________________________________
 void AliFJWrapper::ClearMemory()
 {
-  // Destructor.
+  // Delete everything, including the jet/area definitions and the reused ghosts.
+
+  ClearEventMemory();
+  ClearDefinitions();
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearEventMemory()
+{
+  // Delete the per-event objects (cluster sequences and subtractors).
+  // The jet/area definitions and the reused ghosts are kept for the next event.
+
+  if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
+  if (fClustSeqES)          { delete fClustSeqES;        fClustSeqES        = NULL; }
+  if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
+  if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
+  if (fClustSeqReusedGhosts) { delete fClustSeqReusedGhosts; fClustSeqReusedGhosts = NULL; }
+  #ifdef FASTJET_VERSION
+  if (fGenSubtractor)          { delete fGenSubtractor; fGenSubtractor = NULL; }
+  if (fConstituentSubtractor)  { delete fConstituentSubtractor; fConstituentSubtractor = NULL; }
+  if (fEventConstituentSubtractor) { delete fEventConstituentSubtractor; fEventConstituentSubtractor = NULL; }
+  if (fSoftDrop)          { delete fSoftDrop; fSoftDrop = NULL;}
+  #endif
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearDefinitions()
+{
+  // Delete the jet/area definitions, the background estimator and the reused ghosts.
+  // The subtractors refer to the background estimator and are deleted as well.
+
   if (fAreaDef)           { delete fAreaDef;           fAreaDef         = NULL; }
   if (fVorAreaSpec)       { delete fVorAreaSpec;       fVorAreaSpec     = NULL; }
   if (fGhostedAreaSpec)   { delete fGhostedAreaSpec;   fGhostedAreaSpec = NULL; }
   if (fJetDef)            { delete fJetDef;            fJetDef          = NULL; }
   if (fPlugin)            { delete fPlugin;            fPlugin          = NULL; }
   if (fRange)             { delete fRange;             fRange           = NULL; }
-  if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
-  if (fClustSeqES)          { delete fClustSeqES;        fClustSeqES        = NULL; }
-  if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
-  if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
   #ifdef FASTJET_VERSION
-  if (fBkrdEstimator)          { delete fBkrdEstimator; fBkrdEstimator = NULL; }
   if (fGenSubtractor)          { delete fGenSubtractor; fGenSubtractor = NULL; }
   if (fConstituentSubtractor)  { delete fConstituentSubtractor; fConstituentSubtractor = NULL; }
-  if (fSoftDrop)          { delete fSoftDrop; fSoftDrop = NULL;}
+  if (fEventConstituentSubtractor) { delete fEventConstituentSubtractor; fEventConstituentSubtractor = NULL; }
+  if (fBkrdEstimator)          { delete fBkrdEstimator; fBkrdEstimator = NULL; }
   #endif
+  fGhosts.clear();
 }
 
 //_________________________________________________________________________________________________
@@ -412,8 +482,8 @@ void AliFJWrapper::Clear(const Option_t */*opt*/)
   fInputGhosts.clear();
   fMedUsedForBgSub = 0;
 
-  // for the moment brute force delete everything
-  ClearMemory();
+  // the definitions are kept, they are recreated in Run() only if the settings change
+  ClearEventMemory();
 }
 
 //_________________________________________________________________________________________________
@@ -513,7 +583,7 @@ Double_t AliFJWrapper::GetJetArea(UInt_t idx) const
 
   Double_t retval = -1; // really wrong area..
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area(fInclusiveJets[idx]);
+    retval = GetClusterSequence()->area(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -553,7 +623,7 @@ fastjet::PseudoJet AliFJWrapper::GetJetAreaVector(UInt_t idx) const
   // Get the jet area as vector.
   fastjet::PseudoJet retval;
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area_4vector(fInclusiveJets[idx]);
+    retval = GetClusterSequence()->area_4vector(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -620,7 +690,7 @@ AliFJWrapper::GetJetConstituents(UInt_t idx) const
   std::vector<fastjet::PseudoJet> retval;
 
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->constituents(fInclusiveJets[idx]);
+    retval = GetClusterSequence()->constituents(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetConstituents wrong index: %d",idx));
   }
@@ -669,7 +739,8 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
   // Get the median and sigma from fastjet.
   // User can also do it on his own because the cluster sequence is exposed (via a getter)
 
-  if (!fClustSeq) {
+  const fj::ClusterSequenceAreaBase* clustSeq = GetClusterSequence();
+  if (!clustSeq) {
     AliError("[e] Run the jfinder first.");
     return;
   }
@@ -677,11 +748,11 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
   Double_t mean_area = 0;
   try {
     if(0 == remove) {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      clustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }  else {
-      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(fClustSeq->inclusive_jets());
+      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(clustSeq->inclusive_jets());
       input_jets.erase(input_jets.begin(), input_jets.begin() + remove);
-      fClustSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
+      clustSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
       input_jets.clear();
     }
   } catch (fj::Error) {
@@ -692,9 +763,56 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
 }
 
 //_________________________________________________________________________________________________
-Int_t AliFJWrapper::Run()
+fj::ClusterSequenceAreaBase* AliFJWrapper::GetClusterSequence() const
 {
-  // Run the actual jet finder.
+  // Cluster sequence of the inclusive jets: fClustSeq, or fClustSeqReusedGhosts
+  // if the jets were found with the reused ghosts (SetReuseGhosts()).
+
+  if (fClustSeqReusedGhosts) return fClustSeqReusedGhosts;
+  return fClustSeq;
+}
+
+//_________________________________________________________________________________________________
+AliFJWrapper::DefinitionSettings AliFJWrapper::GetDefinitionSettings() const
+{
+  // Current settings entering the jet and area definitions.
+
+  DefinitionSettings settings;
+  settings.fAlgor         = fAlgor;
+  settings.fScheme        = fScheme;
+  settings.fStrategy      = fStrategy;
+  settings.fAreaType      = fAreaType;
+  settings.fNGhostRepeats = fNGhostRepeats;
+  settings.fGhostArea     = fGhostArea;
+  settings.fMaxRap        = fMaxRap;
+  settings.fR             = fR;
+  settings.fGridScatter   = fGridScatter;
+  settings.fKtScatter     = fKtScatter;
+  settings.fMeanGhostKt   = fMeanGhostKt;
+  settings.fPluginAlgor   = fPluginAlgor;
+  return settings;
+}
+
+//_________________________________________________________________________________________________
+bool AliFJWrapper::DefinitionSettings::operator==(const DefinitionSettings& o) const
+{
+  return fAlgor == o.fAlgor && fScheme == o.fScheme && fStrategy == o.fStrategy && fAreaType == o.fAreaType &&
+    fNGhostRepeats == o.fNGhostRepeats && fGhostArea == o.fGhostArea && fMaxRap == o.fMaxRap && fR == o.fR &&
+    fGridScatter == o.fGridScatter && fKtScatter == o.fKtScatter && fMeanGhostKt == o.fMeanGhostKt &&
+    fPluginAlgor == o.fPluginAlgor;
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliFJWrapper::PrepareDefinitions()
+{
+  // Create the jet and area definitions, the range and the background estimator.
+  // They are kept across events and only recreated if the settings changed.
+
+  DefinitionSettings settings = GetDefinitionSettings();
+  if (fJetDef && settings == fDefSettings) return kTRUE;
+
+  ClearDefinitions();
+  fDefSettings = settings;
 
   if (fAreaType == fj::voronoi_area) {
     // Rfact - check dependence - default is 1.
@@ -740,38 +858,141 @@ Int_t AliFJWrapper::Run()
       fJetDef = new fastjet::JetDefinition(fPlugin);
     } else {
       AliError("[e] Unrecognized plugin number!");
+      return kFALSE;
     }
   } else {
     fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
   }
 
+  // FJ3 :: Define an JetMedianBackgroundEstimator just in case it will be used
+#ifdef FASTJET_VERSION
+  fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
+#endif
+
+  return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::Run()
+{
+  // Run the actual jet finder.
+  // With fReuseGhosts (only for active_area_explicit_ghosts) the ghosts are generated
+  // in the first event and the same ghosts are used in all following events.
+
+  if (!PrepareDefinitions()) return -1;
+
+  if (Cluster() != 0) {
+    AliError(" [w] FJ Exception caught.");
+    return -1;
+  }
+
+  if (fLegacyMode) { SetLegacyFJ(); } // for FJ 2.x even if fLegacyMode is set, SetLegacyFJ is dummy
+
+  return 0;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::Cluster()
+{
+  // Cluster the input and fill the inclusive jets, with the definitions prepared beforehand.
+  // No logging here: this is the part of Run() executed on the worker threads of RunBatch().
+
+  if (fClustSeq)             { delete fClustSeq;             fClustSeq             = NULL; }
+  if (fClustSeqES)           { delete fClustSeqES;           fClustSeqES           = NULL; }
+  if (fClustSeqReusedGhosts) { delete fClustSeqReusedGhosts; fClustSeqReusedGhosts = NULL; }
+
   try {
-    fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
+    if (UseReusedGhosts()) {
+      // the area definition holds its own copy of the ghosted area spec
+      if (fGhosts.empty()) fAreaDef->ghost_spec().add_ghosts(fGhosts);
+      fClustSeqReusedGhosts = new fj::ClusterSequenceActiveAreaExplicitGhosts(fInputVectors, *fJetDef, fGhosts,
+                                                                              fAreaDef->ghost_spec().actual_ghost_area());
+    } else {
+      fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
+    }
     if(fEventSub){
       DoEventConstituentSubtraction();
       fClustSeqES = new fj::ClusterSequenceArea(fEventSubCorrectedVectors, *fJetDef, *fAreaDef);
     }
   } catch (fj::Error) {
-    AliError(" [w] FJ Exception caught.");
     return -1;
   }
 
-  // FJ3 :: Define an JetMedianBackgroundEstimator just in case it will be used
-#ifdef FASTJET_VERSION
-  fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
-#endif
-
-  if (fLegacyMode) { SetLegacyFJ(); } // for FJ 2.x even if fLegacyMode is set, SetLegacyFJ is dummy
-
   // inclusive jets:
   fInclusiveJets.clear();
   fEventSubJets.clear();
-  fInclusiveJets = fClustSeq->inclusive_jets(0.0);
+  fInclusiveJets = GetClusterSequence()->inclusive_jets(0.0);
   if(fEventSub) fEventSubJets  = fClustSeqES->inclusive_jets(0.0);
 
   return 0;
 }
 
+//_________________________________________________________________________________________________
+Bool_t AliFJWrapper::IsThreadSafe() const
+{
+  // Whether Run() can be called concurrently with other wrappers.
+  // Requires a fastjet build with --enable-thread-safety: otherwise the banner, the
+  // warning counters and the lazily built tables of fastjet are shared without protection.
+  // Ghosts drawn inside fastjet use a random generator shared by all instances,
+  // plugins, the event-wise subtraction and the legacy mode (printout) are not considered.
+
+#ifdef FASTJET_HAVE_THREAD_SAFETY
+  if (fAlgor == fj::plugin_algorithm || fEventSub || fLegacyMode) return kFALSE;
+  if (fAreaType == fj::voronoi_area) return kTRUE;
+  return UseReusedGhosts();
+#else
+  return kFALSE;
+#endif
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::RunBatch(const std::vector<AliFJWrapper*>& wrappers, Int_t nThreads)
+{
+  // Run the jet finder of several independent wrappers, e.g. for the embedding replicas
+  // or background subtraction variants of the same event.
+  // Wrappers which can run concurrently (see IsThreadSafe()) are processed on a thread pool
+  // with nThreads threads (0 = ROOT default), the others sequentially in the calling thread.
+  // The definitions and the reused ghosts are prepared sequentially beforehand, the
+  // failures of the concurrent wrappers are reported afterwards from the calling thread.
+  // Returns the number of wrappers for which Run() failed.
+
+  std::vector<AliFJWrapper*> concurrent;
+  Int_t nfailed = 0;
+
+#ifdef FASTJET_VERSION
+  fj::ClusterSequence::print_banner(); // only printed once, avoid doing it from the worker threads
+#endif
+
+  for (UInt_t i = 0; i < wrappers.size(); i++) {
+    AliFJWrapper* wrapper = wrappers[i];
+    if (!wrapper->PrepareDefinitions()) { nfailed++; continue; }
+    if (wrapper->UseReusedGhosts() && wrapper->fGhosts.empty())
+      wrapper->fAreaDef->ghost_spec().add_ghosts(wrapper->fGhosts);
+    if (wrapper->IsThreadSafe()) {
+      concurrent.push_back(wrapper);
+    } else {
+      if (wrapper->Run() != 0) nfailed++;
+    }
+  }
+
+#ifdef R__USE_IMT
+  if (concurrent.size() > 1) {
+    std::vector<Int_t> results(concurrent.size(), 0);
+    ROOT::TThreadExecutor pool(nThreads > 0 ? (UInt_t)nThreads : 0u);
+    pool.Foreach([&](UInt_t i) { results[i] = concurrent[i]->Cluster(); }, ROOT::TSeqU(concurrent.size()));
+    for (UInt_t i = 0; i < results.size(); i++) {
+      if (results[i] == 0) continue;
+      AliErrorGeneral("AliFJWrapper::RunBatch", Form(" [w] FJ Exception caught in %s.", concurrent[i]->GetName()));
+      nfailed++;
+    }
+    return nfailed;
+  }
+#endif
+  for (UInt_t i = 0; i < concurrent.size(); i++) if (concurrent[i]->Run() != 0) nfailed++;
+
+  return nfailed;
+}
+
 //_________________________________________________________________________________________________
 Int_t AliFJWrapper::Filter()
 {
@@ -779,13 +1000,13 @@ Int_t AliFJWrapper::Filter()
 //  AliFJWrapper::Filter
 //
 
-  fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+  fj::JetDefinition jetDef(fAlgor, fR, fScheme, fStrategy);
 
   if (fDoFilterArea) {
     if (fInputGhosts.size()>0) {
       try {
         fClustSeqActGhosts = new fj::ClusterSequenceActiveAreaExplicitGhosts(fInputVectors,
-                                                                           *fJetDef,
+                                                                            jetDef,
                                                                             fInputGhosts,
                                                                             fGhostArea);
       } catch (fj::Error) {
@@ -800,7 +1021,7 @@ Int_t AliFJWrapper::Filter()
     }
   } else {
     try {
-      fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, *fJetDef);
+      fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, jetDef);
     } catch (fj::Error) {
       AliError(" [w] FJ Exception caught.");
       return -1;
@@ -845,7 +1066,7 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
   // check what was specified (default is -1)
   if (median_pt < 0) {
     try {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      GetClusterSequence()->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }
 
     catch (fj::Error) {
@@ -871,13 +1092,13 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
   for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
     if ( fUseArea4Vector ) {
       // subtract the background using the area4vector
-      fj::PseudoJet area4v = fClustSeq->area_4vector(fInclusiveJets[i]);
+      fj::PseudoJet area4v = GetClusterSequence()->area_4vector(fInclusiveJets[i]);
       fj::PseudoJet jet_sub = fInclusiveJets[i] - area4v * fMedUsedForBgSub;
       fSubtractedJetsPt.push_back(jet_sub.perp()); // here we put only the pt of the jet - note: this can be negative
     } else {
       // subtract the background using scalars
       // fj::PseudoJet jet_sub = fInclusiveJets[i] - area * fMedUsedForBgSub_;
-      Double_t area = fClustSeq->area(fInclusiveJets[i]);
+      Double_t area = GetClusterSequence()->area(fInclusiveJets[i]);
       // standard subtraction
       Double_t pt_sub = fInclusiveJets[i].perp() - fMedUsedForBgSub * area;
       fSubtractedJetsPt.push_back(pt_sub); // here we put only the pt of the jet - note: this can be negative
@@ -1429,10 +1650,10 @@ Double_t AliFJWrapper::NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius,
 
   //Option 0=Nsubjettiness result, 1=opening angle between axes in Eta-Phi plane, 2=Distance between axes in Eta-Phi plane
   
-  fJetDef = new fj::JetDefinition(fAlgor, fR*2, fScheme, fStrategy ); //the *2 is becasue of a handful of jets that end up missing a track for some reason.
+  fj::JetDefinition jetDef(fAlgor, fR*2, fScheme, fStrategy ); //the *2 is becasue of a handful of jets that end up missing a track for some reason.
 
   try {
-    fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, *fJetDef);
+    fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, jetDef);
     // ClustSeqSA = new fastjet::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
   } catch (fj::Error) {
     AliError(" [w] FJ Exception caught.");
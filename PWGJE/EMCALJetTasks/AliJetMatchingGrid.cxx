@@ -0,0 +1,164 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+
+#include <TMath.h>
+#include <TVector2.h>
+
+#include "AliJetMatchingGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliJetMatchingGrid)
+/// \endcond
+
+/**
+ * Default constructor: a single cell, i.e. all objects are candidates
+ */
+AliJetMatchingGrid::AliJetMatchingGrid() :
+  TObject(),
+  fRadius(0),
+  fEtaMin(-1),
+  fEtaCellSize(2),
+  fPhiCellSize(TMath::TwoPi()),
+  fNEtaCells(1),
+  fNPhiCells(1),
+  fEntries(),
+  fSorted(),
+  fCellStart()
+{
+}
+
+/**
+ * Set the search radius and the eta range of the grid, and clear the grid.
+ * The cell size is the smallest size not below the radius that divides the range.
+ * @param radius Search radius
+ * @param etaMin Lower edge of the grid in eta
+ * @param etaMax Upper edge of the grid in eta
+ */
+void AliJetMatchingGrid::Init(Double_t radius, Double_t etaMin, Double_t etaMax)
+{
+  fRadius = radius;
+  fEtaMin = etaMin;
+  fNEtaCells = 1;
+  fNPhiCells = 1;
+  if (radius > 0) {
+    fNEtaCells = TMath::Max(1, TMath::FloorNint((etaMax - etaMin) / radius));
+    fNPhiCells = TMath::Max(1, TMath::FloorNint(TMath::TwoPi() / radius));
+  }
+  fEtaCellSize = (etaMax - etaMin) / fNEtaCells;
+  fPhiCellSize = TMath::TwoPi() / fNPhiCells;
+  Clear();
+}
+
+/**
+ * Remove all objects, the allocated storage is kept
+ */
+void AliJetMatchingGrid::Clear(Option_t*)
+{
+  fEntries.clear();
+  fSorted.clear();
+  fCellStart.assign(fNEtaCells * fNPhiCells + 1, 0);
+}
+
+/**
+ * Add an object to the grid. Build() must be called after the last object is added.
+ * @param index User index of the object, returned by FindCandidates()
+ * @param eta Eta of the object
+ * @param phi Phi of the object
+ */
+void AliJetMatchingGrid::Add(Int_t index, Double_t eta, Double_t phi)
+{
+  Entry e;
+  e.fIndex = index;
+  e.fCell = EtaBin(eta) * fNPhiCells + PhiBin(phi);
+  e.fEta = eta;
+  e.fPhi = phi;
+  fEntries.push_back(e);
+}
+
+/**
+ * Sort the objects by cell (counting sort, stable w.r.t. the order of Add())
+ */
+void AliJetMatchingGrid::Build()
+{
+  const Int_t ncells = fNEtaCells * fNPhiCells;
+  fCellStart.assign(ncells + 1, 0);
+  for (auto &e : fEntries) fCellStart[e.fCell + 1]++;
+  for (Int_t i = 0; i < ncells; i++) fCellStart[i + 1] += fCellStart[i];
+
+  fSorted.resize(fEntries.size());
+  std::vector<Int_t> &pos = fCellStart;
+  for (auto &e : fEntries) fSorted[pos[e.fCell]++] = e;
+  // pos[i] now holds the end of cell i, i.e. the start of cell i+1
+  for (Int_t i = ncells; i > 0; i--) fCellStart[i] = fCellStart[i - 1];
+  fCellStart[0] = 0;
+}
+
+/**
+ * Find the objects within the search radius from the direction (eta,phi)
+ * @param eta Eta of the direction
+ * @param phi Phi of the direction
+ * @param candidates Output: user indices of the objects, in increasing order
+ */
+void AliJetMatchingGrid::FindCandidates(Double_t eta, Double_t phi, std::vector<Int_t> &candidates) const
+{
+  candidates.clear();
+  const Int_t ieta = EtaBin(eta), iphi = PhiBin(phi);
+  const Int_t etaFirst = TMath::Max(0, ieta - 1), etaLast = TMath::Min(fNEtaCells - 1, ieta + 1);
+  // with less than 3 cells in phi all of them are neighbours
+  const Int_t nphi = fNPhiCells < 3 ? fNPhiCells : 3;
+  const Int_t phiFirst = fNPhiCells < 3 ? 0 : iphi - 1;
+  // tiny tolerance to make sure rounding never loses a pair at exactly the radius
+  const Double_t maxDist = fRadius > 0 ? fRadius * (1. + 1e-9) : -1;
+
+  for (Int_t ie = etaFirst; ie <= etaLast; ie++) {
+    for (Int_t k = 0; k < nphi; k++) {
+      Int_t ip = (phiFirst + k + fNPhiCells) % fNPhiCells;
+      Int_t cell = ie * fNPhiCells + ip;
+      for (Int_t i = fCellStart[cell]; i < fCellStart[cell + 1]; i++) {
+        const Entry &e = fSorted[i];
+        if (maxDist >= 0 && DeltaR(eta, phi, e.fEta, e.fPhi) > maxDist) continue;
+        candidates.push_back(e.fIndex);
+      }
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+}
+
+/**
+ * Distance in (eta,phi), same definition as AliEmcalJet::DeltaR
+ */
+Double_t AliJetMatchingGrid::DeltaR(Double_t eta1, Double_t phi1, Double_t eta2, Double_t phi2)
+{
+  Double_t dPhi = TVector2::Phi_mpi_pi(phi1 - phi2);
+  Double_t dEta = eta1 - eta2;
+  return TMath::Sqrt(dPhi * dPhi + dEta * dEta);
+}
+
+Int_t AliJetMatchingGrid::EtaBin(Double_t eta) const
+{
+  Int_t bin = TMath::FloorNint((eta - fEtaMin) / fEtaCellSize);
+  if (bin < 0) return 0;
+  if (bin >= fNEtaCells) return fNEtaCells - 1;
+  return bin;
+}
+
+Int_t AliJetMatchingGrid::PhiBin(Double_t phi) const
+{
+  Int_t bin = TMath::FloorNint(TVector2::Phi_0_2pi(phi) / fPhiCellSize);
+  if (bin < 0) return 0;
+  if (bin >= fNPhiCells) return fNPhiCells - 1;
+  return bin;
+}
@@ -0,0 +1,83 @@
+#ifndef ALIJETMATCHINGGRID_H
+#define ALIJETMATCHINGGRID_H
+/**************************************************************************
+* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+#include <vector>
+#include <TObject.h>
+
+/**
+ * @class AliJetMatchingGrid
+ * @brief (eta,phi) grid for the candidate search in the jet matching
+ *
+ * Objects (jets) are sorted into cells of an (eta,phi) grid with cell size
+ * not smaller than the search radius, with periodic boundaries in phi. The
+ * candidates within the search radius from a given direction are then found
+ * by looking at the 3x3 neighbouring cells only. Objects outside the eta range
+ * of the grid are put in the first/last eta row, which keeps the search exact.
+ *
+ * The distance is computed as in AliEmcalJet::DeltaR. Candidates are returned
+ * in increasing order of the index given in Add(), such that a loop over them
+ * visits the objects in the same order as a loop over the full list.
+ *
+ * The storage is kept between events, only Clear() / Init() / Add() / Build()
+ * are needed for each new set of objects.
+ */
+class AliJetMatchingGrid : public TObject {
+public:
+  AliJetMatchingGrid();
+  virtual ~AliJetMatchingGrid() {}
+
+  void          Init(Double_t radius, Double_t etaMin = -1., Double_t etaMax = 1.);
+  void          Clear(Option_t* option = "");
+  void          Add(Int_t index, Double_t eta, Double_t phi);
+  void          Build();
+  void          FindCandidates(Double_t eta, Double_t phi, std::vector<Int_t>& candidates) const;
+
+  Double_t      GetRadius()                                   const { return fRadius            ; }
+  Int_t         GetNEntries()                                 const { return fEntries.size()    ; }
+
+  static Double_t DeltaR(Double_t eta1, Double_t phi1, Double_t eta2, Double_t phi2);
+
+protected:
+  /**
+   * @struct Entry
+   * @brief Object stored in the grid
+   */
+  struct Entry {
+    Int_t       fIndex;   ///< user index of the object
+    Int_t       fCell;    ///< cell of the object
+    Double_t    fEta;     ///< eta of the object
+    Double_t    fPhi;     ///< phi of the object
+  };
+
+  Int_t         EtaBin(Double_t eta)                          const;
+  Int_t         PhiBin(Double_t phi)                          const;
+
+  Double_t              fRadius;        ///< search radius
+  Double_t              fEtaMin;        ///< lower edge of the grid in eta
+  Double_t              fEtaCellSize;   ///< cell size in eta
+  Double_t              fPhiCellSize;   ///< cell size in phi
+  Int_t                 fNEtaCells;     ///< number of cells in eta
+  Int_t                 fNPhiCells;     ///< number of cells in phi
+  std::vector<Entry>    fEntries;       //!<! objects added since the last Clear()
+  std::vector<Entry>    fSorted;        //!<! objects sorted by cell
+  std::vector<Int_t>    fCellStart;     //!<! position of the first object of each cell in fSorted
+
+  /// \cond CLASSIMP
+  ClassDef(AliJetMatchingGrid, 1); // (eta,phi) grid for the jet matching
+  /// \endcond
+};
+
+#endif
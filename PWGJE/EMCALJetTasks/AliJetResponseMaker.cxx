@@ -59,6 +59,11 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fPtgAxis(0),
   fDBCAxis(0),
   fJetRelativeEPAngle(0),
+  fUseMatchingGrid(kTRUE),
+  fLabelMatchingMaxDistance(-1),
+  fMatchingGrid(),
+  fMatchingJets2(),
+  fMatchingCandidates(),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
   fHistRejectionReason1(0),
@@ -148,6 +153,11 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fPtgAxis(0),
   fDBCAxis(0),
   fJetRelativeEPAngle(0),
+  fUseMatchingGrid(kTRUE),
+  fLabelMatchingMaxDistance(-1),
+  fMatchingGrid(),
+  fMatchingJets2(),
+  fMatchingCandidates(),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
   fHistRejectionReason1(0),
@@ -1417,6 +1427,11 @@ Bool_t AliJetResponseMaker::DoJetMatching()
 void AliJetResponseMaker::DoJetLoop()
 {
   // Do the jet loop.
+  // If fUseMatchingGrid is set, only the jets2 within the maximum matching distance
+  // from jet1 are scored (found with an (eta,phi) grid). For the geometrical matching
+  // this gives exactly the same matches as the loop over all pairs. For the MC label
+  // and same collections matching the search radius is fLabelMatchingMaxDistance,
+  // and all pairs are scored if it is negative (default).
 
   AliJetContainer *jets1 = static_cast<AliJetContainer*>(fJetCollArray.At(0));
   AliJetContainer *jets2 = static_cast<AliJetContainer*>(fJetCollArray.At(1));
@@ -1426,8 +1441,24 @@ void AliJetResponseMaker::DoJetLoop()
   AliEmcalJet* jet1 = 0;
   AliEmcalJet* jet2 = 0;
 
+  Double_t radius = -1;
+  if (fUseMatchingGrid) {
+    if (fMatching == kGeometrical) radius = TMath::Max(fMatchingPar1, fMatchingPar2);
+    else radius = fLabelMatchingMaxDistance;
+  }
+
+  fMatchingJets2.clear();
   jets2->ResetCurrentID();
-  while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
+  while ((jet2 = jets2->GetNextJet())) {
+    jet2->ResetMatching();
+    fMatchingJets2.push_back(jet2);
+  }
+
+  if (radius > 0) {
+    fMatchingGrid.Init(radius);
+    for (UInt_t i = 0; i < fMatchingJets2.size(); i++) fMatchingGrid.Add(i, fMatchingJets2[i]->Eta(), fMatchingJets2[i]->Phi());
+    fMatchingGrid.Build();
+  }
 
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
@@ -1435,10 +1466,14 @@ void AliJetResponseMaker::DoJetLoop()
 
     if (jet1->MCPt() < fMinJetMCPt) continue;
 
-    jets2->ResetCurrentID();
-    while ((jet2 = jets2->GetNextJet())) {
-      SetMatchingLevel(jet1, jet2, fMatching);
-    } // jet2 loop
+    if (radius > 0) {
+      // candidates are sorted, i.e. visited in the same order as in the full loop
+      fMatchingGrid.FindCandidates(jet1->Eta(), jet1->Phi(), fMatchingCandidates);
+      for (auto i : fMatchingCandidates) SetMatchingLevel(jet1, fMatchingJets2[i], fMatching);
+    }
+    else {
+      for (auto jet : fMatchingJets2) SetMatchingLevel(jet1, jet, fMatching);
+    }
   } // jet1 loop
 }
 
@@ -27,6 +27,7 @@ class AliNamedArrayI;
 #include "AliEmcalJet.h"
 #include "AliAnalysisTaskEmcalJet.h"
 #include "AliEmcalEmbeddingQA.h"
+#include "AliJetMatchingGrid.h"
 
 class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
  public:
@@ -59,6 +60,8 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        SetPtgAxis(Int_t b)                                             { fPtgAxis           = b         ; }
   void                        SetDBCAxis(Int_t b)                                             { fDBCAxis           = b         ; }
   void                        SetJetRelativeEPAngleAxis(Int_t b)                              { fJetRelativeEPAngle = b        ; }
+  void                        SetUseMatchingGrid(Bool_t b)                                    { fUseMatchingGrid   = b         ; }
+  void                        SetLabelMatchingMaxDistance(Double_t d)                         { fLabelMatchingMaxDistance = d  ; }
 
   static AliJetResponseMaker * AddTaskJetResponseMaker(
       const char *ntracks1           = "Tracks",
@@ -124,6 +127,11 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Int_t                       fPtgAxis;                                // add Ptg axis in matching THnSparse (default=0)
   Int_t                       fDBCAxis;                                // add DBC (number of soft dropped branches) axis in matching THnSparse (default=0)
   Int_t                       fJetRelativeEPAngle;                     ///< add jet angle relative to the EP in matching THnSparse (default=0)
+  Bool_t                      fUseMatchingGrid;                        ///< use an (eta,phi) grid to find the matching candidates instead of looping over all pairs
+  Double_t                    fLabelMatchingMaxDistance;               ///< max distance of the candidates for the MC label / same collections matching (<0 = all pairs)
+  AliJetMatchingGrid          fMatchingGrid;                           //!<! (eta,phi) grid of the jets2 for the candidate search
+  std::vector<AliEmcalJet*>   fMatchingJets2;                          //!<! jets2 in the order of the container
+  std::vector<Int_t>          fMatchingCandidates;                     //!<! candidates for the current jet1
 
   Bool_t                      fIsJet1Rho;                              //!whether the jet1 collection has to be average subtracted
   Bool_t                      fIsJet2Rho;                              //!whether the jet2 collection has to be average subtracted
@@ -204,6 +212,6 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 29) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
@@ -25,6 +25,7 @@
 #pragma link C++ class AliJetEmbeddingTask+;
 #pragma link C++ class AliJetEmbeddingFromGenTask+;
 #pragma link C++ class AliJetFastSimulation+;
+#pragma link C++ class AliJetMatchingGrid+;
 #pragma link C++ class AliJetModelBaseTask+;
 #pragma link C++ class AliJetModelCopyTracks+;
 #pragma link C++ class AliJetModelMergeBranches+;
@@ -239,6 +240,7 @@
 #pragma link C++ class PWGJE::EMCALJetTasks::AliAnalysisEmcalTriggerSelectionHelper+;
 #pragma link C++ namespace PWGJE::EMCALJetTasks::Test;
 #pragma link C++ class PWGJE::EMCALJetTasks::Test::AliAnalysisTaskEmcalTriggerSelectionTest+;
+#pragma link C++ class PWGJE::EMCALJetTasks::Test::TestAliJetMatchingGrid+;
 
 #ifdef WITH_ROOUNFOLD
 // Classes which need direct access only to RooUnfold objects
@@ -282,6 +284,7 @@
 #pragma link C++ class AliAnalysisTaskSVtaskMCFilter+;
 #pragma link C++ class AliAnalysisTaskEA+;
 #pragma link C++ class PWGJE::EMCALJetTasks::AliLundPlaneHelper+;
+#pragma link C++ class PWGJE::EMCALJetTasks::Test::TestAliFJWrapper+;
 #pragma link C++ class PWGJE::EMCALJetTasks::AliAnalysisTaskEmcalSoftDropData+;
 #ifdef WITH_ROOUNFOLD
 // Classes which need direct access to both Fastjet and RooUnfold objects
@@ -0,0 +1,146 @@
+/************************************************************************************
+ * Copyright (C) 2020, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TString.h>
+
+#include "AliFJWrapper.h"
+#include "TestAliFJWrapper.h"
+
+/// \cond CLASSIMP
+ClassImp(PWGJE::EMCALJetTasks::Test::TestAliFJWrapper)
+/// \endcond
+
+using namespace PWGJE::EMCALJetTasks::Test;
+
+bool TestAliFJWrapper::RunAllTests() const {
+  bool result = true;
+  if(!TestRunBatch()) {
+    std::cout << "Test RunBatch failed" << std::endl;
+    result = false;
+  }
+  return result;
+}
+
+bool TestAliFJWrapper::TestRunBatch() const {
+  const int kNWrappers = 6, kNEvents = 3, kNParticles = 300;
+  std::vector<std::unique_ptr<AliFJWrapper>> reference, batch;
+  std::vector<AliFJWrapper *> batchpointers;
+  for(int iwrapper = 0; iwrapper < kNWrappers; iwrapper++) {
+    reference.emplace_back(new AliFJWrapper(Form("reference%d", iwrapper), Form("reference%d", iwrapper)));
+    batch.emplace_back(new AliFJWrapper(Form("batch%d", iwrapper), Form("batch%d", iwrapper)));
+    ConfigureWrapper(*reference.back(), iwrapper);
+    ConfigureWrapper(*batch.back(), iwrapper);
+    batchpointers.push_back(batch.back().get());
+  }
+
+  TRandom3 rnd(1234);
+  bool result = true;
+  for(int ievent = 0; ievent < kNEvents; ievent++) {
+    for(int iwrapper = 0; iwrapper < kNWrappers; iwrapper++) {
+      // each wrapper gets its own event, as the embedding replicas
+      reference[iwrapper]->Clear();
+      batch[iwrapper]->Clear();
+      for(int ipart = 0; ipart < kNParticles; ipart++) {
+        double pt = rnd.Exp(1.) + 0.15, eta = rnd.Uniform(-0.9, 0.9), phi = rnd.Uniform(0., TMath::TwoPi());
+        double px = pt * TMath::Cos(phi), py = pt * TMath::Sin(phi), pz = pt * TMath::SinH(eta);
+        double e = TMath::Sqrt(px * px + py * py + pz * pz);
+        reference[iwrapper]->AddInputVector(px, py, pz, e, ipart);
+        batch[iwrapper]->AddInputVector(px, py, pz, e, ipart);
+      }
+      if(reference[iwrapper]->Run()) {
+        std::cout << "Run failed for wrapper " << iwrapper << std::endl;
+        return false;
+      }
+    }
+    if(AliFJWrapper::RunBatch(batchpointers, 4)) {
+      std::cout << "RunBatch failed in event " << ievent << std::endl;
+      return false;
+    }
+    for(int iwrapper = 0; iwrapper < kNWrappers; iwrapper++) {
+      // areas are only reproducible with fixed ghosts or Voronoi areas
+      if(!AssertSameJets(*batch[iwrapper], *reference[iwrapper], iwrapper % 3 != 2)) {
+        std::cout << "Different jets for wrapper " << iwrapper << " in event " << ievent << std::endl;
+        result = false;
+      }
+    }
+  }
+  return result;
+}
+
+void TestAliFJWrapper::ConfigureWrapper(AliFJWrapper &wrapper, int variant) const {
+  wrapper.SetAlgorithm(fastjet::antikt_algorithm);
+  wrapper.SetRecombScheme(fastjet::pt_scheme);
+  wrapper.SetR(0.2 + 0.1 * (variant / 3));
+  wrapper.SetMaxRap(1.);
+  wrapper.SetGhostArea(0.01);
+  switch(variant % 3) {
+  case 0:
+    // ghosts generated once, without random scatter: identical in both sets
+    wrapper.SetAreaType(fastjet::active_area_explicit_ghosts);
+    wrapper.SetGridScatter(0.);
+    wrapper.SetKtScatter(0.);
+    wrapper.SetReuseGhosts(kTRUE);
+    break;
+  case 1:
+    wrapper.SetAreaType(fastjet::voronoi_area);
+    break;
+  case 2:
+    // random ghosts: run sequentially, only the jet momenta are compared
+    wrapper.SetAreaType(fastjet::active_area);
+    break;
+  };
+}
+
+bool TestAliFJWrapper::AssertSameJets(const AliFJWrapper &test, const AliFJWrapper &reference, bool comparearea) const {
+  const std::vector<fastjet::PseudoJet> &testjets = test.GetInclusiveJets(), &refjets = reference.GetInclusiveJets();
+  // hard jets only, pure ghost jets depend on the ghosts
+  std::vector<fastjet::PseudoJet> testhard = fastjet::sorted_by_pt(fastjet::SelectorPtMin(1.)(testjets)),
+                                  refhard = fastjet::sorted_by_pt(fastjet::SelectorPtMin(1.)(refjets));
+  if(testhard.size() != refhard.size()) {
+    std::cout << "Number of jets: " << testhard.size() << " (batch) vs " << refhard.size() << " (reference)" << std::endl;
+    return false;
+  }
+  for(size_t ijet = 0; ijet < testhard.size(); ijet++) {
+    if(TMath::Abs(testhard[ijet].pt() - refhard[ijet].pt()) > 1e-9 || TMath::Abs(testhard[ijet].rap() - refhard[ijet].rap()) > 1e-9 ||
+       TMath::Abs(testhard[ijet].delta_phi_to(refhard[ijet])) > 1e-9) {
+      std::cout << "Jet " << ijet << ": pt " << testhard[ijet].pt() << " (batch) vs " << refhard[ijet].pt() << " (reference)" << std::endl;
+      return false;
+    }
+    if(!comparearea) continue;
+    double testarea = test.GetClusterSequence()->area(testhard[ijet]), refarea = reference.GetClusterSequence()->area(refhard[ijet]);
+    if(TMath::Abs(testarea - refarea) > 1e-9) {
+      std::cout << "Jet " << ijet << ": area " << testarea << " (batch) vs " << refarea << " (reference)" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
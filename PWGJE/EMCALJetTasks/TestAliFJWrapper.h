@@ -0,0 +1,93 @@
+/************************************************************************************
+ * Copyright (C) 2020, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef PWGJE_EMCALJETTASKS_TESTALIFJWRAPPER_H
+#define PWGJE_EMCALJETTASKS_TESTALIFJWRAPPER_H
+
+#include <TObject.h>
+
+class AliFJWrapper;
+
+namespace PWGJE {
+namespace EMCALJetTasks {
+namespace Test {
+
+/**
+ * @class TestAliFJWrapper
+ * @brief Unit test for the batched jet finding of AliFJWrapper
+ * @ingroup EMCALJETFW
+ *
+ * Jets found with AliFJWrapper::RunBatch() must be identical to the jets
+ * found by calling AliFJWrapper::Run() on each wrapper, covering
+ * - wrappers run on the thread pool (reused ghosts, Voronoi areas)
+ * - wrappers run sequentially inside the batch (random ghosts)
+ * - several events, with the definitions and ghosts kept across events
+ */
+class TestAliFJWrapper : public TObject {
+public:
+  /**
+   * @brief Constructor
+   */
+  TestAliFJWrapper() {}
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~TestAliFJWrapper() {}
+
+  /**
+   * @brief Run test suite
+   * @return true All tests passed
+   * @return false At least one test failed
+   */
+  bool RunAllTests() const;
+
+  /**
+   * @brief Compare RunBatch() to sequential Run() calls
+   *
+   * Two identical sets of wrappers with different jet radii and area types
+   * are fed with the same toy events, one set is run with Run(), the other
+   * with RunBatch(). Jet momenta and areas must agree.
+   *
+   * @return true Test passed
+   * @return false Test failed
+   */
+  bool TestRunBatch() const;
+
+protected:
+  void ConfigureWrapper(AliFJWrapper &wrapper, int variant) const;
+  bool AssertSameJets(const AliFJWrapper &test, const AliFJWrapper &reference, bool comparearea) const;
+
+  /// \cond CLASSIMP
+  ClassDef(TestAliFJWrapper, 1);
+  /// \endcond
+};
+
+}
+}
+}
+
+#endif
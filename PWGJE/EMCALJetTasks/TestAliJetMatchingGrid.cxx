@@ -0,0 +1,149 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TVector2.h>
+
+#include "AliJetMatchingGrid.h"
+#include "TestAliJetMatchingGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(PWGJE::EMCALJetTasks::Test::TestAliJetMatchingGrid)
+/// \endcond
+
+using namespace PWGJE::EMCALJetTasks::Test;
+
+namespace {
+
+/**
+ * Closest-jet bookkeeping as in AliJetResponseMaker::SetMatchingLevel
+ */
+struct ClosestJets {
+  Int_t    fClosest[2] = {-1, -1};
+  Double_t fDist[2] = {999, 999};
+
+  void Update(Int_t other, Double_t d) {
+    if (d < fDist[0]) {
+      fClosest[1] = fClosest[0]; fDist[1] = fDist[0];
+      fClosest[0] = other; fDist[0] = d;
+    }
+    else if (d < fDist[1]) {
+      fClosest[1] = other; fDist[1] = d;
+    }
+  }
+};
+
+std::vector<std::pair<Int_t, Int_t> > Match(const std::vector<ClosestJets> &c1, const std::vector<ClosestJets> &c2, Double_t maxDist)
+{
+  std::vector<std::pair<Int_t, Int_t> > matches;
+  for (UInt_t i = 0; i < c1.size(); i++) {
+    Int_t j = c1[i].fClosest[0];
+    if (j < 0) continue;
+    if (c2[j].fClosest[0] != (Int_t)i) continue;
+    if (c1[i].fDist[0] > maxDist || c2[j].fDist[0] > maxDist) continue;
+    matches.push_back(std::make_pair(i, j));
+  }
+  return matches;
+}
+
+}
+
+/**
+ * Run the matching test for several configurations
+ * @return true if all tests passed
+ */
+bool TestAliJetMatchingGrid::RunAllTests() const
+{
+  bool result = true;
+  result &= TestMatching(200, 40, 40, 0.2, 0.7);    // small-R jets in the acceptance
+  result &= TestMatching(200, 150, 120, 0.2, 0.9);  // dense events with fake jets
+  result &= TestMatching(200, 20, 20, 0.6, 1.5);    // large R, jets outside the eta range of the grid
+  result &= TestMatching(100, 10, 10, 4., 0.9);     // radius larger than the phi range
+  return result;
+}
+
+/**
+ * Compare the geometrical matching from the brute-force loop with the grid based matching
+ * @param nevents Number of random events
+ * @param njets1 Number of jets in collection 1
+ * @param njets2 Number of jets in collection 2 (the first ones are smeared copies of jets 1)
+ * @param radius Maximum matching distance
+ * @param etaRange Jets are generated in |eta| < etaRange
+ * @return true if the matched pairs are identical in all events
+ */
+bool TestAliJetMatchingGrid::TestMatching(Int_t nevents, Int_t njets1, Int_t njets2, Double_t radius, Double_t etaRange) const
+{
+  TRandom3 rnd(1234);
+  AliJetMatchingGrid grid;
+  std::vector<Int_t> candidates;
+  Int_t nfailed = 0, nmatches = 0;
+
+  for (Int_t iev = 0; iev < nevents; iev++) {
+    std::vector<Double_t> eta1(njets1), phi1(njets1), eta2(njets2), phi2(njets2);
+    for (Int_t i = 0; i < njets1; i++) {
+      eta1[i] = rnd.Uniform(-etaRange, etaRange);
+      // a fraction of the jets close to the phi boundary
+      phi1[i] = (i % 5 == 0) ? TVector2::Phi_0_2pi(rnd.Gaus(0, radius)) : rnd.Uniform(0, TMath::TwoPi());
+    }
+    for (Int_t i = 0; i < njets2; i++) {
+      if (i < njets1 && rnd.Rndm() < 0.7) {
+        eta2[i] = eta1[i] + rnd.Gaus(0, radius / 2);
+        phi2[i] = TVector2::Phi_0_2pi(phi1[i] + rnd.Gaus(0, radius / 2));
+      }
+      else {
+        eta2[i] = rnd.Uniform(-etaRange, etaRange);
+        phi2[i] = rnd.Uniform(0, TMath::TwoPi());
+      }
+    }
+
+    // brute force
+    std::vector<ClosestJets> bf1(njets1), bf2(njets2);
+    for (Int_t i = 0; i < njets1; i++) {
+      for (Int_t j = 0; j < njets2; j++) {
+        Double_t d = AliJetMatchingGrid::DeltaR(eta1[i], phi1[i], eta2[j], phi2[j]);
+        bf1[i].Update(j, d);
+        bf2[j].Update(i, d);
+      }
+    }
+
+    // grid
+    std::vector<ClosestJets> g1(njets1), g2(njets2);
+    grid.Init(radius);
+    for (Int_t j = 0; j < njets2; j++) grid.Add(j, eta2[j], phi2[j]);
+    grid.Build();
+    for (Int_t i = 0; i < njets1; i++) {
+      grid.FindCandidates(eta1[i], phi1[i], candidates);
+      for (auto j : candidates) {
+        Double_t d = AliJetMatchingGrid::DeltaR(eta1[i], phi1[i], eta2[j], phi2[j]);
+        g1[i].Update(j, d);
+        g2[j].Update(i, d);
+      }
+    }
+
+    std::vector<std::pair<Int_t, Int_t> > mbf = Match(bf1, bf2, radius), mgrid = Match(g1, g2, radius);
+    if (mbf != mgrid) {
+      std::cout << "Event " << iev << ": " << mbf.size() << " matches from the full loop, " << mgrid.size() << " from the grid" << std::endl;
+      nfailed++;
+    }
+    nmatches += mbf.size();
+  }
+  std::cout << "TestAliJetMatchingGrid: R = " << radius << ", " << nevents << " events, " << nmatches << " matches, "
+            << nfailed << " events with differences" << std::endl;
+  return nfailed == 0;
+}
@@ -0,0 +1,54 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#ifndef PWGJE_EMCALJETTASKS_TESTALIJETMATCHINGGRID_H
+#define PWGJE_EMCALJETTASKS_TESTALIJETMATCHINGGRID_H
+
+#include <TObject.h>
+
+namespace PWGJE {
+namespace EMCALJetTasks {
+namespace Test {
+
+/**
+ * @class TestAliJetMatchingGrid
+ * @brief Regression test for the grid based jet matching
+ *
+ * Random sets of detector level and particle level jets are matched
+ * geometrically once with the brute-force loop over all pairs and once
+ * with the candidates found by AliJetMatchingGrid, using the closest-jet
+ * bookkeeping of AliJetResponseMaker. The test passes if the matched pairs
+ * are identical, including jets close to the phi boundary and outside the
+ * eta range of the grid.
+ *
+ * Run with macros/TestAliJetMatchingGrid.C (ctest func_PWGJEEMCALJetTasks_AliJetMatchingGrid)
+ */
+class TestAliJetMatchingGrid : public TObject {
+public:
+  TestAliJetMatchingGrid() {}
+  virtual ~TestAliJetMatchingGrid() {}
+
+  bool RunAllTests() const;
+  bool TestMatching(Int_t nevents, Int_t njets1, Int_t njets2, Double_t radius, Double_t etaRange) const;
+
+  /// \cond CLASSIMP
+  ClassDef(TestAliJetMatchingGrid, 1);
+  /// \endcond
+};
+
+}
+}
+}
+
+#endif
@@ -12,8 +12,14 @@
 
 #include "AliExternalBDT.h"
 
+#include <TSystem.h>
+
 #include <cassert>
+#include <cmath>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -27,6 +33,24 @@ namespace {
       return false;
     }
   }
+
+  /// Tag unique to this handler, for the temporary files written next to the
+  /// shared ones: the cache directory can be shared by jobs on different nodes
+  std::string uniqueTag(const void *handler) {
+    return std::string(gSystem->HostName()) + "_" + std::to_string(gSystem->GetPid()) + "_" +
+      std::to_string((unsigned long)handler);
+  }
+
+  void removeDirectory(const std::string &dir) {
+    void *dirp = gSystem->OpenDirectory(dir.data());
+    if (!dirp) return;
+    while (const char *entry = gSystem->GetDirEntry(dirp)) {
+      const std::string name{entry};
+      if (name != "." && name != "..") gSystem->Unlink((dir + "/" + name).data());
+    }
+    gSystem->FreeDirectory(dirp);
+    gSystem->Unlink(dir.data());
+  }
 }
 
 AliExternalBDT::AliExternalBDT(std::string name) :
@@ -35,7 +59,14 @@ AliExternalBDT::AliExternalBDT(std::string name) :
   fModelPath{""},
   fModelName{""},
   fCompiler{},
-  fPredictor{}
+  fPredictor{},
+  fCacheDirectory{""},
+  fNThreads{1},
+  fModelHash{""},
+  fLibraryPath{""},
+  fEntries{},
+  fBatchFeatures{},
+  fBatchScores{}
 {
 }
 
@@ -45,9 +76,18 @@ bool AliExternalBDT::CompileAndLoadModelLibrary() {
   if (checkFile(path + "/main.so")) {
     std::cout << "Library found: " << path.data() << "/main.so . Loading it!" << std::endl;
   } else {
+    /// The library is built under a temporary name and renamed when complete,
+    /// so that concurrent jobs never load a partially written main.so
     std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
-    system((std::string("gcc -c -O1 -fPIC ") + path + "/main.c -o " + path + "/main.o && gcc -shared " + path + \
-          "/main.o -o " + path + "/main.so").data());
+    const std::string tmp = path + "/main_" + uniqueTag(this);
+    const int status = gSystem->Exec((std::string("gcc -c -O1 -fPIC ") + path + "/main.c -o " + tmp + ".o && gcc -shared " + \
+          tmp + ".o -o " + tmp + ".so").data());
+    gSystem->Unlink((tmp + ".o").data());
+    if (status != 0 || rename((tmp + ".so").data(), (path + "/main.so").data()) != 0) {
+      std::cerr << "Library compilation failed." << std::endl;
+      gSystem->Unlink((tmp + ".so").data());
+      return false;
+    }
   }
   return LoadModelLibrary(path + "/main.so");
 }
@@ -58,25 +98,58 @@ bool AliExternalBDT::CreateModelCode() {
     std::cout << "Code found: " << path.data() << "/main.c . \
       Remove it or unset/change the AliExternalBDT name to force its regeneration." << std::endl;
   } else {
+    /// The code is generated in a temporary directory which is then renamed:
+    /// the directory of the model either does not exist or is complete
+    const std::string tmp = path + "_" + uniqueTag(this);
     const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
     if (status_comp != 0) {
       std::cerr << "Compiler creation failed." << std::endl;
       return false;
     }
-    const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, path.data());
+    const int status_gen = TreeliteCompilerGenerateCode(fCompiler, fModel, 1, tmp.data());
     if (status_gen != 0) {
       std::cerr << "Code generation failed." << std::endl;
+      removeDirectory(tmp);
       return false;
     }
+    if (rename(tmp.data(), path.data()) != 0) {
+      /// Another job was faster: its code is used
+      removeDirectory(tmp);
+      if (!checkFile(path + "/main.c")) {
+        std::cerr << "Code generation failed: cannot create " << path.data() << std::endl;
+        return false;
+      }
+    }
   }
   return true;
 }
 
+std::string AliExternalBDT::GetModelHash() const {
+  /// FNV-1a hash of the model file: the same model gets the same library
+  /// name in all the jobs, so that it is compiled only once
+  std::ifstream model(fModelPath.data(), std::ios::binary);
+  if (!model.good()) return "";
+  unsigned long long hash = 14695981039346656037ull;
+  char c;
+  while (model.get(c)) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ull;
+  }
+  std::ostringstream hex;
+  hex << std::hex << hash;
+  return hex.str();
+}
+
 std::string AliExternalBDT::GetUniquePath() {
+  /// The model hash is part of all the names, such that an updated model with
+  /// the same file name never reuses a library of the old one
+  std::string dir = fCacheDirectory.empty() ? "" : fCacheDirectory + "/";
   if (fBDTname.empty()) {
-    return fModelName + std::to_string((unsigned long)this);
+    if (fModelHash.empty()) return dir + fModelName + std::to_string((unsigned long)this);
+    return dir + fModelName + "_" + fModelHash;
   } else {
-    return fBDTname + "_" + fModelName;
+    if (fModelHash.empty()) return dir + fBDTname + "_" + fModelName;
+    return dir + fBDTname + "_" + fModelName + "_" + fModelHash;
   }
 }
 
@@ -87,6 +160,12 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
   }
   fModelPath = path;
   fModelName = fModelPath.substr(fModelPath.find_last_of("\\/")+1,fModelPath.size());
+  fModelHash = GetModelHash();
+  if (!fCacheDirectory.empty() && gSystem->mkdir(fCacheDirectory.data(), kTRUE) != 0 &&
+      gSystem->AccessPathName(fCacheDirectory.data())) {
+    std::cerr << "Cannot create the cache directory " << fCacheDirectory.data() << std::endl;
+    return false;
+  }
   int status = 0;
   switch (type) {
     case 0:
@@ -119,25 +198,84 @@ bool AliExternalBDT::LoadLightGBMModel(std::string path) {
 }
 
 bool AliExternalBDT::LoadModelLibrary(std::string path) {
-  const int status = TreelitePredictorLoad(path.data(), 1, 1, &fPredictor);
+  if (fPredictor) {
+    TreelitePredictorFree(fPredictor);
+    fPredictor = nullptr;
+  }
+  const int status = TreelitePredictorLoad(path.data(), fNThreads, 1, &fPredictor);
   if (status != 0) {
     std::cerr << "Library loading failed" << std::endl;
+    fPredictor = nullptr;
     return false;
   }
+  fLibraryPath = path;
   return true;
 }
 
+void AliExternalBDT::SetNThreads(int nThreads) {
+  /// The number of threads is fixed when the predictor is created: a library
+  /// which is already loaded is reloaded with the new setting
+  if (nThreads == fNThreads) return;
+  fNThreads = nThreads;
+  if (fPredictor && !LoadModelLibrary(fLibraryPath)) {
+    std::cerr << "The predictor could not be recreated with " << nThreads << " threads" << std::endl;
+  }
+}
+
 double AliExternalBDT::Predict(double *features, int size, bool useRawScore) {
-  std::vector<TreelitePredictorEntry> entries(size);
-  for (size_t iEntry = 0; iEntry < entries.size(); ++iEntry) {
-    entries[iEntry].fvalue = static_cast<float>(features[iEntry]);
+  fEntries.resize(size);
+  for (size_t iEntry = 0; iEntry < fEntries.size(); ++iEntry) {
+    /// NaN features are missing, as in PredictBatch
+    if (std::isnan(features[iEntry])) {
+      fEntries[iEntry].missing = -1;
+    } else {
+      fEntries[iEntry].fvalue = static_cast<float>(features[iEntry]);
+    }
   }
   size_t out_size{0u};
   TreelitePredictorQueryResultSizeSingleInst(fPredictor, &out_size);
   assert(out_size == 1);
   float output = 0.f;
-  TreelitePredictorPredictInst(fPredictor, entries.data(),
+  TreelitePredictorPredictInst(fPredictor, fEntries.data(),
       static_cast<int>(useRawScore), &output,
       &out_size);
   return output;
 }
+
+bool AliExternalBDT::PredictBatch(const double *features, int nRows, int nCols, double *scores, bool useRawScore) {
+  /// Score nRows candidates at once: features is the row-major
+  /// [nRows][nCols] matrix, scores has nRows entries. The prediction runs
+  /// on the threads of the predictor (see SetNThreads). NaN features are
+  /// treated as missing.
+  if (nRows <= 0) return true;
+  const size_t size = static_cast<size_t>(nRows) * nCols;
+  fBatchFeatures.resize(size);
+  for (size_t iEntry = 0; iEntry < size; ++iEntry) {
+    fBatchFeatures[iEntry] = static_cast<float>(features[iEntry]);
+  }
+  DenseBatchHandle batch;
+  if (TreeliteAssembleDenseBatch(fBatchFeatures.data(), std::numeric_limits<float>::quiet_NaN(),
+        nRows, nCols, &batch) != 0) {
+    std::cerr << "Batch creation failed." << std::endl;
+    return false;
+  }
+  size_t out_size{0u};
+  TreelitePredictorQueryResultSize(fPredictor, batch, 0, &out_size);
+  if (out_size != static_cast<size_t>(nRows)) {
+    std::cerr << "Unexpected result size " << out_size << " for " << nRows << " candidates." << std::endl;
+    TreeliteDeleteDenseBatch(batch);
+    return false;
+  }
+  fBatchScores.resize(out_size);
+  const int status = TreelitePredictorPredictBatch(fPredictor, batch, 0, 0,
+      static_cast<int>(useRawScore), fBatchScores.data(), &out_size);
+  TreeliteDeleteDenseBatch(batch);
+  if (status != 0) {
+    std::cerr << "Batch prediction failed." << std::endl;
+    return false;
+  }
+  for (int iRow = 0; iRow < nRows; ++iRow) {
+    scores[iRow] = fBatchScores[iRow];
+  }
+  return true;
+}
@@ -29,11 +29,19 @@ public:
   bool LoadModelLibrary(std::string path);
   bool LoadXGBoostModel(std::string path);
 
+  /// NaN features are passed to the model as missing values, as in
+  /// PredictBatch. Before they were passed as values, which changes the
+  /// score of candidates with NaN features for models trained with missing values.
   double Predict(double *features, int size, bool useRaw = false);
+  bool PredictBatch(const double *features, int nRows, int nCols, double *scores, bool useRaw = false);
+
+  void SetCacheDirectory(std::string dir) { fCacheDirectory = dir; }
+  void SetNThreads(int nThreads);
 
 private:
   bool CompileAndLoadModelLibrary();
   bool CreateModelCode();
+  std::string GetModelHash() const;
   std::string GetUniquePath();
   bool LoadModel(const std::string &path, int type);
 
@@ -43,6 +51,14 @@ private:
   std::string fModelName;
   CompilerHandle fCompiler;
   PredictorHandle fPredictor;
+  std::string fCacheDirectory;  /// Directory of the generated code and compiled libraries
+  int fNThreads;                /// Number of threads used by the predictor
+  std::string fModelHash;       /// Hash of the model file, part of the names of the compiled libraries
+  std::string fLibraryPath;     /// Compiled library of the loaded predictor
+
+  std::vector<TreelitePredictorEntry> fEntries; //! Preallocated features for Predict
+  std::vector<float> fBatchFeatures;            //! Preallocated feature matrix for PredictBatch
+  std::vector<float> fBatchScores;              //! Preallocated output for PredictBatch
 };
 
 #endif
@@ -51,6 +51,8 @@ int test_AliEsternalBDT(string path = "") {
     return 1;
   }
 
+  std::vector<double> allFeatures, singleScores;
+
   while (fReader.Next()) {
 
     double features[12] = {*fValueDeltaMass,  *fValueDLen,       *fValueNormDLXY,
@@ -58,9 +60,38 @@ int test_AliEsternalBDT(string path = "") {
                            *fValueSigCombK0,  *fValueSigCombK1,  *fValueSigCombK2,
                            *fValueSigCombPi0, *fValueSigCombPi1, *fValueSigCombPi2};
 
-    fAliExtBDT_Pred << Form("%.10f", fBDT->Predict(features, 12, true)) << std::endl;
+    double score = fBDT->Predict(features, 12, true);
+    fAliExtBDT_Pred << Form("%.10f", score) << std::endl;
+    allFeatures.insert(allFeatures.end(), features, features + 12);
+    singleScores.push_back(score);
   }
   fInput->Close();
+
+  // the batch prediction has to give the same scores
+  std::vector<double> batchScores(singleScores.size());
+  if (!fBDT->PredictBatch(allFeatures.data(), singleScores.size(), 12, batchScores.data(), true)) {
+    std::cout << "TEST: Fail! (batch prediction)" << std::endl;
+    return 1;
+  }
+  for (size_t iCand = 0; iCand < singleScores.size(); ++iCand) {
+    if (abs(batchScores[iCand] - singleScores[iCand]) > DELTA) {
+      std::cout << "TEST: Fail! (batch prediction)" << std::endl;
+      return 1;
+    }
+  }
+
+  // changing the number of threads recreates the predictor, the scores must not change
+  fBDT->SetNThreads(2);
+  if (!fBDT->PredictBatch(allFeatures.data(), singleScores.size(), 12, batchScores.data(), true)) {
+    std::cout << "TEST: Fail! (batch prediction with 2 threads)" << std::endl;
+    return 1;
+  }
+  for (size_t iCand = 0; iCand < singleScores.size(); ++iCand) {
+    if (abs(batchScores[iCand] - singleScores[iCand]) > DELTA) {
+      std::cout << "TEST: Fail! (batch prediction with 2 threads)" << std::endl;
+      return 1;
+    }
+  }
   delete fBDT;
 
   fAliExtBDT_Pred.clear();
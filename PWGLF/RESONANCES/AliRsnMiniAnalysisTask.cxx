@@ -13,6 +13,9 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 
 #include <Riostream.h>
+#include <algorithm>
+#include <limits>
+#include <map>
 
 #include <TH1.h>
 #include <TList.h>
@@ -578,6 +581,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       else printNum = 0;
    }
 
+   // mixing variables of all events, kept in memory for the search of the mixing partners
+   std::vector<Float_t> evVz(nEvents), evMult(nEvents), evAngle(nEvents);
+
    // loop on events, and for each one fill all outputs
    // using the appropriate procedure depending on its type
    // only mother-related histograms are filled in UserExec,
@@ -586,6 +592,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
       fEvBuffer->GetEntry(ievt);
+      evVz[ievt]    = fMiniEvent->Vz();
+      evMult[ievt]  = fMiniEvent->Mult();
+      evAngle[ievt] = fMiniEvent->Angle();
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -635,66 +644,28 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
-
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
    // search for good matchings
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
-         // check that the found good events has not enough matches already
-         if (nmatched[imix] >= fNMix) continue;
-         // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
-         nmatched[ievt]++;
-         nmatched[imix]++;
-         if (nmatched[ievt] >= fNMix) break;
-      }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
-   }
+   std::vector< std::vector<Int_t> > matched(nEvents);
+   FindMixingPartners(evVz, evMult, evAngle, matched, printNum);
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
+      if (matched[ievt].empty()) continue;
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
+      for (UInt_t im = 0; im < matched[ievt].size(); im++) {
+         imix = matched[ievt][im];
          fEvBuffer->GetEntry(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
@@ -707,11 +678,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -1607,13 +1575,21 @@ void AliRsnMiniAnalysisTask::SetDselection(UShort_t originDselection)
 Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2)
 {
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+/// Same as above, from the mixing variables of the two events.
+///
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
       if (dv > fMaxDiffVz) {
          //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
          return kFALSE;
@@ -1628,12 +1604,12 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
       }
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1641,6 +1617,110 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+/// Search of the mixing partners of all buffered events.
+///
+/// The events are indexed in cells of (vz, mult, angle) of size (fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle):
+/// for binned mixing these are the mixing bins, for continuous mixing the matching events
+/// are in the same or in a neighbouring cell. Only these events are checked, in the same
+/// order as in a scan of the whole buffer (ievt+1, ievt+2, ..., wrapping around), so that
+/// the matches are the same as with the scan.
+///
+/// \param vz, mult, angle Mixing variables of the buffered events
+/// \param matched Indexes of the events to be mixed with each event
+/// \param printNum Progress is printed every printNum events (0 = never)
+///
+void AliRsnMiniAnalysisTask::FindMixingPartners(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle,
+                                                std::vector< std::vector<Int_t> > &matched, Int_t printNum) const
+{
+   typedef std::pair<Int_t, std::pair<Int_t, Int_t> > CellKey;
+
+   Int_t ievt, imix, nEvents = (Int_t)vz.size();
+   Double_t width[3] = {fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle};
+   // in case of a non-positive width all events go into one cell and EventsMatch decides
+   Int_t range[3];
+   for (Int_t i = 0; i < 3; i++) range[i] = (fContinuousMix && width[i] > 0.) ? 1 : 0;
+   // continuous mixing: EventsMatch compares the float difference, the cells are enlarged
+   // by its rounding error, so that matching events are never more than one cell apart
+   if (fContinuousMix) {
+      Double_t maxAbs[3] = {0., 0., 0.};
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         maxAbs[0] = TMath::Max(maxAbs[0], (Double_t)TMath::Abs(vz[ievt]));
+         maxAbs[1] = TMath::Max(maxAbs[1], (Double_t)TMath::Abs(mult[ievt]));
+         maxAbs[2] = TMath::Max(maxAbs[2], (Double_t)TMath::Abs(angle[ievt]));
+      }
+      for (Int_t i = 0; i < 3; i++)
+         if (width[i] > 0.) width[i] += 2. * maxAbs[i] * std::numeric_limits<Float_t>::epsilon();
+   }
+
+   // cell of each event, and events in each cell (in increasing order)
+   std::vector<CellKey> evCell(nEvents);
+   std::map<CellKey, std::vector<Int_t> > cells;
+   for (ievt = 0; ievt < nEvents; ievt++) {
+      Float_t val[3] = {vz[ievt], mult[ievt], angle[ievt]};
+      Int_t icell[3];
+      for (Int_t i = 0; i < 3; i++) {
+         if (width[i] <= 0.) icell[i] = 0;
+         else if (fContinuousMix) icell[i] = (Int_t)TMath::Floor(val[i] / width[i]);
+         else icell[i] = (Int_t)(val[i] / width[i]); // as in EventsMatch
+      }
+      evCell[ievt] = CellKey(icell[0], std::make_pair(icell[1], icell[2]));
+      cells[evCell[ievt]].push_back(ievt);
+   }
+
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector<const std::vector<Int_t>*> candidates;
+   std::vector<UInt_t> pos;
+   std::map<CellKey, std::vector<Int_t> >::const_iterator it;
+
+   for (ievt = 0; ievt < nEvents; ievt++) {
+      if (printNum&&(ievt%printNum==0)) {
+         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
+         fflush(stdout);
+      }
+      if (nmatched[ievt] >= fNMix) continue;
+
+      // cells which can contain matching events
+      candidates.clear();
+      for (Int_t dv = -range[0]; dv <= range[0]; dv++)
+         for (Int_t dm = -range[1]; dm <= range[1]; dm++)
+            for (Int_t da = -range[2]; da <= range[2]; da++) {
+               it = cells.find(CellKey(evCell[ievt].first + dv, std::make_pair(evCell[ievt].second.first + dm, evCell[ievt].second.second + da)));
+               if (it != cells.end()) candidates.push_back(&it->second);
+            }
+      pos.resize(candidates.size());
+
+      // first the events after ievt, then the ones before it: merge the cells in this order
+      for (Int_t pass = 0; pass < 2 && nmatched[ievt] < fNMix; pass++) {
+         for (UInt_t ic = 0; ic < candidates.size(); ic++)
+            pos[ic] = (pass == 0) ? std::upper_bound(candidates[ic]->begin(), candidates[ic]->end(), ievt) - candidates[ic]->begin() : 0;
+         while (nmatched[ievt] < fNMix) {
+            Int_t best = -1;
+            imix = nEvents;
+            for (UInt_t ic = 0; ic < candidates.size(); ic++) {
+               if (pos[ic] >= candidates[ic]->size()) continue;
+               Int_t i = (*candidates[ic])[pos[ic]];
+               if (pass == 1 && i >= ievt) continue;
+               if (i < imix) {imix = i; best = ic;}
+            }
+            if (best < 0) break;
+            pos[best]++;
+            // check that the found good events has not enough matches already
+            if (nmatched[imix] >= fNMix) continue;
+            // skip if events are not matched
+            if (!EventsMatch(vz[ievt], mult[ievt], angle[ievt], vz[imix], mult[imix], angle[imix])) continue;
+            // check that the array of good matches for mixed does not already contain main event
+            if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
+            // add new mixing candidate
+            matched[ievt].push_back(imix);
+            nmatched[ievt]++;
+            nmatched[imix]++;
+         }
+      }
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
+   }
+}
+
 //---------------------------------------------------------------------
 /// Patch to be used with 2011 Pb-Pb data for flat centrality distribution
 ///
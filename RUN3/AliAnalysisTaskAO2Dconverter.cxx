@@ -19,6 +19,7 @@
  */
 
 #include "TChain.h"
+#include "TFile.h"
 #include "TTree.h"
 #include "AliAnalysisTask.h"
 #include "AliAnalysisManager.h"
@@ -48,6 +49,8 @@
 #include "AliGenPythiaEventHeader.h"
 #include "AliGenToyEventHeader.h"
 
+#include <cstring>
+
 ClassImp(AliAnalysisTaskAO2Dconverter);
 
 namespace
@@ -90,11 +93,30 @@ const TClass* AliAnalysisTaskAO2Dconverter::Generator[kGenerators] = { AliGenEve
 TTree* AliAnalysisTaskAO2Dconverter::CreateTree(TreeIndex t)
 {
   fTree[t] = new TTree(TreeName[t], TreeTitle[t]);
+  fTree[t]->SetAutoFlush(fAutoFlush[t] != 0 ? fAutoFlush[t] : fNumberOfEventsPerCluster);
+#ifdef R__USE_IMT
+  fTree[t]->SetImplicitMT(fImplicitMT);
+#endif
+  fTruncations[t].clear();
   if (fTreeStatus[t])
-    fTree[t]->Branch("fEventId", &fEventId, "fEventId/l"); // Branch common to all trees
+    AddBranch(t, "fEventId", &fEventId, "fEventId/l"); // Branch common to all trees
   return fTree[t];
 }
 
+void AliAnalysisTaskAO2Dconverter::AddBranch(TreeIndex t, const char* name, void* address, const char* leaflist, UInt_t truncationMask)
+{
+  // Create the branch with the basket size of the tree.
+  // With truncation enabled, the mask is applied to the (single float) value before each Fill
+  fTree[t]->Branch(name, address, leaflist, fBasketSize[t] > 0 ? fBasketSize[t] : 32000);
+
+  if (fTruncate && truncationMask && TString(leaflist).EndsWith("/F")) {
+    Truncation trunc;
+    trunc.fAddress = static_cast<Float_t*>(address);
+    trunc.fMask = truncationMask;
+    fTruncations[t].push_back(trunc);
+  }
+}
+
 void AliAnalysisTaskAO2Dconverter::PostTree(TreeIndex t)
 {
   if (!fTreeStatus[t])
@@ -106,6 +128,13 @@ void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
 {
   if (!fTreeStatus[t])
     return;
+  // Lossy compression: truncate the mantissa of the selected float fields
+  for (auto& trunc : fTruncations[t]) {
+    UInt_t bits;
+    memcpy(&bits, trunc.fAddress, sizeof(bits));
+    bits &= trunc.fMask;
+    memcpy(trunc.fAddress, &bits, sizeof(bits));
+  }
   fTree[t]->Fill();
 }
 
@@ -120,116 +149,116 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   }
 
   // create output objects
-  OpenFile(1); // Necessary for large outputs
+  TFile* file = OpenFile(1); // Necessary for large outputs
+  if (file && fCompressionSettings >= 0)
+    file->SetCompressionSettings(fCompressionSettings);
 
   // Associate branches for fEventTree
-  TTree* Events = CreateTree(kEvents);
-  Events->SetAutoFlush(fNumberOfEventsPerCluster);
+  CreateTree(kEvents);
   if (fTreeStatus[kEvents]) {
-    Events->Branch("fVtxX", &fVtxX, "fVtxX/F");
-    Events->Branch("fVtxY", &fVtxY, "fVtxY/F");
-    Events->Branch("fVtxZ", &fVtxZ, "fVtxZ/F");
-    Events->Branch("fCentFwd", &fCentFwd, "fCentFwd/F");
-    Events->Branch("fCentBarrel", &fCentBarrel, "fCentBarrel/F");
-    Events->Branch("fEventTime", &fEventTime, "fEventTime[10]/F");
-    Events->Branch("fEventTimeRes", &fEventTimeRes, "fEventTimeRes[10]/F");
-    Events->Branch("fEventTimeMask", &fEventTimeMask, "fEventTimeMask[10]/b");
+    AddBranch(kEvents, "fVtxX", &fVtxX, "fVtxX/F");
+    AddBranch(kEvents, "fVtxY", &fVtxY, "fVtxY/F");
+    AddBranch(kEvents, "fVtxZ", &fVtxZ, "fVtxZ/F");
+    AddBranch(kEvents, "fCentFwd", &fCentFwd, "fCentFwd/F");
+    AddBranch(kEvents, "fCentBarrel", &fCentBarrel, "fCentBarrel/F");
+    AddBranch(kEvents, "fEventTime", &fEventTime, "fEventTime[10]/F");
+    AddBranch(kEvents, "fEventTimeRes", &fEventTimeRes, "fEventTimeRes[10]/F");
+    AddBranch(kEvents, "fEventTimeMask", &fEventTimeMask, "fEventTimeMask[10]/b");
     if (fTaskMode == kMC) {
-      Events->Branch("fGeneratorID", &fGeneratorID, "fGeneratorID/S");
-      Events->Branch("fMCVtxX", &fMCVtxX, "fMCVtxX/F");
-      Events->Branch("fMCVtxY", &fMCVtxY, "fMCVtxY/F");
-      Events->Branch("fMCVtxZ", &fMCVtxZ, "fMCVtxZ/F");
+      AddBranch(kEvents, "fGeneratorID", &fGeneratorID, "fGeneratorID/S");
+      AddBranch(kEvents, "fMCVtxX", &fMCVtxX, "fMCVtxX/F");
+      AddBranch(kEvents, "fMCVtxY", &fMCVtxY, "fMCVtxY/F");
+      AddBranch(kEvents, "fMCVtxZ", &fMCVtxZ, "fMCVtxZ/F");
     }
   }
   PostTree(kEvents);
 
   // Associate branches for fTrackTree
-  TTree* Tracks = CreateTree(kTracks);
-  Tracks->SetAutoFlush(fNumberOfEventsPerCluster);
+  CreateTree(kTracks);
   if (fTreeStatus[kTracks]) {
-    Tracks->Branch("fX", &fX, "fX/F");
-    Tracks->Branch("fAlpha", &fAlpha, "fAlpha/F");
-    Tracks->Branch("fY", &fY, "fY/F");
-    Tracks->Branch("fZ", &fZ, "fZ/F");
-    Tracks->Branch("fSnp", &fSnp, "fSnp/F");
-    Tracks->Branch("fTgl", &fTgl, "fTgl/F");
-    Tracks->Branch("fSigned1Pt", &fSigned1Pt, "fSigned1Pt/F");
-    Tracks->Branch("fCYY", &fCYY, "fCYY/F");
-    Tracks->Branch("fCZY", &fCZY, "fCZY/F");
-    Tracks->Branch("fCZZ", &fCZZ, "fCZZ/F");
-    Tracks->Branch("fCSnpY", &fCSnpY, "fCSnpY/F");
-    Tracks->Branch("fCSnpZ", &fCSnpZ, "fCSnpZ/F");
-    Tracks->Branch("fCSnpSnp", &fCSnpSnp, "fCSnpSnp/F");
-    Tracks->Branch("fCTglY", &fCTglY, "fCTglY/F");
-    Tracks->Branch("fCTglZ", &fCTglZ, "fCTglZ/F");
-    Tracks->Branch("fCTglSnp", &fCTglSnp, "fCTglSnp/F");
-    Tracks->Branch("fCTglTgl", &fCTglTgl, "fCTglTgl/F");
-    Tracks->Branch("fC1PtY", &fC1PtY, "fC1PtY/F");
-    Tracks->Branch("fC1PtZ", &fC1PtZ, "fC1PtZ/F");
-    Tracks->Branch("fC1PtSnp", &fC1PtSnp, "fC1PtSnp/F");
-    Tracks->Branch("fC1PtTgl", &fC1PtTgl, "fC1PtTgl/F");
-    Tracks->Branch("fC1Pt21Pt2", &fC1Pt21Pt2, "fC1Pt21Pt2/F");
-    Tracks->Branch("fTPCinnerP", &fTPCinnerP, "fTPCinnerP/F");
-    Tracks->Branch("fFlags", &fFlags, "fFlags/l");
-    Tracks->Branch("fITSClusterMap", &fITSClusterMap, "fITSClusterMap/b");
-    Tracks->Branch("fTPCncls", &fTPCncls, "fTPCncls/s");
-    Tracks->Branch("fTRDntracklets", &fTRDntracklets, "fTRDntracklets/b");
-    Tracks->Branch("fITSchi2Ncl", &fITSchi2Ncl, "fITSchi2Ncl/F");
-    Tracks->Branch("fTPCchi2Ncl", &fTPCchi2Ncl, "fTPCchi2Ncl/F");
-    Tracks->Branch("fTRDchi2", &fTRDchi2, "fTRDchi2/F");
-    Tracks->Branch("fTOFchi2", &fTOFchi2, "fTOFchi2/F");
-    Tracks->Branch("fTPCsignal", &fTPCsignal, "fTPCsignal/F");
-    Tracks->Branch("fTRDsignal", &fTRDsignal, "fTRDsignal/F");
-    Tracks->Branch("fTOFsignal", &fTOFsignal, "fTOFsignal/F");
-    Tracks->Branch("fLength", &fLength, "fLength/F");
-    Tracks->Branch("fLabel", &fLabel, "fLabel/I");
-    Tracks->Branch("fTOFLabel", &fTOFLabel, "fTOFLabel[3]/I");
+    AddBranch(kTracks, "fX", &fX, "fX/F");
+    AddBranch(kTracks, "fAlpha", &fAlpha, "fAlpha/F");
+    AddBranch(kTracks, "fY", &fY, "fY/F");
+    AddBranch(kTracks, "fZ", &fZ, "fZ/F");
+    AddBranch(kTracks, "fSnp", &fSnp, "fSnp/F");
+    AddBranch(kTracks, "fTgl", &fTgl, "fTgl/F");
+    AddBranch(kTracks, "fSigned1Pt", &fSigned1Pt, "fSigned1Pt/F");
+    AddBranch(kTracks, "fCYY", &fCYY, "fCYY/F", fTrackCovDiagMask);
+    AddBranch(kTracks, "fCZY", &fCZY, "fCZY/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fCZZ", &fCZZ, "fCZZ/F", fTrackCovDiagMask);
+    AddBranch(kTracks, "fCSnpY", &fCSnpY, "fCSnpY/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fCSnpZ", &fCSnpZ, "fCSnpZ/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fCSnpSnp", &fCSnpSnp, "fCSnpSnp/F", fTrackCovDiagMask);
+    AddBranch(kTracks, "fCTglY", &fCTglY, "fCTglY/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fCTglZ", &fCTglZ, "fCTglZ/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fCTglSnp", &fCTglSnp, "fCTglSnp/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fCTglTgl", &fCTglTgl, "fCTglTgl/F", fTrackCovDiagMask);
+    AddBranch(kTracks, "fC1PtY", &fC1PtY, "fC1PtY/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fC1PtZ", &fC1PtZ, "fC1PtZ/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fC1PtSnp", &fC1PtSnp, "fC1PtSnp/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fC1PtTgl", &fC1PtTgl, "fC1PtTgl/F", fTrackCovOffDiagMask);
+    AddBranch(kTracks, "fC1Pt21Pt2", &fC1Pt21Pt2, "fC1Pt21Pt2/F", fTrackCovDiagMask);
+    AddBranch(kTracks, "fTPCinnerP", &fTPCinnerP, "fTPCinnerP/F");
+    AddBranch(kTracks, "fFlags", &fFlags, "fFlags/l");
+    AddBranch(kTracks, "fITSClusterMap", &fITSClusterMap, "fITSClusterMap/b");
+    AddBranch(kTracks, "fTPCncls", &fTPCncls, "fTPCncls/s");
+    AddBranch(kTracks, "fTRDntracklets", &fTRDntracklets, "fTRDntracklets/b");
+    AddBranch(kTracks, "fITSchi2Ncl", &fITSchi2Ncl, "fITSchi2Ncl/F");
+    AddBranch(kTracks, "fTPCchi2Ncl", &fTPCchi2Ncl, "fTPCchi2Ncl/F");
+    AddBranch(kTracks, "fTRDchi2", &fTRDchi2, "fTRDchi2/F");
+    AddBranch(kTracks, "fTOFchi2", &fTOFchi2, "fTOFchi2/F");
+    AddBranch(kTracks, "fTPCsignal", &fTPCsignal, "fTPCsignal/F", fTrackSignalMask);
+    AddBranch(kTracks, "fTRDsignal", &fTRDsignal, "fTRDsignal/F", fTrackSignalMask);
+    AddBranch(kTracks, "fTOFsignal", &fTOFsignal, "fTOFsignal/F", fTrackSignalMask);
+    AddBranch(kTracks, "fLength", &fLength, "fLength/F");
+    AddBranch(kTracks, "fLabel", &fLabel, "fLabel/I");
+    AddBranch(kTracks, "fTOFLabel", &fTOFLabel, "fTOFLabel[3]/I");
   }
   PostTree(kTracks);
 
   // Associate branches for Calo
-  TTree* Calo = CreateTree(kCalo);
-  Calo->SetAutoFlush(fNumberOfEventsPerCluster);
+  CreateTree(kCalo);
   if (fTreeStatus[kCalo]) {
-    Calo->Branch("fCellNumber", &fCellNumber, "fCellNumber/S");
-    Calo->Branch("fAmplitude", &fAmplitude, "fAmplitude/F");
-    Calo->Branch("fTime", &fTime, "fTime/F");
-    Calo->Branch("fType", &fType, "fType/B");
+    AddBranch(kCalo, "fCellNumber", &fCellNumber, "fCellNumber/S");
+    AddBranch(kCalo, "fAmplitude", &fAmplitude, "fAmplitude/F");
+    AddBranch(kCalo, "fTime", &fTime, "fTime/F");
+    AddBranch(kCalo, "fType", &fType, "fType/B");
   }
   PostTree(kCalo);
 
   // Associate branches for TOF
-  TTree* TOF = CreateTree(kTOF);
-  TOF->SetAutoFlush(fNumberOfEventsPerCluster);
+  CreateTree(kTOF);
   if (fTreeStatus[kTOF]) {
-    TOF->Branch("fTOFChannel", &fTOFChannel, "fTOFChannel/I");
-    TOF->Branch("fTOFncls", &fTOFncls, "fTOFncls/S");
-    TOF->Branch("fDx", &fDx, "fDx/F");
-    TOF->Branch("fDz", &fDz, "fDz/F");
-    TOF->Branch("fToT", &fToT, "fToT/F");
+    AddBranch(kTOF, "fTOFChannel", &fTOFChannel, "fTOFChannel/I");
+    AddBranch(kTOF, "fTOFncls", &fTOFncls, "fTOFncls/S");
+    AddBranch(kTOF, "fDx", &fDx, "fDx/F");
+    AddBranch(kTOF, "fDz", &fDz, "fDz/F");
+    AddBranch(kTOF, "fToT", &fToT, "fToT/F");
   }
   PostTree(kTOF);
 
   // Associate branches for Kinematics
-  TTree* Kinematics = CreateTree(kKinematics);
-  Kinematics->SetAutoFlush(fNumberOfEventsPerCluster);
+  CreateTree(kKinematics);
   if (fTreeStatus[kMC]) {
-    Kinematics->Branch("fPdgCode", &fPdgCode, "fPdgCode/I");
-    Kinematics->Branch("fMother", &fMother, "fMother[2]/I");
-    Kinematics->Branch("fDaughter", &fDaughter, "fDaughter[2]/I");
-
-    Kinematics->Branch("fPx", &fPx, "fPx/F");
-    Kinematics->Branch("fPy", &fPy, "fPy/F");
-    Kinematics->Branch("fPz", &fPz, "fPz/F");
-
-    Kinematics->Branch("fVx", &fVx, "fVx/F");
-    Kinematics->Branch("fVy", &fVy, "fVy/F");
-    Kinematics->Branch("fVz", &fVz, "fVz/F");
-    Kinematics->Branch("fVt", &fVt, "fVt/F");
+    AddBranch(kKinematics, "fPdgCode", &fPdgCode, "fPdgCode/I");
+    AddBranch(kKinematics, "fMother", &fMother, "fMother[2]/I");
+    AddBranch(kKinematics, "fDaughter", &fDaughter, "fDaughter[2]/I");
+
+    AddBranch(kKinematics, "fPx", &fPx, "fPx/F");
+    AddBranch(kKinematics, "fPy", &fPy, "fPy/F");
+    AddBranch(kKinematics, "fPz", &fPz, "fPz/F");
+
+    AddBranch(kKinematics, "fVx", &fVx, "fVx/F");
+    AddBranch(kKinematics, "fVy", &fVy, "fVy/F");
+    AddBranch(kKinematics, "fVz", &fVz, "fVz/F");
+    AddBranch(kKinematics, "fVt", &fVt, "fVt/F");
   }
   PostTree(kKinematics);
 
   Prune(); //Removing all unwanted branches (if any)
+
+  fNConverted = 0;
+  fStopwatch.Start(kTRUE);
 }
 
 void AliAnalysisTaskAO2Dconverter::Prune()
@@ -485,11 +514,35 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
       FillTree(kKinematics);
     }
   }
+  fNConverted++;
+
   //Posting data
   for (Int_t i = 0; i < kTrees; i++)
     PostTree((TreeIndex)i);
 }
 
+void AliAnalysisTaskAO2Dconverter::FinishTaskOutput()
+{
+  // Report of the output size and of the conversion throughput
+  fStopwatch.Stop();
+  const Double_t time = fStopwatch.RealTime();
+  AliInfo(Form("Converted %lld events in %.1f s (%.1f events/s)", fNConverted, time, time > 0 ? fNConverted / time : 0.));
+  for (Int_t i = 0; i < kTrees; i++) {
+    if (!fTreeStatus[i] || !fTree[i])
+      continue;
+    fTree[i]->FlushBaskets();
+    const Long64_t entries = fTree[i]->GetEntries();
+    const Long64_t zipBytes = fTree[i]->GetZipBytes();
+    const Long64_t totBytes = fTree[i]->GetTotBytes();
+    AliInfo(Form("%-10s %10lld entries, %8.1f bytes/entry (%.1f uncompressed), %.2f entries/event, compression factor %.2f",
+                 TreeName[i].Data(), entries,
+                 entries > 0 ? (Double_t)zipBytes / entries : 0.,
+                 entries > 0 ? (Double_t)totBytes / entries : 0.,
+                 fNConverted > 0 ? (Double_t)entries / fNConverted : 0.,
+                 zipBytes > 0 ? (Double_t)totBytes / zipBytes : 0.));
+  }
+}
+
 void AliAnalysisTaskAO2Dconverter::Terminate(Option_t *)
 {
   // terminate
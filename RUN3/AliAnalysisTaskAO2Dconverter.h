@@ -10,6 +10,9 @@
 #include "AliEventCuts.h"
 
 #include <TString.h>
+#include <TStopwatch.h>
+
+#include <vector>
 
 #include "TClass.h"
 
@@ -29,6 +32,7 @@ public:
 
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
   virtual void Terminate(Option_t *option);
 
   void SetNumberOfEventsPerCluster(int n) { fNumberOfEventsPerCluster = n; }
@@ -73,6 +77,16 @@ public:
   void Prune(TString p) { fPruneList = p; }; // Setter of the pruning list
   void SetMCMode() { fTaskMode = kMC; };     // Setter of the MC running mode
 
+  // Output tuning
+  void SetAutoFlush(TreeIndex t, Long64_t n) { fAutoFlush[t] = n; };            // Cluster size of tree t (>0: entries, <0: bytes, 0 (default): SetNumberOfEventsPerCluster value)
+  void SetBasketSize(TreeIndex t, Int_t size) { fBasketSize[t] = size; };        // Initial basket size of the branches of tree t (0: ROOT default)
+  void SetCompressionSettings(Int_t settings) { fCompressionSettings = settings; }; // Compression algorithm and level of the output file, e.g. 505 for LZMA level 5 (-1: file default)
+  // Compress the baskets of the output trees in parallel. Only effective if ROOT implicit multi-threading is
+  // enabled, which is process wide and therefore left to the steering macro: ROOT::EnableImplicitMT(nThreads)
+  void SetImplicitMT(Bool_t enable = kTRUE) { fImplicitMT = enable; };
+  void SetTruncation(Bool_t enable = kTRUE) { fTruncate = enable; };             // Lossy truncation of the mantissa of covariance and PID fields
+  void SetTruncationMasks(UInt_t covDiag, UInt_t covOffDiag, UInt_t signal) { fTrackCovDiagMask = covDiag; fTrackCovOffDiagMask = covOffDiag; fTrackSignalMask = signal; };
+
   AliAnalysisFilter fTrackFilter; // Standard track filter object
 private:
   AliEventCuts fEventCuts;      //! Standard event cuts
@@ -83,11 +97,31 @@ private:
   TTree* fTree[kTrees] = { nullptr }; //! Array with all the output trees
   void Prune();                       // Function to perform tree pruning
   void FillTree(TreeIndex t);         // Function to fill the trees (only the active ones)
+  void AddBranch(TreeIndex t, const char* name, void* address, const char* leaflist, UInt_t truncationMask = 0u);
+
+  // Float fields truncated before each Fill (only with SetTruncation)
+  struct Truncation {
+    Float_t* fAddress = nullptr; // Address of the member variable bound to the branch
+    UInt_t fMask = 0u;           // Mask applied to the bits of the float value
+  };
+  std::vector<Truncation> fTruncations[kTrees]; //! Truncated fields of the output trees
+
+  // Throughput monitoring
+  TStopwatch fStopwatch;     //! Conversion time
+  Long64_t fNConverted = 0;  //! Number of converted events
 
   // Task configuration variables
   TString fPruneList = "";                // Names of the branches that will not be saved to output file
   Bool_t fTreeStatus[kTrees] = { kTRUE }; // Status of the trees i.e. kTRUE (enabled) or kFALSE (disabled)
   int fNumberOfEventsPerCluster = 1000;   // Maximum basket size of the trees
+  Long64_t fAutoFlush[kTrees] = { 0 };                                             // Cluster size per tree (>0: entries, <0: bytes, 0: fNumberOfEventsPerCluster)
+  Int_t fBasketSize[kTrees] = { 0, 256000, 64000, 64000, 256000 };                 // Initial basket size per tree
+  Int_t fCompressionSettings = -1; // Compression settings of the output file
+  Bool_t fImplicitMT = kFALSE;     // Use ROOT implicit multi-threading for the basket compression
+  Bool_t fTruncate = kFALSE;       // Truncate the mantissa of covariance and PID fields
+  UInt_t fTrackCovDiagMask = 0xFFFFFF00;    // Diagonal covariance elements: 15 bits of mantissa
+  UInt_t fTrackCovOffDiagMask = 0xFFFF0000; // Off-diagonal covariance elements: 7 bits of mantissa
+  UInt_t fTrackSignalMask = 0xFFFFFF00;     // PID signals: 15 bits of mantissa
 
   TaskModes fTaskMode = kStandard; // Running mode of the task. Useful to set for e.g. MC mode
 
@@ -199,7 +233,7 @@ private:
   Float_t fTime = -999.f;       /// Cell time
   Char_t fType = -1;            /// Cell type (-1 is undefined, 0 is PHOS, 1 is EMCAL)
 
-  ClassDef(AliAnalysisTaskAO2Dconverter, 1);
+  ClassDef(AliAnalysisTaskAO2Dconverter, 3);
 };
 
 #endif